@@ -0,0 +1,140 @@
+#pragma once
+
+#include "NetworkPlatform.h"
+#include <string>
+#include <vector>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <atomic>
+
+namespace Nuclear {
+
+/**
+ * @brief Sharded listener that absorbs connection bursts without accept-queue overflow
+ *
+ * Each shard owns a listening socket bound with SO_REUSEPORT so the kernel
+ * spreads incoming connections across shards. Shards drain their accept queue
+ * in batches using non-blocking accept4 and immediately hand the new socket to
+ * the connection handler; no per-client work runs on an acceptor thread.
+ *
+ * Platforms without SO_REUSEPORT load balancing (Windows) fall back to a
+ * single shard.
+ */
+class AcceptorPool {
+public:
+    using ConnectionHandler = std::function<void(SOCKET, const std::string&)>;
+    using ErrorHandler = std::function<void(const std::string&)>;
+
+    struct Statistics {
+        size_t acceptedConnections;
+        size_t acceptBatches;
+        size_t largestBatch;
+        size_t acceptErrors;
+    };
+
+private:
+    struct AcceptorShard {
+        SOCKET listenSocket;
+        std::unique_ptr<std::thread> thread;
+    };
+
+    std::vector<AcceptorShard> m_shards;
+    std::atomic<bool> m_running;
+    int m_port;
+    size_t m_requestedShards;
+
+    ConnectionHandler m_connectionHandler;
+    ErrorHandler m_errorHandler;
+
+    std::atomic<size_t> m_acceptedConnections;
+    std::atomic<size_t> m_acceptBatches;
+    std::atomic<size_t> m_largestBatch;
+    std::atomic<size_t> m_acceptErrors;
+
+    static constexpr int POLL_TIMEOUT_MS = 100;
+    static constexpr size_t MAX_ACCEPT_BATCH = 64;
+    static constexpr int EXHAUSTED_BACKOFF_MS = 100;
+
+public:
+    /**
+     * @brief Constructor
+     * @param port Port shared by all acceptor shards
+     * @param shardCount Number of acceptor shards to run
+     */
+    AcceptorPool(int port, size_t shardCount);
+
+    /**
+     * @brief Destructor - stops shards and closes listening sockets
+     */
+    ~AcceptorPool();
+
+    AcceptorPool(const AcceptorPool&) = delete;
+    AcceptorPool& operator=(const AcceptorPool&) = delete;
+
+    /**
+     * @brief Set handler invoked for every accepted connection
+     * @param handler Receives the non-blocking client socket and its address
+     */
+    void SetConnectionHandler(ConnectionHandler handler);
+
+    /**
+     * @brief Set error handler callback
+     * @param handler Function to call when error occurs
+     */
+    void SetErrorHandler(ErrorHandler handler);
+
+    /**
+     * @brief Open listening sockets and start acceptor threads
+     * @return true if at least one shard is listening
+     */
+    bool Start();
+
+    /**
+     * @brief Stop acceptor threads and close listening sockets
+     */
+    void Stop();
+
+    /**
+     * @brief Get number of listening shards
+     * @return Active shard count
+     */
+    size_t GetShardCount() const;
+
+    /**
+     * @brief Get accept statistics
+     * @return Snapshot of accept counters
+     */
+    Statistics GetStatistics() const;
+
+private:
+    /**
+     * @brief Create, bind and listen on a non-blocking socket
+     * @param reusePort Whether to share the port with other shards
+     * @return Listening socket or INVALID_SOCKET on error
+     */
+    SOCKET CreateListenSocket(bool reusePort);
+
+    /**
+     * @brief Acceptor loop for a single shard (runs in separate thread)
+     * @param listenSocket Shard listening socket
+     */
+    void AcceptLoop(SOCKET listenSocket);
+
+    /**
+     * @brief Accept every pending connection on a ready listening socket
+     * @param listenSocket Shard listening socket
+     * @param descriptorsExhausted Set when accept failed for lack of file
+     *        descriptors or buffers and the shard should back off
+     * @return Number of connections accepted
+     */
+    size_t DrainAcceptQueue(SOCKET listenSocket, bool& descriptorsExhausted);
+
+    /**
+     * @brief Report error through the error handler
+     * @param error Error message
+     */
+    void ReportError(const std::string& error);
+};
+
+} // namespace Nuclear
\ No newline at end of file
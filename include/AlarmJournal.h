@@ -0,0 +1,278 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <map>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include <chrono>
+#include <cstdint>
+
+namespace Nuclear {
+
+/**
+ * @brief Kind of alarm journal record
+ */
+enum class JournalRecordType : uint8_t {
+    AlarmRaised = 1,
+    AlarmCleared = 2,
+    Acknowledged = 3
+};
+
+/**
+ * @brief One alarm transition or operator acknowledgment
+ */
+struct JournalRecord {
+    JournalRecordType type;
+    uint64_t sequence;        // Assigned by Append, contiguous from 1
+    int64_t timestampUs;      // Microseconds since the Unix epoch
+    int alarmId;
+    double value;             // Value at the transition; unused for acknowledgments
+    std::string actor;        // Acknowledging operator or client; empty for transitions
+};
+
+/**
+ * @brief Alarm that still needs attention after replaying the journal
+ *
+ * Alarms leave the set once they are both cleared and acknowledged, so a
+ * cleared but unacknowledged alarm is restored too.
+ */
+struct JournaledAlarm {
+    int alarmId;
+    int64_t raisedAtUs;
+    double value;
+    bool active;
+    bool acknowledged;
+    std::string acknowledgedBy;
+    int64_t acknowledgedAtUs;
+};
+
+/**
+ * @brief Write-ahead journal for alarm transitions and acknowledgments
+ *
+ * Append only serializes the record into an in-memory batch; a background
+ * thread writes the batch to the end of the journal and syncs it to disk
+ * every commitInterval (or sooner once maxBatchBytes are pending), so one
+ * fsync covers every record of the interval and the monitoring thread never
+ * waits on the disk. The file is extended in preallocateBytes steps so a
+ * commit rarely changes the file size and the sync stays a data-only flush.
+ *
+ * commitInterval trades durability for latency: at most one interval of
+ * records is lost on a crash. Zero commits and syncs inside Append, for
+ * callers (or benchmarks) that need every record durable before returning.
+ * WaitDurable lets a single record, such as an acknowledgment, be confirmed
+ * durable before replying without making every Append synchronous.
+ *
+ * File layout: u32 magic "NPAJ", u16 version, u16 reserved, then records of
+ * u32 length, u32 CRC-32 of the body, and a body of u8 type, u64 sequence,
+ * i64 timestamp, i32 alarm ID, f64 value, u16 actor length and the actor.
+ * Replay stops at a zero length (preallocated space), a bad CRC or a break
+ * in the sequence, so a record torn by a crash ends the journal.
+ */
+class AlarmJournal {
+public:
+    struct Config {
+        std::chrono::milliseconds commitInterval;   // Zero commits synchronously in Append
+        size_t maxBatchBytes;                       // Commit early once this much is pending
+        size_t preallocateBytes;                    // File growth step
+        bool syncToDisk;                            // false leaves durability to the OS cache
+    };
+
+    struct Statistics {
+        uint64_t recordsAppended;
+        uint64_t recordsRecovered;
+        uint64_t commits;
+        uint64_t bytesWritten;
+        uint64_t preallocations;
+        uint64_t writeErrors;
+        double averageAppendMicros;         // Cost on the caller per record
+        double maxAppendMicros;
+        double averageCommitMicros;         // Write plus sync per batch
+        double maxCommitMicros;
+        double averageBatchRecords;
+        double maxDurabilityLagMicros;      // Append of a batch's oldest record to its sync
+        bool tornTailDiscarded;             // Replay stopped at a damaged record
+    };
+
+    static Config DefaultConfig() {
+        return Config{std::chrono::milliseconds(50), 64 * 1024, 4 * 1024 * 1024, true};
+    }
+
+private:
+    Config m_config;
+    std::string m_path;
+    intptr_t m_file;                    // POSIX descriptor or Windows HANDLE; -1 when closed
+    uint64_t m_tail;                    // Offset where the next batch is written
+    uint64_t m_allocated;               // Current file size including preallocated space
+    std::map<int, JournaledAlarm> m_recovered;
+
+    // Batch being filled by Append
+    std::vector<uint8_t> m_pending;
+    uint64_t m_nextSequence;
+    uint64_t m_pendingLastSequence;
+    size_t m_pendingRecords;
+    std::chrono::steady_clock::time_point m_pendingSince;
+    bool m_commitRequested;
+    std::mutex m_pendingMutex;
+    std::condition_variable m_pendingCondition;
+
+    // Batch being written; commits are serialized by m_commitMutex
+    std::vector<uint8_t> m_writing;
+    std::mutex m_commitMutex;
+
+    std::atomic<uint64_t> m_durableSequence;
+    std::mutex m_durableMutex;
+    std::condition_variable m_durableCondition;
+
+    std::atomic<bool> m_running;
+    std::unique_ptr<std::thread> m_commitThread;
+
+    mutable std::mutex m_statisticsMutex;
+    Statistics m_statistics;
+    double m_appendMicrosTotal;
+    double m_commitMicrosTotal;
+
+    static constexpr size_t HEADER_SIZE = 8;
+    static constexpr size_t RECORD_OVERHEAD = 8;        // Length and CRC
+    static constexpr size_t MAX_ACTOR_LENGTH = 256;
+
+public:
+    /**
+     * @brief Constructor
+     * @param config Commit interval, batch limit, preallocation and sync policy
+     */
+    explicit AlarmJournal(const Config& config = DefaultConfig());
+
+    /**
+     * @brief Destructor - commits pending records and closes the file
+     */
+    ~AlarmJournal();
+
+    AlarmJournal(const AlarmJournal&) = delete;
+    AlarmJournal& operator=(const AlarmJournal&) = delete;
+
+    /**
+     * @brief Open or create a journal, replay it and start committing
+     * @param path Journal file path
+     * @return false if the file cannot be opened or is not an alarm journal
+     *
+     * Anything after the last intact record is truncated away and the cut
+     * synced before the first append, so stale records beyond a torn tail
+     * can never follow new ones. New records are appended from there; the
+     * alarm state rebuilt by the replay is available from GetRecoveredAlarms.
+     */
+    bool Open(const std::string& path);
+
+    /**
+     * @brief Commit pending records, stop the commit thread and close the file
+     */
+    void Close();
+
+    /**
+     * @brief Check whether the journal is open
+     * @return true if records can be appended
+     */
+    bool IsOpen() const;
+
+    /**
+     * @brief Queue a record for the next commit
+     * @param record Record to journal; its sequence is assigned here
+     * @return Assigned sequence, or 0 if the journal is not open or the actor is too long
+     */
+    uint64_t Append(const JournalRecord& record);
+
+    /**
+     * @brief Journal an alarm transition
+     * @param alarmId Alarm ID
+     * @param active true when raised, false when cleared
+     * @param value Value at the transition
+     * @param timestampUs Transition time, microseconds since the Unix epoch
+     * @return Assigned sequence, or 0 on failure
+     */
+    uint64_t RecordAlarm(int alarmId, bool active, double value, int64_t timestampUs);
+
+    /**
+     * @brief Journal an operator acknowledgment
+     * @param alarmId Alarm ID
+     * @param actor Acknowledging operator or client
+     * @param timestampUs Acknowledgment time, microseconds since the Unix epoch
+     * @return Assigned sequence, or 0 on failure
+     */
+    uint64_t RecordAcknowledgment(int alarmId, const std::string& actor, int64_t timestampUs);
+
+    /**
+     * @brief Commit now and wait until a record is durable
+     * @param sequence Sequence returned by Append
+     * @param timeout Maximum wait
+     * @return true if the record is durable
+     */
+    bool WaitDurable(uint64_t sequence, std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Get highest sequence known to be on disk
+     * @return Sequence, 0 if none
+     */
+    uint64_t GetDurableSequence() const;
+
+    /**
+     * @brief Get alarm state rebuilt when the journal was opened
+     * @return Alarms active or unacknowledged at the end of the replay, by ID
+     */
+    std::vector<JournaledAlarm> GetRecoveredAlarms() const;
+
+    /**
+     * @brief Get journal statistics
+     * @return Statistics snapshot
+     */
+    Statistics GetStatistics() const;
+
+    /**
+     * @brief Read every intact record of a journal file
+     * @param path Journal file path
+     * @param records Output records in sequence order
+     * @return false if the file is missing or not an alarm journal
+     */
+    static bool Replay(const std::string& path, std::vector<JournalRecord>& records);
+
+    /**
+     * @brief Apply a record to an alarm state map
+     * @param alarms Alarm state by ID
+     * @param record Record to apply
+     */
+    static void ApplyRecord(std::map<int, JournaledAlarm>& alarms, const JournalRecord& record);
+
+private:
+    /**
+     * @brief Commit pending batches every interval until stopped (commit thread)
+     */
+    void CommitLoop();
+
+    /**
+     * @brief Write and sync the pending batch
+     * @return false if the write or sync failed
+     */
+    bool Commit();
+
+    /**
+     * @brief Extend the file so a write of the given size fits
+     * @param size Bytes about to be written at m_tail
+     * @return false if the file cannot be extended
+     */
+    bool EnsureAllocated(size_t size);
+
+    /**
+     * @brief Read records from the start of a journal until the first non-intact one
+     * @param in Journal stream positioned at the file header
+     * @param records Output intact records
+     * @param end Output offset just past the last intact record
+     * @param torn Output true if reading stopped at a damaged record rather than unused space
+     * @return false if the header is not an alarm journal header
+     */
+    static bool ParseJournal(std::istream& in, std::vector<JournalRecord>& records, uint64_t& end, bool& torn);
+};
+
+} // namespace Nuclear
\ No newline at end of file
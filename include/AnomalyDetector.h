@@ -0,0 +1,147 @@
+#pragma once
+
+#include "SensorQuality.h"
+#include "SensorSnapshot.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace Nuclear {
+
+/**
+ * @brief Anomaly flags reported per channel per scan
+ */
+using AnomalyFlags = uint8_t;
+
+static constexpr AnomalyFlags ANOMALY_NONE         = 0x00;
+static constexpr AnomalyFlags ANOMALY_DRIFT_HIGH   = 0x01;  // CUSUM detected sustained upward shift
+static constexpr AnomalyFlags ANOMALY_DRIFT_LOW    = 0x02;  // CUSUM detected sustained downward shift
+static constexpr AnomalyFlags ANOMALY_SPIKE        = 0x04;  // Sample far outside recent median +/- MAD
+static constexpr AnomalyFlags ANOMALY_INCONSISTENT = 0x08;  // Disagrees with its redundant channels
+
+/**
+ * @brief Online per-channel anomaly detectors for streaming sensor data
+ *
+ * Each channel carries an EWMA mean/variance baseline with a two-sided CUSUM
+ * for slow drift, and a short fixed window for median-absolute-deviation
+ * spike detection. Redundant channels can be grouped for cross-channel
+ * consistency checks. State is stored column-wise and sized once, so memory
+ * is bounded and every sample costs O(1) (the MAD window has a fixed size).
+ * Not thread-safe; owned by the processing pass.
+ */
+class AnomalyDetectorBank {
+public:
+    static constexpr size_t MAX_MAD_WINDOW = 15;
+
+    struct Config {
+        double ewmaAlpha;          // Baseline smoothing factor (0, 1]
+        double cusumSlack;         // CUSUM allowance k, in baseline standard deviations
+        double cusumThreshold;     // CUSUM decision interval h, in baseline standard deviations
+        size_t madWindow;          // Samples in spike window (3..MAX_MAD_WINDOW)
+        double spikeThreshold;     // Spike when |x - median| > threshold * scaled MAD
+        double minDeviation;       // Floor for sigma and MAD to avoid flagging flat signals
+        uint32_t warmupSamples;    // Samples before a channel starts reporting
+    };
+
+    struct ConsistencyGroup {
+        std::vector<size_t> channels;  // Redundant channels measuring the same quantity
+        double tolerance;              // Maximum allowed deviation from the group median
+    };
+
+private:
+    Config m_config;
+    size_t m_channelCount;
+
+    std::vector<double> m_mean;
+    std::vector<double> m_variance;
+    std::vector<double> m_cusumHigh;
+    std::vector<double> m_cusumLow;
+    std::vector<uint32_t> m_sampleCount;
+    std::vector<double> m_window;        // m_channelCount x madWindow ring buffers
+    std::vector<uint8_t> m_windowPos;
+
+    std::vector<ConsistencyGroup> m_groups;
+
+public:
+    /**
+     * @brief Constructor with default detector tuning
+     */
+    AnomalyDetectorBank();
+
+    /**
+     * @brief Get default detector tuning
+     * @return Default configuration
+     */
+    static Config DefaultConfig();
+
+    /**
+     * @brief Size detector state and reset all channels
+     * @param channelCount Number of channels
+     * @param config Detector tuning
+     */
+    void Configure(size_t channelCount, const Config& config);
+
+    /**
+     * @brief Set redundant channel groups for consistency checks
+     * @param groups Groups of channel indices
+     */
+    void SetConsistencyGroups(std::vector<ConsistencyGroup> groups);
+
+    /**
+     * @brief Run all detectors over one scan
+     * @param snapshot Scan of channelCount channels; fixed-point channels are read in
+     *        engineering units and unusable samples are skipped
+     * @param flags Output anomaly flags (channelCount entries)
+     * @return Number of channels with at least one anomaly flag
+     */
+    size_t Process(const SensorSnapshot& snapshot, AnomalyFlags* flags);
+
+    /**
+     * @brief Reset one channel's detector state (e.g. after recalibration)
+     * @param channel Channel index
+     */
+    void ResetChannel(size_t channel);
+
+    /**
+     * @brief Get number of configured channels
+     * @return Channel count
+     */
+    size_t GetChannelCount() const;
+
+    /**
+     * @brief Flatten detector state (baselines, CUSUM sums, spike windows)
+     * @param state Output; channelCount * (6 + madWindow) values
+     *
+     * Used to replicate detector state to a hot standby so it does not
+     * restart warm-up after a takeover.
+     */
+    void ExportState(std::vector<double>& state) const;
+
+    /**
+     * @brief Restore state written by ExportState
+     * @param state Flattened state for the current channel count and window
+     * @return false if the size does not match this configuration
+     */
+    bool ImportState(const std::vector<double>& state);
+
+private:
+    /**
+     * @brief Run single-channel detectors and update channel state
+     * @param channel Channel index
+     * @param value New sample
+     * @return Anomaly flags for this sample
+     */
+    AnomalyFlags ProcessSample(size_t channel, double value);
+
+    /**
+     * @brief Flag group members that deviate from the group median
+     *
+     * Groups with fewer than three usable members are skipped: two
+     * disagreeing channels give no majority to say which one is wrong.
+     * @param snapshot Scan being processed
+     * @param flags Anomaly flags to update
+     */
+    void CheckConsistency(const SensorSnapshot& snapshot, AnomalyFlags* flags) const;
+};
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,204 @@
+#pragma once
+
+#include "SensorSnapshot.h"
+#include "SensorQuality.h"
+#include <vector>
+#include <string>
+#include <memory>
+#include <chrono>
+#include <cstdint>
+
+namespace Nuclear {
+
+/**
+ * @brief Level crossing that starts a burst capture
+ */
+struct BurstTrigger {
+    int sensorId;
+    double lowLimit;     // Trigger when the value falls below this
+    double highLimit;    // Trigger when the value rises above this
+};
+
+/**
+ * @brief High-rate waveform captured around one trigger
+ *
+ * Samples are stored row-major (sample, channel) as float, which keeps a
+ * 2 s / 10 ms capture of a 32-channel device group under 30 KB.
+ */
+struct BurstWaveform {
+    std::vector<int> sensorIds;
+    std::vector<SensorKind> kinds;
+    int triggerSensorId;
+    double triggerValue;
+    int64_t triggerTimeUs;              // Microseconds since the Unix epoch
+    size_t preTriggerSamples;           // Samples before the trigger sample
+    size_t sampleCount;
+    size_t droppedSamples;              // Samples left out because the buffer was full or the offset overflowed
+    std::vector<int32_t> offsetsUs;     // Per sample, relative to the trigger; within +/-MAX_OFFSET_US
+    std::vector<float> values;          // sampleCount x channels
+    std::vector<SensorQuality> quality; // sampleCount x channels
+};
+
+/**
+ * @brief Trigger-driven burst capture for one device group
+ *
+ * Fed every scan at normal cadence while armed, keeping a short pre-trigger
+ * history. When a trigger crosses its limit the capture switches to
+ * capturing; the owner then polls the group at GetSampleInterval() and keeps
+ * feeding samples until the buffer is full or the burst duration elapses.
+ * All buffers are allocated at construction, so a burst never allocates.
+ * Pre-trigger samples older than MAX_OFFSET_US are left out of the waveform
+ * rather than wrapping their int32 offset. A post-trigger sample that cannot
+ * be stored ends the capture, so the waveform never has a silent gap; every
+ * sample left out is counted in droppedSamples.
+ *
+ * Not thread-safe; owned by the acquisition loop.
+ */
+class BurstCapture {
+public:
+    enum class State {
+        Armed,
+        Capturing,
+        Complete
+    };
+
+    struct Config {
+        std::chrono::milliseconds sampleInterval;   // Poll period while capturing
+        std::chrono::milliseconds duration;         // Post-trigger capture length
+        size_t preTriggerSamples;                   // Normal-cadence samples kept before the trigger
+    };
+
+private:
+    Config m_config;
+    std::vector<BurstTrigger> m_triggers;
+    std::vector<size_t> m_triggerChannels;
+    std::vector<uint8_t> m_triggerOutside;
+
+    // Pre-trigger ring at normal cadence
+    std::vector<int64_t> m_preTimes;
+    std::vector<double> m_preValues;
+    std::vector<SensorQuality> m_preQuality;
+    size_t m_preHead;
+    size_t m_preCount;
+
+    BurstWaveform m_waveform;
+    size_t m_maxSamples;
+    State m_state;
+
+    static constexpr uint32_t FILE_MAGIC = 0x5742504E;  // "NPBW"
+    static constexpr uint16_t FILE_VERSION = 1;
+
+    BurstCapture(const std::vector<int>& sensorIds, const std::vector<SensorKind>& kinds,
+                 const std::vector<BurstTrigger>& triggers, const Config& config);
+
+public:
+    static constexpr size_t MAX_CHANNELS = 65535;               // Channel count is a u16 in the file
+    static constexpr int64_t MAX_OFFSET_US = 2147483647;        // Sample offsets are int32
+
+    /**
+     * @brief Create a capture - allocates pre-trigger and waveform buffers
+     * @param sensorIds Channels of the device group, in feed order
+     * @param kinds Kind of each channel (same length as sensorIds)
+     * @param triggers Triggers on channels of this group; others are ignored
+     * @param config Burst rate, length and pre-trigger depth
+     * @return nullptr if the group is empty, larger than MAX_CHANNELS, kinds
+     *         differ in length, or duration plus one sample interval exceeds
+     *         MAX_OFFSET_US
+     */
+    static std::unique_ptr<BurstCapture> Create(const std::vector<int>& sensorIds,
+                                                const std::vector<SensorKind>& kinds,
+                                                const std::vector<BurstTrigger>& triggers, const Config& config);
+
+    /**
+     * @brief Default burst: 10 ms sampling for 2 s with 10 pre-trigger scans
+     * @return Default configuration
+     */
+    static Config DefaultConfig();
+
+    /**
+     * @brief Feed one sample of the group
+     * @param timeUs Sample time in microseconds since the Unix epoch
+     * @param values Channel values in engineering units, in group order
+     * @param quality Channel quality flags in group order
+     * @return State after this sample; Capturing on the sample that fired a trigger
+     */
+    State Feed(int64_t timeUs, const double* values, const SensorQuality* quality);
+
+    /**
+     * @brief Discard the waveform and arm for the next trigger
+     */
+    void Rearm();
+
+    /**
+     * @brief Get current state
+     * @return Armed, Capturing or Complete
+     */
+    State GetState() const;
+
+    /**
+     * @brief Get the poll period to use while capturing
+     * @return Burst sample interval
+     */
+    std::chrono::milliseconds GetSampleInterval() const;
+
+    /**
+     * @brief Get group channels
+     * @return Sensor IDs in feed order
+     */
+    const std::vector<int>& GetSensorIds() const;
+
+    /**
+     * @brief Get group channel kinds
+     * @return Kinds in feed order
+     */
+    const std::vector<SensorKind>& GetKinds() const;
+
+    /**
+     * @brief Get the captured waveform (complete once state is Complete)
+     * @return Waveform
+     */
+    const BurstWaveform& GetWaveform() const;
+
+    /**
+     * @brief Persist the waveform in compact little-endian binary form
+     * @param path Output file path
+     * @return true if the file was written
+     */
+    bool Save(const std::string& path) const;
+
+    /**
+     * @brief Load a waveform written by Save
+     * @param path Input file path
+     * @param waveform Loaded waveform
+     * @return false if the file is missing, truncated, not a burst file or names an unknown kind
+     */
+    static bool Load(const std::string& path, BurstWaveform& waveform);
+
+private:
+    /**
+     * @brief Check triggers against one sample
+     * @param values Channel values
+     * @param quality Channel quality flags
+     * @return Index of the trigger that fired, or m_triggers.size()
+     */
+    size_t CheckTriggers(const double* values, const SensorQuality* quality);
+
+    /**
+     * @brief Start the waveform with the pre-trigger history
+     * @param timeUs Trigger time
+     * @param trigger Trigger that fired
+     * @param values Channel values of the trigger sample
+     */
+    void BeginCapture(int64_t timeUs, size_t trigger, const double* values);
+
+    /**
+     * @brief Append one row to the waveform
+     * @param timeUs Sample time
+     * @param values Channel values
+     * @param quality Channel quality flags
+     * @return false if the waveform is full or the offset does not fit int32
+     */
+    bool AppendSample(int64_t timeUs, const double* values, const SensorQuality* quality);
+};
+
+} // namespace Nuclear
\ No newline at end of file
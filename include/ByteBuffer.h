@@ -0,0 +1,102 @@
+#pragma once
+
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace Nuclear {
+
+// Little-endian encoding helpers shared by the binary file formats
+
+inline void PutU16(std::vector<uint8_t>& out, uint16_t value) {
+    out.push_back(static_cast<uint8_t>(value));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+inline void PutU32(std::vector<uint8_t>& out, uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) {
+        out.push_back(static_cast<uint8_t>(value >> shift));
+    }
+}
+
+inline void PutU64(std::vector<uint8_t>& out, uint64_t value) {
+    for (int shift = 0; shift < 64; shift += 8) {
+        out.push_back(static_cast<uint8_t>(value >> shift));
+    }
+}
+
+inline void PutFloat(std::vector<uint8_t>& out, float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    PutU32(out, bits);
+}
+
+inline void PutDouble(std::vector<uint8_t>& out, double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    PutU64(out, bits);
+}
+
+/**
+ * @brief Decode a little-endian integer from raw bytes (no bounds check)
+ * @param data Pointer to the first byte
+ * @param bytes Width in bytes, at most 8
+ * @return Decoded value
+ */
+inline uint64_t LoadLittleEndian(const uint8_t* data, size_t bytes) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < bytes; ++i) {
+        value |= static_cast<uint64_t>(data[i]) << (8 * i);
+    }
+    return value;
+}
+
+/**
+ * @brief Bounds-checked little-endian reader over a byte buffer
+ *
+ * Reads past the end return zero and latch Ok() to false, so callers can
+ * decode a whole header and check once.
+ */
+class ByteReader {
+private:
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_offset;
+    bool m_ok;
+
+public:
+    explicit ByteReader(const std::vector<uint8_t>& data)
+        : m_data(data.data()), m_size(data.size()), m_offset(0), m_ok(true) {}
+
+    ByteReader(const uint8_t* data, size_t size) : m_data(data), m_size(size), m_offset(0), m_ok(true) {}
+
+    bool Ok() const { return m_ok; }
+    size_t Remaining() const { return m_size - m_offset; }
+
+    uint64_t Get(size_t bytes) {
+        if (!m_ok || m_size - m_offset < bytes) {
+            m_ok = false;
+            return 0;
+        }
+        uint64_t value = LoadLittleEndian(m_data + m_offset, bytes);
+        m_offset += bytes;
+        return value;
+    }
+
+    float GetFloat() {
+        uint32_t bits = static_cast<uint32_t>(Get(4));
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    double GetDouble() {
+        uint64_t bits = Get(8);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+};
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "SensorSnapshot.h"
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <unordered_map>
+#include <cstdint>
+
+namespace Nuclear {
+
+/**
+ * @brief Immutable, versioned list of the channels a sensor reader serves
+ *
+ * A new ChannelSet with a higher version is published only when the set of
+ * channels actually changes, so consumers can key prepared read plans and
+ * encoding schemas on GetVersion() and rebuild them only when it moves.
+ * Fixed-point scaling is part of the layout: changing a channel's scale
+ * publishes a new version, and every scan read through the set shares its
+ * ChannelScaling.
+ */
+class ChannelSet {
+private:
+    uint64_t m_version;
+    std::vector<int> m_sensorIds;
+    std::vector<SensorKind> m_kinds;
+    std::shared_ptr<const ChannelScaling> m_scales;     // Null if every channel is floating point
+    std::unordered_map<int, size_t> m_channelIndex;
+
+    ChannelSet(uint64_t version, std::vector<int> sensorIds, std::vector<SensorKind> kinds,
+               std::shared_ptr<const ChannelScaling> scales);
+
+public:
+    /**
+     * @brief Create a channel set
+     * @param version Catalog version this set was published under
+     * @param sensorIds Sensor IDs in channel order
+     * @param kinds Sensor kind per channel
+     * @param scales Fixed-point scaling per channel; empty if every channel is floating point
+     * @return nullptr if kinds and sensorIds differ in length, a sensor ID is
+     *         repeated, a kind is unknown, or scales is neither empty nor one
+     *         entry per channel, or has a negative scale
+     *
+     * A missing kind is a configuration error, never defaulted: a guessed
+     * kind would give the channel another quantity's ranges and limits.
+     */
+    static std::shared_ptr<const ChannelSet> Create(uint64_t version, std::vector<int> sensorIds,
+                                                    std::vector<SensorKind> kinds,
+                                                    std::vector<FixedPointScale> scales = {});
+
+    /**
+     * @brief Get catalog version
+     * @return Version number, strictly increasing across changes
+     */
+    uint64_t GetVersion() const;
+
+    /**
+     * @brief Get sensor IDs in channel order
+     * @return Sensor identifiers
+     */
+    const std::vector<int>& GetSensorIds() const;
+
+    /**
+     * @brief Get sensor kinds in channel order
+     * @return Sensor kinds
+     */
+    const std::vector<SensorKind>& GetKinds() const;
+
+    /**
+     * @brief Get fixed-point scaling, shared with the snapshots read through this set
+     * @return Scaling per channel, or null if every channel is floating point
+     */
+    const std::shared_ptr<const ChannelScaling>& GetScales() const;
+
+    /**
+     * @brief Get number of channels
+     * @return Channel count
+     */
+    size_t Size() const;
+
+    /**
+     * @brief Find channel index of a sensor
+     * @param sensorId Sensor identifier
+     * @param channel Channel index on success
+     * @return true if sensor is in this set
+     */
+    bool FindChannel(int sensorId, size_t& channel) const;
+
+    /**
+     * @brief Check whether two sets describe the same channels
+     * @param sensorIds Sensor IDs in channel order
+     * @param kinds Sensor kinds in channel order
+     * @param scales Fixed-point scaling; empty if every channel is floating point
+     * @return true if IDs, kinds and scaling match exactly
+     */
+    bool Matches(const std::vector<int>& sensorIds, const std::vector<SensorKind>& kinds,
+                 const std::vector<FixedPointScale>& scales = {}) const;
+};
+
+/**
+ * @brief Publishes the current ChannelSet of a sensor reader
+ *
+ * Readers call Current() without locking; Update() is called on device
+ * reconnects or configuration changes and publishes a new version only if
+ * the channel list differs.
+ */
+class SensorCatalog {
+private:
+    std::shared_ptr<const ChannelSet> m_current;
+    std::atomic<uint64_t> m_version;
+    std::mutex m_updateMutex;
+
+public:
+    /**
+     * @brief Constructor - publishes an empty set at version 0
+     */
+    SensorCatalog();
+
+    /**
+     * @brief Get current channel set (lock-free)
+     * @return Immutable channel set
+     */
+    std::shared_ptr<const ChannelSet> Current() const;
+
+    /**
+     * @brief Get current version without taking a reference to the set
+     * @return Current version
+     */
+    uint64_t GetVersion() const;
+
+    /**
+     * @brief Publish a new channel list if it differs from the current one
+     * @param sensorIds Sensor IDs in channel order
+     * @param kinds Sensor kinds in channel order
+     * @param scales Fixed-point scaling; empty if every channel is floating point
+     * @return true if a new version was published; false if unchanged or if
+     *         ChannelSet::Create rejects the lists (the current set is kept)
+     */
+    bool Update(std::vector<int> sensorIds, std::vector<SensorKind> kinds, std::vector<FixedPointScale> scales = {});
+};
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,262 @@
+#pragma once
+
+#include "NetworkPlatform.h"
+#include "SlotMap.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <functional>
+#include <unordered_map>
+
+namespace Nuclear {
+
+/**
+ * @brief Client table keyed by client ID with stable handles
+ *
+ * Lookups by ID or handle are O(1) and removal never shuffles other clients'
+ * handles. Writers must be serialized by the owner (SocketManager holds its
+ * clients mutex); broadcast readers use GetBroadcastList, an immutable
+ * snapshot read without locks. Add and Remove only mark the snapshot
+ * out of date; the owner rebuilds it with PublishPending once per batch of
+ * changes (SocketManager: once per network loop iteration), so N
+ * disconnects in one iteration cost one rebuild instead of N.
+ *
+ * The registry owns registered sockets. Each one is held by a lease shared
+ * with every broadcast snapshot that lists it and is closed only when the
+ * last holder lets go, so a snapshot taken before a disconnect can never
+ * send on a descriptor number the kernel has already reused for a new,
+ * unauthenticated accept. Owners must not close a registered socket
+ * themselves: Remove the client (or replace its socket and MarkChanged).
+ *
+ * @tparam Client Connection type exposing clientId, socket and authenticated
+ */
+template <typename Client>
+class ClientRegistry {
+public:
+    using SocketCloser = std::function<void(SOCKET)>;
+
+    /**
+     * @brief Keeps a client socket open while the registry or a snapshot refers to it
+     */
+    class SocketLease {
+    private:
+        SOCKET m_socket;
+        SocketCloser m_closer;
+
+    public:
+        SocketLease(SOCKET socket, SocketCloser closer) : m_socket(socket), m_closer(std::move(closer)) {}
+        ~SocketLease() {
+            if (m_closer) {
+                m_closer(m_socket);
+            }
+        }
+
+        SocketLease(const SocketLease&) = delete;
+        SocketLease& operator=(const SocketLease&) = delete;
+
+        SOCKET Get() const { return m_socket; }
+    };
+
+    struct BroadcastTarget {
+        SlotHandle handle;
+        SOCKET socket;                              // Open for as long as lease is held
+        std::shared_ptr<const SocketLease> lease;
+    };
+
+    using BroadcastList = std::vector<BroadcastTarget>;
+
+    static void CloseSocket(SOCKET socket) {
+        closesocket(socket);
+    }
+
+private:
+    SlotMap<Client> m_clients;
+    std::unordered_map<std::string, SlotHandle> m_idIndex;
+    std::unordered_map<std::string, std::shared_ptr<const SocketLease>> m_leases;
+    SocketCloser m_closer;
+    std::shared_ptr<const BroadcastList> m_broadcastList;
+    std::atomic<size_t> m_clientCount;
+    bool m_changed;                 // Membership or client state differs from the published snapshot
+
+public:
+    /**
+     * @brief Constructor
+     * @param expectedClients Capacity to reserve up front
+     * @param closer Called once per socket when its last lease is released
+     */
+    explicit ClientRegistry(size_t expectedClients = 0, SocketCloser closer = &ClientRegistry::CloseSocket)
+        : m_closer(std::move(closer)), m_broadcastList(std::make_shared<const BroadcastList>()), m_clientCount(0),
+          m_changed(false) {
+        m_clients.Reserve(expectedClients);
+        m_idIndex.reserve(expectedClients);
+        m_leases.reserve(expectedClients);
+    }
+
+    /**
+     * @brief Register client under its clientId
+     * @param client Connection to register
+     * @return Handle to the client, or invalid handle if the ID is already taken
+     */
+    SlotHandle Add(Client client) {
+        if (m_idIndex.count(client.clientId) != 0) {
+            return INVALID_SLOT_HANDLE;
+        }
+
+        std::string clientId = client.clientId;
+        SlotHandle handle = m_clients.Insert(std::move(client));
+        m_idIndex.emplace(std::move(clientId), handle);
+        MarkChanged();
+        return handle;
+    }
+
+    /**
+     * @brief Remove client by ID
+     * @param clientId Client identifier
+     * @return true if client was registered
+     *
+     * The socket is closed once no broadcast snapshot holds it any more;
+     * the published snapshot keeps listing it until the next publish.
+     */
+    bool Remove(const std::string& clientId) {
+        auto it = m_idIndex.find(clientId);
+        if (it == m_idIndex.end()) {
+            return false;
+        }
+
+        m_clients.Erase(it->second);
+        m_idIndex.erase(it);
+        m_leases.erase(clientId);
+        MarkChanged();
+        return true;
+    }
+
+    /**
+     * @brief Remove client by handle
+     * @param handle Client handle
+     * @return true if handle was live
+     */
+    bool Remove(SlotHandle handle) {
+        const Client* client = m_clients.Get(handle);
+        if (client == nullptr) {
+            return false;
+        }
+        return Remove(std::string(client->clientId));
+    }
+
+    /**
+     * @brief Find client by ID
+     * @param clientId Client identifier
+     * @return Pointer to client or nullptr if not registered
+     */
+    Client* Find(const std::string& clientId) {
+        auto it = m_idIndex.find(clientId);
+        return it == m_idIndex.end() ? nullptr : m_clients.Get(it->second);
+    }
+
+    /**
+     * @brief Resolve client handle
+     * @param handle Client handle
+     * @return Pointer to client or nullptr if handle is stale
+     */
+    Client* Get(SlotHandle handle) {
+        return m_clients.Get(handle);
+    }
+
+    /**
+     * @brief Get handle for client ID
+     * @param clientId Client identifier
+     * @return Handle or invalid handle if not registered
+     */
+    SlotHandle FindHandle(const std::string& clientId) const {
+        auto it = m_idIndex.find(clientId);
+        return it == m_idIndex.end() ? INVALID_SLOT_HANDLE : it->second;
+    }
+
+    /**
+     * @brief Record a change to be picked up by the next PublishPending
+     *
+     * Add and Remove call this; owners call it after flipping authenticated
+     * or replacing a socket in place.
+     */
+    void MarkChanged() {
+        m_changed = true;
+        m_clientCount.store(m_clients.Size(), std::memory_order_release);
+    }
+
+    /**
+     * @brief Rebuild the broadcast snapshot if anything changed since the last publish
+     * @return true if a new snapshot was published
+     */
+    bool PublishPending() {
+        if (!m_changed) {
+            return false;
+        }
+        Publish();
+        return true;
+    }
+
+    /**
+     * @brief Rebuild the broadcast snapshot now
+     *
+     * O(clients); for a change that must reach the very next broadcast,
+     * such as a newly authenticated client. A replaced socket is closed
+     * once no snapshot holds it.
+     */
+    void Publish() {
+        auto list = std::make_shared<BroadcastList>();
+        list->reserve(m_clients.Size());
+
+        for (size_t i = 0; i < m_clients.Size(); ++i) {
+            const Client* client = m_clients.Get(m_clients.HandleAt(i));
+            std::shared_ptr<const SocketLease>& lease = m_leases[client->clientId];
+            if (client->socket == INVALID_SOCKET) {
+                lease.reset();
+            } else if (!lease || lease->Get() != client->socket) {
+                lease = std::make_shared<const SocketLease>(client->socket, m_closer);
+            }
+
+            if (client->authenticated && lease) {
+                list->push_back({m_clients.HandleAt(i), client->socket, lease});
+            }
+        }
+
+        std::atomic_store(&m_broadcastList, std::shared_ptr<const BroadcastList>(std::move(list)));
+        m_clientCount.store(m_clients.Size(), std::memory_order_release);
+        m_changed = false;
+    }
+
+    /**
+     * @brief Get authenticated clients for broadcast (lock-free)
+     * @return Immutable snapshot valid for as long as the caller holds it
+     */
+    std::shared_ptr<const BroadcastList> GetBroadcastList() const {
+        return std::atomic_load(&m_broadcastList);
+    }
+
+    /**
+     * @brief Get number of registered clients (lock-free)
+     * @return Client count as of the last change
+     */
+    size_t Size() const {
+        return m_clientCount.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get IDs of all registered clients
+     * @return Vector of client identifiers
+     */
+    std::vector<std::string> GetClientIds() const {
+        std::vector<std::string> ids;
+        ids.reserve(m_clients.Size());
+        for (const auto& client : m_clients) {
+            ids.push_back(client.clientId);
+        }
+        return ids;
+    }
+
+    typename std::vector<Client>::iterator begin() { return m_clients.begin(); }
+    typename std::vector<Client>::iterator end() { return m_clients.end(); }
+};
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "IClock.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <cstdint>
+
+namespace Nuclear {
+
+/**
+ * @brief IClock backed by the real steady and system clocks
+ */
+class SystemClock : public IClock {
+public:
+    std::chrono::steady_clock::time_point SteadyNow() const override;
+    std::chrono::system_clock::time_point SystemNow() const override;
+
+    /**
+     * @brief Shared process-wide instance, used when no clock is injected
+     * @return System clock
+     */
+    static std::shared_ptr<IClock> Instance();
+};
+
+/**
+ * @brief Manually driven clock for replay, simulation and tests
+ *
+ * Time moves only when Advance or SetSystemTime is called. Steady time never
+ * moves backwards: setting an earlier wall-clock time leaves it unchanged.
+ * Reads and updates are atomic, so one driver thread can move the clock
+ * while other threads read it.
+ */
+class VirtualClock : public IClock {
+private:
+    std::atomic<int64_t> m_steadyNanos;
+    std::atomic<int64_t> m_systemNanos;
+
+public:
+    /**
+     * @brief Constructor
+     * @param systemStart Initial wall-clock time; steady time starts at its epoch
+     */
+    explicit VirtualClock(std::chrono::system_clock::time_point systemStart = std::chrono::system_clock::time_point());
+
+    std::chrono::steady_clock::time_point SteadyNow() const override;
+    std::chrono::system_clock::time_point SystemNow() const override;
+
+    /**
+     * @brief Move both clocks forward
+     * @param elapsed Time to advance; negative values are ignored
+     */
+    void Advance(std::chrono::nanoseconds elapsed);
+
+    /**
+     * @brief Jump wall-clock time, moving steady time forward by the same amount
+     * @param time New wall-clock time
+     */
+    void SetSystemTime(std::chrono::system_clock::time_point time);
+};
+
+/**
+ * @brief Time of one monitoring cycle, read once and shared down the pipeline
+ *
+ * Every stage of a cycle (acquisition, processing, report, broadcast) uses
+ * these values instead of calling now() itself, so one cycle has one time
+ * and the hot path formats its timestamp exactly once.
+ */
+struct CycleContext {
+    uint64_t cycleNumber = 0;
+    std::chrono::steady_clock::time_point steadyTime;
+    std::chrono::system_clock::time_point wallTime;
+    std::string timestamp;      // wallTime as ISO 8601 UTC with milliseconds
+
+    /**
+     * @brief Read a clock once for a new cycle
+     * @param clock Clock to read
+     * @param cycleNumber Sequence number of the cycle
+     * @return Context for the cycle
+     */
+    static CycleContext Capture(const IClock& clock, uint64_t cycleNumber);
+};
+
+/**
+ * @brief Format wall-clock time as ISO 8601 UTC
+ * @param time Time to format
+ * @return e.g. "2024-05-01T12:00:00.250Z"
+ */
+std::string FormatTimestamp(std::chrono::system_clock::time_point time);
+
+} // namespace Nuclear
\ No newline at end of file
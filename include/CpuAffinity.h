@@ -0,0 +1,28 @@
+#pragma once
+
+#include <thread>
+
+namespace Nuclear {
+
+/**
+ * @brief Get number of logical cores available to the process
+ * @return Core count, at least 1
+ */
+unsigned GetCoreCount();
+
+/**
+ * @brief Pin the calling thread to one logical core
+ * @param core Zero-based core index
+ * @return false if the core does not exist or the platform refused
+ */
+bool PinCurrentThreadToCore(int core);
+
+/**
+ * @brief Pin a running thread to one logical core
+ * @param thread Thread to pin
+ * @param core Zero-based core index
+ * @return false if the core does not exist or the platform refused
+ */
+bool PinThreadToCore(std::thread& thread, int core);
+
+} // namespace Nuclear
\ No newline at end of file
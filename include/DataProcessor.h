@@ -1,10 +1,18 @@
 #pragma once
 
 #include "IDataProcessor.h"
+#include "AnomalyDetector.h"
+#include "RedundancyVoter.h"
+#include "GroupAggregator.h"
+#include "DerivedChannelEngine.h"
+#include "SteamTable.h"
+#include "SequenceOfEventsRecorder.h"
+#include "SensorKernels.h"
 #include <memory>
 #include <vector>
 #include <mutex>
 #include <chrono>
+#include <unordered_map>
 
 namespace Nuclear {
 
@@ -15,6 +23,22 @@ namespace Nuclear {
  * Implements thread-safe operations for real-time processing
  */
 class DataProcessor : public IDataProcessor {
+public:
+    struct RedundancyGroupConfig {
+        int groupId;
+        SensorKind kind;
+        std::vector<int> sensorIds;       // Two or three redundant sensors
+        double discrepancyTolerance;
+        DegradedSelect degradedSelect = DegradedSelect::High;  // Survivor voted after a channel fails
+    };
+
+    struct GroupConfig {
+        int groupId;
+        std::string name;                 // e.g. "Loop A", "SG-2", "Containment"
+        int parentId;                     // -1 for a root group
+        std::vector<int> sensorIds;       // Sensors belonging directly to this group
+    };
+
 private:
     // Safety thresholds
     double m_maxTemperature;
@@ -24,16 +48,58 @@ private:
     // Thread safety
     mutable std::mutex m_thresholdsMutex;
     
+    // Per-kind validation/threshold kernels; thresholds are mirrored into the plan
+    SensorKernelPlan m_kernelPlan;
+    std::vector<uint8_t> m_kernelFlags;
+    mutable std::mutex m_kernelMutex;
+    
     // Statistics tracking
     struct Statistics {
         size_t totalReadings;
         size_t alertCount;
-        std::chrono::steady_clock::time_point lastProcessingTime;
+        std::chrono::steady_clock::time_point lastProcessingTime;  // Cycle time, not a fresh clock read
         double processingTimeMs;
     };
     
     mutable Statistics m_statistics;
     mutable std::mutex m_statisticsMutex;
+    
+    // Streaming anomaly detection; channels are mapped by sensor ID
+    std::unique_ptr<AnomalyDetectorBank> m_anomalyDetectors;
+    std::unordered_map<int, size_t> m_anomalyChannels;
+    std::vector<double> m_anomalyValues;
+    std::vector<SensorQuality> m_anomalyQuality;
+    std::vector<AnomalyFlags> m_anomalyScratch;
+    std::mutex m_anomalyMutex;
+    
+    // Redundancy voting; member channels are alarmed through their voted value
+    RedundancyVoter m_voter;
+    std::unordered_map<int, size_t> m_votingChannels;
+    std::vector<double> m_votingValues;
+    std::vector<SensorQuality> m_votingQuality;
+    std::mutex m_votingMutex;
+    
+    // Hierarchical per-group aggregates computed in one segmented reduction
+    GroupAggregator m_groupAggregator;
+    std::unordered_map<int, size_t> m_groupChannels;
+    std::vector<double> m_groupValues;
+    std::vector<SensorQuality> m_groupQuality;
+    std::mutex m_groupMutex;
+    
+    // Derived/calculated channels compiled once, evaluated every scan
+    DerivedChannelEngine m_derivedEngine;
+    std::unordered_map<int, size_t> m_derivedInputChannels;
+    std::vector<double> m_derivedValues;
+    std::vector<SensorQuality> m_derivedQuality;
+    std::mutex m_derivedMutex;
+    
+    // Alarm transitions for the sequence-of-events recorder; state per sensor/group ID
+    SequenceOfEventsRecorder* m_eventRecorder;
+    std::unordered_map<int, bool> m_alarmActive;
+    std::mutex m_alarmStateMutex;
+    
+    // Time source for calls made outside a cycle; cycles carry their own time
+    std::shared_ptr<IClock> m_clock;
 
 public:
     /**
@@ -48,6 +114,7 @@ public:
     
     // IDataProcessor interface implementation
     ProcessedData ProcessReadings(const std::vector<SensorReading>& readings) override;
+    ProcessedData ProcessReadings(const std::vector<SensorReading>& readings, const CycleContext& cycle) override;
     void SetSafetyThresholds(double maxTemperature, double maxPressure, double maxRadiation) override;
     bool ValidateReading(const SensorReading& reading) const override;
     
@@ -61,34 +128,165 @@ public:
      * @brief Reset processing statistics
      */
     void ResetStatistics();
+    
+    /**
+     * @brief Enable per-channel anomaly detection in the processing pass
+     * @param sensorIds Sensors to monitor; detector state is sized once for them
+     * @param config Detector tuning
+     * @param redundantGroups Groups of sensor IDs measuring the same quantity, with tolerances
+     */
+    void EnableAnomalyDetection(const std::vector<int>& sensorIds,
+                                const AnomalyDetectorBank::Config& config,
+                                const std::vector<std::pair<std::vector<int>, double>>& redundantGroups = {});
+    
+    /**
+     * @brief Disable anomaly detection and release detector state
+     */
+    void DisableAnomalyDetection();
+    
+    /**
+     * @brief Configure redundancy groups voted in the processing pass
+     * @param groups Groups of two or three redundant sensor IDs
+     * @return Number of groups accepted
+     *
+     * Group members are voted (median select / 2oo3) before threshold checks
+     * and only the voted value is compared against safety thresholds.
+     */
+    size_t ConfigureRedundancyGroups(const std::vector<RedundancyGroupConfig>& groups);
+    
+    /**
+     * @brief Configure loop / steam generator / area grouping hierarchy
+     * @param groups Group definitions in any order
+     * @return false if a parent is unknown or the hierarchy has a cycle
+     *
+     * Group membership is compiled once into index arrays; every scan then
+     * fills ProcessedData::groupAggregates with per-kind sum, min and max.
+     */
+    bool ConfigureGroups(const std::vector<GroupConfig>& groups);
+    
+    /**
+     * @brief Select the threshold policy for one sensor kind
+     * @param kind Sensor kind
+     * @param threshold Policy (high limit or band) and its limits
+     *
+     * SetSafetyThresholds resets every kind to a high-limit policy at the
+     * given maxima.
+     */
+    void SetThresholdPolicy(SensorKind kind, const SensorKernelPlan::KindThreshold& threshold);
+    
+    /**
+     * @brief Validate, threshold and average a column-oriented scan
+     * @param snapshot Scan to evaluate
+     * @param flags Output CHANNEL_* bits per channel
+     * @return Per-kind counts, sums and extremes, and the total alarm count
+     *
+     * Runs the compile-time specialized kernel for each run of same-kind
+     * channels instead of comparing sensor type strings per reading.
+     * Fixed-point channels are checked on their counts.
+     */
+    SensorKernelPlan::ScanResult EvaluateSnapshot(const SensorSnapshot& snapshot, std::vector<uint8_t>& flags);
+    
+    /**
+     * @brief Record alarm raise/clear transitions into a sequence-of-events recorder
+     * @param recorder Recorder that outlives this processor, or nullptr to stop recording
+     *
+     * Only transitions are recorded, stamped with the time of the cycle
+     * that detected them.
+     */
+    void SetEventRecorder(SequenceOfEventsRecorder* recorder);
+    
+    /**
+     * @brief Replace the clock used when ProcessReadings is called without a cycle
+     * @param clock Clock to read; nullptr restores the system clock
+     */
+    void SetClock(std::shared_ptr<IClock> clock);
+    
+    /**
+     * @brief Configure derived channels (delta-T, margins, rates...)
+     * @param definitions Derived channel expressions
+     * @param inputSensorIds Raw sensors the expressions may reference
+     * @param error Description of the first problem on failure
+     * @return false if an expression does not compile; previous channels are kept
+     *
+     * Derived values are appended as ordinary readings before threshold
+     * checks, voting, aggregation and broadcast, so they alarm and trend
+     * like physical points. Steam-table functions (tsat, psat, subcooling)
+     * and unit conversions are registered with the engine at construction,
+     * e.g. "subcooling(sensor(1001), sensor(2001))".
+     */
+    bool ConfigureDerivedChannels(const std::vector<DerivedChannelDefinition>& definitions,
+                                  const std::vector<int>& inputSensorIds, std::string& error);
 
 private:
     /**
      * @brief Calculate average values for each sensor type
      * @param readings Vector of sensor readings
-     * @return Calculated averages
+     * @param voted Voted redundancy groups, each counted once in place of its members
+     * @return Calculated averages over readings with usable quality only
+     *
+     * Readings are gathered into per-kind columns and summed by the kind's
+     * kernel, so the type string is parsed once per reading.
      */
-    std::tuple<double, double, double> CalculateAverages(const std::vector<SensorReading>& readings) const;
+    std::tuple<double, double, double> CalculateAverages(const std::vector<SensorReading>& readings,
+                                                         const std::vector<VotedReading>& voted) const;
     
     /**
      * @brief Check if any readings exceed safety thresholds
      * @param readings Vector of sensor readings
-     * @return Pair of (alertTriggered, alertMessage)
+     * @param voted Voted redundancy groups, compared in place of their members
+     * @return Pair of (alertTriggered, alertMessage, including discrepancy alarms)
+     *
+     * Readings with unusable quality are not compared against thresholds;
+     * they are reported by CheckSensorQuality instead. Comparisons use the
+     * kernel plan's policy for each kind. Alarm raise/clear transitions
+     * update m_alarmActive under m_alarmStateMutex.
+     */
+    std::pair<bool, std::string> CheckSafetyThresholds(const std::vector<SensorReading>& readings,
+                                                       const std::vector<VotedReading>& voted);
+    
+    /**
+     * @brief Vote configured redundancy groups for one scan
+     * @param readings Filtered readings
+     * @return One voted reading per group
      */
-    std::pair<bool, std::string> CheckSafetyThresholds(const std::vector<SensorReading>& readings) const;
+    std::vector<VotedReading> VoteRedundantChannels(const std::vector<SensorReading>& readings);
+    
+    /**
+     * @brief Compute per-group aggregates for one scan
+     * @param readings Filtered readings
+     * @return Aggregates for every configured group, children before parents
+     */
+    std::vector<GroupAggregate> AggregateGroups(const std::vector<SensorReading>& readings);
+    
+    /**
+     * @brief Evaluate derived channels for one scan and append them as readings
+     * @param readings Filtered readings; derived readings are appended in place
+     *
+     * Inputs missing from the scan are evaluated as COMM_FAIL, which
+     * propagates to every derived value that uses them.
+     */
+    void EvaluateDerivedChannels(std::vector<SensorReading>& readings);
     
     /**
      * @brief Validate reading value ranges
      * @param reading Sensor reading to validate
-     * @return true if reading is within expected ranges
+     * @return true if reading is within its kind's SENSOR_KIND_RANGES entry
      */
     bool IsValueInRange(const SensorReading& reading) const;
     
+    /**
+     * @brief Report sensors whose quality flags make their readings unusable
+     * @param readings Vector of sensor readings
+     * @return Pair of (faultDetected, faultMessage listing sensor IDs and flags)
+     */
+    std::pair<bool, std::string> CheckSensorQuality(const std::vector<SensorReading>& readings) const;
+    
     /**
      * @brief Generate timestamp string
-     * @return Current timestamp in ISO format
+     * @param cycle Cycle being processed
+     * @return Cycle timestamp in ISO format, formatted once per cycle
      */
-    std::string GenerateTimestamp() const;
+    const std::string& GenerateTimestamp(const CycleContext& cycle) const;
     
     /**
      * @brief Filter out invalid or anomalous readings
@@ -96,6 +294,17 @@ private:
      * @return Filtered readings
      */
     std::vector<SensorReading> FilterReadings(const std::vector<SensorReading>& readings) const;
+    
+    /**
+     * @brief Run anomaly detectors over one scan, in the same pass as filtering
+     * @param readings Filtered readings
+     * @param flags Output ANOMALY_* bits per reading
+     * @return Number of anomalous readings
+     *
+     * Readings for sensors not registered with EnableAnomalyDetection are
+     * reported as ANOMALY_NONE.
+     */
+    size_t DetectAnomalies(const std::vector<SensorReading>& readings, std::vector<uint8_t>& flags);
 };
 
 } // namespace Nuclear 
\ No newline at end of file
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "SensorSnapshot.h"
+#include "SensorQuality.h"
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace Nuclear {
+
+/**
+ * @brief Computed point defined by an expression over other channels
+ *
+ * Expression syntax:
+ * - numbers, + - * / and parentheses, unary minus
+ * - sensor(101)         value of raw sensor 101
+ * - coreDeltaT          value of another derived channel, by name
+ * - abs(x) sqrt(x) min(a, b) max(a, b) and any registered function
+ * - rate(x)             change of x per second since the previous scan
+ *
+ * Example: "sensor(1002) - sensor(1001)" for delta-T across the core.
+ */
+struct DerivedChannelDefinition {
+    int sensorId;              // ID the derived value is published under
+    std::string name;          // Name other expressions refer to
+    SensorKind kind;           // Selects thresholds and units downstream
+    std::string expression;
+};
+
+/**
+ * @brief Compiles derived-channel expressions to bytecode and evaluates them per scan
+ *
+ * Expressions are parsed once at configuration load into a flat postfix
+ * program per channel, ordered so every derived channel is evaluated after
+ * the channels it depends on. Evaluation is a tight stack-machine loop with
+ * no allocation; result quality is the union of the input qualities.
+ *
+ * Not thread-safe; owned by the processing pass.
+ */
+class DerivedChannelEngine {
+public:
+    using UnaryFunction = double (*)(double);
+    using BinaryFunction = double (*)(double, double);
+
+private:
+    enum class OpCode : uint8_t {
+        PushConstant,
+        LoadSensor,
+        LoadDerived,
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Negate,
+        CallUnary,
+        CallBinary,
+        Rate
+    };
+
+    struct Instruction {
+        OpCode op;
+        uint32_t operand;
+    };
+
+    struct Program {
+        std::vector<Instruction> code;
+        size_t maxStackDepth;
+    };
+
+    struct RateState {
+        double previousValue;
+        double previousTime;
+        bool primed;
+    };
+
+    std::unordered_map<std::string, UnaryFunction> m_unaryFunctions;
+    std::unordered_map<std::string, BinaryFunction> m_binaryFunctions;
+    std::vector<UnaryFunction> m_unaryTable;
+    std::vector<BinaryFunction> m_binaryTable;
+
+    std::vector<DerivedChannelDefinition> m_definitions;  // Evaluation order
+    std::vector<Program> m_programs;
+    std::vector<double> m_constants;
+    std::vector<RateState> m_rateStates;
+
+    std::vector<double> m_values;
+    std::vector<SensorQuality> m_quality;
+    std::vector<double> m_valueStack;
+    std::vector<SensorQuality> m_qualityStack;
+
+public:
+    /**
+     * @brief Constructor - registers the built-in functions
+     */
+    DerivedChannelEngine();
+
+    /**
+     * @brief Register a one-argument function usable in expressions
+     * @param name Function name
+     * @param function Function pointer
+     * @return false if name is already registered
+     */
+    bool RegisterFunction(const std::string& name, UnaryFunction function);
+
+    /**
+     * @brief Register a two-argument function usable in expressions
+     * @param name Function name
+     * @param function Function pointer
+     * @return false if name is already registered
+     */
+    bool RegisterFunction(const std::string& name, BinaryFunction function);
+
+    /**
+     * @brief Compile derived channel definitions against a raw channel layout
+     * @param definitions Derived channels in any order
+     * @param sensorIds Raw sensor IDs in channel order (as passed to Evaluate)
+     * @param error Description of the first problem on failure
+     * @return true if every expression compiled, dependencies are acyclic and
+     *         every derived sensor ID is distinct from the raw ones and each other
+     */
+    bool Compile(const std::vector<DerivedChannelDefinition>& definitions,
+                 const std::vector<int>& sensorIds, std::string& error);
+
+    /**
+     * @brief Evaluate every derived channel for one scan
+     * @param snapshot Raw channels in the compiled layout; fixed-point channels are read in engineering units
+     * @param timeSeconds Scan time in seconds, used by rate()
+     */
+    void Evaluate(const SensorSnapshot& snapshot, double timeSeconds);
+
+    /**
+     * @brief Append derived channels to a snapshot as additional channels
+     * @param snapshot Snapshot to extend; derived channels are floating point
+     */
+    void AppendTo(SensorSnapshot& snapshot) const;
+
+    /**
+     * @brief Get definitions in evaluation order
+     * @return Derived channel definitions
+     */
+    const std::vector<DerivedChannelDefinition>& GetDefinitions() const;
+
+    /**
+     * @brief Get values from the last Evaluate call, in evaluation order
+     * @return Derived values
+     */
+    const std::vector<double>& GetValues() const;
+
+    /**
+     * @brief Get quality from the last Evaluate call, in evaluation order
+     * @return Derived quality flags
+     */
+    const std::vector<SensorQuality>& GetQuality() const;
+
+private:
+    class Parser;
+};
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,238 @@
+#pragma once
+
+#include "SnapshotDeltaCodec.h"
+#include "SocketManager.h"
+#include "NetworkPlatform.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+
+namespace Nuclear {
+
+/**
+ * @brief Operations-center tier that merges several plant monitors into one fleet view
+ *
+ * Each upstream link connects to a monitor's SocketManager port, requests
+ * its binary delta feed and rebuilds the plant snapshot on its own thread.
+ * Links conflate: only the latest decoded snapshot per upstream is kept,
+ * so a fast plant never queues work for the merge. The publish thread
+ * merges dirty upstreams into a flat fleet snapshot (one contiguous channel
+ * range per upstream, rebuilt only when a layout changes) and re-serves
+ * it to dashboards as a delta feed through the downstream SocketManager.
+ *
+ * Fleet channel IDs are FleetSensorId(upstreamIndex, sensorId), so plants
+ * reusing the same sensor IDs stay distinct. An upstream snapshot whose
+ * layout does not fit that scheme (a sensor ID outside [0, FLEET_ID_STRIDE)
+ * or an upstream index whose range would overflow int) is dropped when it
+ * is merged instead of aliasing another plant's channels.
+ */
+class FleetAggregator {
+public:
+    struct Config {
+        std::chrono::milliseconds publishInterval;
+        std::chrono::milliseconds reconnectInterval;
+        SnapshotDeltaEncoder::Config encoder;
+    };
+
+    struct UpstreamStatus {
+        std::string plantId;
+        std::string host;
+        int port;
+        bool connected;
+        uint64_t framesReceived;
+        uint64_t framesConflated;       // Decoded snapshots replaced before a merge picked them up
+        uint64_t bytesReceived;
+        uint64_t resyncs;               // Deltas dropped while waiting for a keyframe
+        uint64_t layoutsRejected;       // Snapshots dropped because their IDs do not fit the fleet ID range
+        uint64_t lastScanNumber;
+    };
+
+    static constexpr int FLEET_ID_STRIDE = 1000000;
+    static constexpr const char* FEED_REQUEST = "SUBSCRIBE_DELTA\n";
+
+    static Config DefaultConfig() {
+        return Config{std::chrono::milliseconds(1000), std::chrono::milliseconds(2000),
+                      SnapshotDeltaEncoder::DefaultConfig()};
+    }
+
+private:
+    struct Upstream {
+        std::string plantId;
+        std::string host;
+        int port;
+
+        // Owned by the link thread (or the Ingest caller)
+        SnapshotDeltaDecoder decoder;
+
+        // Conflation mailbox: latest decoded snapshot wins
+        std::mutex mailboxMutex;
+        SensorSnapshot latest;
+        bool dirty = false;
+
+        std::atomic<bool> connected{false};
+        std::atomic<uint64_t> framesReceived{0};
+        std::atomic<uint64_t> framesConflated{0};
+        std::atomic<uint64_t> bytesReceived{0};
+        std::atomic<uint64_t> resyncs{0};
+        std::atomic<uint64_t> layoutsRejected{0};
+        std::atomic<uint64_t> lastScanNumber{0};
+        std::unique_ptr<std::thread> linkThread;
+    };
+
+    Config m_config;
+    std::vector<std::unique_ptr<Upstream>> m_upstreams;
+    std::unique_ptr<SocketManager> m_downstream;
+    std::atomic<bool> m_running;
+    std::unique_ptr<std::thread> m_publishThread;
+
+    // Merge structures (guarded by m_fleetMutex)
+    SensorSnapshot m_fleet;
+    std::vector<SensorSnapshot> m_views;        // Last merged snapshot per upstream
+    std::vector<size_t> m_rangeOffset;          // First fleet channel of each upstream
+    std::vector<uint8_t> m_layoutKnown;         // Non-zero once an upstream contributed channels
+    uint64_t m_mergeCount;
+    mutable std::mutex m_fleetMutex;
+
+    // Downstream feed (publish thread only)
+    SnapshotDeltaEncoder m_encoder;
+    std::vector<uint8_t> m_frame;
+    std::atomic<bool> m_keyframeDue;            // Set when a downstream client connects
+
+    static constexpr int POLL_TIMEOUT_MS = 100;
+    static constexpr size_t RECEIVE_BUFFER_SIZE = 64 * 1024;
+
+public:
+    /**
+     * @brief Constructor
+     * @param downstream Socket manager serving dashboards, or nullptr to only merge
+     * @param config Publish rate, reconnect interval and downstream encoder settings
+     */
+    explicit FleetAggregator(std::unique_ptr<SocketManager> downstream, const Config& config = DefaultConfig());
+
+    /**
+     * @brief Destructor - stops links and the publish thread
+     */
+    ~FleetAggregator();
+
+    FleetAggregator(const FleetAggregator&) = delete;
+    FleetAggregator& operator=(const FleetAggregator&) = delete;
+
+    /**
+     * @brief Add a plant monitor to aggregate
+     * @param plantId Plant identifier, used in status output
+     * @param host Monitor address (IPv4)
+     * @param port Monitor SocketManager port
+     * @return Upstream index, or -1 if running
+     */
+    int AddUpstream(const std::string& plantId, const std::string& host, int port);
+
+    /**
+     * @brief Connect every upstream and start publishing
+     * @return false if already running or no upstream is configured
+     */
+    bool Start();
+
+    /**
+     * @brief Disconnect upstreams and stop publishing
+     */
+    void Stop();
+
+    /**
+     * @brief Apply one received frame payload to an upstream
+     * @param upstream Upstream index
+     * @param payload Frame payload without length prefix
+     * @param size Payload size
+     * @return false if the frame is malformed and the link should reconnect
+     *
+     * Called by the link threads; while the aggregator is not started it can
+     * be fed from another transport. The decoded snapshot replaces any not
+     * yet merged.
+     */
+    bool Ingest(size_t upstream, const uint8_t* payload, size_t size);
+
+    /**
+     * @brief Merge the latest snapshot of every dirty upstream into the fleet view
+     * @return true if the fleet view changed
+     *
+     * Runs on the publish thread; callable directly when not started.
+     */
+    bool MergeLatest();
+
+    /**
+     * @brief Get a copy of the fleet-wide snapshot
+     * @return Fleet snapshot; channels of disconnected upstreams are COMM_FAIL
+     */
+    SensorSnapshot GetFleetSnapshot() const;
+
+    /**
+     * @brief Get link state and counters per upstream
+     * @return One entry per upstream, in AddUpstream order
+     */
+    std::vector<UpstreamStatus> GetUpstreamStatus() const;
+
+    /**
+     * @brief Map a plant sensor to its fleet channel ID
+     * @param upstream Upstream index
+     * @param sensorId Sensor ID within that plant (checked by FitsFleetIdRange)
+     * @return Fleet sensor ID
+     */
+    static int FleetSensorId(size_t upstream, int sensorId);
+
+    /**
+     * @brief Check that a plant sensor maps to a distinct fleet channel ID
+     * @param upstream Upstream index
+     * @param sensorId Sensor ID within that plant
+     * @return false if sensorId is negative or not below FLEET_ID_STRIDE, or
+     *         the upstream's ID range does not fit in int
+     */
+    static bool FitsFleetIdRange(size_t upstream, int sensorId);
+
+private:
+    /**
+     * @brief Connect, request the delta feed and ingest frames until stopped (link thread)
+     * @param index Upstream index
+     */
+    void LinkLoop(size_t index);
+
+    /**
+     * @brief Open a TCP connection without blocking past a deadline
+     * @param host IPv4 address
+     * @param port Port number
+     * @param timeout Longest time to wait for the handshake
+     * @return Connected blocking socket, or INVALID_SOCKET on error or timeout
+     */
+    static SOCKET ConnectTo(const std::string& host, int port, std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Merge and broadcast at the publish interval (publish thread)
+     *
+     * The first frame after a downstream client connects is a keyframe, so
+     * the new client never waits for the keyframe interval to decode. It is
+     * sent at the next publish interval even if no upstream changed.
+     */
+    void PublishLoop();
+
+    /**
+     * @brief Recompute channel ranges and fleet IDs (caller holds m_fleetMutex)
+     */
+    void RebuildLayout();
+
+    /**
+     * @brief Copy an upstream's values and quality into its fleet range (caller holds m_fleetMutex)
+     * @param view Last merged snapshot of the upstream
+     * @param offset First fleet channel of the upstream
+     */
+    void CopyValues(const SensorSnapshot& view, size_t offset);
+
+    /**
+     * @brief Sleep in short steps until the interval elapses or the aggregator stops
+     * @param interval Time to wait
+     */
+    void WaitWhileRunning(std::chrono::milliseconds interval) const;
+};
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "IDataProcessor.h"
+#include "SensorSnapshot.h"
+#include <vector>
+#include <string>
+#include <cstddef>
+
+namespace Nuclear {
+
+/**
+ * @brief Node of the plant grouping hierarchy (plant, area, loop, steam generator...)
+ */
+struct GroupDefinition {
+    int groupId;
+    std::string name;
+    int parentId;                   // -1 for a root group
+    std::vector<size_t> channels;   // Channels belonging directly to this group
+};
+
+/**
+ * @brief Per-group sum/min/max/count over a scan, for every group at once
+ *
+ * Configure compiles the hierarchy into CSR membership arrays ordered so that
+ * children precede parents. Aggregate then runs a single segmented reduction
+ * over the member index array and folds each group's result into its parent,
+ * so cost is proportional to total membership plus group count, not to
+ * groups x channels. Only channels with usable quality contribute.
+ *
+ * Not thread-safe; owned by the processing pass.
+ */
+class GroupAggregator {
+private:
+    static constexpr size_t KIND_COUNT = 3;
+
+    std::vector<GroupDefinition> m_groups;       // Children before parents
+    std::vector<size_t> m_parentSlot;            // Slot of parent group, or NO_PARENT
+    std::vector<size_t> m_memberOffsets;         // CSR offsets, size groups + 1
+    std::vector<size_t> m_memberChannels;        // CSR member channel indices
+    std::vector<uint8_t> m_channelKind;          // SensorKind per channel
+
+    std::vector<GroupAggregate> m_results;
+
+    static constexpr size_t NO_PARENT = static_cast<size_t>(-1);
+
+public:
+    GroupAggregator() = default;
+
+    /**
+     * @brief Compile grouping hierarchy
+     * @param groups Group definitions in any order
+     * @param kinds Sensor kind of every channel
+     * @return false if a parent is unknown, the hierarchy has a cycle, a
+     *         channel index is out of range, or a channel is listed more than
+     *         once within one tree (e.g. in both a group and its ancestor);
+     *         the previous configuration is kept
+     */
+    bool Configure(std::vector<GroupDefinition> groups, const std::vector<SensorKind>& kinds);
+
+    /**
+     * @brief Aggregate one scan into every group
+     * @param snapshot Scan in the configured layout; fixed-point channels are read in engineering units
+     * @return Aggregates in hierarchy order (children before parents)
+     */
+    const std::vector<GroupAggregate>& Aggregate(const SensorSnapshot& snapshot);
+
+    /**
+     * @brief Get results of the last Aggregate call
+     * @return Aggregates in hierarchy order
+     */
+    const std::vector<GroupAggregate>& GetResults() const;
+
+    /**
+     * @brief Get number of configured groups
+     * @return Group count
+     */
+    size_t GetGroupCount() const;
+};
+
+} // namespace Nuclear
\ No newline at end of file
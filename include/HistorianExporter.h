@@ -0,0 +1,262 @@
+#pragma once
+
+#include "ScanRecording.h"
+#include "ThreadPool.h"
+#include <vector>
+#include <string>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <iosfwd>
+#include <fstream>
+#include <limits>
+#include <cstdint>
+
+namespace Nuclear {
+
+/**
+ * @brief Output format of a historian export
+ */
+enum class ExportFormat {
+    Csv,            // One row per scan: scan, timestamp_us, one column per channel
+    Columnar        // Row groups of per-channel columns with a footer index (see ColumnarExportReader)
+};
+
+/**
+ * @brief Streams scan recordings out to CSV or a columnar file for offline analysis
+ *
+ * The export walks the recording one chunk at a time and never holds more
+ * than two chunks: while the worker pool processes chunk N the calling
+ * thread writes chunk N-1 and reads chunk N+1, so reads, CPU work and
+ * writes overlap and memory stays bounded regardless of export size.
+ *
+ * CSV decodes the selected channels in parallel (one task per channel
+ * range), then formats row blocks in parallel; the blocks are written in
+ * order. Columnar output needs no decoding: chunk payloads are already
+ * column-wise, so each task copies its channels' value and quality slices
+ * straight into the row group.
+ *
+ * The exporter owns its worker pool, so it never competes with a plant's
+ * monitoring thread or shared worker pool for queue slots.
+ *
+ * Columnar layout: u32 magic "NPCX", u16 version, u16 reserved, u32 channel
+ * count, then i32 sensor IDs and u8 kinds. Each row group is u32 magic
+ * "RGRP", u32 rows and a ScanChunk payload of the selected channels. The
+ * footer lists per row group u64 offset, u32 rows, i64 first and last
+ * timestamps, and ends with u64 footer offset, u32 row group count and the
+ * file magic.
+ */
+class HistorianExporter {
+public:
+    struct Options {
+        ExportFormat format;
+        std::vector<int> sensorIds;     // Channels to export in this order; empty exports all
+        int64_t startUs;                // First timestamp included, microseconds since the Unix epoch
+        int64_t endUs;                  // First timestamp excluded
+        bool includeQuality;            // CSV: add a quality flags column per channel
+        size_t workers;                 // Worker threads; 0 picks cores minus one
+    };
+
+    struct Result {
+        bool completed;
+        std::string error;
+        uint64_t rowsExported;
+        uint64_t chunksRead;
+        uint64_t chunksSkipped;         // Outside the time range
+        uint64_t bytesWritten;
+        double seconds;
+        double megabytesPerSecond;
+    };
+
+    static Options DefaultOptions() {
+        return Options{ExportFormat::Csv, {}, std::numeric_limits<int64_t>::min(),
+                       std::numeric_limits<int64_t>::max(), false, 0};
+    }
+
+private:
+    // One chunk in flight: encoded input, decoded columns and formatted output
+    struct Batch {
+        ScanChunk chunk;
+        std::vector<uint64_t> scanNumbers;
+        std::vector<int64_t> timestamps;
+        size_t firstRow = 0;
+        size_t rowCount = 0;
+
+        std::vector<double> values;             // Selected channels x scanCount, channel-major (CSV)
+        std::vector<SensorQuality> quality;
+        std::vector<std::string> text;          // One formatted block of CSV rows per task
+        std::vector<uint8_t> rowGroup;          // Columnar row group
+
+        std::atomic<size_t> remaining{0};       // Tasks left in the current stage
+        bool done = true;
+        std::mutex mutex;
+        std::condition_variable condition;
+    };
+
+    Options m_options;
+    std::unique_ptr<ThreadPool> m_pool;
+    std::atomic<bool> m_cancelled;
+
+    // Per export
+    std::vector<size_t> m_channels;             // Recording channel of each exported column
+    Batch m_batches[2];
+
+    static constexpr size_t MIN_ROWS_PER_TASK = 64;
+
+public:
+    /**
+     * @brief Constructor
+     * @param options Format, channel selection, time range and worker count
+     */
+    explicit HistorianExporter(const Options& options = DefaultOptions());
+
+    HistorianExporter(const HistorianExporter&) = delete;
+    HistorianExporter& operator=(const HistorianExporter&) = delete;
+
+    /**
+     * @brief Export a recording file
+     * @param recordingPath Scan recording to read
+     * @param outputPath File to create; an existing file is replaced
+     * @return Counters and throughput; completed is false on error or cancellation
+     */
+    Result Export(const std::string& recordingPath, const std::string& outputPath);
+
+    /**
+     * @brief Export from an open recording to a stream
+     * @param reader Recording positioned at its first chunk
+     * @param out Output stream
+     * @return Counters and throughput; completed is false on error or cancellation
+     */
+    Result Export(ScanRecordingReader& reader, std::ostream& out);
+
+    /**
+     * @brief Stop a running export after the chunk in progress
+     */
+    void Cancel();
+
+    /**
+     * @brief Parse a format name
+     * @param name "csv" or "columnar"
+     * @param format Output format
+     * @return false if the name is unknown
+     */
+    static bool ParseFormat(const std::string& name, ExportFormat& format);
+
+    /**
+     * @brief Parse a time bound
+     * @param text "YYYY-MM-DDTHH:MM:SS[Z]" in UTC, or microseconds since the Unix epoch
+     * @param timestampUs Microseconds since the Unix epoch
+     * @return false if the text is not a time
+     */
+    static bool ParseTime(const std::string& text, int64_t& timestampUs);
+
+private:
+    /**
+     * @brief Find the rows of a chunk inside the time range and start processing them
+     * @param batch Batch holding a freshly read chunk
+     * @return false if no row of the chunk is in range
+     */
+    bool StartBatch(Batch& batch);
+
+    /**
+     * @brief Run the stage after decoding (CSV formatting), or finish the batch
+     * @param batch Batch whose decode tasks all completed
+     */
+    void FinishDecode(Batch& batch);
+
+    /**
+     * @brief Mark a batch complete and wake the exporting thread
+     * @param batch Batch whose last task completed
+     */
+    void MarkDone(Batch& batch);
+
+    /**
+     * @brief Block until a batch completes
+     * @param batch Batch to wait for
+     */
+    void WaitBatch(Batch& batch);
+
+    /**
+     * @brief Queue a task, running it inline if the pool refuses it
+     * @param task Task to run
+     */
+    void Dispatch(ThreadPool::Task task);
+
+    /**
+     * @brief Split work into task ranges
+     * @param items Item count
+     * @param minimum Smallest range worth a task
+     * @return Number of tasks
+     */
+    size_t TaskCount(size_t items, size_t minimum) const;
+
+    /**
+     * @brief Build the CSV header line
+     * @param reader Recording supplying sensor IDs
+     * @return Header text
+     */
+    std::string CsvHeader(const ScanRecordingReader& reader) const;
+
+    /**
+     * @brief Build the columnar file header
+     * @param reader Recording supplying sensor IDs and kinds
+     * @return Header bytes
+     */
+    std::vector<uint8_t> ColumnarHeader(const ScanRecordingReader& reader) const;
+};
+
+/**
+ * @brief Reads row groups of a columnar historian export
+ */
+class ColumnarExportReader {
+public:
+    struct RowGroupInfo {
+        uint64_t offset;
+        size_t rows;
+        int64_t firstUs;
+        int64_t lastUs;
+    };
+
+private:
+    std::ifstream m_file;
+    std::vector<int> m_sensorIds;
+    std::vector<SensorKind> m_kinds;
+    std::vector<RowGroupInfo> m_rowGroups;
+
+public:
+    /**
+     * @brief Open an export and read its header and footer index
+     * @param path Columnar export file
+     * @return false if the file is missing, truncated, not a columnar export or names an unknown kind
+     */
+    bool Open(const std::string& path);
+
+    /**
+     * @brief Get exported channel layout
+     * @return Sensor IDs in column order
+     */
+    const std::vector<int>& GetSensorIds() const;
+
+    /**
+     * @brief Get exported channel kinds
+     * @return Kinds in column order
+     */
+    const std::vector<SensorKind>& GetKinds() const;
+
+    /**
+     * @brief Get the footer index
+     * @return Row groups in file order
+     */
+    const std::vector<RowGroupInfo>& GetRowGroups() const;
+
+    /**
+     * @brief Read one row group
+     * @param index Row group index
+     * @param chunk Output; decode with ScanChunk::DecodeTimes and DecodeChannel
+     * @return false if the index is out of range or the group is damaged
+     */
+    bool ReadRowGroup(size_t index, ScanChunk& chunk);
+};
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <chrono>
+
+namespace Nuclear {
+
+/**
+ * @brief Interface for reading time
+ *
+ * Injected into PlantMonitor, DataProcessor and SocketManager so timing
+ * behavior can be driven by a virtual clock in replay and soak tests.
+ */
+class IClock {
+public:
+    virtual ~IClock() = default;
+
+    /**
+     * @brief Monotonic time for intervals, deadlines and timeouts
+     * @return Current steady time
+     */
+    virtual std::chrono::steady_clock::time_point SteadyNow() const = 0;
+
+    /**
+     * @brief Wall-clock time for timestamps
+     * @return Current system time
+     */
+    virtual std::chrono::system_clock::time_point SystemNow() const = 0;
+};
+
+} // namespace Nuclear
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "SensorQuality.h"
+#include "Clock.h"
 #include <vector>
 #include <string>
 
@@ -10,6 +12,31 @@ struct SensorReading {
     double value;
     std::string timestamp;
     std::string sensorType;
+    SensorQuality quality = QUALITY_GOOD;  // QUALITY_* flags set during acquisition
+};
+
+struct VotedReading {
+    int groupId;
+    std::string sensorType;
+    double value;
+    SensorQuality quality;      // GOOD, SUBSTITUTED when degraded, COMM_FAIL when no channel usable
+    bool discrepancy;           // Redundant channels disagree beyond tolerance
+};
+
+struct AggregateStats {
+    size_t count;               // Usable readings contributing
+    double sum;
+    double min;
+    double max;
+};
+
+struct GroupAggregate {
+    int groupId;
+    std::string name;
+    int parentId;               // -1 for a root group
+    AggregateStats temperature;
+    AggregateStats pressure;
+    AggregateStats radiation;
 };
 
 struct ProcessedData {
@@ -19,6 +46,11 @@ struct ProcessedData {
     double averageTemperature;
     double averagePressure;
     double averageRadiation;
+    size_t unusableReadings;  // Readings excluded from averages and threshold checks by quality
+    std::vector<uint8_t> anomalyFlags;  // ANOMALY_* bits per entry of readings (empty if detection is off)
+    size_t anomalyCount;
+    std::vector<VotedReading> votedReadings;  // One per configured redundancy group
+    std::vector<GroupAggregate> groupAggregates;  // Per loop / steam generator / area, children first
 };
 
 /**
@@ -34,9 +66,24 @@ public:
      * @brief Process raw sensor readings and generate alerts if needed
      * @param readings Vector of raw sensor readings
      * @return Processed data with calculated averages and alerts
+     *
+     * Only readings with usable quality feed averages and threshold alarms;
+     * readings flagged COMM_FAIL, STALE or OUT_OF_RANGE raise a sensor fault
+     * alert instead.
      */
     virtual ProcessedData ProcessReadings(const std::vector<SensorReading>& readings) = 0;
     
+    /**
+     * @brief Process readings using the time captured at the start of the cycle
+     * @param readings Vector of raw sensor readings
+     * @param cycle Cycle time shared by acquisition, processing and reporting
+     * @return Processed data with calculated averages and alerts
+     *
+     * Alerts and statistics take their time from cycle rather than reading
+     * a clock, so a replayed or simulated cycle processes deterministically.
+     */
+    virtual ProcessedData ProcessReadings(const std::vector<SensorReading>& readings, const CycleContext& cycle) = 0;
+    
     /**
      * @brief Set safety thresholds for alert generation
      * @param maxTemperature Maximum safe temperature in Celsius
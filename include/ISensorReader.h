@@ -1,11 +1,15 @@
 #pragma once
 
+#include "ChannelSet.h"
+#include "SensorQuality.h"
 #include <memory>
 #include <vector>
 #include <string>
 
 namespace Nuclear {
 
+class MetricsRegistry;
+
 /**
  * @brief Interface for reading sensor data from nuclear plant equipment
  * 
@@ -48,6 +52,54 @@ public:
      * @return Vector of sensor identifiers
      */
     virtual std::vector<int> GetAvailableSensors() const = 0;
+    
+    /**
+     * @brief Get cached set of available channels
+     * @return Immutable channel set; a new version is published only when
+     *         devices reconnect or configuration changes the channel list
+     */
+    virtual std::shared_ptr<const ChannelSet> GetChannelSet() const = 0;
+    
+    /**
+     * @brief Read a group of channels in as few device round trips as possible
+     * @param sensorIds Channels to read
+     * @param kinds Kind of each channel
+     * @param values Output values, one per channel
+     * @param quality Output quality flags, one per channel
+     * @return Number of channels read with usable quality
+     *
+     * Used for high-rate burst acquisition of a device group, where
+     * per-sensor calls cannot keep up with the burst sample interval.
+     */
+    virtual size_t ReadChannels(const std::vector<int>& sensorIds, const std::vector<SensorKind>& kinds,
+                                double* values, SensorQuality* quality) const = 0;
+    
+    /**
+     * @brief Acquire every channel of a channel set in one call
+     * @param channels Channel set to read, normally the one from GetChannelSet()
+     * @param snapshot Output; columns are resized to the set only when its layout differs
+     * @return Number of channels read with usable quality
+     *
+     * The bulk path for a full scan: one virtual call per scan instead of
+     * one per sensor. Implementations fill sensorIds, kinds, values and
+     * quality, or counts for channels the set scales as fixed point (see
+     * SensorSnapshot::SetScaling); scanNumber and acquiredAt are left to the caller. Channels
+     * that cannot be read are returned with QUALITY_COMM_FAIL.
+     */
+    virtual size_t ReadSnapshot(const ChannelSet& channels, SensorSnapshot& snapshot) const = 0;
+    
+    /**
+     * @brief Get a per-device acquisition report for status output
+     * @return One line per field device; empty if the reader has no devices
+     */
+    virtual std::string GetDeviceStatus() const { return std::string(); }
+    
+    /**
+     * @brief Export per-device acquisition metrics
+     * @param registry Registry that outlives the reader
+     * @return false if the reader has nothing to export
+     */
+    virtual bool RegisterMetrics(MetricsRegistry& /*registry*/) { return false; }
 };
 
 } // namespace Nuclear 
\ No newline at end of file
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <functional>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+namespace Nuclear {
+
+/**
+ * @brief Monotonic counter; Increment is one relaxed atomic add
+ */
+class MetricCounter {
+private:
+    alignas(64) std::atomic<uint64_t> m_value{0};
+
+public:
+    void Increment(uint64_t amount = 1) { m_value.fetch_add(amount, std::memory_order_relaxed); }
+    uint64_t Get() const { return m_value.load(std::memory_order_relaxed); }
+};
+
+/**
+ * @brief Gauge holding a double; Set is one relaxed atomic store
+ */
+class MetricGauge {
+private:
+    alignas(64) std::atomic<uint64_t> m_bits{0};
+
+public:
+    void Set(double value);
+    void Add(double delta);
+    double Get() const;
+};
+
+/**
+ * @brief Fixed-bucket histogram; Observe is a bucket search and two atomic updates
+ *
+ * Bucket bounds are fixed at registration. Counts are kept per bucket and
+ * made cumulative only when read, so observers never touch shared totals
+ * other than the sum.
+ */
+class MetricHistogram {
+public:
+    struct Snapshot {
+        std::vector<double> bounds;
+        std::vector<uint64_t> cumulative;   // One per bound, then +Inf
+        uint64_t count;
+        double sum;
+    };
+
+private:
+    std::vector<double> m_bounds;
+    std::unique_ptr<std::atomic<uint64_t>[]> m_buckets;     // bounds.size() + 1 (overflow)
+    alignas(64) std::atomic<uint64_t> m_sumBits{0};
+
+public:
+    /**
+     * @brief Constructor
+     * @param bounds Ascending bucket upper bounds
+     */
+    explicit MetricHistogram(std::vector<double> bounds);
+
+    /**
+     * @brief Record one observation
+     * @param value Observed value (seconds for latencies)
+     */
+    void Observe(double value);
+
+    /**
+     * @brief Read cumulative bucket counts, count and sum
+     * @return Snapshot; count always equals the +Inf bucket
+     */
+    Snapshot Read() const;
+};
+
+/**
+ * @brief Process-wide registry of counters, gauges and histograms
+ *
+ * Components register their metrics once (at startup) and keep the returned
+ * pointers; updating a metric is a relaxed atomic operation with no lock.
+ * Values that already live in a component's statistics can be registered
+ * as functions evaluated at scrape time instead of being mirrored.
+ *
+ * The family table is immutable and replaced copy-on-write on registration,
+ * so Render never blocks registration or updates.
+ */
+class MetricsRegistry {
+public:
+    enum class MetricType {
+        Counter,
+        Gauge,
+        Histogram
+    };
+
+    using Labels = std::vector<std::pair<std::string, std::string>>;
+    using ValueFunction = std::function<double()>;
+
+private:
+    struct Series {
+        std::string labels;                             // Rendered label pairs without braces, e.g. device="pump_1"
+        std::shared_ptr<MetricCounter> counter;
+        std::shared_ptr<MetricGauge> gauge;
+        std::shared_ptr<MetricHistogram> histogram;
+        ValueFunction function;                         // Evaluated at render time when set
+    };
+
+    struct Family {
+        std::string name;
+        std::string help;
+        MetricType type;
+        std::vector<Series> series;
+    };
+
+    using FamilyTable = std::vector<Family>;
+
+    std::shared_ptr<const FamilyTable> m_table;
+    std::mutex m_registrationMutex;
+
+public:
+    MetricsRegistry();
+
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    /**
+     * @brief Get or create a counter
+     * @param name Metric name ([a-zA-Z_:][a-zA-Z0-9_:]*)
+     * @param help Help text
+     * @param labels Label names and values identifying the series
+     * @return Counter, or nullptr if the name or labels are invalid or the name has another type
+     */
+    MetricCounter* GetCounter(const std::string& name, const std::string& help, const Labels& labels = Labels());
+
+    /**
+     * @brief Get or create a gauge
+     * @param name Metric name
+     * @param help Help text
+     * @param labels Label names and values identifying the series
+     * @return Gauge, or nullptr if the name or labels are invalid or the name has another type
+     */
+    MetricGauge* GetGauge(const std::string& name, const std::string& help, const Labels& labels = Labels());
+
+    /**
+     * @brief Get or create a histogram
+     * @param name Metric name
+     * @param help Help text
+     * @param bounds Ascending bucket upper bounds; ignored if the series exists
+     * @param labels Label names and values identifying the series
+     * @return Histogram, or nullptr if arguments are invalid or the name has another type
+     */
+    MetricHistogram* GetHistogram(const std::string& name, const std::string& help, const std::vector<double>& bounds,
+                                  const Labels& labels = Labels());
+
+    /**
+     * @brief Expose a value read from a component at scrape time
+     * @param name Metric name
+     * @param help Help text
+     * @param type Counter or Gauge
+     * @param labels Label names and values identifying the series
+     * @param function Returns the current value; must be thread-safe
+     * @return false if arguments are invalid, the series exists or the name has another type
+     */
+    bool RegisterFunction(const std::string& name, const std::string& help, MetricType type, const Labels& labels,
+                          ValueFunction function);
+
+    /**
+     * @brief Render every series in the Prometheus text exposition format (0.0.4)
+     * @return Exposition text
+     */
+    std::string Render() const;
+
+    /**
+     * @brief Get number of registered series
+     * @return Series count
+     */
+    size_t GetSeriesCount() const;
+
+    /**
+     * @brief Exponential bucket bounds
+     * @param start First upper bound
+     * @param factor Ratio between consecutive bounds (> 1)
+     * @param count Number of bounds
+     * @return Ascending bounds
+     */
+    static std::vector<double> ExponentialBuckets(double start, double factor, size_t count);
+
+    /**
+     * @brief Default latency buckets, 50 us to about 3 s
+     * @return Ascending bounds in seconds
+     */
+    static std::vector<double> LatencyBuckets();
+
+private:
+    /**
+     * @brief Find or add a series, copying the table on change
+     * @param name Metric name
+     * @param help Help text
+     * @param type Metric type
+     * @param labels Label set
+     * @param create Fills a new series; not called if the series exists
+     * @param mustBeNew Fail if the series already exists
+     * @param series Output; the existing or new series
+     * @return false if arguments are invalid, the name has another type, or mustBeNew and the series exists
+     */
+    bool FindOrAdd(const std::string& name, const std::string& help, MetricType type, const Labels& labels,
+                   const std::function<void(Series&)>& create, bool mustBeNew, Series& series);
+
+    /**
+     * @brief Check a metric or label name
+     * @param name Name to check
+     * @param allowColon true for metric names
+     * @return true if valid
+     */
+    static bool IsValidName(const std::string& name, bool allowColon);
+};
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "MetricsRegistry.h"
+#include "NetworkPlatform.h"
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <string>
+#include <chrono>
+#include <cstdint>
+
+namespace Nuclear {
+
+/**
+ * @brief Minimal HTTP listener serving a MetricsRegistry for Prometheus scrapes
+ *
+ * Answers "GET /metrics" with the registry rendered in the text exposition
+ * format and closes the connection; every other request gets a 404. One
+ * thread serves scrapes one at a time, which is ample for a monitoring stack
+ * polling every few seconds and keeps the listener off the scan path
+ * entirely: rendering only reads atomics and never takes a lock the
+ * monitoring thread could be waiting on. Because scrapes are serial, both
+ * the request read and the response write run against a deadline; a client
+ * that stops reading is dropped rather than stalling later scrapes or Stop().
+ *
+ * Binds to loopback by default; expose it on a plant network deliberately.
+ */
+class MetricsServer {
+public:
+    struct Config {
+        std::string bindAddress;                    // IPv4 address to listen on
+        int port;                                   // 0 picks a free port (see GetPort)
+        size_t maxRequestBytes;                     // Larger requests are refused
+        std::chrono::milliseconds requestTimeout;   // Time allowed to send the request head
+        std::chrono::milliseconds responseTimeout;  // Time allowed to drain the response
+    };
+
+    struct Statistics {
+        uint64_t scrapes;
+        uint64_t notFound;
+        uint64_t badRequests;
+        uint64_t bytesServed;
+        uint64_t timedOut;           // Responses dropped because the client stopped reading
+        double lastRenderMicros;
+        double maxRenderMicros;
+    };
+
+    static Config DefaultConfig() {
+        return Config{"127.0.0.1", 9464, 8192, std::chrono::milliseconds(2000), std::chrono::milliseconds(2000)};
+    }
+
+private:
+    const MetricsRegistry& m_registry;
+    Config m_config;
+
+    SOCKET m_listenSocket;
+    int m_boundPort;
+    std::atomic<bool> m_running;
+    std::unique_ptr<std::thread> m_serveThread;
+
+    // Updated by the serving thread only; atomics so GetStatistics needs no lock
+    std::atomic<uint64_t> m_scrapes;
+    std::atomic<uint64_t> m_notFound;
+    std::atomic<uint64_t> m_badRequests;
+    std::atomic<uint64_t> m_bytesServed;
+    std::atomic<uint64_t> m_timedOut;
+    std::atomic<double> m_lastRenderMicros;
+    std::atomic<double> m_maxRenderMicros;
+
+    static constexpr int POLL_INTERVAL_MS = 200;
+
+public:
+    /**
+     * @brief Constructor
+     * @param registry Registry to serve; must outlive the server
+     * @param config Listen address and request limits
+     */
+    explicit MetricsServer(const MetricsRegistry& registry, const Config& config = DefaultConfig());
+
+    /**
+     * @brief Destructor
+     */
+    ~MetricsServer();
+
+    MetricsServer(const MetricsServer&) = delete;
+    MetricsServer& operator=(const MetricsServer&) = delete;
+
+    /**
+     * @brief Bind the listener and start serving
+     * @return false if already running or the address cannot be bound
+     */
+    bool Start();
+
+    /**
+     * @brief Stop serving and close the listener
+     */
+    void Stop();
+
+    /**
+     * @brief Check if the server is running
+     * @return true if running
+     */
+    bool IsRunning() const;
+
+    /**
+     * @brief Get the bound port
+     * @return Port, or -1 when not running
+     */
+    int GetPort() const;
+
+    /**
+     * @brief Get scrape statistics
+     * @return Statistics snapshot
+     */
+    Statistics GetStatistics() const;
+
+private:
+    /**
+     * @brief Accept and answer connections until stopped
+     */
+    void ServeLoop();
+
+    /**
+     * @brief Read one request and send the response
+     * @param client Accepted connection; closed by the caller
+     */
+    void HandleConnection(SOCKET client);
+
+    /**
+     * @brief Send a complete response
+     * @param client Connection
+     * @param status Status line text, e.g. "200 OK"
+     * @param contentType Content-Type header value
+     * @param body Response body
+     * @return true if everything was sent before responseTimeout expired
+     */
+    bool SendResponse(SOCKET client, const char* status, const char* contentType, const std::string& body);
+};
+
+} // namespace Nuclear
\ No newline at end of file
@@ -1,19 +1,16 @@
 #pragma once
 
 #include "ISensorReader.h"
+#include "NetworkPlatform.h"
+#include "SensorHealth.h"
+#include "ChannelSet.h"
+#include "ModbusTelemetry.h"
 #include <memory>
 #include <string>
 #include <vector>
 #include <mutex>
-
-#ifdef _WIN32
-#include <winsock2.h>
-#include <ws2tcpip.h>
-#else
-#include <sys/socket.h>
-#include <netinet/in.h>
-#include <arpa/inet.h>
-#endif
+#include <unordered_map>
+#include <cstdint>
 
 namespace Nuclear {
 
@@ -35,6 +32,48 @@ private:
     std::vector<ModbusConnection> m_connections;
     mutable std::mutex m_connectionMutex;
     int m_transactionId;
+    
+    // Quality flags and liveness derived from read outcomes (guarded by m_connectionMutex)
+    mutable SensorHealthTracker m_sensorHealth;
+    
+    // Per-device request counts, RTT and slow-device flags; index matches m_connections (guarded by m_connectionMutex)
+    mutable ModbusTelemetry m_telemetry;
+    
+    // Channels served by the configured devices; rebuilt on connect/disconnect/AddDevice
+    SensorCatalog m_catalog;
+    
+    /**
+     * @brief Prepared register reads for a whole channel set
+     *
+     * Built once per ChannelSet version: channels are grouped by device and
+     * function code and coalesced into contiguous blocks of at most
+     * MAX_REGISTERS_PER_READ registers, so a scan is a fixed list of
+     * pipelined requests followed by a scatter of registers into channels.
+     */
+    struct ModbusReadPlan {
+        struct DeviceReads {
+            int deviceIndex;
+            uint8_t functionCode;
+            std::vector<std::pair<uint16_t, uint16_t>> blocks;  // (start address, quantity)
+            std::vector<size_t> channels;        // Snapshot channel per register read, in block order
+            std::vector<size_t> blockOfChannel;  // Block index per entry of channels
+        };
+        
+        uint64_t channelSetVersion = 0;
+        std::vector<DeviceReads> devices;
+        std::vector<size_t> unmappedChannels;   // Channels no configured device serves
+        
+        // Reused per scan to avoid allocation
+        std::vector<uint16_t> registers;
+        std::vector<uint8_t> blockOk;
+        std::vector<uint8_t> readOk;
+    };
+    
+    // Guarded by m_connectionMutex; rebuilt when ReadSnapshot sees a new channel set version
+    mutable ModbusReadPlan m_readPlan;
+    
+    // Configured fixed-point scales by sensor ID, applied to m_catalog on every rebuild (guarded by m_connectionMutex)
+    std::unordered_map<int, FixedPointScale> m_fixedPointChannels;
 
     // Modbus function codes
     static constexpr uint8_t MODBUS_READ_HOLDING_REGISTERS = 0x03;
@@ -44,6 +83,10 @@ private:
     static constexpr int TEMPERATURE_BASE_ADDRESS = 0x1000;
     static constexpr int PRESSURE_BASE_ADDRESS = 0x2000;
     static constexpr int RADIATION_BASE_ADDRESS = 0x3000;
+    
+    // Batched reads: registers per request (Modbus limit) and requests in flight per device
+    static constexpr uint16_t MAX_REGISTERS_PER_READ = 125;
+    static constexpr size_t MAX_PIPELINED_REQUESTS = 4;
 
 public:
     /**
@@ -79,10 +122,107 @@ public:
     double ReadTemperature(int sensorId) const override;
     double ReadPressure(int sensorId) const override;
     double ReadRadiationLevel(int sensorId) const override;
+    
+    /**
+     * @brief Check if sensor answered its most recent read
+     * @param sensorId Unique identifier for the sensor
+     * @return true if the last read of this sensor succeeded
+     *
+     * Answered from the health tracker; never issues a Modbus request.
+     */
     bool IsSensorOnline(int sensorId) const override;
+    
+    /**
+     * @brief Get quality flags assigned to a sensor's most recent read
+     * @param sensorId Unique identifier for the sensor
+     * @return Quality flags; COMM_FAIL if sensor is unknown
+     */
+    SensorQuality GetLastQuality(int sensorId) const;
     std::vector<int> GetAvailableSensors() const override;
+    std::shared_ptr<const ChannelSet> GetChannelSet() const override;
+    
+    /**
+     * @brief Read a group of channels with batched, pipelined register reads
+     * @param sensorIds Channels to read
+     * @param kinds Kind of each channel
+     * @param values Output values, one per channel
+     * @param quality Output quality flags, one per channel
+     * @return Number of channels read with usable quality
+     *
+     * Channels are coalesced into contiguous register blocks per device and
+     * up to MAX_PIPELINED_REQUESTS blocks are sent before the first response
+     * is awaited, so a burst sample costs about one round trip per device.
+     */
+    size_t ReadChannels(const std::vector<int>& sensorIds, const std::vector<SensorKind>& kinds,
+                        double* values, SensorQuality* quality) const override;
+    
+    /**
+     * @brief Acquire a whole scan with one pipelined request batch per device
+     * @param channels Channel set to read
+     * @param snapshot Output snapshot
+     * @return Number of channels read with usable quality
+     *
+     * Uses the read plan prepared for channels' version, rebuilding it only
+     * when the version changes. Quality comes from the health tracker's
+     * ClassifySnapshot, so a scan is classified in one pass. The snapshot
+     * adopts channels' scaling; fixed-point channels receive their register
+     * value in counts only; their values entry is not populated (see
+     * SensorSnapshot::EngineeringValue).
+     */
+    size_t ReadSnapshot(const ChannelSet& channels, SensorSnapshot& snapshot) const override;
+    
+    /**
+     * @brief Keep a channel's register value as scaled integer counts
+     * @param sensorId Sensor identifier
+     * @param scale Engineering units per count and offset; a zero scale reverts to floating point
+     * @return false if the scale is negative
+     *
+     * Republishes the catalog with the new scaling, so the change reaches
+     * readers as a new ChannelSet version. The scale should match the
+     * register's engineering conversion so converted counts equal
+     * ConvertToEngineeringUnits for the same register.
+     */
+    bool SetFixedPointChannel(int sensorId, const FixedPointScale& scale);
+    
+    /**
+     * @brief Get request telemetry of every configured device
+     * @return Statistics in AddDevice order
+     */
+    std::vector<ModbusDeviceStats> GetDeviceStatistics() const;
+    
+    /**
+     * @brief Get one status line per device with counters, RTT and a diagnosis
+     * @return Status text from ModbusTelemetry::FormatStatus
+     */
+    std::string GetDeviceStatus() const override;
+    
+    /**
+     * @brief Export per-device request counters and RTT histograms
+     * @param registry Registry that outlives this handler
+     * @return true
+     */
+    bool RegisterMetrics(MetricsRegistry& registry) override;
+    
+    /**
+     * @brief Be told when a device's latency degrades or recovers
+     * @param handler Called on the acquiring thread with m_connectionMutex held; must not call back in
+     */
+    void SetSlowDeviceHandler(ModbusTelemetry::SlowDeviceHandler handler);
 
 private:
+    /**
+     * @brief Rebuild channel list from connected devices and publish it if changed
+     *
+     * Also resets the health tracker when a new catalog version is published.
+     */
+    void RefreshChannelCatalog();
+    
+    /**
+     * @brief Build the read plan for a channel set (caller holds m_connectionMutex)
+     * @param channels Channel set to plan reads for
+     */
+    void BuildReadPlan(const ChannelSet& channels) const;
+    
     /**
      * @brief Send Modbus request and receive response
      * @param deviceIndex Index of device in connections vector
@@ -90,9 +230,29 @@ private:
      * @param address Register address to read
      * @param quantity Number of registers to read
      * @return Raw register value or -1 on error
+     *
+     * The request and its outcome (response, exception, timeout or socket
+     * failure) are recorded in m_telemetry.
      */
     int SendModbusRequest(int deviceIndex, uint8_t functionCode, uint16_t address, uint16_t quantity) const;
     
+    /**
+     * @brief Read several register blocks from one device with requests pipelined
+     * @param deviceIndex Index of device in connections vector
+     * @param functionCode Modbus function code
+     * @param blocks (start address, quantity) pairs, each at most MAX_REGISTERS_PER_READ
+     * @param registers Output registers, concatenated in block order
+     * @param blockOk Output per block, non-zero if its response was valid
+     * @return true if every block was read
+     *
+     * Responses are matched to requests by transaction ID. Each request's
+     * send time is kept with its transaction ID, so m_telemetry gets a true
+     * per-request RTT even with several requests in flight.
+     */
+    bool SendPipelinedRequests(int deviceIndex, uint8_t functionCode,
+                               const std::vector<std::pair<uint16_t, uint16_t>>& blocks,
+                               std::vector<uint16_t>& registers, std::vector<uint8_t>& blockOk) const;
+    
     /**
      * @brief Convert raw Modbus register value to engineering units
      * @param rawValue Raw 16-bit register value
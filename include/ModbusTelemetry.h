@@ -0,0 +1,235 @@
+#pragma once
+
+#include "MetricsRegistry.h"
+#include <vector>
+#include <string>
+#include <functional>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+namespace Nuclear {
+
+/**
+ * @brief Counters and latency figures for one Modbus device
+ */
+struct ModbusDeviceStats {
+    std::string device;                 // "ip:port"
+    uint64_t requests;
+    uint64_t responses;                 // Normal responses
+    uint64_t exceptions;                // Exception responses of any code
+    uint64_t busyExceptions;            // Codes 0x05 (acknowledge) and 0x06 (server device busy)
+    uint64_t timeouts;
+    uint64_t failures;                  // Send errors and dropped connections
+    uint64_t bytesSent;
+    uint64_t bytesReceived;
+    uint8_t lastExceptionCode;
+
+    double averageRttMicros;
+    double maxRttMicros;
+    double recentRttMicros;             // Fast moving average
+    double baselineRttMicros;           // Slow moving average of normal samples; frozen while slow
+    double p50RttMicros;                // Estimated from the RTT histogram (bucket upper bound)
+    double p99RttMicros;
+    std::vector<uint64_t> rttBuckets;   // Counts per GetRttBounds() bucket, then overflow
+
+    double timeoutRate;                 // Recent share of requests that timed out
+    double busyRate;                    // Recent share of requests answered busy
+    bool slow;
+    uint64_t slowTransitions;
+};
+
+/**
+ * @brief Per-device Modbus request telemetry and slow-device detection
+ *
+ * Fed from the request path ModbusHandler already runs: one call when a
+ * request is sent and one when its response, exception, timeout or failure
+ * is seen. A device is flagged slow when its recent round-trip time rises
+ * well above its own baseline, and cleared with hysteresis once it
+ * recovers, so one PLC creeping from 2 ms to 20 ms is caught even though
+ * every device has a different normal latency.
+ *
+ * Timeout and busy-exception rates are tracked separately from RTT, which
+ * lets status output tell a lossy network (timeouts, normal RTT when it
+ * answers) from an overloaded PLC (rising RTT, busy exceptions).
+ *
+ * Not thread-safe; ModbusHandler guards it with its connection mutex. The
+ * series registered through RegisterMetrics are atomic and can be scraped
+ * without that mutex.
+ */
+class ModbusTelemetry {
+public:
+    struct Config {
+        double recentWeight;                        // EWMA weight of the recent RTT and rates
+        double baselineWeight;                      // EWMA weight of the baseline RTT
+        size_t warmupResponses;                     // Responses before a device can be flagged
+        double slowRatio;                           // Flag when recent > baseline * slowRatio ...
+        std::chrono::microseconds slowFloor;        // ... and recent > slowFloor
+        double recoverRatio;                        // Clear when recent < baseline * recoverRatio
+    };
+
+    static Config DefaultConfig() {
+        return Config{0.2, 0.01, 50, 3.0, std::chrono::microseconds(1000), 1.5};
+    }
+
+    // Called on slow transitions; slow is the new state
+    using SlowDeviceHandler = std::function<void(const std::string& device, bool slow)>;
+
+private:
+    struct DeviceMetrics {
+        MetricCounter* requests = nullptr;
+        MetricCounter* exceptions = nullptr;
+        MetricCounter* timeouts = nullptr;
+        MetricCounter* failures = nullptr;
+        MetricCounter* bytesSent = nullptr;
+        MetricCounter* bytesReceived = nullptr;
+        MetricHistogram* rttSeconds = nullptr;
+        MetricGauge* slow = nullptr;
+    };
+
+    struct Device {
+        ModbusDeviceStats stats;
+        double rttMicrosTotal = 0.0;
+        uint64_t rttSamples = 0;
+        DeviceMetrics metrics;
+    };
+
+    Config m_config;
+    std::vector<Device> m_devices;
+    std::vector<double> m_bounds;           // RTT bucket bounds in microseconds
+    MetricsRegistry* m_registry;            // Optional; devices added later are registered too
+    SlowDeviceHandler m_slowHandler;
+
+public:
+    /**
+     * @brief Constructor
+     * @param config Averaging weights and slow-device thresholds
+     */
+    explicit ModbusTelemetry(const Config& config = DefaultConfig());
+
+    /**
+     * @brief Track a device
+     * @param device Device name, normally "ip:port"
+     * @return Device index used by the Record calls
+     */
+    size_t AddDevice(const std::string& device);
+
+    /**
+     * @brief Forget all devices
+     */
+    void Clear();
+
+    /**
+     * @brief Call a handler whenever a device becomes slow or recovers
+     * @param handler Handler run on the recording thread, or nullptr
+     */
+    void SetSlowDeviceHandler(SlowDeviceHandler handler);
+
+    /**
+     * @brief Record a request sent
+     * @param device Device index
+     * @param bytes Frame size
+     */
+    void RecordRequest(size_t device, size_t bytes);
+
+    /**
+     * @brief Record a normal response
+     * @param device Device index
+     * @param bytes Frame size
+     * @param rtt Time from sending the request to receiving the response
+     */
+    void RecordResponse(size_t device, size_t bytes, std::chrono::microseconds rtt);
+
+    /**
+     * @brief Record an exception response
+     * @param device Device index
+     * @param bytes Frame size
+     * @param exceptionCode Modbus exception code
+     *
+     * Exception round trips are not latency samples: a busy PLC answers
+     * 0x06 quickly, which would otherwise hide the slowdown.
+     */
+    void RecordException(size_t device, size_t bytes, uint8_t exceptionCode);
+
+    /**
+     * @brief Record a request that got no response in time
+     * @param device Device index
+     */
+    void RecordTimeout(size_t device);
+
+    /**
+     * @brief Record a send error or dropped connection
+     * @param device Device index
+     */
+    void RecordFailure(size_t device);
+
+    /**
+     * @brief Check whether a device is flagged slow
+     * @param device Device index
+     * @return true if flagged
+     */
+    bool IsSlow(size_t device) const;
+
+    /**
+     * @brief Get one device's statistics
+     * @param device Device index
+     * @return Statistics; empty if the index is unknown
+     */
+    ModbusDeviceStats GetDeviceStats(size_t device) const;
+
+    /**
+     * @brief Get every device's statistics
+     * @return Statistics in device order
+     */
+    std::vector<ModbusDeviceStats> GetAllStats() const;
+
+    /**
+     * @brief Format a status table, one line per device, with a diagnosis
+     * @return Status text
+     */
+    std::string FormatStatus() const;
+
+    /**
+     * @brief Export per-device series labelled device="ip:port"
+     * @param registry Registry that outlives this tracker
+     */
+    void RegisterMetrics(MetricsRegistry& registry);
+
+    /**
+     * @brief Get RTT histogram bucket bounds
+     * @return Ascending upper bounds in microseconds
+     */
+    const std::vector<double>& GetRttBounds() const;
+
+private:
+    /**
+     * @brief Update latency figures and the slow flag with one RTT sample
+     * @param device Device
+     * @param rttMicros Round-trip time
+     */
+    void AddRttSample(Device& device, double rttMicros);
+
+    /**
+     * @brief Update the recent timeout and busy rates with one request outcome
+     * @param device Device
+     * @param timedOut true for a timeout
+     * @param busy true for a busy exception
+     */
+    void AddOutcome(Device& device, bool timedOut, bool busy);
+
+    /**
+     * @brief Register one device's series
+     * @param device Device
+     */
+    void RegisterDevice(Device& device);
+
+    /**
+     * @brief Estimate a percentile from the RTT histogram
+     * @param device Device
+     * @param fraction Percentile as a fraction, e.g. 0.99
+     * @return Upper bound of the bucket holding the percentile
+     */
+    double Percentile(const Device& device, double fraction) const;
+};
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+/**
+ * @brief Platform socket definitions shared by the network components
+ *
+ * Windows builds use Winsock directly; POSIX builds map the Winsock names
+ * used throughout the code base onto BSD sockets.
+ */
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+#else
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+
+namespace Nuclear {
+
+using SOCKET = int;
+
+static constexpr SOCKET INVALID_SOCKET = -1;
+static constexpr int SOCKET_ERROR = -1;
+
+inline int closesocket(SOCKET socket) {
+    return ::close(socket);
+}
+
+} // namespace Nuclear
+#endif
\ No newline at end of file
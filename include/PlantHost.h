@@ -0,0 +1,179 @@
+#pragma once
+
+#include "PlantMonitor.h"
+#include "SocketManager.h"
+#include "SubscriptionRouter.h"
+#include "ThreadPool.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+
+namespace Nuclear {
+
+/**
+ * @brief Runs several units' PlantMonitors in one process
+ *
+ * Each plant keeps its own sensor reader, processor, configuration and
+ * monitoring thread, pinned to its own core. The plants share one network
+ * front-end, which routes each plant's reports only to clients that sent
+ * "SUBSCRIBE <plantId>", and one worker pool sized for all of them.
+ * "SUBSCRIBE_DELTA [plantId]" routes that plant's binary delta feed to the
+ * client instead, so a FleetAggregator can read a hosted plant.
+ */
+class PlantHost {
+public:
+    struct PlantConfig {
+        std::string configFile;
+        int scanIntervalMs = 1000;
+        int core = AUTO_CORE;           // AUTO_CORE, NO_PINNING or a core index
+    };
+
+    static constexpr int AUTO_CORE = -1;    // Next core after the front-end's
+    static constexpr int NO_PINNING = -2;
+
+private:
+    struct HostedPlant {
+        std::unique_ptr<PlantMonitor> monitor;
+        PlantConfig config;
+    };
+
+    std::vector<HostedPlant> m_plants;
+    std::unique_ptr<SocketManager> m_frontEnd;
+    SubscriptionRouter m_router;
+    std::unique_ptr<ThreadPool> m_workers;
+    std::atomic<bool> m_running;
+    mutable std::mutex m_hostMutex;
+
+    // Worker pool sizing: off-cycle work per plant plus front-end traffic
+    static constexpr size_t WORKERS_PER_PLANT = 1;
+    static constexpr size_t FRONT_END_WORKERS = 2;
+    static constexpr size_t MAX_QUEUED_PER_WORKER = 256;
+
+public:
+    /**
+     * @brief Constructor
+     * @param frontEnd Socket manager shared by every hosted plant
+     */
+    explicit PlantHost(std::unique_ptr<SocketManager> frontEnd);
+
+    /**
+     * @brief Destructor - stops every plant and the front-end
+     */
+    ~PlantHost();
+
+    PlantHost(const PlantHost&) = delete;
+    PlantHost& operator=(const PlantHost&) = delete;
+
+    /**
+     * @brief Add a plant to host
+     * @param monitor Plant monitor, normally constructed without a socket manager
+     * @param config Configuration file, scan interval and core for this plant
+     * @return false if running, monitor is null or its plant ID is already hosted
+     */
+    bool AddPlant(std::unique_ptr<PlantMonitor> monitor, const PlantConfig& config);
+
+    /**
+     * @brief Start the front-end, the shared pool and every plant
+     * @return true if all plants started; on failure everything started is stopped again
+     */
+    bool Start();
+
+    /**
+     * @brief Stop every plant, then the front-end and the shared pool
+     */
+    void Stop();
+
+    /**
+     * @brief Check if the host is running
+     * @return true between a successful Start and Stop
+     */
+    bool IsRunning() const;
+
+    /**
+     * @brief Get number of hosted plants
+     * @return Plant count
+     */
+    size_t GetPlantCount() const;
+
+    /**
+     * @brief Find a hosted plant
+     * @param plantId Plant identifier
+     * @return Plant monitor, or nullptr if not hosted
+     */
+    PlantMonitor* GetPlant(const std::string& plantId) const;
+
+    /**
+     * @brief Get status of every hosted plant
+     * @return JSON object with one status entry per plant
+     */
+    std::string GetStatus() const;
+
+    /**
+     * @brief Get the subscription router of the shared front-end
+     * @return Router
+     */
+    const SubscriptionRouter& GetRouter() const;
+
+    /**
+     * @brief Worker shards needed for a number of plants
+     * @param plantCount Hosted plants
+     * @return Shard count, capped at the core count
+     */
+    static size_t WorkerShardCount(size_t plantCount);
+
+    /**
+     * @brief Core a plant is pinned to
+     * @param config Plant configuration
+     * @param plantIndex Position of the plant in the host
+     * @return Core index, or -1 for no pinning
+     *
+     * AUTO_CORE spreads plants round-robin over cores 1..N-1, leaving core 0
+     * to the front-end and the shared pool.
+     */
+    static int ResolveCore(const PlantConfig& config, size_t plantIndex);
+
+private:
+    /**
+     * @brief Handle data received by the shared front-end
+     * @param clientId Client identifier
+     * @param data Received data
+     */
+    void HandleClientData(const std::string& clientId, const std::string& data);
+
+    /**
+     * @brief Send a plant's report to its subscribers
+     * @param plantId Publishing plant
+     * @param data Report payload
+     * @return Number of clients the data was sent to
+     *
+     * Subscriptions are dropped by the front-end's disconnect handler; a
+     * subscriber found unreachable here before that runs is removed as well.
+     */
+    int PublishPlantData(const std::string& plantId, const std::string& data);
+
+    /**
+     * @brief Send a plant's delta frame to its delta feed subscribers
+     * @param plantId Publishing plant
+     * @param frame Encoded SnapshotDeltaEncoder frame
+     * @return Number of clients the frame was sent to
+     */
+    int PublishDeltaFrame(const std::string& plantId, const std::string& frame);
+
+    /**
+     * @brief Send data to every client on one feed of a plant
+     * @param plantId Publishing plant
+     * @param data Payload
+     * @param feed Feed whose subscribers receive it
+     * @return Number of clients the data was sent to
+     */
+    int PublishToFeed(const std::string& plantId, const std::string& data, SubscriptionRouter::Feed feed);
+
+    /**
+     * @brief Stop plants that were started (caller holds m_hostMutex)
+     */
+    void StopPlants();
+};
+
+} // namespace Nuclear
\ No newline at end of file
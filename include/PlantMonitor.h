@@ -4,11 +4,22 @@
 #include "IDataProcessor.h"
 #include "ISecurityManager.h"
 #include "SocketManager.h"
+#include "SequenceOfEventsRecorder.h"
+#include "BurstCapture.h"
+#include "RecordedSensorReader.h"
+#include "Clock.h"
+#include "SnapshotDeltaCodec.h"
+#include "StateReplication.h"
+#include "AlarmJournal.h"
+#include "MetricsRegistry.h"
+#include "ScanTracer.h"
 #include <memory>
 #include <string>
 #include <atomic>
+#include <mutex>
 #include <thread>
 #include <chrono>
+#include <functional>
 
 namespace Nuclear {
 
@@ -23,6 +34,16 @@ namespace Nuclear {
  * - Dependency Inversion: Depends on abstractions, not concretions
  */
 class PlantMonitor {
+public:
+    using Publisher = std::function<int(const std::string& plantId, const std::string& data)>;
+    
+    struct ReplayStatistics {
+        uint64_t scansReplayed;
+        double scansPerSecond;       // Wall-clock throughput of the full pipeline
+        double speedup;              // Requested speedup; 0 means unthrottled
+        bool finished;
+    };
+
 private:
     std::unique_ptr<ISensorReader> m_sensorReader;
     std::unique_ptr<IDataProcessor> m_dataProcessor;
@@ -33,6 +54,68 @@ private:
     std::unique_ptr<std::thread> m_monitoringThread;
     std::chrono::milliseconds m_scanInterval;
     
+    // Scan plan keyed on the sensor reader's channel set version
+    std::shared_ptr<const ChannelSet> m_channelSet;
+    uint64_t m_channelSetVersion;
+    SensorSnapshot m_snapshot;          // Filled by one ISensorReader::ReadSnapshot call per scan
+    
+    // Microsecond-ordered alarm and channel transitions, frozen around trips
+    SequenceOfEventsRecorder m_eventRecorder;
+    std::string m_eventDumpDirectory;
+    
+    // Transient capture: per device group, fed every scan, polled at burst rate once triggered
+    std::vector<std::unique_ptr<BurstCapture>> m_burstCaptures;
+    std::vector<std::chrono::steady_clock::time_point> m_burstNextSample;   // Per group, while capturing
+    std::vector<double> m_burstValues;
+    std::vector<SensorQuality> m_burstQuality;
+    std::string m_burstDirectory;
+    
+    // Binary delta feed for clients that sent "SUBSCRIBE_DELTA" (e.g. a FleetAggregator)
+    SnapshotDeltaEncoder m_deltaEncoder;        // Forced to a keyframe when a subscriber joins
+    std::vector<uint8_t> m_deltaFrame;
+    std::vector<std::string> m_deltaSubscribers;
+    std::mutex m_deltaMutex;
+    Publisher m_deltaPublisher;                 // Replaces m_deltaSubscribers sends when set
+    bool m_deltaKeyframeDue;                    // Guarded by m_deltaMutex
+    
+    // Multi-plant hosting: pipeline core, shared front-end and shared workers (all optional)
+    int m_coreAffinity;                 // -1 leaves the monitoring thread unpinned
+    Publisher m_publisher;              // Replaces m_socketManager broadcasts when set
+    ThreadPool* m_workerPool;           // Non-owning; off-cycle work keyed by plant ID
+    
+    // Hot standby: per-scan state handed to the replicator after processing (optional)
+    std::unique_ptr<StateReplicator> m_replicator;
+    ReplicatedState m_replicatedState;          // Reused every scan to avoid reallocation
+    
+    // Crash-safe record of alarm transitions and operator acknowledgments (optional)
+    std::unique_ptr<AlarmJournal> m_alarmJournal;
+    
+    // Prometheus metrics, updated lock-free on the scan path; all null until RegisterMetrics
+    struct ScanMetrics {
+        MetricHistogram* acquireSeconds;        // Sensor read
+        MetricHistogram* processSeconds;        // Validation, thresholds and anomaly detection
+        MetricHistogram* publishSeconds;        // Broadcast, delta feed and replication hand-off
+        MetricHistogram* cycleSeconds;          // Whole cycle
+        MetricCounter* overruns;                // Cycles longer than the scan interval
+        MetricCounter* publishDrops;            // Broadcasts that reached no client
+    };
+    ScanMetrics m_scanMetrics;
+    
+    // Span traces of cycles that overrun; Mode::Off until EnableScanTracing
+    ScanTracer m_scanTracer;
+    
+    // Time source, read once per cycle into a CycleContext shared down the pipeline
+    std::shared_ptr<IClock> m_clock;
+    uint64_t m_cycleNumber;
+    
+    // Historian replay: scans come from a recording and time follows the recorded timestamps
+    RecordedSensorReader* m_replayReader;                        // Non-owning view of m_sensorReader
+    double m_replaySpeedup;
+    std::shared_ptr<VirtualClock> m_replayClock;                 // Set to the recorded time of each scan
+    std::chrono::steady_clock::time_point m_replayStarted;
+    std::atomic<uint64_t> m_replayScans;
+    std::atomic<bool> m_replayFinished;
+    
     // Configuration
     std::string m_plantId;
     std::string m_configFile;
@@ -43,7 +126,8 @@ public:
      * @param sensorReader Interface for reading sensor data
      * @param dataProcessor Interface for processing data
      * @param securityManager Interface for security operations
-     * @param socketManager Socket manager for network communication
+     * @param socketManager Socket manager for network communication; may be
+     *        nullptr when a PlantHost front-end publishes for this plant
      * @param plantId Unique identifier for this plant
      */
     PlantMonitor(std::unique_ptr<ISensorReader> sensorReader,
@@ -71,6 +155,25 @@ public:
      */
     bool StartMonitoring(int scanIntervalMs = 1000);
     
+    /**
+     * @brief Start replaying a recording through the full processing pipeline
+     * @param speedup Replay rate relative to recorded time (e.g. 10 to 1000); 0 runs unthrottled
+     * @return false if the sensor reader is not a RecordedSensorReader or monitoring is running
+     *
+     * MonitoringLoop runs in virtual clock mode: a VirtualClock replaces the
+     * monitor's clock, each cycle advances the recording by one scan and sets
+     * the clock to its recorded time, and the wait between cycles is the
+     * recorded interval divided by speedup. Monitoring stops by itself when
+     * the recording is exhausted.
+     */
+    bool StartReplay(double speedup);
+    
+    /**
+     * @brief Get replay progress and throughput
+     * @return Replay statistics; zeros if no replay has run
+     */
+    ReplayStatistics GetReplayStatistics() const;
+    
     /**
      * @brief Stop monitoring operations
      */
@@ -79,12 +182,18 @@ public:
     /**
      * @brief Get current system status
      * @return JSON string containing system status
+     *
+     * Includes the sensor reader's per-device report (GetDeviceStatus) so
+     * a slow or unreachable PLC can be told apart from a network problem.
      */
     std::string GetSystemStatus() const;
     
     /**
      * @brief Perform emergency shutdown
      * @param reason Reason for emergency shutdown
+     *
+     * Triggers the sequence-of-events recorder; the pre/post-trip window is
+     * written to the event dump directory by the recorder's own thread.
      */
     void EmergencyShutdown(const std::string& reason);
     
@@ -100,6 +209,151 @@ public:
      */
     void SetScanInterval(int intervalMs);
     
+    /**
+     * @brief Add a device group for trigger-driven burst capture
+     * @param sensorIds Channels of the device group
+     * @param triggers Level crossings that start a burst
+     * @param config Burst sample interval, duration and pre-trigger depth
+     * @return false if monitoring is running, the group is empty or has more
+     *         than BurstCapture::MAX_CHANNELS channels, or the config is invalid
+     *
+     * When a trigger fires, the group alone is polled at the burst interval
+     * through ISensorReader::ReadChannels until the capture completes. Burst
+     * samples are interleaved with normal scans on the monitoring thread, so
+     * plant-wide scanning keeps its cadence during a burst. Completed
+     * captures are written to the burst directory in BurstCapture's binary format.
+     */
+    bool AddBurstGroup(const std::vector<int>& sensorIds, const std::vector<BurstTrigger>& triggers,
+                       const BurstCapture::Config& config = BurstCapture::DefaultConfig());
+    
+    /**
+     * @brief Get the sequence-of-events recorder
+     * @return Recorder fed by acquisition and the alarm path
+     */
+    SequenceOfEventsRecorder& GetEventRecorder();
+    
+    /**
+     * @brief Pin the monitoring thread to one core
+     * @param core Zero-based core index, or -1 to leave the thread unpinned
+     * @return false if monitoring is running
+     *
+     * Applied by the monitoring thread itself when it starts, so the whole
+     * acquisition/processing pipeline of this plant stays on that core.
+     */
+    bool SetCoreAffinity(int core);
+    
+    /**
+     * @brief Route status reports through a shared front-end instead of the own socket manager
+     * @param publisher Called once per report with this plant's ID; nullptr restores direct broadcast
+     * @return false if monitoring is running
+     */
+    bool SetPublisher(Publisher publisher);
+    
+    /**
+     * @brief Route the binary delta feed through a shared front-end
+     * @param publisher Called once per encoded frame with this plant's ID; nullptr restores direct sends
+     * @return false if monitoring is running
+     *
+     * The front-end owns the delta subscriber list; it calls
+     * RequestDeltaKeyframe when a client joins.
+     */
+    bool SetDeltaPublisher(Publisher publisher);
+    
+    /**
+     * @brief Make the next delta frame a keyframe (thread-safe)
+     *
+     * Called by the shared front-end when a client joins this plant's delta
+     * feed, so it starts from a full snapshot.
+     */
+    void RequestDeltaKeyframe();
+    
+    /**
+     * @brief Run off-cycle work (event dumps, burst file writes) on a shared pool
+     * @param pool Pool that outlives this monitor, or nullptr to run it on the monitoring thread
+     * @return false if monitoring is running
+     *
+     * Tasks are submitted with SubmitTo keyed on the plant ID, so one
+     * plant's files are written in order.
+     */
+    bool SetWorkerPool(ThreadPool* pool);
+    
+    /**
+     * @brief Replace the clock read at the start of each monitoring cycle
+     * @param clock Clock to read; nullptr restores the system clock
+     * @return false if monitoring is running
+     *
+     * The socket manager is given the same clock, so heartbeats and idle
+     * timeouts follow it too. Use a VirtualClock for deterministic tests.
+     */
+    bool SetClock(std::shared_ptr<IClock> clock);
+    
+    /**
+     * @brief Stream per-scan state to a hot standby
+     * @param config Replication endpoint and heartbeat interval
+     * @return false if monitoring is running or the endpoint cannot be bound
+     *
+     * After each processed scan the last values, alarm states and detector
+     * state are handed to a StateReplicator; the monitoring thread only
+     * copies them into its staging slot. Once a standby that took over
+     * fences the replicator, the monitoring thread leaves its loop at the
+     * next scan, so a primary cut off by a partition steps down when it
+     * heals instead of running beside its replacement.
+     */
+    bool EnableReplication(const StateReplicator::Config& config);
+    
+    /**
+     * @brief Seed a standby that is taking over with the primary's last state
+     * @param state State from StandbyReceiver's takeover handler
+     * @return false if monitoring is running or the state does not fit this configuration
+     *
+     * Restores alarm states and detector state so the first scans after
+     * takeover neither re-announce active alarms nor restart warm-up.
+     */
+    bool RestoreState(const ReplicatedState& state);
+    
+    /**
+     * @brief Journal alarm transitions and acknowledgments, restoring alarm state from it
+     * @param path Journal file; created if missing
+     * @param config Commit interval and sync policy
+     * @return false if monitoring is running or the journal cannot be opened
+     *
+     * Alarms active or unacknowledged at the end of the replay are restored
+     * before the first scan, so a restart neither loses nor re-announces them.
+     */
+    bool EnableAlarmJournal(const std::string& path, const AlarmJournal::Config& config = AlarmJournal::DefaultConfig());
+    
+    /**
+     * @brief Register this plant's metrics for scraping
+     * @param registry Registry served by a MetricsServer; must outlive the monitor
+     * @return false if monitoring is running
+     *
+     * Adds per-stage scan latency histograms and overrun/drop counters,
+     * updated on the scan path with relaxed atomics, and scrape-time
+     * functions over DataProcessor::GetStatistics,
+     * SecurityManager::GetSecurityStats, SocketManager::GetClientCount and
+     * the journal and replicator statistics if they were enabled first, and
+     * forwards to the sensor reader for per-device Modbus series. Every
+     * series carries a plant label, so hosted units can share one registry.
+     */
+    bool RegisterMetrics(MetricsRegistry& registry);
+    
+    /**
+     * @brief Capture span traces of cycles that overrun
+     * @param config Mode and overrun threshold; Mode::Off disables tracing
+     * @return false if monitoring is running
+     *
+     * Captured cycles are kept in memory until DumpScanTraces; see
+     * ScanTracer for the overhead when no cycle overruns.
+     */
+    bool EnableScanTracing(const ScanTracer::Config& config);
+    
+    /**
+     * @brief Write captured cycles as a Chrome trace
+     * @param path Trace file to create; open in chrome://tracing or Perfetto
+     * @return false if the file cannot be written
+     */
+    bool DumpScanTraces(const std::string& path) const;
+    
     /**
      * @brief Get plant identifier
      * @return Plant ID string
@@ -109,14 +363,76 @@ public:
 private:
     /**
      * @brief Main monitoring loop (runs in separate thread)
+     *
+     * Sleeps until the earlier of the next scan and the next burst sample
+     * returned by ServiceBurstCaptures, so bursts never delay a scan by
+     * more than one group read. In replay mode the loop is paced by
+     * recorded timestamps rather than m_scanInterval, and exits when the
+     * recording is exhausted.
      */
     void MonitoringLoop();
     
+    /**
+     * @brief Read the clock once and number the next cycle
+     * @return Context passed to every stage of the cycle
+     */
+    CycleContext BeginCycle();
+    
     /**
      * @brief Perform single monitoring cycle
+     * @param cycle Time of this cycle; no stage reads the clock itself
      * @return true if cycle completed successfully
+     *
+     * The whole scan is acquired through a single ReadSnapshot call on the
+     * current channel set; per-sensor reads are not used on this path.
+     *
+     * Fixed-point channels stay in counts for the whole cycle: the
+     * threshold kernels compare counts, and voting, group aggregation,
+     * anomaly detection, derived channels and recording take m_snapshot
+     * and read single channels through EngineeringValue. Only the report
+     * path (ToReadings and GenerateMonitoringReport) converts the scan.
+     *
+     * The cycle is bracketed by m_scanTracer.BeginCycle/EndCycle and its
+     * stages are ScopedSpans: "acquire", "process" (with "validate",
+     * "thresholds", "anomaly" and "alarms" inside), "encode", "encrypt",
+     * "broadcast" and "replicate". Spans cost a branch while tracing is off.
+     */
+    bool PerformMonitoringCycle(const CycleContext& cycle);
+    
+    /**
+     * @brief Feed one scan to every armed burst group
+     * @param readings Readings of the scan just acquired
+     *
+     * Never blocks: a group whose trigger fires is only scheduled here
+     * (m_burstNextSample) and sampled by ServiceBurstCaptures.
+     */
+    void ProcessBurstCaptures(const std::vector<SensorReading>& readings);
+    
+    /**
+     * @brief Take one burst sample from every capturing group that is due
+     * @param now Current time
+     * @return Earliest next burst sample, or time_point::max() if none is capturing
+     *
+     * Each due group costs one ReadChannels call. A completed capture is
+     * persisted (on the worker pool when set) and the group re-armed.
+     */
+    std::chrono::steady_clock::time_point ServiceBurstCaptures(std::chrono::steady_clock::time_point now);
+    
+    /**
+     * @brief Re-fetch channel set and rebuild scan plan if its version changed
+     * @return true if the scan plan was rebuilt
+     *
+     * Called at the start of every cycle; costs one atomic load when the
+     * channel set is unchanged.
+     */
+    bool RefreshScanPlan();
+    
+    /**
+     * @brief Advance the replay by one scan and compute the wait before the next
+     * @param wait Wall-clock time to wait before the next cycle
+     * @return false when the recording is exhausted
      */
-    bool PerformMonitoringCycle();
+    bool AdvanceReplay(std::chrono::steady_clock::duration& wait);
     
     /**
      * @brief Load configuration from file
@@ -129,6 +445,10 @@ private:
      * @brief Handle data received from network clients
      * @param clientId Client identifier
      * @param data Received data
+     *
+     * "SUBSCRIBE_DELTA" moves the client from JSON reports to the binary
+     * SnapshotDeltaEncoder feed, starting with a keyframe. "ACK <alarmId>"
+     * is journaled and confirmed only once the journal reports it durable.
      */
     void HandleClientData(const std::string& clientId, const std::string& data);
     
@@ -142,9 +462,18 @@ private:
      * @brief Generate monitoring report
      * @param processedData Processed sensor data
      * @return JSON formatted report
+     *
+     * Fixed-point channels are converted to engineering units here, not
+     * at acquisition.
      */
     std::string GenerateMonitoringReport(const ProcessedData& processedData) const;
     
+    /**
+     * @brief Write a frozen sequence-of-events capture (runs on the recorder thread)
+     * @param capture Events around the trigger
+     */
+    void DumpEventCapture(const SequenceCapture& capture) const;
+    
     /**
      * @brief Log system event
      * @param level Log level (INFO, WARNING, ERROR, CRITICAL)
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "ISensorReader.h"
+#include "ScanRecording.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include <mutex>
+
+namespace Nuclear {
+
+/**
+ * @brief ISensorReader that serves whole snapshots from a scan recording
+ *
+ * Used for historian replay: each AdvanceScan() loads the next recorded
+ * scan, and every read until the next advance is answered from it, so the
+ * real DataProcessor/alarm/report pipeline sees exactly what was recorded.
+ * Recorded quality flags are preserved; an unrecorded sensor reads -1.
+ * Group reads also compare the requested kind with the recorded one, and a
+ * channel recorded as a different kind reads as unrecorded (COMM_FAIL).
+ */
+class RecordedSensorReader : public ISensorReader {
+private:
+    ScanRecordingReader m_reader;
+    std::shared_ptr<const ChannelSet> m_channelSet;
+
+    SensorSnapshot m_current;
+    bool m_hasScan;
+    bool m_exhausted;
+    uint64_t m_scansServed;
+    mutable std::mutex m_mutex;
+
+public:
+    RecordedSensorReader();
+
+    /**
+     * @brief Open a recording
+     * @param path Recording written by ScanRecordingWriter
+     * @return false if the file cannot be read
+     */
+    bool Open(const std::string& path);
+
+    /**
+     * @brief Load the next recorded scan
+     * @return false once the recording is exhausted
+     */
+    bool AdvanceScan();
+
+    /**
+     * @brief Restart from the first recorded scan
+     */
+    void Rewind();
+
+    /**
+     * @brief Get the scan currently being served
+     * @return Copy of the current snapshot
+     */
+    SensorSnapshot GetCurrentSnapshot() const;
+
+    /**
+     * @brief Check whether every recorded scan has been served
+     * @return true after AdvanceScan has returned false
+     */
+    bool IsExhausted() const;
+
+    /**
+     * @brief Get number of scans served since Open or Rewind
+     * @return Scan count
+     */
+    uint64_t GetScansServed() const;
+
+    // ISensorReader interface implementation
+    double ReadTemperature(int sensorId) const override;
+    double ReadPressure(int sensorId) const override;
+    double ReadRadiationLevel(int sensorId) const override;
+    bool IsSensorOnline(int sensorId) const override;
+    std::vector<int> GetAvailableSensors() const override;
+    std::shared_ptr<const ChannelSet> GetChannelSet() const override;
+    size_t ReadChannels(const std::vector<int>& sensorIds, const std::vector<SensorKind>& kinds,
+                        double* values, SensorQuality* quality) const override;
+
+    /**
+     * @brief Copy the current scan into a snapshot
+     * @param channels Channel set to read
+     * @param snapshot Output snapshot
+     * @return Number of channels with usable recorded quality
+     *
+     * When the set matches the recording's layout the value and quality
+     * columns are copied whole; otherwise each channel is looked up.
+     */
+    size_t ReadSnapshot(const ChannelSet& channels, SensorSnapshot& snapshot) const override;
+
+private:
+    /**
+     * @brief Look up a sensor in the current scan (caller holds m_mutex)
+     * @param sensorId Sensor identifier
+     * @param channel Channel index on success
+     * @return true if the sensor is recorded and a scan is loaded
+     */
+    bool FindCurrent(int sensorId, size_t& channel) const;
+
+    /**
+     * @brief Look up a sensor of a given kind in the current scan (caller holds m_mutex)
+     * @param sensorId Sensor identifier
+     * @param kind Kind the caller expects
+     * @param channel Channel index on success
+     * @return false also when the sensor was recorded as a different kind
+     */
+    bool FindCurrent(int sensorId, SensorKind kind, size_t& channel) const;
+
+    /**
+     * @brief Read a recorded value
+     * @param sensorId Sensor identifier
+     * @return Recorded value, or -1 if the sensor is not recorded
+     */
+    double ReadRecorded(int sensorId) const;
+};
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "SensorQuality.h"
+#include "SensorSnapshot.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace Nuclear {
+
+/**
+ * @brief Survivor selected when a redundancy group has lost a channel
+ */
+enum class DegradedSelect : uint8_t {
+    High = 0,   // Highest survivor; trips if either exceeds a high setpoint
+    Low = 1     // Lowest survivor; for quantities that trip on a low setpoint
+};
+
+/**
+ * @brief Redundant channels voted into a single value
+ */
+struct RedundancyGroup {
+    int groupId;                      // Identifier reported with the voted value
+    SensorKind kind;                  // Quantity measured, selects the alarm threshold
+    std::vector<size_t> channels;     // Two or three redundant channel indices
+    double discrepancyTolerance;      // Maximum spread between usable channels
+    DegradedSelect degradedSelect = DegradedSelect::High;
+};
+
+/**
+ * @brief Median-select / 2-out-of-3 voting over redundancy groups
+ *
+ * Groups are compiled into flat per-slot index and mask arrays so each scan
+ * is a gather followed by one branch-free pass of min/max/select operations
+ * the compiler can vectorize. With every channel usable the vote is the
+ * median (2oo3) or, for two-channel groups, the mean. Once a channel is
+ * unusable the group degrades to 1oo2: the vote is the highest (or, per
+ * group, lowest) survivor, so either survivor alone can trip. Averaging the
+ * survivors instead would hide one reading beyond the setpoint.
+ *
+ * Not thread-safe; owned by the processing pass.
+ */
+class RedundancyVoter {
+public:
+    struct Statistics {
+        size_t groupsVoted;
+        size_t degradedGroups;     // Fewer than all channels usable
+        size_t failedGroups;       // No usable channel
+        size_t discrepancies;      // Spread above tolerance
+    };
+
+private:
+    std::vector<RedundancyGroup> m_groups;
+    size_t m_channelCount;
+
+    // Compiled slot arrays, one entry per group
+    std::vector<size_t> m_indexA;
+    std::vector<size_t> m_indexB;
+    std::vector<size_t> m_indexC;
+    std::vector<uint8_t> m_hasC;
+    std::vector<uint8_t> m_selectLow;
+    std::vector<double> m_tolerance;
+    std::vector<uint8_t> m_isMember;   // Per channel: belongs to a group
+
+    // Gather buffers reused across scans
+    std::vector<double> m_a;
+    std::vector<double> m_b;
+    std::vector<double> m_c;
+    std::vector<double> m_maskA;
+    std::vector<double> m_maskB;
+    std::vector<double> m_maskC;
+
+    // Results, one entry per group
+    std::vector<double> m_voted;
+    std::vector<SensorQuality> m_votedQuality;
+    std::vector<uint8_t> m_discrepancy;
+
+    Statistics m_statistics;
+
+public:
+    RedundancyVoter();
+
+    /**
+     * @brief Compile redundancy groups for a channel layout
+     * @param groups Groups to vote; groups with fewer than two valid channels, a
+     *        channel listed twice, or a member of another kind are dropped
+     * @param kinds Sensor kind of every channel in the value arrays passed to Vote
+     * @return Number of groups accepted
+     */
+    size_t Configure(std::vector<RedundancyGroup> groups, const std::vector<SensorKind>& kinds);
+
+    /**
+     * @brief Vote every group for one scan
+     * @param snapshot Scan in the configured layout; fixed-point channels are read in engineering units
+     * @return Number of groups whose spread exceeds tolerance
+     */
+    size_t Vote(const SensorSnapshot& snapshot);
+
+    /**
+     * @brief Get configured groups in result order
+     * @return Redundancy groups
+     */
+    const std::vector<RedundancyGroup>& GetGroups() const;
+
+    /**
+     * @brief Get voted values from the last Vote call
+     * @return One value per group (NaN if no channel was usable)
+     */
+    const std::vector<double>& GetVotedValues() const;
+
+    /**
+     * @brief Get voted quality from the last Vote call
+     * @return GOOD with all channels usable, SUBSTITUTED when degraded, COMM_FAIL when none usable
+     */
+    const std::vector<SensorQuality>& GetVotedQuality() const;
+
+    /**
+     * @brief Get discrepancy flags from the last Vote call
+     * @return Non-zero per group whose usable channels disagree beyond tolerance
+     */
+    const std::vector<uint8_t>& GetDiscrepancies() const;
+
+    /**
+     * @brief Check whether a channel is voted (and so not alarmed individually)
+     * @param channel Channel index
+     * @return true if channel belongs to a redundancy group
+     */
+    bool IsVotedChannel(size_t channel) const;
+
+    /**
+     * @brief Get cumulative voting statistics
+     * @return Statistics since construction or last Configure
+     */
+    Statistics GetStatistics() const;
+};
+
+} // namespace Nuclear
\ No newline at end of file
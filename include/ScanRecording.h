@@ -0,0 +1,185 @@
+#pragma once
+
+#include "SensorSnapshot.h"
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdint>
+
+namespace Nuclear {
+
+/**
+ * @brief One chunk of a scan recording, still in its encoded form
+ *
+ * Within a chunk data is stored column-wise: scan numbers, timestamps, then
+ * for each channel its values followed by its quality bytes. Any channel can
+ * therefore be decoded independently, which lets exporters decode channels
+ * in parallel without touching the rest of the chunk.
+ */
+struct ScanChunk {
+    size_t scanCount = 0;
+    size_t channelCount = 0;
+    std::vector<uint8_t> payload;
+
+    /**
+     * @brief Decode scan numbers and timestamps
+     * @param scanNumbers Output, scanCount entries
+     * @param timestampsUs Output microseconds since the Unix epoch, scanCount entries
+     */
+    void DecodeTimes(uint64_t* scanNumbers, int64_t* timestampsUs) const;
+
+    /**
+     * @brief Decode one channel's column
+     * @param channel Channel index
+     * @param values Output, scanCount entries
+     * @param quality Output, scanCount entries
+     */
+    void DecodeChannel(size_t channel, double* values, SensorQuality* quality) const;
+
+    /**
+     * @brief Payload size for a chunk of the given shape
+     * @param scans Scans in the chunk
+     * @param channels Channels per scan
+     * @return Payload bytes
+     */
+    static size_t PayloadSize(size_t scans, size_t channels);
+};
+
+/**
+ * @brief Appends snapshots to a chunked scan recording file
+ *
+ * Snapshots are buffered column-wise and written one chunk at a time, so
+ * recording costs one sequential write per chunk rather than per scan.
+ * Every snapshot must have the channel layout the file was opened with.
+ */
+class ScanRecordingWriter {
+private:
+    std::ofstream m_file;
+    std::vector<int> m_sensorIds;
+    std::vector<SensorKind> m_kinds;
+    size_t m_chunkScans;
+
+    // Pending chunk, channel-major
+    std::vector<uint64_t> m_scanNumbers;
+    std::vector<int64_t> m_timestamps;
+    std::vector<double> m_values;
+    std::vector<SensorQuality> m_quality;
+    size_t m_pendingScans;
+    uint64_t m_scansWritten;
+
+public:
+    static constexpr size_t DEFAULT_CHUNK_SCANS = 256;
+
+    ScanRecordingWriter();
+
+    /**
+     * @brief Destructor - flushes the pending chunk
+     */
+    ~ScanRecordingWriter();
+
+    /**
+     * @brief Create a recording file
+     * @param path Output file path; an existing file is replaced
+     * @param sensorIds Channel layout of every snapshot to be appended
+     * @param kinds Kind of each channel
+     * @param chunkScans Scans per chunk
+     * @return true if the file was created and the header written; false also when a
+     *         chunk of chunkScans scans would exceed the size a reader accepts
+     */
+    bool Open(const std::string& path, const std::vector<int>& sensorIds, const std::vector<SensorKind>& kinds,
+              size_t chunkScans = DEFAULT_CHUNK_SCANS);
+
+    /**
+     * @brief Append one snapshot
+     * @param snapshot Snapshot with the layout given to Open; fixed-point channels are stored converted
+     * @return false if the sensor IDs or kinds differ from Open's, or the write failed
+     */
+    bool Append(const SensorSnapshot& snapshot);
+
+    /**
+     * @brief Write the pending partial chunk
+     * @return true on success
+     */
+    bool Flush();
+
+    /**
+     * @brief Flush and close the file
+     */
+    void Close();
+
+    /**
+     * @brief Get number of scans appended
+     * @return Scan count
+     */
+    uint64_t GetScanCount() const;
+
+private:
+    /**
+     * @brief Encode and write the pending scans as one chunk
+     * @return true on success
+     */
+    bool WriteChunk();
+};
+
+/**
+ * @brief Reads a chunked scan recording, chunk by chunk or snapshot by snapshot
+ */
+class ScanRecordingReader {
+private:
+    std::ifstream m_file;
+    std::vector<int> m_sensorIds;
+    std::vector<SensorKind> m_kinds;
+    std::streampos m_dataStart;
+
+    // Chunk being served by ReadNext
+    ScanChunk m_chunk;
+    std::vector<uint64_t> m_scanNumbers;
+    std::vector<int64_t> m_timestamps;
+    std::vector<double> m_values;
+    std::vector<SensorQuality> m_quality;
+    size_t m_nextScan;
+
+public:
+    ScanRecordingReader();
+
+    /**
+     * @brief Open a recording and read its header
+     * @param path Recording file path
+     * @return false if the file is missing, not a scan recording, or names an unknown sensor kind
+     */
+    bool Open(const std::string& path);
+
+    /**
+     * @brief Get recorded channel layout
+     * @return Sensor IDs in channel order
+     */
+    const std::vector<int>& GetSensorIds() const;
+
+    /**
+     * @brief Get recorded channel kinds
+     * @return Kinds in channel order
+     */
+    const std::vector<SensorKind>& GetKinds() const;
+
+    /**
+     * @brief Read the next encoded chunk
+     * @param chunk Output chunk
+     * @return false at end of file, on a truncated chunk, or on a corrupt header
+     *         (no scans, or a payload larger than any writer produces)
+     */
+    bool ReadChunk(ScanChunk& chunk);
+
+    /**
+     * @brief Read the next snapshot
+     * @param snapshot Output snapshot; columns are reused across calls
+     * @return false at end of recording
+     */
+    bool ReadNext(SensorSnapshot& snapshot);
+
+    /**
+     * @brief Restart from the first scan
+     */
+    void Rewind();
+};
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <chrono>
+#include <iosfwd>
+#include <cstdint>
+#include <cstddef>
+
+namespace Nuclear {
+
+/**
+ * @brief One timed span of a traced cycle
+ */
+struct TraceSpan {
+    const char* name;           // Static string, e.g. "acquire"
+    const char* category;       // Static string, e.g. "scan"
+    int64_t startNs;            // Relative to the tracer's epoch
+    int64_t durationNs;
+    uint32_t threadId;          // Small per-thread number, stable for the process
+    uint32_t depth;             // Nesting depth on its thread; 0 is outermost
+};
+
+/**
+ * @brief Spans of one captured cycle
+ */
+struct CycleTrace {
+    uint64_t cycleNumber;
+    uint32_t threadId;          // Thread that opened and closed the cycle
+    int64_t startNs;
+    int64_t durationNs;
+    uint32_t spansDropped;      // Spans beyond maxSpansPerCycle
+    std::vector<TraceSpan> spans;
+};
+
+/**
+ * @brief Scoped timing traces of scan cycles that overrun
+ *
+ * Spans (see ScopedSpan) are recorded into a fixed per-cycle scratch area
+ * while a cycle is open. When the cycle ends it is kept only if it took
+ * longer than the overrun threshold, in which case its spans are copied into
+ * a ring of the most recent captured cycles; otherwise the scratch is simply
+ * reused. The cycle that overran is therefore traced in full, without
+ * having to catch the problem twice.
+ *
+ * With tracing off, a span costs one relaxed load and a branch: no clock is
+ * read and nothing is written. While tracing, a span is two steady_clock
+ * reads and one slot claimed with an atomic increment, so worker threads
+ * can record spans for the cycle too; their tasks must finish before
+ * EndCycle. Wall time is always steady_clock, never the plant's IClock, so
+ * traces stay meaningful under replay.
+ *
+ * Dumps use the Chrome trace event format (chrome://tracing, Perfetto).
+ */
+class ScanTracer {
+public:
+    enum class Mode {
+        Off,            // Spans are not recorded
+        Overruns,       // Cycles longer than overrunThreshold are kept
+        Always          // Every cycle is kept (ring holds the most recent)
+    };
+
+    struct Config {
+        Mode mode;
+        std::chrono::microseconds overrunThreshold;
+        size_t ringCycles;              // Captured cycles retained
+        size_t maxSpansPerCycle;        // Further spans in a cycle are counted as dropped
+    };
+
+    struct Statistics {
+        uint64_t cyclesTraced;          // Cycles opened while tracing
+        uint64_t cyclesCaptured;        // Cycles copied into the ring
+        uint64_t spansDropped;
+        double maxCycleMicros;
+        double lastCaptureMicros;       // Duration of the most recently captured cycle
+    };
+
+    static Config DefaultConfig() {
+        return Config{Mode::Overruns, std::chrono::microseconds(1000000), 16, 256};
+    }
+
+private:
+    Config m_config;
+    std::chrono::steady_clock::time_point m_epoch;
+
+    // Open cycle; written by span owners, read by EndCycle
+    std::atomic<bool> m_cycleOpen;
+    std::atomic<size_t> m_spanCount;
+    std::vector<TraceSpan> m_scratch;
+    uint64_t m_cycleNumber;
+    uint32_t m_cycleThreadId;
+    int64_t m_cycleStartNs;
+
+    // Captured cycles; oldest overwritten first
+    std::vector<CycleTrace> m_ring;
+    size_t m_ringNext;
+    size_t m_ringSize;
+    Statistics m_statistics;
+    mutable std::mutex m_ringMutex;
+
+public:
+    /**
+     * @brief Constructor
+     * @param config Mode, threshold and ring size
+     */
+    explicit ScanTracer(const Config& config = DefaultConfig());
+
+    ScanTracer(const ScanTracer&) = delete;
+    ScanTracer& operator=(const ScanTracer&) = delete;
+
+    /**
+     * @brief Change mode and threshold; the ring is cleared if its sizes change
+     * @param config New configuration
+     * @return false if a cycle is open
+     *
+     * Call from the thread that runs the cycles.
+     */
+    bool SetConfig(const Config& config);
+
+    /**
+     * @brief Get the configuration
+     * @return Configuration
+     */
+    const Config& GetConfig() const;
+
+    /**
+     * @brief Open a cycle; spans recorded until EndCycle belong to it
+     * @param cycleNumber Cycle identifier shown in the trace
+     */
+    void BeginCycle(uint64_t cycleNumber);
+
+    /**
+     * @brief Close the open cycle and keep it if it overran
+     * @return true if the cycle was captured
+     */
+    bool EndCycle();
+
+    /**
+     * @brief Check whether spans are being recorded
+     * @return true while a cycle is open and tracing is on
+     */
+    bool IsRecording() const { return m_cycleOpen.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Record a finished span (normally called by ScopedSpan)
+     * @param name Static span name
+     * @param category Static category
+     * @param start Span start
+     * @param end Span end
+     * @param depth Nesting depth on the calling thread
+     */
+    void RecordSpan(const char* name, const char* category, std::chrono::steady_clock::time_point start,
+                    std::chrono::steady_clock::time_point end, uint32_t depth);
+
+    /**
+     * @brief Copy the captured cycles
+     * @return Cycles, oldest first
+     */
+    std::vector<CycleTrace> GetCapturedCycles() const;
+
+    /**
+     * @brief Forget captured cycles
+     */
+    void ClearCaptured();
+
+    /**
+     * @brief Write captured cycles in Chrome trace event format
+     * @param out Output stream
+     * @return Number of cycles written
+     */
+    size_t WriteChromeTrace(std::ostream& out) const;
+
+    /**
+     * @brief Write captured cycles to a Chrome trace file
+     * @param path File to create; an existing file is replaced
+     * @return false if the file cannot be written
+     */
+    bool DumpChromeTrace(const std::string& path) const;
+
+    /**
+     * @brief Get tracing statistics
+     * @return Statistics snapshot
+     */
+    Statistics GetStatistics() const;
+
+    /**
+     * @brief Small number identifying the calling thread in traces
+     * @return Thread number, assigned on first use
+     */
+    static uint32_t CurrentThreadId();
+
+private:
+    /**
+     * @brief Nanoseconds since the tracer's epoch
+     * @param time Time point
+     * @return Offset in nanoseconds
+     */
+    int64_t ToNs(std::chrono::steady_clock::time_point time) const;
+};
+
+/**
+ * @brief RAII span: times the enclosing scope into the tracer's open cycle
+ *
+ * ScopedSpan span(m_tracer, "encrypt");
+ *
+ * Nested spans on one thread record their depth, which trace viewers show
+ * as a flame graph under the cycle.
+ */
+class ScopedSpan {
+private:
+    ScanTracer* m_tracer;
+    const char* m_name;
+    const char* m_category;
+    std::chrono::steady_clock::time_point m_start;
+
+    static thread_local uint32_t t_depth;
+
+public:
+    /**
+     * @brief Start a span if the tracer is recording
+     * @param tracer Tracer
+     * @param name Static span name
+     * @param category Static category
+     */
+    ScopedSpan(ScanTracer& tracer, const char* name, const char* category = "scan")
+        : m_tracer(tracer.IsRecording() ? &tracer : nullptr), m_name(name), m_category(category) {
+        if (m_tracer) {
+            m_start = std::chrono::steady_clock::now();
+            ++t_depth;
+        }
+    }
+
+    ~ScopedSpan() {
+        if (m_tracer) {
+            --t_depth;
+            m_tracer->RecordSpan(m_name, m_category, m_start, std::chrono::steady_clock::now(), t_depth);
+        }
+    }
+
+    ScopedSpan(const ScopedSpan&) = delete;
+    ScopedSpan& operator=(const ScopedSpan&) = delete;
+};
+
+} // namespace Nuclear
\ No newline at end of file
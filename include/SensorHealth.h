@@ -0,0 +1,146 @@
+#pragma once
+
+#include "SensorQuality.h"
+#include "SensorSnapshot.h"
+#include "SequenceOfEventsRecorder.h"
+#include <vector>
+#include <unordered_map>
+#include <chrono>
+#include <cstdint>
+
+namespace Nuclear {
+
+/**
+ * @brief Tracks per-channel sensor health and assigns quality flags during acquisition
+ *
+ * Health is derived from the outcome of the reads the scan already performs,
+ * so liveness never costs an extra round trip. State is stored column-wise by
+ * channel index; not thread-safe, owned by the acquiring thread.
+ */
+class SensorHealthTracker {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Config {
+        std::chrono::milliseconds staleAfter;  // Age after which a held value is STALE
+        bool substituteLastGood;               // Serve last good value on COMM_FAIL
+    };
+
+private:
+    Config m_config;
+
+    std::vector<int> m_sensorIds;
+    std::unordered_map<int, size_t> m_channelIndex;
+
+    std::vector<double> m_minValue;
+    std::vector<double> m_maxValue;
+    std::vector<double> m_lastGoodValue;
+    std::vector<Clock::time_point> m_lastGoodTime;
+    std::vector<uint8_t> m_hasGoodValue;
+    std::vector<uint8_t> m_online;
+    std::vector<SensorQuality> m_lastQuality;
+    std::vector<uint8_t> m_classified;           // Has a quality to transition from
+
+    SequenceOfEventsRecorder* m_eventRecorder;   // Optional; receives quality transitions
+
+public:
+    /**
+     * @brief Constructor with default 5 s staleness and substitution enabled
+     */
+    SensorHealthTracker();
+
+    /**
+     * @brief Set staleness and substitution policy
+     * @param config New configuration
+     */
+    void SetConfig(const Config& config);
+
+    /**
+     * @brief Record quality transitions into a sequence-of-events recorder
+     * @param recorder Recorder that outlives this tracker, or nullptr to stop recording
+     *
+     * A channel's first classification after Reset is its initial state, not
+     * a transition, and is not recorded.
+     */
+    void SetEventRecorder(SequenceOfEventsRecorder* recorder);
+
+    /**
+     * @brief Reset tracked channels
+     * @param sensorIds Sensor IDs in channel order
+     */
+    void Reset(const std::vector<int>& sensorIds);
+
+    /**
+     * @brief Set physical instrument range for a channel
+     * @param channel Channel index
+     * @param minValue Lowest physically possible value
+     * @param maxValue Highest physically possible value
+     */
+    void SetRange(size_t channel, double minValue, double maxValue);
+
+    /**
+     * @brief Classify one acquired sample
+     * @param channel Channel index
+     * @param readOk Whether the device answered
+     * @param value Acquired value; replaced by the held value when substituting
+     * @param now Acquisition time
+     * @return Quality flags for this sample
+     */
+    SensorQuality Classify(size_t channel, bool readOk, double& value, Clock::time_point now);
+
+    /**
+     * @brief Classify a whole snapshot in one pass
+     * @param snapshot Snapshot whose values (or counts, for fixed-point channels) and quality are updated
+     * @param readOk One entry per channel, non-zero if the device answered
+     * @param now Acquisition time
+     */
+    void ClassifySnapshot(SensorSnapshot& snapshot, const std::vector<uint8_t>& readOk, Clock::time_point now);
+
+    /**
+     * @brief Check whether a channel answered its last read
+     * @param channel Channel index
+     * @return true if the last read succeeded
+     */
+    bool IsOnline(size_t channel) const;
+
+    /**
+     * @brief Get quality assigned by the most recent Classify call
+     * @param channel Channel index
+     * @return Quality flags; COMM_FAIL if channel was never classified
+     */
+    SensorQuality GetLastQuality(size_t channel) const;
+
+    /**
+     * @brief Check whether a sensor answered its last read
+     * @param sensorId Sensor identifier
+     * @return true if sensor is tracked and its last read succeeded
+     */
+    bool IsSensorOnline(int sensorId) const;
+
+    /**
+     * @brief Get channel index for a sensor
+     * @param sensorId Sensor identifier
+     * @param channel Channel index on success
+     * @return true if sensor is tracked
+     */
+    bool FindChannel(int sensorId, size_t& channel) const;
+
+    /**
+     * @brief Get number of tracked channels
+     * @return Channel count
+     */
+    size_t GetChannelCount() const;
+
+private:
+    /**
+     * @brief Derive quality flags for one sample
+     * @param channel Channel index
+     * @param readOk Whether the device answered
+     * @param value Acquired value; replaced by the held value when substituting
+     * @param now Acquisition time
+     * @return Quality flags for this sample
+     */
+    SensorQuality Evaluate(size_t channel, bool readOk, double& value, Clock::time_point now);
+};
+
+} // namespace Nuclear
\ No newline at end of file
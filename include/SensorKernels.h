@@ -0,0 +1,430 @@
+#pragma once
+
+#include "SensorSnapshot.h"
+#include "SensorQuality.h"
+#include <array>
+#include <memory>
+#include <vector>
+#include <limits>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+namespace Nuclear {
+
+/**
+ * @brief Physical instrument range of one sensor kind
+ */
+struct SensorKindRange {
+    SensorKind kind;
+    double minValue;
+    double maxValue;
+};
+
+/**
+ * @brief Instrument ranges indexed by SensorKind
+ *
+ * A value outside its kind's range is an instrument fault, not a process
+ * excursion, and is excluded from averages and threshold alarms.
+ */
+constexpr std::array<SensorKindRange, 3> SENSOR_KIND_RANGES = {{
+    {SensorKind::Temperature, -50.0, 1000.0},   // Celsius
+    {SensorKind::Pressure, 0.0, 3500.0},        // PSI
+    {SensorKind::Radiation, 0.0, 10000.0}       // mSv/h
+}};
+
+constexpr size_t SENSOR_KIND_COUNT = SENSOR_KIND_RANGES.size();
+
+static_assert(IsKnownSensorKind(SENSOR_KIND_COUNT - 1) && !IsKnownSensorKind(SENSOR_KIND_COUNT),
+              "SENSOR_KIND_RANGES must cover every SensorKind");
+
+constexpr const SensorKindRange& GetKindRange(SensorKind kind) {
+    return SENSOR_KIND_RANGES[static_cast<size_t>(kind)];
+}
+
+static_assert(GetKindRange(SensorKind::Temperature).kind == SensorKind::Temperature &&
+              GetKindRange(SensorKind::Pressure).kind == SensorKind::Pressure &&
+              GetKindRange(SensorKind::Radiation).kind == SensorKind::Radiation,
+              "SENSOR_KIND_RANGES must be indexed by SensorKind");
+
+/**
+ * @brief Tag type carrying a sensor kind and its range as compile-time constants
+ */
+template <SensorKind Kind>
+struct SensorKindTag {
+    static constexpr SensorKind kind = Kind;
+    static constexpr double minValue = GetKindRange(Kind).minValue;
+    static constexpr double maxValue = GetKindRange(Kind).maxValue;
+};
+
+using TemperatureTag = SensorKindTag<SensorKind::Temperature>;
+using PressureTag = SensorKindTag<SensorKind::Pressure>;
+using RadiationTag = SensorKindTag<SensorKind::Radiation>;
+
+/**
+ * @brief Threshold limits handed to a kernel; which fields apply depends on the policy
+ */
+struct ThresholdLimits {
+    double low;
+    double high;
+};
+
+/**
+ * @brief Threshold limits of a fixed-point channel, converted to counts
+ *
+ * low is the smallest count at or above the engineering limit and high the
+ * largest at or below it, so integer comparisons give the same alarms.
+ */
+struct FixedPointLimits {
+    int64_t low;
+    int64_t high;
+};
+
+/**
+ * @brief Alarm when a value exceeds the high limit
+ */
+struct HighLimitPolicy {
+    template <typename Value, typename Limits>
+    static bool Exceeds(Value value, const Limits& limits) { return value > limits.high; }
+};
+
+/**
+ * @brief Alarm when a value leaves the band [low, high]
+ */
+struct BandPolicy {
+    template <typename Value, typename Limits>
+    static bool Exceeds(Value value, const Limits& limits) {
+        return (value < limits.low) | (value > limits.high);
+    }
+};
+
+/**
+ * @brief Threshold policy selected at run time; maps to a policy type in the kernel table
+ */
+enum class ThresholdPolicy : uint8_t {
+    HighLimit = 0,
+    Band = 1
+};
+
+constexpr size_t THRESHOLD_POLICY_COUNT = 2;
+
+// Per-channel kernel output bits
+static constexpr uint8_t CHANNEL_UNUSABLE     = 0x01;  // Quality flags exclude the value
+static constexpr uint8_t CHANNEL_OUT_OF_RANGE = 0x02;  // Outside the kind's instrument range (or NaN)
+static constexpr uint8_t CHANNEL_ALARM        = 0x04;  // Valid and beyond the threshold policy
+
+/**
+ * @brief Aggregate result of a kernel over a run of channels
+ */
+struct KernelResult {
+    size_t valid;           // Usable and within range
+    size_t unusable;
+    size_t outOfRange;
+    size_t alarms;
+    double sum;             // Over valid channels
+    double min;
+    double max;
+
+    static KernelResult Empty() {
+        return KernelResult{0, 0, 0, 0, 0.0, std::numeric_limits<double>::infinity(),
+                            -std::numeric_limits<double>::infinity()};
+    }
+
+    void Merge(const KernelResult& other) {
+        valid += other.valid;
+        unusable += other.unusable;
+        outOfRange += other.outOfRange;
+        alarms += other.alarms;
+        sum += other.sum;
+        min = other.min < min ? other.min : min;
+        max = other.max > max ? other.max : max;
+    }
+};
+
+/**
+ * @brief Validate, threshold and aggregate a run of channels of one kind
+ * @tparam KindTag SensorKindTag supplying the range as constants
+ * @tparam Policy Threshold policy type
+ * @param values Channel values
+ * @param quality Channel quality flags
+ * @param count Number of channels
+ * @param limits Threshold limits for Policy
+ * @param flags Output CHANNEL_* bits per channel
+ * @return Counts, sum, min and max over the run
+ *
+ * The loop body has no data-dependent branches: every test is evaluated
+ * and combined with bitwise operators and selects, so the compiler can
+ * vectorize it and a scan's mix of good and bad channels costs no
+ * mispredictions.
+ */
+template <typename KindTag, typename Policy>
+KernelResult RunSensorKernel(const double* values, const SensorQuality* quality, size_t count,
+                             const ThresholdLimits& limits, uint8_t* flags) {
+    constexpr double minValue = KindTag::minValue;
+    constexpr double maxValue = KindTag::maxValue;
+    constexpr double inf = std::numeric_limits<double>::infinity();
+
+    size_t valid = 0;
+    size_t unusable = 0;
+    size_t outOfRange = 0;
+    size_t alarms = 0;
+    double sum = 0.0;
+    double low = inf;
+    double high = -inf;
+
+    for (size_t i = 0; i < count; ++i) {
+        double value = values[i];
+        bool usable = (quality[i] & QUALITY_UNUSABLE_MASK) == 0;
+        bool inRange = (value >= minValue) & (value <= maxValue);   // NaN fails both
+        bool isValid = usable & inRange;
+        bool alarm = isValid & Policy::Exceeds(value, limits);
+
+        flags[i] = static_cast<uint8_t>((usable ? 0 : CHANNEL_UNUSABLE) |
+                                        (usable & !inRange ? CHANNEL_OUT_OF_RANGE : 0) | (alarm ? CHANNEL_ALARM : 0));
+        valid += isValid;
+        unusable += !usable;
+        outOfRange += usable & !inRange;
+        alarms += alarm;
+        sum += isValid ? value : 0.0;
+        low = isValid && value < low ? value : low;
+        high = isValid && value > high ? value : high;
+    }
+
+    return KernelResult{valid, unusable, outOfRange, alarms, sum, low, high};
+}
+
+/**
+ * @brief Validate, threshold and aggregate a run of fixed-point channels of one kind
+ * @tparam KindTag SensorKindTag supplying the range as constants
+ * @tparam Policy Threshold policy type
+ * @param counts Channel values in counts
+ * @param quality Channel quality flags
+ * @param count Number of channels
+ * @param scale Scaling shared by the run
+ * @param limits Threshold limits for Policy in engineering units
+ * @param flags Output CHANNEL_* bits per channel
+ * @return Counts, sum, min and max over the run in engineering units
+ *
+ * Range and limits are converted to counts once per call; the loop then
+ * compares integers only, which is exact and packs twice as many lanes
+ * per vector as the double kernel.
+ */
+template <typename KindTag, typename Policy>
+KernelResult RunFixedPointKernel(const int32_t* counts, const SensorQuality* quality, size_t count,
+                                 const FixedPointScale& scale, const ThresholdLimits& limits, uint8_t* flags) {
+    const int64_t minCounts = scale.CountsCeil(KindTag::minValue);
+    const int64_t maxCounts = scale.CountsFloor(KindTag::maxValue);
+    const FixedPointLimits countLimits{scale.CountsCeil(limits.low), scale.CountsFloor(limits.high)};
+
+    size_t valid = 0;
+    size_t unusable = 0;
+    size_t outOfRange = 0;
+    size_t alarms = 0;
+    int64_t sum = 0;
+    int64_t low = std::numeric_limits<int64_t>::max();
+    int64_t high = std::numeric_limits<int64_t>::min();
+
+    for (size_t i = 0; i < count; ++i) {
+        int64_t value = counts[i];
+        bool usable = (quality[i] & QUALITY_UNUSABLE_MASK) == 0;
+        bool inRange = (value >= minCounts) & (value <= maxCounts);
+        bool isValid = usable & inRange;
+        bool alarm = isValid & Policy::Exceeds(value, countLimits);
+
+        flags[i] = static_cast<uint8_t>((usable ? 0 : CHANNEL_UNUSABLE) |
+                                        (usable & !inRange ? CHANNEL_OUT_OF_RANGE : 0) | (alarm ? CHANNEL_ALARM : 0));
+        valid += isValid;
+        unusable += !usable;
+        outOfRange += usable & !inRange;
+        alarms += alarm;
+        sum += isValid ? value : 0;
+        low = isValid && value < low ? value : low;
+        high = isValid && value > high ? value : high;
+    }
+
+    KernelResult result{valid, unusable, outOfRange, alarms, 0.0, std::numeric_limits<double>::infinity(),
+                        -std::numeric_limits<double>::infinity()};
+    if (valid > 0) {
+        result.sum = scale.scale * static_cast<double>(sum) + scale.offset * static_cast<double>(valid);
+        result.min = scale.ToEngineering(low);
+        result.max = scale.ToEngineering(high);
+    }
+    return result;
+}
+
+/**
+ * @brief Signature shared by every instantiated kernel
+ */
+using SensorKernelFunction = KernelResult (*)(const double*, const SensorQuality*, size_t, const ThresholdLimits&,
+                                              uint8_t*);
+
+/**
+ * @brief Signature shared by every instantiated fixed-point kernel
+ */
+using FixedPointKernelFunction = KernelResult (*)(const int32_t*, const SensorQuality*, size_t,
+                                                  const FixedPointScale&, const ThresholdLimits&, uint8_t*);
+
+namespace Detail {
+
+template <size_t KindIndex, typename Policy>
+constexpr SensorKernelFunction InstantiateKernel() {
+    return &RunSensorKernel<SensorKindTag<SENSOR_KIND_RANGES[KindIndex].kind>, Policy>;
+}
+
+// Policy index order must match ThresholdPolicy
+template <size_t KindIndex>
+constexpr std::array<SensorKernelFunction, THRESHOLD_POLICY_COUNT> KernelRow() {
+    return {{InstantiateKernel<KindIndex, HighLimitPolicy>(), InstantiateKernel<KindIndex, BandPolicy>()}};
+}
+
+template <size_t... KindIndexes>
+constexpr std::array<std::array<SensorKernelFunction, THRESHOLD_POLICY_COUNT>, sizeof...(KindIndexes)>
+KernelTable(std::index_sequence<KindIndexes...>) {
+    return {{KernelRow<KindIndexes>()...}};
+}
+
+template <size_t KindIndex, typename Policy>
+constexpr FixedPointKernelFunction InstantiateFixedPointKernel() {
+    return &RunFixedPointKernel<SensorKindTag<SENSOR_KIND_RANGES[KindIndex].kind>, Policy>;
+}
+
+template <size_t KindIndex>
+constexpr std::array<FixedPointKernelFunction, THRESHOLD_POLICY_COUNT> FixedPointKernelRow() {
+    return {{InstantiateFixedPointKernel<KindIndex, HighLimitPolicy>(),
+             InstantiateFixedPointKernel<KindIndex, BandPolicy>()}};
+}
+
+template <size_t... KindIndexes>
+constexpr std::array<std::array<FixedPointKernelFunction, THRESHOLD_POLICY_COUNT>, sizeof...(KindIndexes)>
+FixedPointKernelTable(std::index_sequence<KindIndexes...>) {
+    return {{FixedPointKernelRow<KindIndexes>()...}};
+}
+
+} // namespace Detail
+
+/**
+ * @brief Every kind x policy kernel, instantiated at compile time
+ */
+constexpr std::array<std::array<SensorKernelFunction, THRESHOLD_POLICY_COUNT>, SENSOR_KIND_COUNT> SENSOR_KERNELS =
+    Detail::KernelTable(std::make_index_sequence<SENSOR_KIND_COUNT>());
+
+/**
+ * @brief Every kind x policy fixed-point kernel, instantiated at compile time
+ */
+constexpr std::array<std::array<FixedPointKernelFunction, THRESHOLD_POLICY_COUNT>, SENSOR_KIND_COUNT>
+    SENSOR_FIXED_POINT_KERNELS = Detail::FixedPointKernelTable(std::make_index_sequence<SENSOR_KIND_COUNT>());
+
+/**
+ * @brief Look up the kernel for a kind and policy
+ * @param kind Sensor kind
+ * @param policy Threshold policy
+ * @return Instantiated kernel
+ */
+constexpr SensorKernelFunction GetSensorKernel(SensorKind kind, ThresholdPolicy policy) {
+    return SENSOR_KERNELS[static_cast<size_t>(kind)][static_cast<size_t>(policy)];
+}
+
+/**
+ * @brief Look up the fixed-point kernel for a kind and policy
+ * @param kind Sensor kind
+ * @param policy Threshold policy
+ * @return Instantiated kernel
+ */
+constexpr FixedPointKernelFunction GetFixedPointKernel(SensorKind kind, ThresholdPolicy policy) {
+    return SENSOR_FIXED_POINT_KERNELS[static_cast<size_t>(kind)][static_cast<size_t>(policy)];
+}
+
+/**
+ * @brief Maps a scan's channels onto instantiated kernels
+ *
+ * Built once per channel layout: consecutive channels of the same kind and
+ * scaling form a group, and each group is bound to the kernel for its kind,
+ * representation and that kind's threshold policy. Running the plan is then one indirect call per
+ * group with no per-channel type dispatch. Channel sets from the Modbus
+ * catalog are ordered by kind, so a scan is normally three groups.
+ *
+ * Not thread-safe; owned by the processing thread.
+ */
+class SensorKernelPlan {
+public:
+    struct KindThreshold {
+        ThresholdPolicy policy;
+        ThresholdLimits limits;
+    };
+
+    struct Group {
+        size_t offset;
+        size_t count;
+        SensorKind kind;
+        FixedPointScale scale;                  // Zero scale: floating-point group
+        SensorKernelFunction kernel;            // Null for channels of an unknown kind
+        FixedPointKernelFunction fixedKernel;   // Set for fixed-point groups only
+    };
+
+    struct ScanResult {
+        std::array<KernelResult, SENSOR_KIND_COUNT> byKind;
+        size_t alarms;
+    };
+
+private:
+    std::array<KindThreshold, SENSOR_KIND_COUNT> m_thresholds;
+    std::vector<SensorKind> m_kinds;        // Layout the groups were built for
+    std::shared_ptr<const ChannelScaling> m_scales;
+    std::vector<Group> m_groups;
+
+public:
+    /**
+     * @brief Constructor with high-limit policies at the default safety thresholds
+     */
+    SensorKernelPlan();
+
+    /**
+     * @brief Set a kind's threshold policy and limits
+     * @param kind Sensor kind; unknown kinds are ignored
+     * @param threshold Policy and limits
+     */
+    void SetThreshold(SensorKind kind, const KindThreshold& threshold);
+
+    /**
+     * @brief Get a kind's threshold policy and limits
+     * @param kind Sensor kind; must be known
+     * @return Policy and limits
+     */
+    const KindThreshold& GetThreshold(SensorKind kind) const;
+
+    /**
+     * @brief Group channels by kind and scaling for a channel layout
+     * @param kinds Kind of each channel
+     * @param scales Layout scaling; null if all are floating point
+     */
+    void Build(const std::vector<SensorKind>& kinds, const std::shared_ptr<const ChannelScaling>& scales = nullptr);
+
+    /**
+     * @brief Check whether the plan was built for a layout
+     * @param kinds Kind of each channel
+     * @param scales Layout scaling; null if all are floating point
+     * @return true if Run can be used without Build
+     *
+     * Scans sharing the ChannelScaling the plan was built for match on
+     * the pointer; only a different table is compared entry by entry.
+     */
+    bool Matches(const std::vector<SensorKind>& kinds,
+                 const std::shared_ptr<const ChannelScaling>& scales = nullptr) const;
+
+    /**
+     * @brief Run every group's kernel over a snapshot
+     * @param snapshot Scan; rebuilds the plan first if its layout or scaling changed
+     * @param flags Output CHANNEL_* bits per channel, resized to the snapshot
+     * @return Per-kind results and the total alarm count; empty if the columns differ in length.
+     *         Channels of an unknown kind get no kernel and are flagged CHANNEL_UNUSABLE.
+     */
+    ScanResult Run(const SensorSnapshot& snapshot, std::vector<uint8_t>& flags);
+
+    /**
+     * @brief Get the channel groups
+     * @return Groups in channel order
+     */
+    const std::vector<Group>& GetGroups() const;
+};
+
+} // namespace Nuclear
\ No newline at end of file
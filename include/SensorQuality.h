@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace Nuclear {
+
+/**
+ * @brief Per-reading quality flags, combined into one byte per channel
+ *
+ * A reading with no flags set is good. Flags accumulate: a held value served
+ * during a communication failure is COMM_FAIL | SUBSTITUTED, and becomes
+ * STALE as well once it is older than the configured limit.
+ */
+using SensorQuality = uint8_t;
+
+static constexpr SensorQuality QUALITY_GOOD         = 0x00;
+static constexpr SensorQuality QUALITY_STALE        = 0x01;  // No fresh good value within the staleness limit
+static constexpr SensorQuality QUALITY_COMM_FAIL    = 0x02;  // Device did not answer this scan
+static constexpr SensorQuality QUALITY_OUT_OF_RANGE = 0x04;  // Outside the instrument's physical range
+static constexpr SensorQuality QUALITY_SUBSTITUTED  = 0x08;  // Held, voted or otherwise not measured directly
+
+// Flags that disqualify a value from aggregation and threshold alarms
+static constexpr SensorQuality QUALITY_UNUSABLE_MASK = QUALITY_STALE | QUALITY_COMM_FAIL | QUALITY_OUT_OF_RANGE;
+
+/**
+ * @brief Check whether a reading is good
+ * @param quality Quality flags
+ * @return true if no flags are set
+ */
+inline bool IsQualityGood(SensorQuality quality) {
+    return quality == QUALITY_GOOD;
+}
+
+/**
+ * @brief Check whether a reading may feed aggregates and threshold alarms
+ * @param quality Quality flags
+ * @return true if reading is good or only substituted
+ */
+inline bool IsQualityUsable(SensorQuality quality) {
+    return (quality & QUALITY_UNUSABLE_MASK) == 0;
+}
+
+/**
+ * @brief Render quality flags for reports and logs
+ * @param quality Quality flags
+ * @return Flag names joined with '|', or "GOOD"
+ */
+inline std::string QualityToString(SensorQuality quality) {
+    if (quality == QUALITY_GOOD) {
+        return "GOOD";
+    }
+
+    std::string result;
+    auto append = [&result](const char* name) {
+        if (!result.empty()) {
+            result += '|';
+        }
+        result += name;
+    };
+
+    if (quality & QUALITY_STALE) append("STALE");
+    if (quality & QUALITY_COMM_FAIL) append("COMM_FAIL");
+    if (quality & QUALITY_OUT_OF_RANGE) append("OUT_OF_RANGE");
+    if (quality & QUALITY_SUBSTITUTED) append("SUBSTITUTED");
+    return result;
+}
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,258 @@
+#pragma once
+
+#include "IDataProcessor.h"
+#include "SensorQuality.h"
+#include <vector>
+#include <string>
+#include <memory>
+#include <chrono>
+#include <cstdint>
+
+namespace Nuclear {
+
+/**
+ * @brief Physical quantity measured by a channel
+ */
+enum class SensorKind : uint8_t {
+    Temperature = 0,
+    Pressure = 1,
+    Radiation = 2
+};
+
+/**
+ * @brief Get sensor type name used in SensorReading::sensorType
+ * @param kind Sensor kind
+ * @return Lower-case type name
+ */
+const char* SensorKindName(SensorKind kind);
+
+/**
+ * @brief Parse sensor type name
+ * @param name Type name as used in SensorReading::sensorType
+ * @param kind Parsed kind on success
+ * @return true if name is a known sensor type
+ */
+bool ParseSensorKind(const std::string& name, SensorKind& kind);
+
+/**
+ * @brief Check a kind byte read from a file or the wire
+ * @param kind Raw kind value
+ * @return true if it names a SensorKind
+ */
+constexpr bool IsKnownSensorKind(uint8_t kind) {
+    return kind <= static_cast<uint8_t>(SensorKind::Radiation);
+}
+
+/**
+ * @brief Linear scaling of a fixed-point channel: value = offset + scale * counts
+ *
+ * A scale of zero marks a floating-point channel.
+ */
+struct FixedPointScale {
+    double scale = 0.0;         // Engineering units per count; positive for fixed-point channels
+    double offset = 0.0;        // Engineering value at zero counts
+
+    bool IsFixed() const { return scale > 0.0; }
+
+    double ToEngineering(int64_t counts) const { return offset + scale * static_cast<double>(counts); }
+
+    /**
+     * @brief Largest count whose engineering value does not exceed value
+     * @param value Engineering value
+     * @return Count, clamped to the int32 range widened by one on each side
+     *
+     * With CountsCeil this turns "value > limit" and "value < limit" into
+     * exact integer comparisons: eng > limit <=> counts > CountsFloor(limit).
+     */
+    int64_t CountsFloor(double value) const;
+
+    /**
+     * @brief Smallest count whose engineering value is not below value
+     * @param value Engineering value
+     * @return Count, clamped like CountsFloor
+     */
+    int64_t CountsCeil(double value) const;
+
+    /**
+     * @brief Nearest count to an engineering value, for storing it
+     * @param value Engineering value
+     * @return Rounded count, clamped to the int32 range; 0 for NaN
+     */
+    int32_t ToCounts(double value) const;
+
+    bool operator==(const FixedPointScale& other) const {
+        return scale == other.scale && offset == other.offset;
+    }
+    bool operator!=(const FixedPointScale& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Scaling of every channel of a layout, shared by the scans read through it
+ *
+ * Owned by the ChannelSet and immutable once published, so a snapshot
+ * holds one pointer to it rather than a scale per channel.
+ */
+using ChannelScaling = std::vector<FixedPointScale>;
+
+/**
+ * @brief Column-oriented readings for one scan
+ *
+ * Every column has one entry per channel in the same order. Quality is
+ * stored as one byte of QUALITY_* flags per channel so whole-scan
+ * passes can test it without touching the value column.
+ *
+ * Channels can be fixed point: the ChannelSet gives them a scale and
+ * acquisition keeps their scaled register value in counts only; their
+ * values entry is never populated. Kernels, deadbands and delta encoding
+ * work on the integers, and every other consumer reads a channel through
+ * EngineeringValue. Converting a whole scan to doubles is left to the
+ * report path (ToReadings, the monitoring report's JSON).
+ *
+ * The values column holds floating-point channels. While every channel of
+ * the layout is fixed point it is dropped, so a reading takes 4 bytes of
+ * counts instead of 8 of values (plus 1 of quality either way); the
+ * 16-byte scales live once in the layout's shared ChannelScaling. A
+ * layout mixing both keeps values at one entry per channel next to
+ * counts, and saves nothing over floating point.
+ */
+struct SensorSnapshot {
+    uint64_t scanNumber = 0;
+    std::chrono::system_clock::time_point acquiredAt;
+
+    std::vector<int> sensorIds;
+    std::vector<SensorKind> kinds;
+    std::vector<double> values;             // Empty while every channel is fixed point
+    std::vector<SensorQuality> quality;
+
+    // Fixed-point channels: scaling of the layout (null if every channel is floating point) and,
+    // while it is set, one count per channel. Channels past the end of the scaling, such as
+    // derived channels appended after acquisition, are floating point.
+    std::shared_ptr<const ChannelScaling> scales;
+    std::vector<int32_t> counts;
+
+    /**
+     * @brief Resize all columns, resetting quality to COMM_FAIL
+     * @param channelCount Number of channels
+     *
+     * Existing channels keep their representation; added channels are
+     * floating point unless the scaling covers them.
+     */
+    void Resize(size_t channelCount);
+
+    size_t Size() const { return sensorIds.size(); }
+
+    /**
+     * @brief Append a floating-point channel (e.g. a derived channel)
+     * @param sensorId Sensor identifier
+     * @param kind Sensor kind
+     * @param value Value in engineering units
+     * @param flags Quality flags
+     *
+     * Restores the values column first if every channel so far was fixed point.
+     */
+    void AppendChannel(int sensorId, SensorKind kind, double value, SensorQuality flags);
+
+    /**
+     * @brief Adopt a layout's scaling (acquisition)
+     * @param scaling ChannelSet::GetScales(); null makes every channel floating point
+     *
+     * Sizes counts to the snapshot when scaling is set and releases it
+     * otherwise, and drops values when scaling makes every channel fixed
+     * point. Passing the same pointer as the last scan is O(1).
+     */
+    void SetScaling(std::shared_ptr<const ChannelScaling> scaling);
+
+    /**
+     * @brief Switch one channel to fixed point, or back with a zero scale
+     * @param channel Channel index
+     * @param scale Scaling of the channel's counts
+     * @return false if channel is out of range or scale is negative
+     *
+     * Copies the shared scaling; for building layouts by hand, not per scan.
+     */
+    bool SetFixedPoint(size_t channel, const FixedPointScale& scale);
+
+    /**
+     * @brief Check whether any channel may be fixed point
+     * @return true while a scaling is set
+     */
+    bool HasFixedPoint() const { return scales != nullptr; }
+
+    bool IsFixedPoint(size_t channel) const {
+        return scales && channel < scales->size() && (*scales)[channel].IsFixed();
+    }
+
+    /**
+     * @brief Get a fixed-point channel's scaling
+     * @param channel Channel index for which IsFixedPoint is true
+     * @return Scale and offset
+     */
+    const FixedPointScale& Scale(size_t channel) const { return (*scales)[channel]; }
+
+    /**
+     * @brief Check whether two snapshots scale their channels alike
+     * @param other Snapshot with the same channel count
+     * @return true if every channel has the same representation and scale
+     */
+    bool SameScaling(const SensorSnapshot& other) const;
+
+    /**
+     * @brief Get a channel's value in engineering units
+     * @param channel Channel index
+     * @return Converted counts for fixed-point channels, values entry otherwise
+     *
+     * The only way consumers other than the kernels read a value.
+     */
+    double EngineeringValue(size_t channel) const {
+        return IsFixedPoint(channel) ? Scale(channel).ToEngineering(counts[channel]) : values[channel];
+    }
+
+    /**
+     * @brief Store a value in engineering units in the channel's representation
+     * @param channel Channel index
+     * @param value Value in engineering units; rounded to counts for fixed-point channels
+     */
+    void SetEngineeringValue(size_t channel, double value) {
+        if (IsFixedPoint(channel)) {
+            counts[channel] = Scale(channel).ToCounts(value);
+        } else {
+            values[channel] = value;
+        }
+    }
+
+    /**
+     * @brief Count channels whose quality is not usable
+     * @return Number of channels failing IsQualityUsable
+     */
+    size_t CountUnusable() const {
+        size_t count = 0;
+        for (SensorQuality flags : quality) {
+            count += (flags & QUALITY_UNUSABLE_MASK) != 0 ? 1 : 0;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Expand snapshot into row-oriented readings for IDataProcessor
+     * @param timestamp Timestamp applied to every reading
+     * @return One SensorReading per channel in engineering units, quality included
+     *
+     * Part of the report path, where fixed-point channels are converted.
+     */
+    std::vector<SensorReading> ToReadings(const std::string& timestamp) const;
+
+private:
+    /**
+     * @brief Check whether the scaling makes every one of channelCount channels fixed point
+     * @param channelCount Number of channels
+     * @return true if the values column is not needed
+     */
+    bool AllFixedPoint(size_t channelCount) const;
+
+    /**
+     * @brief Size values to the snapshot, or release it while every channel is fixed point
+     */
+    void ResizeValues();
+};
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <functional>
+#include <chrono>
+#include <cstdint>
+
+namespace Nuclear {
+
+/**
+ * @brief What produced a sequence-of-events record
+ */
+enum class EventCause : uint8_t {
+    QualityChange,      // Acquisition quality flags changed (old/new are flag values)
+    LimitCrossed,       // Channel crossed a setpoint
+    AlarmRaised,
+    AlarmCleared,
+    Trip,               // Protective action; triggers a capture by default
+    Operator,
+    Custom
+};
+
+/**
+ * @brief Get cause name for logs and dumps
+ * @param cause Event cause
+ * @return Upper-case cause name
+ */
+const char* EventCauseName(EventCause cause);
+
+/**
+ * @brief One time-stamped transition
+ */
+struct SequenceEvent {
+    uint64_t sequence;        // Global record order, ties broken by arrival
+    int64_t timestampUs;      // Microseconds since the Unix epoch
+    int channel;              // Sensor or alarm ID
+    double oldValue;
+    double newValue;
+    EventCause cause;
+};
+
+/**
+ * @brief Events frozen around one trigger, oldest first
+ */
+struct SequenceCapture {
+    std::string reason;
+    int64_t triggerTimeUs;
+    size_t triggerPosition;               // Index of the trigger event in time order
+    std::vector<SequenceEvent> events;
+};
+
+/**
+ * @brief Sequence-of-events recorder with pre/post-trigger capture
+ *
+ * Producers (acquisition, alarm engine) append into a pre-allocated ring
+ * with one fetch_add and a handful of relaxed stores; nothing on the record
+ * path allocates, locks or blocks. Each slot carries a sequence stamp that
+ * readers validate, so torn slots are skipped rather than reported.
+ *
+ * A trigger (explicit, or a record whose cause is in the trigger mask)
+ * marks the ring position. Once the post-trigger event count or time window
+ * is reached the ring is frozen, the window is copied out, recording resumes,
+ * and the capture is handed to the dump handler on the recorder's own thread.
+ * Producers never signal that thread; it polls a flag every few
+ * milliseconds. Records arriving during the short freeze are counted as dropped.
+ */
+class SequenceOfEventsRecorder {
+public:
+    using DumpHandler = std::function<void(const SequenceCapture&)>;
+
+    struct Config {
+        size_t capacity;                              // Power of two, at least 2 x (pre + post)
+        size_t preTriggerEvents;
+        size_t postTriggerEvents;
+        std::chrono::milliseconds postTriggerWindow;  // Freeze after this even if few events arrive
+    };
+
+    struct Statistics {
+        uint64_t recorded;
+        uint64_t dropped;
+        uint64_t captures;
+    };
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> stamp;       // 2*index+1 while writing, 2*index+2 when complete
+        std::atomic<int64_t> timestampUs;
+        std::atomic<int> channel;
+        std::atomic<double> oldValue;
+        std::atomic<double> newValue;
+        std::atomic<uint8_t> cause;
+    };
+
+    enum TriggerState : int {
+        ARMED = 0,
+        ARMING = 1,         // Trigger fields being written by the thread that won the trigger
+        TRIGGERED = 2,
+        FROZEN = 3
+    };
+
+    Config m_config;
+    std::unique_ptr<Slot[]> m_slots;
+    size_t m_mask;
+
+    std::atomic<uint64_t> m_writeIndex;
+    std::atomic<int> m_state;
+    std::atomic<uint64_t> m_triggerIndex;
+    std::atomic<int64_t> m_triggerTimeUs;
+    std::atomic<int> m_triggerChannel;
+    std::atomic<uint8_t> m_triggerCause;
+    std::atomic<uint32_t> m_triggerCauseMask;
+
+    std::atomic<uint64_t> m_recorded;
+    std::atomic<uint64_t> m_dropped;
+    std::atomic<uint64_t> m_captures;
+
+    // Set by Record once the post-trigger count is reached; polled by the dump thread
+    std::atomic<bool> m_freezeDue;
+
+    // Trigger reason and dump thread; never touched on the record path
+    std::mutex m_triggerMutex;
+    std::string m_triggerReason;
+    std::condition_variable m_dumpCondition;
+    std::atomic<bool> m_running;
+    std::thread m_dumpThread;
+    DumpHandler m_dumpHandler;
+
+    static constexpr std::chrono::milliseconds DUMP_POLL_INTERVAL{5};
+
+public:
+    /**
+     * @brief Constructor - allocates the ring
+     * @param config Ring size and capture window
+     */
+    explicit SequenceOfEventsRecorder(const Config& config = DefaultConfig());
+
+    /**
+     * @brief Destructor - stops the dump thread
+     */
+    ~SequenceOfEventsRecorder();
+
+    SequenceOfEventsRecorder(const SequenceOfEventsRecorder&) = delete;
+    SequenceOfEventsRecorder& operator=(const SequenceOfEventsRecorder&) = delete;
+
+    /**
+     * @brief Default window: 4096 events before, 4096 events or 10 s after
+     * @return Default configuration
+     */
+    static Config DefaultConfig();
+
+    /**
+     * @brief Start the dump thread
+     * @param handler Called with each completed capture, off the record path
+     * @return true if started
+     */
+    bool Start(DumpHandler handler);
+
+    /**
+     * @brief Stop the dump thread; a capture in progress is delivered first
+     */
+    void Stop();
+
+    /**
+     * @brief Record one transition (wait-free)
+     * @param channel Sensor or alarm ID
+     * @param oldValue Value before the transition
+     * @param newValue Value after the transition
+     * @param cause What produced the transition
+     * @param timestampUs Event time; defaults to now
+     * @return false if dropped because a capture is being frozen
+     */
+    bool Record(int channel, double oldValue, double newValue, EventCause cause, int64_t timestampUs = NowMicros());
+
+    /**
+     * @brief Start a capture around the current ring position
+     * @param reason Reason stored with the capture
+     * @return false if a capture is already in progress
+     */
+    bool Trigger(const std::string& reason);
+
+    /**
+     * @brief Select causes that start a capture automatically when recorded
+     * @param causes Trigger causes; replaces the previous set
+     */
+    void SetTriggerCauses(const std::vector<EventCause>& causes);
+
+    /**
+     * @brief Check whether a capture is in progress
+     * @return true between trigger and delivery
+     */
+    bool IsCapturing() const;
+
+    /**
+     * @brief Copy the most recent events without triggering
+     * @param maxEvents Upper bound on events returned
+     * @return Events oldest first
+     */
+    std::vector<SequenceEvent> GetRecentEvents(size_t maxEvents) const;
+
+    /**
+     * @brief Get recorder statistics
+     * @return Statistics snapshot
+     */
+    Statistics GetStatistics() const;
+
+    /**
+     * @brief Write a capture as CSV
+     * @param capture Capture to write
+     * @param path Output file path
+     * @return true if the file was written
+     */
+    static bool WriteCapture(const SequenceCapture& capture, const std::string& path);
+
+    /**
+     * @brief Current time for event timestamps
+     * @return Microseconds since the Unix epoch
+     */
+    static int64_t NowMicros();
+
+private:
+    /**
+     * @brief Mark the trigger position if armed (lock-free)
+     * @param index Ring index of the first post-trigger event
+     * @param timestampUs Trigger time
+     * @param channel Channel that caused the trigger, or -1
+     * @param cause Cause that caused the trigger
+     * @return true if this call started the capture
+     */
+    bool BeginCapture(uint64_t index, int64_t timestampUs, int channel, EventCause cause);
+
+    /**
+     * @brief Freeze once the post-trigger window is complete
+     * @return true if the ring is frozen and ready to copy
+     */
+    bool CheckFreeze();
+
+    /**
+     * @brief Copy completely written slots in ring index range [first, last)
+     * @param first First ring index
+     * @param last One past the last ring index
+     * @param events Output; events are appended in ring order
+     */
+    void CopyEvents(uint64_t first, uint64_t last, std::vector<SequenceEvent>& events) const;
+
+    /**
+     * @brief Copy the frozen window, re-arm, and return the capture
+     * @return Completed capture
+     */
+    SequenceCapture ExtractCapture();
+
+    /**
+     * @brief Dump thread main loop
+     */
+    void DumpLoop();
+};
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+
+namespace Nuclear {
+
+/**
+ * @brief Stable handle into a SlotMap
+ *
+ * Handles stay valid while their element lives and become stale once it is
+ * erased, even if the slot is later reused.
+ */
+struct SlotHandle {
+    uint32_t index;
+    uint32_t generation;
+
+    bool IsValid() const { return generation != 0; }
+    bool operator==(const SlotHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const SlotHandle& other) const { return !(*this == other); }
+};
+
+static constexpr SlotHandle INVALID_SLOT_HANDLE = {0, 0};
+
+/**
+ * @brief Dense container with O(1) insert, erase and handle lookup
+ *
+ * Values are stored contiguously for fast iteration; erasing swaps the last
+ * value into the hole, so element order is not preserved but handles are.
+ * Not thread-safe.
+ */
+template <typename T>
+class SlotMap {
+private:
+    struct Slot {
+        uint32_t denseIndex;
+        uint32_t generation;
+    };
+
+    static constexpr uint32_t FREE_END = 0xFFFFFFFFu;
+
+    std::vector<Slot> m_slots;
+    std::vector<T> m_values;
+    std::vector<uint32_t> m_denseToSlot;
+    uint32_t m_freeHead;
+
+public:
+    SlotMap() : m_freeHead(FREE_END) {}
+
+    /**
+     * @brief Reserve storage for expected element count
+     * @param capacity Number of elements
+     */
+    void Reserve(size_t capacity) {
+        m_slots.reserve(capacity);
+        m_values.reserve(capacity);
+        m_denseToSlot.reserve(capacity);
+    }
+
+    /**
+     * @brief Insert value
+     * @param value Value to store
+     * @return Handle to the stored value
+     */
+    SlotHandle Insert(T value) {
+        uint32_t slotIndex;
+        if (m_freeHead != FREE_END) {
+            slotIndex = m_freeHead;
+            m_freeHead = m_slots[slotIndex].denseIndex;
+        } else {
+            slotIndex = static_cast<uint32_t>(m_slots.size());
+            m_slots.push_back({0, 1});
+        }
+
+        Slot& slot = m_slots[slotIndex];
+        slot.denseIndex = static_cast<uint32_t>(m_values.size());
+        m_values.push_back(std::move(value));
+        m_denseToSlot.push_back(slotIndex);
+
+        return SlotHandle{slotIndex, slot.generation};
+    }
+
+    /**
+     * @brief Erase value referenced by handle
+     * @param handle Handle returned by Insert
+     * @return true if value existed and was erased
+     */
+    bool Erase(SlotHandle handle) {
+        if (!Contains(handle)) {
+            return false;
+        }
+
+        Slot& slot = m_slots[handle.index];
+        uint32_t hole = slot.denseIndex;
+        uint32_t last = static_cast<uint32_t>(m_values.size() - 1);
+
+        if (hole != last) {
+            m_values[hole] = std::move(m_values[last]);
+            m_denseToSlot[hole] = m_denseToSlot[last];
+            m_slots[m_denseToSlot[hole]].denseIndex = hole;
+        }
+
+        m_values.pop_back();
+        m_denseToSlot.pop_back();
+
+        // Bump generation to invalidate outstanding handles; zero is reserved
+        if (++slot.generation == 0) {
+            slot.generation = 1;
+        }
+        slot.denseIndex = m_freeHead;
+        m_freeHead = handle.index;
+        return true;
+    }
+
+    /**
+     * @brief Check whether handle refers to a live value
+     * @param handle Handle to check
+     * @return true if handle is live
+     */
+    bool Contains(SlotHandle handle) const {
+        return handle.IsValid() && handle.index < m_slots.size() &&
+               m_slots[handle.index].generation == handle.generation &&
+               m_slots[handle.index].denseIndex < m_values.size() &&
+               m_denseToSlot[m_slots[handle.index].denseIndex] == handle.index;
+    }
+
+    /**
+     * @brief Look up value by handle
+     * @param handle Handle to resolve
+     * @return Pointer to value or nullptr if handle is stale
+     */
+    T* Get(SlotHandle handle) {
+        return Contains(handle) ? &m_values[m_slots[handle.index].denseIndex] : nullptr;
+    }
+
+    const T* Get(SlotHandle handle) const {
+        return Contains(handle) ? &m_values[m_slots[handle.index].denseIndex] : nullptr;
+    }
+
+    /**
+     * @brief Get handle of the value at a dense position
+     * @param denseIndex Position in iteration order
+     * @return Handle of that value
+     */
+    SlotHandle HandleAt(size_t denseIndex) const {
+        uint32_t slotIndex = m_denseToSlot[denseIndex];
+        return SlotHandle{slotIndex, m_slots[slotIndex].generation};
+    }
+
+    size_t Size() const { return m_values.size(); }
+    bool Empty() const { return m_values.empty(); }
+
+    typename std::vector<T>::iterator begin() { return m_values.begin(); }
+    typename std::vector<T>::iterator end() { return m_values.end(); }
+    typename std::vector<T>::const_iterator begin() const { return m_values.begin(); }
+    typename std::vector<T>::const_iterator end() const { return m_values.end(); }
+};
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,203 @@
+#pragma once
+
+#include "SensorSnapshot.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace Nuclear {
+
+/**
+ * @brief Encodes a stream of snapshots as keyframes and per-channel deltas
+ *
+ * Binary feed served by a monitor to downstream aggregators. Every frame
+ * is a little-endian u32 payload length followed by the payload:
+ *
+ *   u32 magic "NPDF", u8 type, u64 scanNumber, u64 baseScanNumber,
+ *   u64 acquiredAt (microseconds since epoch), u32 channelCount, then
+ *   keyframe: per channel i32 sensorId, u8 kind, f64 value, u8 quality
+ *   delta:    u32 changedCount, per change u32 channel, f64 value, u8 quality
+ *
+ * Snapshots with fixed-point channels use the scaled frame types instead,
+ * which keep those channels as integer counts on the wire:
+ *
+ *   scaled keyframe: per channel i32 sensorId, u8 kind, u8 quality, u8 format,
+ *                    then f64 value (format 0) or f64 scale, f64 offset, i32 counts (format 1)
+ *   scaled delta:    u32 changedCount, per change u32 channel, u8 quality,
+ *                    then f64 value or i32 counts as set by the last keyframe
+ *
+ * A delta carries only channels whose quality changed or whose value moved
+ * beyond the deadband since the last value sent, and applies only on top
+ * of baseScanNumber. For fixed-point channels the deadband is converted to
+ * counts once per keyframe and compared exactly. Keyframes are sent first,
+ * on layout or scaling changes, every keyframeInterval frames and whenever
+ * a delta would not be smaller.
+ */
+class SnapshotDeltaEncoder {
+public:
+    struct Config {
+        uint32_t keyframeInterval;      // Frames between forced keyframes (0 = only when needed)
+        double deadband;                // Value change below which a channel is not resent
+    };
+
+    struct Statistics {
+        uint64_t keyframes;
+        uint64_t deltas;
+        uint64_t channelsSent;
+        uint64_t bytesEncoded;
+    };
+
+    static Config DefaultConfig() {
+        return Config{100, 0.0};
+    }
+
+private:
+    Config m_config;
+    SensorSnapshot m_reference;         // Values as the decoder holds them
+    bool m_hasReference;
+    uint32_t m_framesSinceKeyframe;
+    size_t m_keyframeBytes;             // Keyframe payload size for the reference layout
+    std::vector<int64_t> m_deadbandCounts;  // Deadband in counts per fixed-point channel
+    std::vector<uint32_t> m_changed;
+    Statistics m_statistics;
+
+public:
+    /**
+     * @brief Constructor
+     * @param config Keyframe interval and deadband
+     */
+    explicit SnapshotDeltaEncoder(const Config& config = DefaultConfig());
+
+    /**
+     * @brief Append one frame for a snapshot
+     * @param snapshot Snapshot to send
+     * @param frame Output buffer; the length-prefixed frame is appended
+     * @return Number of bytes appended
+     */
+    size_t Encode(const SensorSnapshot& snapshot, std::vector<uint8_t>& frame);
+
+    /**
+     * @brief Make the next frame a keyframe (e.g. for a newly connected client)
+     */
+    void ForceKeyframe();
+
+    /**
+     * @brief Get encoding statistics
+     * @return Frame, channel and byte counts
+     */
+    Statistics GetStatistics() const;
+
+private:
+    /**
+     * @brief Append a keyframe and reset the reference to snapshot
+     * @param snapshot Snapshot to send
+     * @param frame Output buffer
+     */
+    void EncodeKeyframe(const SensorSnapshot& snapshot, std::vector<uint8_t>& frame);
+
+    /**
+     * @brief Append a delta of the channels in m_changed and update the reference
+     * @param snapshot Snapshot to send
+     * @param frame Output buffer
+     */
+    void EncodeDelta(const SensorSnapshot& snapshot, std::vector<uint8_t>& frame);
+
+    /**
+     * @brief Check whether a channel differs from the reference enough to resend
+     * @param snapshot Snapshot being encoded
+     * @param channel Channel index
+     * @return true if the channel must be sent
+     */
+    bool ChannelChanged(const SensorSnapshot& snapshot, size_t channel) const;
+};
+
+/**
+ * @brief Rebuilds snapshots from SnapshotDeltaEncoder frames
+ *
+ * Fixed-point channels keep their counts and scaling, and their values
+ * entries are filled in as frames are applied.
+ */
+class SnapshotDeltaDecoder {
+public:
+    enum class Result {
+        Keyframe,           // Snapshot replaced
+        Delta,              // Snapshot updated in place
+        NeedKeyframe,       // Delta does not apply to the held snapshot; wait for a keyframe
+        Malformed           // Frame is corrupt; the stream should be dropped
+    };
+
+private:
+    SensorSnapshot m_snapshot;
+    bool m_hasSnapshot;
+
+public:
+    SnapshotDeltaDecoder();
+
+    /**
+     * @brief Apply one frame payload (without its length prefix)
+     * @param payload Frame payload
+     * @param size Payload size in bytes
+     * @return Outcome; the snapshot is only modified for Keyframe and Delta.
+     *         A frame is validated in full before any channel is applied.
+     */
+    Result Decode(const uint8_t* payload, size_t size);
+
+    /**
+     * @brief Get the snapshot rebuilt so far
+     * @return Current snapshot; empty before the first keyframe
+     */
+    const SensorSnapshot& GetSnapshot() const;
+
+    /**
+     * @brief Check whether a keyframe has been applied
+     * @return true once GetSnapshot is valid
+     */
+    bool HasSnapshot() const;
+
+    /**
+     * @brief Drop the held snapshot (e.g. after a reconnect)
+     */
+    void Reset();
+};
+
+/**
+ * @brief Splits a received byte stream into frame payloads
+ */
+class DeltaFrameAssembler {
+private:
+    std::vector<uint8_t> m_buffer;
+    size_t m_readOffset;
+    bool m_corrupt;
+
+public:
+    static constexpr uint32_t MAX_FRAME_SIZE = 64 * 1024 * 1024;
+
+    DeltaFrameAssembler();
+
+    /**
+     * @brief Append received bytes
+     * @param data Received data
+     * @param size Number of bytes
+     */
+    void Append(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Extract the next complete frame payload
+     * @param payload Output payload without the length prefix
+     * @return false if no complete frame is buffered or the stream is corrupt
+     */
+    bool Next(std::vector<uint8_t>& payload);
+
+    /**
+     * @brief Check whether a frame length exceeded MAX_FRAME_SIZE
+     * @return true if the stream cannot be resynchronized
+     */
+    bool IsCorrupt() const;
+
+    /**
+     * @brief Discard buffered bytes and clear the corrupt flag
+     */
+    void Reset();
+};
+
+} // namespace Nuclear
\ No newline at end of file
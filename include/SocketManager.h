@@ -1,5 +1,11 @@
 #pragma once
 
+#include "NetworkPlatform.h"
+#include "AcceptorPool.h"
+#include "ThreadPool.h"
+#include "TimerWheel.h"
+#include "ClientRegistry.h"
+#include "Clock.h"
 #include <string>
 #include <vector>
 #include <functional>
@@ -7,16 +13,7 @@
 #include <thread>
 #include <atomic>
 #include <mutex>
-
-#ifdef _WIN32
-#include <winsock2.h>
-#include <ws2tcpip.h>
-#pragma comment(lib, "ws2_32.lib")
-#else
-#include <sys/socket.h>
-#include <netinet/in.h>
-#include <arpa/inet.h>
-#endif
+#include <chrono>
 
 namespace Nuclear {
 
@@ -30,6 +27,8 @@ class SocketManager {
 public:
     using DataHandler = std::function<void(const std::string&, const std::string&)>;
     using ErrorHandler = std::function<void(const std::string&)>;
+    using ConnectHandler = std::function<void(const std::string&)>;
+    using DisconnectHandler = std::function<void(const std::string&)>;
 
 private:
     struct ClientConnection {
@@ -38,24 +37,40 @@ private:
         std::string clientId;
         bool authenticated;
         std::chrono::steady_clock::time_point lastActivity;
+        TimerWheel::TimerId heartbeatTimer;
+        TimerWheel::TimerId idleTimer;
     };
 
-    SOCKET m_serverSocket;
-    std::vector<ClientConnection> m_clients;
+    // Keyed by clientId; writers hold m_clientsMutex, BroadcastData reads lock-free
+    ClientRegistry<ClientConnection> m_clients;
     std::atomic<bool> m_running;
-    std::unique_ptr<std::thread> m_acceptThread;
-    std::unique_ptr<std::thread> m_heartbeatThread;
-    std::mutex m_clientsMutex;
+    std::unique_ptr<AcceptorPool> m_acceptorPool;
+    std::unique_ptr<ThreadPool> m_authWorkers;
+    std::unique_ptr<std::thread> m_networkThread;
+    mutable std::mutex m_clientsMutex;
+    
+    // Heartbeat, idle-timeout and deadline timers; owned by the network loop thread
+    TimerWheel m_timerWheel;
+    
+    // Read once per network loop iteration; that time drives the wheel and lastActivity
+    std::shared_ptr<IClock> m_clock;
     
     int m_port;
     DataHandler m_dataHandler;
     ErrorHandler m_errorHandler;
+    ConnectHandler m_connectHandler;
+    DisconnectHandler m_disconnectHandler;
     
     // Security settings
     static constexpr int MAX_CLIENTS = 10;
+    static constexpr int ACCEPTOR_SHARDS = 4;           // SO_REUSEPORT listeners
+    static constexpr int AUTH_WORKER_SHARDS = 2;        // Threads running AuthenticateClient
+    static constexpr int MAX_PENDING_AUTH = 256;        // Queued handshakes per worker shard
     static constexpr int HEARTBEAT_INTERVAL_MS = 30000; // 30 seconds
     static constexpr int CLIENT_TIMEOUT_MS = 60000;     // 60 seconds
     static constexpr int BUFFER_SIZE = 4096;
+    static constexpr int TIMER_TICK_MS = 100;           // Timer wheel resolution
+    static constexpr int NETWORK_POLL_MS = TIMER_TICK_MS;
 
 public:
     /**
@@ -90,17 +105,43 @@ public:
      * @brief Send data to all connected clients
      * @param data Data to send
      * @return Number of clients data was successfully sent to
+     *
+     * Iterates the registry's published broadcast snapshot without taking
+     * the clients mutex. Each target's lease keeps its socket open for the
+     * whole send, even if the client disconnects meanwhile.
      */
     int BroadcastData(const std::string& data);
     
     /**
      * @brief Send data to specific client
-     * @param clientId Client identifier
+     * @param clientId Client identifier (O(1) registry lookup)
      * @param data Data to send
      * @return true if data sent successfully
      */
     bool SendToClient(const std::string& clientId, const std::string& data);
     
+    /**
+     * @brief Send data to client by registry handle
+     * @param client Handle obtained from GetClientHandle
+     * @param data Data to send
+     * @return true if data sent successfully, false if handle is stale
+     */
+    bool SendToClient(SlotHandle client, const std::string& data);
+    
+    /**
+     * @brief Replace the clock driving heartbeats and idle timeouts
+     * @param clock Clock to read; nullptr restores the system clock
+     * @return false if the server is running
+     */
+    bool SetClock(std::shared_ptr<IClock> clock);
+    
+    /**
+     * @brief Resolve client ID to a stable registry handle
+     * @param clientId Client identifier
+     * @return Handle, or invalid handle if client is not connected
+     */
+    SlotHandle GetClientHandle(const std::string& clientId) const;
+    
     /**
      * @brief Set data handler callback
      * @param handler Function to call when data received from client
@@ -114,7 +155,27 @@ public:
     void SetErrorHandler(ErrorHandler handler);
     
     /**
-     * @brief Get number of connected clients
+     * @brief Set connect handler callback
+     * @param handler Function called with the client ID once a client is authenticated and registered
+     *
+     * Called on an authentication worker shard, after the worker has
+     * published the client into the broadcast snapshot, so the next
+     * BroadcastData already reaches it.
+     */
+    void SetConnectHandler(ConnectHandler handler);
+    
+    /**
+     * @brief Set disconnect handler callback
+     * @param handler Function called with the client ID after a client is removed
+     *
+     * Called from DisconnectClient on the network loop thread, for idle
+     * timeouts and failed sends alike, so per-client state kept elsewhere
+     * can be dropped when the client leaves.
+     */
+    void SetDisconnectHandler(DisconnectHandler handler);
+    
+    /**
+     * @brief Get number of connected clients (lock-free)
      * @return Current client count
      */
     int GetClientCount() const;
@@ -133,25 +194,75 @@ public:
 
 private:
     /**
-     * @brief Accept incoming client connections (runs in separate thread)
+     * @brief Hand a freshly accepted connection to an authentication worker shard
+     * @param clientSocket Non-blocking client socket from an acceptor shard
+     * @param clientAddress Client IP address
+     *
+     * Runs on an acceptor thread, so it only queues work; client ID generation
+     * and authentication run in AuthenticatePendingClient on a worker shard.
+     */
+    void OnConnectionAccepted(SOCKET clientSocket, const std::string& clientAddress);
+    
+    /**
+     * @brief Authenticate an accepted connection and register it (runs on worker shard)
+     * @param clientSocket Client socket awaiting authentication
+     * @param clientAddress Client IP address
      */
-    void AcceptConnections();
+    void AuthenticatePendingClient(SOCKET clientSocket, const std::string& clientAddress);
     
     /**
      * @brief Handle client communication
-     * @param client Client connection to handle
+     * @param client Handle of client connection to handle
+     *
+     * Takes a handle rather than a reference so concurrent registry
+     * inserts cannot invalidate it mid-call.
+     */
+    void HandleClient(SlotHandle client);
+    
+    /**
+     * @brief Poll client sockets and advance the timer wheel (runs in separate thread)
+     *
+     * Replaces the periodic heartbeat thread and full client scans: each client
+     * owns a heartbeat timer and an idle timer, so only due clients are touched.
+     * The clock is read once per iteration; that time advances the wheel and
+     * stamps lastActivity for every client polled in the iteration.
+     * Disconnects made during an iteration are published to the broadcast
+     * snapshot together, with one m_clients.PublishPending() at its end.
      */
-    void HandleClient(ClientConnection& client);
+    void NetworkLoop();
     
     /**
-     * @brief Send heartbeat to all clients (runs in separate thread)
+     * @brief Arm heartbeat and idle timers for a newly authenticated client
+     * @param client Client connection to arm timers for
+     * @param now Time of the current network loop iteration
      */
-    void HeartbeatMonitor();
+    void ArmClientTimers(ClientConnection& client, std::chrono::steady_clock::time_point now);
     
     /**
-     * @brief Remove disconnected or timed-out clients
+     * @brief Send heartbeat to one client and re-arm its heartbeat timer
+     * @param clientId Client identifier
+     */
+    void OnHeartbeatDue(const std::string& clientId);
+    
+    /**
+     * @brief Check idle timer expiry against lastActivity
+     * @param clientId Client identifier
+     * @param now Time the wheel was advanced to
+     *
+     * Activity only updates lastActivity; the timer is re-armed for the
+     * remaining time here, so traffic never touches the wheel.
+     */
+    void OnIdleTimeout(const std::string& clientId, std::chrono::steady_clock::time_point now);
+    
+    /**
+     * @brief Cancel a client's timers and remove it from the registry
+     * @param clientId Client identifier
+     *
+     * The socket is shut down here but closed by the registry once no
+     * broadcast snapshot still lists it; the snapshot is republished at the
+     * end of the network loop iteration. The disconnect handler runs last.
      */
-    void CleanupClients();
+    void DisconnectClient(const std::string& clientId);
     
     /**
      * @brief Authenticate client connection
@@ -0,0 +1,418 @@
+#pragma once
+
+#include "SnapshotDeltaCodec.h"
+#include "ByteBuffer.h"
+#include "NetworkPlatform.h"
+#include "Clock.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <unordered_map>
+#include <chrono>
+#include <cstdint>
+
+namespace Nuclear {
+
+/**
+ * @brief Monitor state mirrored to a hot standby every scan
+ */
+struct ReplicatedState {
+    struct Block {
+        std::string name;               // e.g. "anomaly" for AnomalyDetectorBank::ExportState
+        std::vector<double> data;
+    };
+
+    SensorSnapshot values;                      // Last acquired values and quality
+    std::unordered_map<int, bool> alarms;       // Alarm active per sensor/group ID
+    std::vector<Block> blocks;                  // Window aggregates and detector state
+};
+
+/**
+ * @brief Primary side of hot-standby replication
+ *
+ * The monitoring thread hands each scan's state to PublishScan, which only
+ * copies it into a staging slot; a sender thread encodes and streams it to
+ * the connected standby. Values travel as SnapshotDeltaEncoder deltas,
+ * alarms as changed entries and blocks as changed elements, so a quiet
+ * scan costs a few dozen bytes. A standby that connects gets a full sync
+ * first. When no scan is pending the sender emits heartbeats carrying the
+ * last scan number: heartbeats prove the link is up, the advancing scan
+ * number proves the monitoring thread is, so the standby can tell a hung
+ * primary from a quiet plant.
+ *
+ * Every frame carries the primary's epoch as a fencing token. A standby
+ * that took over connects back and sends a fence frame with a higher
+ * epoch; the replicator then stops streaming and calls the fenced handler,
+ * so a primary cut off by a partition steps down once the partition heals
+ * instead of staying active beside its replacement. A standby connecting
+ * while another is held replaces it, since a standby only reconnects after
+ * losing its connection.
+ *
+ * Endpoints are "host:port" for TCP or, on POSIX, "unix:/path".
+ * Frames are length-prefixed like the delta feed:
+ *   u8 type, u64 epoch, u64 scanNumber, u64 sentAt (microseconds since epoch), then for scans
+ *   u8 flags, u32 length + snapshot delta payload,
+ *   u32 alarm count + (i32 id, u8 active) entries,
+ *   u16 block count + per block: u16 name length, name, u32 size, u8 full,
+ *   then size f64 values or u32 count + (u32 index, f64 value) entries.
+ * Fence frames (standby to primary) are the header alone.
+ */
+class StateReplicator {
+public:
+    using FencedHandler = std::function<void(uint64_t epoch)>;
+
+    struct Config {
+        std::string endpoint;
+        std::chrono::milliseconds heartbeatInterval;
+        double valueDeadband;           // Passed to the snapshot delta encoder
+        uint64_t epoch;                 // Fencing token; 0 takes the construction time in microseconds
+    };
+
+    struct Statistics {
+        uint64_t scansPublished;
+        uint64_t scansSent;
+        uint64_t scansConflated;        // Replaced in staging before the sender took them
+        uint64_t heartbeatsSent;
+        uint64_t fullSyncs;
+        uint64_t bytesSent;
+        double averagePublishMicros;    // Cost on the monitoring thread per scan
+        double maxPublishMicros;
+        double averageEncodeMicros;     // Cost on the sender thread per scan
+        double averageBytesPerScan;
+        bool standbyConnected;
+    };
+
+    static Config DefaultConfig() {
+        return Config{"127.0.0.1:7600", std::chrono::milliseconds(100), 0.0, 0};
+    }
+
+private:
+    Config m_config;
+    std::shared_ptr<IClock> m_clock;
+    uint64_t m_epoch;
+    SOCKET m_listenSocket;
+    SOCKET m_standbySocket;
+    int m_boundPort;
+    std::atomic<bool> m_running;
+    std::atomic<bool> m_fenced;
+    FencedHandler m_fencedHandler;
+    std::unique_ptr<std::thread> m_senderThread;
+
+    // Staging slot handed from the monitoring thread to the sender
+    ReplicatedState m_staging;
+    bool m_stagedPending;
+    std::mutex m_stagingMutex;
+    std::condition_variable m_stagingCondition;
+
+    // Sender thread only: state as the standby holds it
+    ReplicatedState m_sending;
+    SnapshotDeltaEncoder m_encoder;
+    std::unordered_map<int, bool> m_sentAlarms;
+    std::unordered_map<std::string, std::vector<double>> m_sentBlocks;
+    std::vector<uint8_t> m_snapshotFrame;
+    std::vector<uint8_t> m_frame;
+
+    // Sender thread only: frames read back from the standby connection
+    DeltaFrameAssembler m_standbyInput;
+    std::vector<uint8_t> m_inputBuffer;
+    std::vector<uint8_t> m_inputPayload;
+
+    mutable std::mutex m_statisticsMutex;
+    Statistics m_statistics;
+    double m_publishMicrosTotal;
+    double m_encodeMicrosTotal;
+
+    static constexpr int ACCEPT_POLL_MS = 50;
+    static constexpr size_t INPUT_BUFFER_SIZE = 256;
+
+public:
+    /**
+     * @brief Constructor
+     * @param config Endpoint, heartbeat interval, deadband and epoch
+     * @param clock Clock for frame timestamps; nullptr uses the system clock
+     */
+    explicit StateReplicator(const Config& config = DefaultConfig(), std::shared_ptr<IClock> clock = nullptr);
+
+    /**
+     * @brief Destructor - stops the sender and closes sockets
+     */
+    ~StateReplicator();
+
+    StateReplicator(const StateReplicator&) = delete;
+    StateReplicator& operator=(const StateReplicator&) = delete;
+
+    /**
+     * @brief Set the function called once when a standby that took over fences this primary
+     * @param handler Called on the sender thread with the fencing epoch; set before Start
+     */
+    void SetFencedHandler(FencedHandler handler);
+
+    /**
+     * @brief Listen for a standby and start the sender thread
+     * @return false if the endpoint cannot be bound
+     */
+    bool Start();
+
+    /**
+     * @brief Stop the sender and disconnect the standby
+     */
+    void Stop();
+
+    /**
+     * @brief Get the bound TCP port (useful with port 0)
+     * @return Port, or -1 for Unix sockets or when not started
+     */
+    int GetPort() const;
+
+    /**
+     * @brief Get the epoch stamped on every frame
+     * @return Fencing token of this primary
+     */
+    uint64_t GetEpoch() const;
+
+    /**
+     * @brief Check whether a higher epoch has fenced this primary
+     * @return true once a fence frame was received; nothing is sent afterwards
+     */
+    bool IsFenced() const;
+
+    /**
+     * @brief Hand one scan's state to the sender (monitoring thread)
+     * @param state State after the scan was processed
+     *
+     * Copies into a staging slot and returns; an unsent previous scan is
+     * replaced, so a slow standby never blocks the scan.
+     */
+    void PublishScan(const ReplicatedState& state);
+
+    /**
+     * @brief Encode a scan message relative to what the standby already holds
+     * @param state State to send
+     * @param fullSync true to send everything (new standby)
+     * @param frame Output buffer; the length-prefixed frame is appended
+     * @return Bytes appended
+     */
+    size_t EncodeScan(const ReplicatedState& state, bool fullSync, std::vector<uint8_t>& frame);
+
+    /**
+     * @brief Encode a heartbeat
+     * @param scanNumber Last scan published
+     * @param frame Output buffer; the length-prefixed frame is appended
+     * @return Bytes appended
+     */
+    size_t EncodeHeartbeat(uint64_t scanNumber, std::vector<uint8_t>& frame) const;
+
+    /**
+     * @brief Get replication overhead statistics
+     * @return Statistics snapshot
+     */
+    Statistics GetStatistics() const;
+
+private:
+    /**
+     * @brief Accept a standby, stream scans and heartbeats (sender thread)
+     */
+    void SenderLoop();
+
+    /**
+     * @brief Accept a pending standby connection if one is waiting
+     * @param timeoutMs How long to wait for one
+     * @return true if a new standby was accepted; it replaces any held one
+     */
+    bool AcceptStandby(int timeoutMs);
+
+    /**
+     * @brief Read whatever the standby connection has sent, without blocking
+     * @return Epoch of a fence frame outranking this primary, or 0
+     *
+     * A followed standby never sends; end of stream disconnects it.
+     */
+    uint64_t ReadStandbyInput();
+
+    /**
+     * @brief Close the standby connection
+     */
+    void DisconnectStandby();
+
+    /**
+     * @brief Send the frame buffer to the standby, disconnecting it on failure
+     * @return true if the whole frame was sent
+     */
+    bool SendFrame();
+};
+
+/**
+ * @brief Standby side of hot-standby replication
+ *
+ * Connects to the primary's endpoint and applies each message to its copy
+ * of the monitor state; a message that fails part way leaves it untouched.
+ * If nothing arrives for takeoverTimeout after a full sync, or heartbeats
+ * keep arriving but the scan number has not advanced for takeoverTimeout
+ * (the primary's monitoring thread is hung), it stops following and calls
+ * the takeover handler with the last applied state, so the standby can
+ * start monitoring from the primary's alarm and detector state.
+ *
+ * Frames from an epoch below the highest one followed are refused. After
+ * takeover the receive thread keeps connecting to the old primary and
+ * sending a fence frame with the next epoch until stopped, so the old
+ * primary steps down as soon as it can be reached.
+ */
+class StandbyReceiver {
+public:
+    using TakeoverHandler = std::function<void(const ReplicatedState&)>;
+
+    struct Config {
+        std::string endpoint;
+        std::chrono::milliseconds takeoverTimeout;      // Silence or stalled scans; a few scan periods
+        std::chrono::milliseconds reconnectInterval;
+    };
+
+    struct Statistics {
+        uint64_t scansApplied;
+        uint64_t heartbeats;
+        uint64_t bytesReceived;
+        uint64_t resyncs;               // Messages ignored until the next full sync
+        uint64_t staleFrames;           // Refused: epoch below the highest followed
+        uint64_t fencesSent;            // Fence frames delivered after takeover
+        uint64_t lastScanNumber;
+        uint64_t epoch;                 // Highest primary epoch followed
+        double lastLagMicros;           // Receive time minus primary send time
+        double maxLagMicros;
+        double averageApplyMicros;
+        bool synchronized;
+        bool takenOver;
+    };
+
+    static Config DefaultConfig() {
+        return Config{"127.0.0.1:7600", std::chrono::milliseconds(3000), std::chrono::milliseconds(100)};
+    }
+
+private:
+    Config m_config;
+    std::shared_ptr<IClock> m_clock;
+    TakeoverHandler m_takeoverHandler;
+    std::atomic<bool> m_running;
+    std::atomic<bool> m_takenOver;
+    std::atomic<bool> m_handedOver;     // Takeover handler has returned
+    std::unique_ptr<std::thread> m_receiveThread;
+
+    // Applied state (guarded by m_stateMutex); values live in the decoder and are copied out on read
+    ReplicatedState m_state;
+    SnapshotDeltaDecoder m_decoder;
+    std::vector<uint8_t> m_snapshotPayload;
+    bool m_synchronized;                // Last message applied cleanly on top of a full sync
+    bool m_everSynchronized;            // Takeover is only possible with a state to take over
+    uint64_t m_epoch;                   // Highest primary epoch followed
+    uint64_t m_progressScan;            // Highest scan number seen from that primary
+    std::chrono::steady_clock::time_point m_lastHeard;
+    std::chrono::steady_clock::time_point m_lastProgress;   // When m_progressScan last advanced
+    mutable std::mutex m_stateMutex;
+
+    Statistics m_statistics;
+    double m_applyMicrosTotal;
+
+    static constexpr int RECEIVE_POLL_MS = 10;
+    static constexpr size_t RECEIVE_BUFFER_SIZE = 64 * 1024;
+
+public:
+    /**
+     * @brief Constructor
+     * @param config Primary endpoint, takeover timeout and reconnect interval
+     * @param clock Clock for heartbeat supervision; nullptr uses the system clock
+     */
+    explicit StandbyReceiver(const Config& config = DefaultConfig(), std::shared_ptr<IClock> clock = nullptr);
+
+    /**
+     * @brief Destructor - stops following
+     */
+    ~StandbyReceiver();
+
+    StandbyReceiver(const StandbyReceiver&) = delete;
+    StandbyReceiver& operator=(const StandbyReceiver&) = delete;
+
+    /**
+     * @brief Set the function called once on takeover
+     * @param handler Called on the receive thread (or the CheckTakeover caller)
+     */
+    void SetTakeoverHandler(TakeoverHandler handler);
+
+    /**
+     * @brief Start following the primary
+     * @return false if already running or taken over
+     */
+    bool Start();
+
+    /**
+     * @brief Stop following (or fencing, after takeover)
+     */
+    void Stop();
+
+    /**
+     * @brief Apply one frame payload (without its length prefix)
+     * @param payload Frame payload
+     * @param size Payload size
+     * @return false if the message is malformed, from a stale epoch, or the connection
+     *         should otherwise be dropped
+     */
+    bool Ingest(const uint8_t* payload, size_t size);
+
+    /**
+     * @brief Take over if the primary has been silent, or its scans stalled, past the timeout
+     * @return true if takeover happened in this call
+     *
+     * Polled by the receive thread; callable directly when not started.
+     */
+    bool CheckTakeover();
+
+    /**
+     * @brief Get a copy of the applied state
+     * @return Replicated state
+     */
+    ReplicatedState GetState() const;
+
+    /**
+     * @brief Check whether a full sync has been applied
+     * @return true if the state mirrors the primary
+     */
+    bool IsSynchronized() const;
+
+    /**
+     * @brief Check whether takeover has happened
+     * @return true once the takeover handler has returned
+     */
+    bool HasTakenOver() const;
+
+    /**
+     * @brief Get replication statistics
+     * @return Statistics snapshot
+     */
+    Statistics GetStatistics() const;
+
+private:
+    /**
+     * @brief Connect, apply messages and supervise heartbeats; fence after takeover (receive thread)
+     */
+    void ReceiveLoop();
+
+    /**
+     * @brief Check or apply a scan message body
+     * @param reader Reader positioned after the flags byte
+     * @param state State to update (the held one, or an empty one for a full sync)
+     * @param decoder Decoder holding the values (the held one, or a fresh one for a full sync)
+     * @param apply false to only validate; state and decoder are then left untouched
+     * @return false if the message does not apply
+     *
+     * A delta is checked against the held state first and then applied in
+     * place, so its cost follows the size of the message rather than of
+     * the state. In the apply pass the values are decoded before anything
+     * else changes, so a full sync that fails leaves only its copies behind.
+     */
+    bool ApplyScan(ByteReader reader, ReplicatedState& state, SnapshotDeltaDecoder& decoder, bool apply);
+};
+
+} // namespace Nuclear
\ No newline at end of file
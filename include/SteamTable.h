@@ -0,0 +1,165 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace Nuclear {
+
+class DerivedChannelEngine;
+
+// Unit conversions between plant units (Celsius, PSI) and IAPWS units (K, MPa)
+constexpr double KELVIN_OFFSET = 273.15;
+constexpr double MPA_PER_PSI = 0.006894757293168361;
+
+constexpr double CelsiusToKelvin(double celsius) { return celsius + KELVIN_OFFSET; }
+constexpr double KelvinToCelsius(double kelvin) { return kelvin - KELVIN_OFFSET; }
+constexpr double CelsiusToFahrenheit(double celsius) { return celsius * 1.8 + 32.0; }
+constexpr double FahrenheitToCelsius(double fahrenheit) { return (fahrenheit - 32.0) / 1.8; }
+constexpr double PsiToMPa(double psi) { return psi * MPA_PER_PSI; }
+constexpr double MPaToPsi(double mpa) { return mpa / MPA_PER_PSI; }
+
+/**
+ * @brief Tabulated water/steam saturation line (IAPWS-IF97 region 4)
+ *
+ * The saturation equations are evaluated once at construction onto uniform
+ * grids in their natural variables: Tsat is tabulated against p^0.25 and
+ * p^0.25 against T, both of which are smooth enough for linear interpolation
+ * to stay well inside instrument accuracy. A lookup is then one square root
+ * pair or multiply, a clamped index and a lerp, with no branches, so the
+ * batch overloads auto-vectorise. Tables are a few KB and stay cache-resident.
+ *
+ * Temperatures are in Celsius and pressures in PSI (absolute), matching the
+ * plant sensors. Inputs outside the configured range return NaN.
+ *
+ * Immutable after construction; safe to share between threads.
+ */
+class SteamTable {
+public:
+    struct Config {
+        double minPressurePsi;
+        double maxPressurePsi;        // At most the critical pressure (3200.1 psia)
+        double minTemperatureC;
+        double maxTemperatureC;       // At most the critical temperature (373.946 C)
+        size_t points;                // Grid points per table
+    };
+
+    static constexpr double CRITICAL_PRESSURE_MPA = 22.064;
+    static constexpr double CRITICAL_TEMPERATURE_K = 647.096;
+
+private:
+    Config m_config;
+
+    // Saturation temperature (C) on a uniform grid in p^0.25 (p in PSI)
+    std::vector<double> m_temperatureTable;
+    double m_pressureRootMin;
+    double m_pressureRootMax;
+    double m_pressureRootScale;     // (points - 1) / (rootMax - rootMin)
+
+    // p^0.25 (p in PSI) on a uniform grid in temperature (C)
+    std::vector<double> m_pressureRootTable;
+    double m_temperatureScale;      // (points - 1) / (maxT - minT)
+
+    double m_maxTemperatureError;
+    double m_maxPressureError;
+
+public:
+    /**
+     * @brief Build tables for the given range and measure interpolation error
+     * @param config Table range and resolution; out-of-range values are clamped to valid IF97 limits
+     */
+    explicit SteamTable(const Config& config = DefaultConfig());
+
+    /**
+     * @brief Default table covering atmospheric to critical pressure
+     * @return Default configuration
+     */
+    static Config DefaultConfig();
+
+    /**
+     * @brief Saturation temperature from the table
+     * @param pressurePsi Absolute pressure in PSI
+     * @return Saturation temperature in Celsius, NaN outside the table range
+     */
+    double SaturationTemperature(double pressurePsi) const;
+
+    /**
+     * @brief Saturation pressure from the table
+     * @param temperatureC Temperature in Celsius
+     * @return Saturation pressure in PSI, NaN outside the table range
+     */
+    double SaturationPressure(double temperatureC) const;
+
+    /**
+     * @brief Subcooling margin: saturation temperature minus actual temperature
+     * @param temperatureC Coolant temperature in Celsius
+     * @param pressurePsi Coolant pressure in PSI
+     * @return Margin in Celsius; negative when the coolant is at or past saturation
+     */
+    double SubcoolingMargin(double temperatureC, double pressurePsi) const;
+
+    /**
+     * @brief Batch saturation temperature for many pressures
+     * @param pressurePsi Input pressures
+     * @param temperatureC Output temperatures
+     * @param count Number of values
+     */
+    void SaturationTemperature(const double* pressurePsi, double* temperatureC, size_t count) const;
+
+    /**
+     * @brief Batch saturation pressure for many temperatures
+     * @param temperatureC Input temperatures
+     * @param pressurePsi Output pressures
+     * @param count Number of values
+     */
+    void SaturationPressure(const double* temperatureC, double* pressurePsi, size_t count) const;
+
+    /**
+     * @brief Saturation temperature from the IF97 backward equation (reference, slow)
+     * @param pressureMPa Absolute pressure in MPa
+     * @return Saturation temperature in K
+     */
+    static double ExactSaturationTemperature(double pressureMPa);
+
+    /**
+     * @brief Saturation pressure from the IF97 saturation equation (reference, slow)
+     * @param temperatureK Temperature in K
+     * @return Saturation pressure in MPa
+     */
+    static double ExactSaturationPressure(double temperatureK);
+
+    /**
+     * @brief Largest table error against IF97 found at construction
+     * @return Error in Celsius
+     */
+    double GetMaxTemperatureError() const;
+
+    /**
+     * @brief Largest relative table error against IF97 found at construction
+     * @return Relative error (fraction of pressure)
+     */
+    double GetMaxPressureError() const;
+
+    /**
+     * @brief Get table configuration
+     * @return Configuration after clamping to IF97 limits
+     */
+    const Config& GetConfig() const;
+};
+
+/**
+ * @brief Process-wide default steam table, built on first use
+ * @return Shared table covering DefaultConfig()
+ */
+const SteamTable& GetDefaultSteamTable();
+
+/**
+ * @brief Register steam-table functions with a derived-channel engine
+ * @param engine Engine to extend
+ * @return true if all functions were registered
+ *
+ * Adds tsat(psi), psat(celsius), subcooling(celsius, psi), c_to_f, f_to_c,
+ * psi_to_mpa and mpa_to_psi, all backed by GetDefaultSteamTable().
+ */
+bool RegisterSteamTableFunctions(DerivedChannelEngine& engine);
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace Nuclear {
+
+/**
+ * @brief Routes published plant data to the clients subscribed to that plant
+ *
+ * Used by PlantHost's shared network front-end. The routing table is an
+ * immutable snapshot republished on every change, so the per-scan publish
+ * path of each plant looks up its subscribers without taking a lock.
+ * Subscriptions change rarely; each change copies the table under a mutex.
+ *
+ * Every plant has two feeds: JSON reports ("SUBSCRIBE <plantId>") and the
+ * binary SnapshotDeltaEncoder feed ("SUBSCRIBE_DELTA [plantId]", as sent by
+ * a FleetAggregator). Each feed has its own table, so a report lookup never
+ * sees delta subscribers and vice versa.
+ */
+class SubscriptionRouter {
+public:
+    using SubscriberList = std::vector<std::string>;
+
+    enum class Feed {
+        Reports,
+        Delta
+    };
+
+private:
+    using RouteTable = std::unordered_map<std::string, std::shared_ptr<const SubscriberList>>;
+
+    std::shared_ptr<const RouteTable> m_routes;
+    std::shared_ptr<const RouteTable> m_deltaRoutes;
+    std::mutex m_updateMutex;
+
+public:
+    /**
+     * @brief Constructor - publishes an empty routing table
+     */
+    SubscriptionRouter();
+
+    /**
+     * @brief Add a plant clients may subscribe to
+     * @param plantId Plant identifier
+     * @return false if the plant is already registered or the ID is empty
+     */
+    bool RegisterPlant(const std::string& plantId);
+
+    /**
+     * @brief Subscribe a client to a plant
+     * @param clientId Client identifier
+     * @param plantId Plant identifier
+     * @param feed Feed to subscribe to
+     * @return false if the plant is unknown; subscribing twice is not an error
+     */
+    bool Subscribe(const std::string& clientId, const std::string& plantId, Feed feed = Feed::Reports);
+
+    /**
+     * @brief Remove one subscription
+     * @param clientId Client identifier
+     * @param plantId Plant identifier
+     * @param feed Feed to unsubscribe from
+     * @return true if the client was subscribed
+     */
+    bool Unsubscribe(const std::string& clientId, const std::string& plantId, Feed feed = Feed::Reports);
+
+    /**
+     * @brief Remove every subscription of a client on both feeds (e.g. after disconnect)
+     * @param clientId Client identifier
+     * @return Number of subscriptions removed
+     */
+    size_t RemoveClient(const std::string& clientId);
+
+    /**
+     * @brief Get the clients subscribed to a plant (lock-free)
+     * @param plantId Plant identifier
+     * @param feed Feed to look up
+     * @return Immutable list valid for as long as the caller holds it; nullptr if the plant is unknown
+     */
+    std::shared_ptr<const SubscriberList> GetSubscribers(const std::string& plantId, Feed feed = Feed::Reports) const;
+
+    /**
+     * @brief Get registered plant IDs
+     * @return Plant identifiers in no particular order
+     */
+    std::vector<std::string> GetPlantIds() const;
+
+    /**
+     * @brief Handle a subscription command from a client
+     * @param clientId Client that sent the message
+     * @param message "SUBSCRIBE <plantId>", "UNSUBSCRIBE <plantId>" or "SUBSCRIBE_DELTA [plantId]"
+     * @param response Reply to send the client; left empty when the client joined a delta feed
+     * @param deltaPlantId Set to the plant whose delta feed the client joined, if any
+     * @return false if message is not a subscription command (response untouched)
+     *
+     * SUBSCRIBE_DELTA may omit the plant ID when exactly one plant is
+     * registered, which is what a FleetAggregator link sends. Joining a
+     * delta feed moves the client off that plant's report feed, and no text
+     * reply is sent because the connection now carries binary frames only.
+     */
+    bool HandleCommand(const std::string& clientId, const std::string& message, std::string& response,
+                       std::string* deltaPlantId = nullptr);
+
+private:
+    /**
+     * @brief Get current table snapshot
+     * @param feed Feed whose table to get
+     * @return Routing table
+     */
+    std::shared_ptr<const RouteTable> CurrentRoutes(Feed feed = Feed::Reports) const;
+
+    /**
+     * @brief Publish a modified table (caller holds m_updateMutex)
+     * @param routes New routing table
+     * @param feed Feed the table belongs to
+     */
+    void PublishRoutes(RouteTable routes, Feed feed = Feed::Reports);
+};
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+
+namespace Nuclear {
+
+/**
+ * @brief Sharded worker pool for off-loading work from latency-sensitive threads
+ *
+ * Each shard owns one worker thread and its own queue, so tasks submitted
+ * with the same shard key run in order and never contend with other shards.
+ */
+class ThreadPool {
+public:
+    using Task = std::function<void()>;
+
+private:
+    struct Shard {
+        std::deque<Task> queue;
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::unique_ptr<std::thread> worker;
+    };
+
+    std::vector<std::unique_ptr<Shard>> m_shards;
+    std::atomic<bool> m_running;
+    std::atomic<size_t> m_nextShard;
+    std::atomic<size_t> m_pendingTasks;
+    size_t m_maxQueuedPerShard;
+
+public:
+    /**
+     * @brief Constructor
+     * @param shardCount Number of worker shards (at least one)
+     * @param maxQueuedPerShard Maximum queued tasks per shard before Submit rejects
+     */
+    explicit ThreadPool(size_t shardCount, size_t maxQueuedPerShard = 1024);
+
+    /**
+     * @brief Destructor - drains queued tasks and joins workers
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Submit task to the next shard in round-robin order
+     * @param task Task to execute
+     * @return true if task was queued, false if pool is stopped or shard is full
+     */
+    bool Submit(Task task);
+
+    /**
+     * @brief Submit task to the shard selected by key
+     * @param shardKey Key hashed onto a shard (e.g. client socket)
+     * @param task Task to execute
+     * @return true if task was queued, false if pool is stopped or shard is full
+     */
+    bool SubmitTo(size_t shardKey, Task task);
+
+    /**
+     * @brief Stop accepting tasks, finish queued ones and join workers
+     */
+    void Shutdown();
+
+    /**
+     * @brief Get number of worker shards
+     * @return Shard count
+     */
+    size_t GetShardCount() const;
+
+    /**
+     * @brief Get number of tasks queued or running across all shards
+     * @return Pending task count
+     */
+    size_t GetPendingTasks() const;
+
+private:
+    /**
+     * @brief Worker loop for a single shard
+     * @param shard Shard served by this worker
+     */
+    void WorkerLoop(Shard& shard);
+
+    /**
+     * @brief Queue task on a specific shard
+     * @param shard Target shard
+     * @param task Task to queue
+     * @return true if task was queued
+     */
+    bool Enqueue(Shard& shard, Task task);
+};
+
+} // namespace Nuclear
\ No newline at end of file
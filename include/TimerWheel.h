@@ -0,0 +1,160 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <functional>
+#include <chrono>
+#include <cstdint>
+
+namespace Nuclear {
+
+/**
+ * @brief Hierarchical timer wheel for heartbeats, idle timeouts and request deadlines
+ *
+ * Four levels of 64 slots each; timers live in a pooled, intrusively linked
+ * table so Schedule, Cancel and Reschedule are O(1) and expiry costs O(1)
+ * amortized per timer. Designed to be driven from a single network loop
+ * thread and is not thread-safe.
+ */
+class TimerWheel {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Callback = std::function<void()>;
+    using TimerId = uint64_t;
+
+    static constexpr TimerId INVALID_TIMER = 0;
+
+private:
+    static constexpr int LEVELS = 4;
+    static constexpr int SLOT_BITS = 6;
+    static constexpr uint32_t SLOTS_PER_LEVEL = 1u << SLOT_BITS;
+    static constexpr uint32_t SLOT_MASK = SLOTS_PER_LEVEL - 1;
+    static constexpr uint32_t NO_ENTRY = 0xFFFFFFFFu;
+
+    struct TimerEntry {
+        uint64_t expiryTick;
+        uint32_t generation;
+        uint32_t next;
+        uint32_t prev;
+        uint16_t level;
+        uint16_t slot;
+        bool active;
+        Callback callback;
+    };
+
+    std::vector<TimerEntry> m_entries;
+    uint32_t m_freeList;
+    std::array<std::array<uint32_t, SLOTS_PER_LEVEL>, LEVELS> m_slots;
+
+    Clock::time_point m_startTime;
+    std::chrono::milliseconds m_tickDuration;
+    uint64_t m_currentTick;
+    size_t m_activeTimers;
+
+public:
+    /**
+     * @brief Constructor
+     * @param tickDuration Wheel resolution; timers fire on tick boundaries
+     * @param initialCapacity Number of timer entries to pre-allocate
+     * @param startTime Time corresponding to tick zero
+     */
+    TimerWheel(std::chrono::milliseconds tickDuration, size_t initialCapacity,
+               Clock::time_point startTime = Clock::now());
+
+    /**
+     * @brief Schedule callback to run after delay
+     * @param delay Delay until expiry (rounded up to whole ticks)
+     * @param callback Function to run on expiry
+     * @return Timer identifier for Cancel/Reschedule
+     */
+    TimerId Schedule(std::chrono::milliseconds delay, Callback callback);
+
+    /**
+     * @brief Cancel a pending timer
+     * @param timerId Timer to cancel
+     * @return true if timer was pending and has been cancelled
+     */
+    bool Cancel(TimerId timerId);
+
+    /**
+     * @brief Move a pending timer to a new expiry, keeping its callback
+     * @param timerId Timer to move
+     * @param delay New delay from the current tick
+     * @return true if timer was pending and has been moved
+     */
+    bool Reschedule(TimerId timerId, std::chrono::milliseconds delay);
+
+    /**
+     * @brief Check whether a timer is still pending
+     * @param timerId Timer to check
+     * @return true if timer has neither fired nor been cancelled
+     */
+    bool IsPending(TimerId timerId) const;
+
+    /**
+     * @brief Advance wheel to current time and fire expired timers
+     * @param now Current time
+     * @return Number of timers fired
+     */
+    size_t Advance(Clock::time_point now);
+
+    /**
+     * @brief Get number of pending timers
+     * @return Pending timer count
+     */
+    size_t GetActiveTimers() const;
+
+    /**
+     * @brief Get wheel resolution
+     * @return Tick duration
+     */
+    std::chrono::milliseconds GetTickDuration() const;
+
+private:
+    /**
+     * @brief Take an entry from the free list, growing the pool if needed
+     * @return Entry index
+     */
+    uint32_t AllocateEntry();
+
+    /**
+     * @brief Return an entry to the free list
+     * @param index Entry index
+     */
+    void ReleaseEntry(uint32_t index);
+
+    /**
+     * @brief Link entry into the slot matching its expiry tick
+     * @param index Entry index
+     */
+    void Link(uint32_t index);
+
+    /**
+     * @brief Unlink entry from its slot
+     * @param index Entry index
+     */
+    void Unlink(uint32_t index);
+
+    /**
+     * @brief Re-file every timer in a higher-level slot into lower levels
+     * @param level Wheel level
+     * @param slot Slot within level
+     */
+    void Cascade(int level, uint32_t slot);
+
+    /**
+     * @brief Convert delay to absolute expiry tick
+     * @param delay Delay from current tick
+     * @return Expiry tick (always after current tick)
+     */
+    uint64_t ExpiryTick(std::chrono::milliseconds delay) const;
+
+    /**
+     * @brief Resolve timer ID to entry index
+     * @param timerId Timer identifier
+     * @return Entry index or NO_ENTRY if ID is stale
+     */
+    uint32_t Resolve(TimerId timerId) const;
+};
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,230 @@
+#include "AcceptorPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace Nuclear {
+
+AcceptorPool::AcceptorPool(int port, size_t shardCount)
+    : m_running(false), m_port(port), m_requestedShards(std::max<size_t>(shardCount, 1)),
+      m_acceptedConnections(0), m_acceptBatches(0), m_largestBatch(0), m_acceptErrors(0) {
+#ifdef _WIN32
+    // Winsock has no SO_REUSEPORT load balancing across listeners
+    m_requestedShards = 1;
+#endif
+}
+
+AcceptorPool::~AcceptorPool() {
+    Stop();
+}
+
+void AcceptorPool::SetConnectionHandler(ConnectionHandler handler) {
+    m_connectionHandler = std::move(handler);
+}
+
+void AcceptorPool::SetErrorHandler(ErrorHandler handler) {
+    m_errorHandler = std::move(handler);
+}
+
+bool AcceptorPool::Start() {
+    if (m_running.load() || !m_connectionHandler) {
+        return false;
+    }
+
+    bool reusePort = m_requestedShards > 1;
+    for (size_t i = 0; i < m_requestedShards; ++i) {
+        SOCKET listenSocket = CreateListenSocket(reusePort);
+        if (listenSocket == INVALID_SOCKET) {
+            ReportError("Failed to open acceptor shard " + std::to_string(i) + " on port " + std::to_string(m_port));
+            continue;
+        }
+        m_shards.push_back({listenSocket, nullptr});
+    }
+
+    if (m_shards.empty()) {
+        return false;
+    }
+
+    m_running = true;
+    for (auto& shard : m_shards) {
+        SOCKET listenSocket = shard.listenSocket;
+        shard.thread = std::make_unique<std::thread>([this, listenSocket]() { AcceptLoop(listenSocket); });
+    }
+
+    return true;
+}
+
+void AcceptorPool::Stop() {
+    m_running = false;
+
+    for (auto& shard : m_shards) {
+        if (shard.thread && shard.thread->joinable()) {
+            shard.thread->join();
+        }
+        if (shard.listenSocket != INVALID_SOCKET) {
+            closesocket(shard.listenSocket);
+        }
+    }
+
+    m_shards.clear();
+}
+
+size_t AcceptorPool::GetShardCount() const {
+    return m_shards.size();
+}
+
+AcceptorPool::Statistics AcceptorPool::GetStatistics() const {
+    return Statistics{
+        m_acceptedConnections.load(std::memory_order_relaxed),
+        m_acceptBatches.load(std::memory_order_relaxed),
+        m_largestBatch.load(std::memory_order_relaxed),
+        m_acceptErrors.load(std::memory_order_relaxed)
+    };
+}
+
+// Private methods implementation
+
+SOCKET AcceptorPool::CreateListenSocket(bool reusePort) {
+    SOCKET listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (listenSocket == INVALID_SOCKET) {
+        return INVALID_SOCKET;
+    }
+
+    int enable = 1;
+    setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&enable), sizeof(enable));
+
+#ifdef SO_REUSEPORT
+    if (reusePort &&
+        setsockopt(listenSocket, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<const char*>(&enable), sizeof(enable)) != 0) {
+        closesocket(listenSocket);
+        return INVALID_SOCKET;
+    }
+#else
+    (void)reusePort;
+#endif
+
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(static_cast<uint16_t>(m_port));
+
+    if (bind(listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == SOCKET_ERROR ||
+        listen(listenSocket, SOMAXCONN) == SOCKET_ERROR) {
+        closesocket(listenSocket);
+        return INVALID_SOCKET;
+    }
+
+#ifdef _WIN32
+    u_long nonBlocking = 1;
+    ioctlsocket(listenSocket, FIONBIO, &nonBlocking);
+#else
+    fcntl(listenSocket, F_SETFL, fcntl(listenSocket, F_GETFL, 0) | O_NONBLOCK);
+#endif
+
+    return listenSocket;
+}
+
+void AcceptorPool::AcceptLoop(SOCKET listenSocket) {
+    while (m_running.load()) {
+#ifdef _WIN32
+        WSAPOLLFD pollDescriptor{};
+        pollDescriptor.fd = listenSocket;
+        pollDescriptor.events = POLLRDNORM;
+        int ready = WSAPoll(&pollDescriptor, 1, POLL_TIMEOUT_MS);
+#else
+        pollfd pollDescriptor{};
+        pollDescriptor.fd = listenSocket;
+        pollDescriptor.events = POLLIN;
+        int ready = poll(&pollDescriptor, 1, POLL_TIMEOUT_MS);
+#endif
+
+        if (ready <= 0) {
+            continue;  // Timeout or interrupted; re-check running flag
+        }
+
+        bool descriptorsExhausted = false;
+        size_t accepted = DrainAcceptQueue(listenSocket, descriptorsExhausted);
+        if (descriptorsExhausted) {
+            // The pending connection stays queued and the listener stays readable,
+            // so stop polling it until descriptors are released instead of spinning
+            std::this_thread::sleep_for(std::chrono::milliseconds(EXHAUSTED_BACKOFF_MS));
+        }
+        if (accepted == 0) {
+            continue;
+        }
+
+        m_acceptBatches.fetch_add(1, std::memory_order_relaxed);
+        size_t largest = m_largestBatch.load(std::memory_order_relaxed);
+        while (accepted > largest &&
+               !m_largestBatch.compare_exchange_weak(largest, accepted, std::memory_order_relaxed)) {
+        }
+    }
+}
+
+size_t AcceptorPool::DrainAcceptQueue(SOCKET listenSocket, bool& descriptorsExhausted) {
+    size_t accepted = 0;
+    descriptorsExhausted = false;
+
+    while (accepted < MAX_ACCEPT_BATCH) {
+        sockaddr_in clientAddress;
+        socklen_t addressLength = sizeof(clientAddress);
+
+#if defined(__linux__)
+        SOCKET clientSocket = accept4(listenSocket, reinterpret_cast<sockaddr*>(&clientAddress),
+                                      &addressLength, SOCK_NONBLOCK | SOCK_CLOEXEC);
+#else
+        SOCKET clientSocket = accept(listenSocket, reinterpret_cast<sockaddr*>(&clientAddress), &addressLength);
+        if (clientSocket != INVALID_SOCKET) {
+#ifdef _WIN32
+            u_long nonBlocking = 1;
+            ioctlsocket(clientSocket, FIONBIO, &nonBlocking);
+#else
+            fcntl(clientSocket, F_SETFL, fcntl(clientSocket, F_GETFL, 0) | O_NONBLOCK);
+#endif
+        }
+#endif
+
+        if (clientSocket == INVALID_SOCKET) {
+#ifdef _WIN32
+            int error = WSAGetLastError();
+            bool queueEmpty = (error == WSAEWOULDBLOCK);
+            bool clientAborted = (error == WSAECONNABORTED || error == WSAECONNRESET);
+            bool exhausted = (error == WSAEMFILE || error == WSAENOBUFS);
+#else
+            int error = errno;
+            bool queueEmpty = (error == EAGAIN || error == EWOULDBLOCK);
+            bool clientAborted = (error == ECONNABORTED);
+            bool exhausted = (error == EMFILE || error == ENFILE || error == ENOBUFS || error == ENOMEM);
+#endif
+            if (clientAborted) {
+                continue;  // Client reset before it was accepted; later connections are still queued
+            }
+            if (!queueEmpty) {
+                m_acceptErrors.fetch_add(1, std::memory_order_relaxed);
+                ReportError("Accept failed with error " + std::to_string(error));
+                descriptorsExhausted = exhausted;
+            }
+            break;
+        }
+
+        char addressBuffer[INET_ADDRSTRLEN] = {0};
+        inet_ntop(AF_INET, &clientAddress.sin_addr, addressBuffer, sizeof(addressBuffer));
+
+        ++accepted;
+        m_acceptedConnections.fetch_add(1, std::memory_order_relaxed);
+
+        // Hand-off only; authentication happens on the caller's worker shards
+        m_connectionHandler(clientSocket, addressBuffer);
+    }
+
+    return accepted;
+}
+
+void AcceptorPool::ReportError(const std::string& error) {
+    if (m_errorHandler) {
+        m_errorHandler(error);
+    }
+}
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,565 @@
+#include "AlarmJournal.h"
+#include "ByteBuffer.h"
+#include <algorithm>
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+
+namespace Nuclear {
+
+namespace {
+
+constexpr uint32_t FILE_MAGIC = 0x4A41504E;   // "NPAJ"
+constexpr uint16_t FILE_VERSION = 1;
+constexpr size_t RECORD_BODY_SIZE = 31;       // Body without the actor
+constexpr intptr_t INVALID_FILE = -1;
+
+struct Crc32Table {
+    uint32_t entries[256];
+
+    constexpr Crc32Table() : entries{} {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+            }
+            entries[i] = crc;
+        }
+    }
+};
+
+constexpr Crc32Table CRC_TABLE;
+
+uint32_t Crc32(const uint8_t* data, size_t size) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < size; ++i) {
+        crc = CRC_TABLE.entries[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+
+void StoreU32(uint8_t* out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+double MicrosSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Thin file layer: positioned writes, data sync and preallocation per platform
+
+#ifdef _WIN32
+intptr_t OpenFile(const std::string& path) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    return file == INVALID_HANDLE_VALUE ? INVALID_FILE : reinterpret_cast<intptr_t>(file);
+}
+
+void CloseFile(intptr_t file) {
+    CloseHandle(reinterpret_cast<HANDLE>(file));
+}
+
+uint64_t FileSize(intptr_t file) {
+    LARGE_INTEGER size;
+    return GetFileSizeEx(reinterpret_cast<HANDLE>(file), &size) ? static_cast<uint64_t>(size.QuadPart) : 0;
+}
+
+bool WriteAt(intptr_t file, uint64_t offset, const uint8_t* data, size_t size) {
+    while (size > 0) {
+        OVERLAPPED position{};
+        position.Offset = static_cast<DWORD>(offset);
+        position.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        DWORD written = 0;
+        DWORD chunk = static_cast<DWORD>(std::min<size_t>(size, 1 << 30));
+        if (!WriteFile(reinterpret_cast<HANDLE>(file), data, chunk, &written, &position) || written == 0) {
+            return false;
+        }
+        data += written;
+        offset += written;
+        size -= written;
+    }
+    return true;
+}
+
+bool SyncData(intptr_t file) {
+    return FlushFileBuffers(reinterpret_cast<HANDLE>(file)) != 0;
+}
+
+bool Truncate(intptr_t file, uint64_t size) {
+    LARGE_INTEGER end;
+    end.QuadPart = static_cast<LONGLONG>(size);
+    HANDLE handle = reinterpret_cast<HANDLE>(file);
+    return SetFilePointerEx(handle, end, nullptr, FILE_BEGIN) && SetEndOfFile(handle);
+}
+
+bool Extend(intptr_t file, uint64_t size) {
+    return Truncate(file, size);
+}
+#else
+intptr_t OpenFile(const std::string& path) {
+    int file = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    return file < 0 ? INVALID_FILE : static_cast<intptr_t>(file);
+}
+
+void CloseFile(intptr_t file) {
+    ::close(static_cast<int>(file));
+}
+
+uint64_t FileSize(intptr_t file) {
+    struct stat status;
+    return fstat(static_cast<int>(file), &status) == 0 ? static_cast<uint64_t>(status.st_size) : 0;
+}
+
+bool WriteAt(intptr_t file, uint64_t offset, const uint8_t* data, size_t size) {
+    while (size > 0) {
+        ssize_t written = pwrite(static_cast<int>(file), data, size, static_cast<off_t>(offset));
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return false;
+        }
+        data += written;
+        offset += static_cast<uint64_t>(written);
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool SyncData(intptr_t file) {
+#ifdef __linux__
+    return fdatasync(static_cast<int>(file)) == 0;
+#else
+    return fsync(static_cast<int>(file)) == 0;
+#endif
+}
+
+bool Truncate(intptr_t file, uint64_t size) {
+    return ftruncate(static_cast<int>(file), static_cast<off_t>(size)) == 0;
+}
+
+bool Extend(intptr_t file, uint64_t size) {
+#ifdef __linux__
+    // Reserve the blocks too, so later commits never allocate
+    if (posix_fallocate(static_cast<int>(file), 0, static_cast<off_t>(size)) == 0) {
+        return true;
+    }
+#endif
+    return Truncate(file, size);
+}
+#endif
+
+} // namespace
+
+AlarmJournal::AlarmJournal(const Config& config)
+    : m_config(config), m_file(INVALID_FILE), m_tail(0), m_allocated(0), m_nextSequence(1),
+      m_pendingLastSequence(0), m_pendingRecords(0), m_commitRequested(false), m_durableSequence(0),
+      m_running(false), m_statistics{0, 0, 0, 0, 0, 0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, false},
+      m_appendMicrosTotal(0.0), m_commitMicrosTotal(0.0) {}
+
+AlarmJournal::~AlarmJournal() {
+    Close();
+}
+
+bool AlarmJournal::Open(const std::string& path) {
+    if (m_running.load()) {
+        return false;
+    }
+
+    // Replay whatever an earlier run left behind
+    std::vector<JournalRecord> records;
+    uint64_t end = HEADER_SIZE;
+    bool torn = false;
+    bool existing = false;
+    {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (in && in.tellg() > 0) {
+            existing = true;
+            in.seekg(0);
+            if (!ParseJournal(in, records, end, torn)) {
+                return false;
+            }
+        }
+    }
+
+    m_file = OpenFile(path);
+    if (m_file == INVALID_FILE) {
+        return false;
+    }
+
+    m_allocated = FileSize(m_file);
+    if (!existing) {
+        std::vector<uint8_t> header;
+        PutU32(header, FILE_MAGIC);
+        PutU16(header, FILE_VERSION);
+        PutU16(header, 0);
+        if (!WriteAt(m_file, 0, header.data(), header.size())) {
+            CloseFile(m_file);
+            m_file = INVALID_FILE;
+            return false;
+        }
+        m_allocated = std::max<uint64_t>(m_allocated, HEADER_SIZE);
+    }
+
+    // Cut everything past the last intact record: a shorter batch written over a torn tail would
+    // otherwise leave stale records behind it that a replay after the next crash could pick up.
+    // The cut is synced before the first append, whatever the sync policy.
+    bool truncated = m_allocated > end;
+    if (truncated && !Truncate(m_file, end)) {
+        CloseFile(m_file);
+        m_file = INVALID_FILE;
+        return false;
+    }
+
+    m_path = path;
+    m_tail = end;
+    m_allocated = std::min(m_allocated, end);
+    if (!EnsureAllocated(m_config.preallocateBytes) || ((m_config.syncToDisk || truncated) && !SyncData(m_file))) {
+        CloseFile(m_file);
+        m_file = INVALID_FILE;
+        return false;
+    }
+
+    m_recovered.clear();
+    for (const JournalRecord& record : records) {
+        ApplyRecord(m_recovered, record);
+    }
+    m_nextSequence = records.empty() ? 1 : records.back().sequence + 1;
+    m_pendingLastSequence = m_nextSequence - 1;
+    m_durableSequence = m_nextSequence - 1;
+
+    {
+        std::lock_guard<std::mutex> lock(m_statisticsMutex);
+        m_statistics.recordsRecovered = records.size();
+        m_statistics.tornTailDiscarded = torn;
+    }
+
+    m_running = true;
+    if (m_config.commitInterval.count() > 0) {
+        m_commitThread = std::make_unique<std::thread>(&AlarmJournal::CommitLoop, this);
+    }
+    return true;
+}
+
+void AlarmJournal::Close() {
+    if (!m_running.exchange(false)) {
+        return;
+    }
+
+    m_pendingCondition.notify_all();
+    if (m_commitThread && m_commitThread->joinable()) {
+        m_commitThread->join();
+    }
+    m_commitThread.reset();
+
+    Commit();
+    CloseFile(m_file);
+    m_file = INVALID_FILE;
+}
+
+bool AlarmJournal::IsOpen() const {
+    return m_running.load();
+}
+
+uint64_t AlarmJournal::Append(const JournalRecord& record) {
+    auto start = std::chrono::steady_clock::now();
+    if (!m_running.load() || record.actor.size() > MAX_ACTOR_LENGTH) {
+        return 0;
+    }
+
+    uint64_t sequence = 0;
+    bool commitNow = m_config.commitInterval.count() == 0;
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        sequence = m_nextSequence++;
+        if (m_pendingRecords == 0) {
+            m_pendingSince = start;
+        }
+
+        size_t offset = m_pending.size();
+        PutU32(m_pending, 0);  // Length and CRC, patched below
+        PutU32(m_pending, 0);
+        m_pending.push_back(static_cast<uint8_t>(record.type));
+        PutU64(m_pending, sequence);
+        PutU64(m_pending, static_cast<uint64_t>(record.timestampUs));
+        PutU32(m_pending, static_cast<uint32_t>(record.alarmId));
+        PutDouble(m_pending, record.value);
+        PutU16(m_pending, static_cast<uint16_t>(record.actor.size()));
+        m_pending.insert(m_pending.end(), record.actor.begin(), record.actor.end());
+
+        const uint8_t* body = m_pending.data() + offset + RECORD_OVERHEAD;
+        size_t bodySize = m_pending.size() - offset - RECORD_OVERHEAD;
+        StoreU32(m_pending.data() + offset, static_cast<uint32_t>(bodySize));
+        StoreU32(m_pending.data() + offset + 4, Crc32(body, bodySize));
+
+        m_pendingRecords++;
+        m_pendingLastSequence = sequence;
+        if (!commitNow && m_pending.size() >= m_config.maxBatchBytes && !m_commitRequested) {
+            m_commitRequested = true;
+            m_pendingCondition.notify_one();
+        }
+    }
+
+    if (commitNow) {
+        Commit();
+    }
+
+    double micros = MicrosSince(start);
+    std::lock_guard<std::mutex> lock(m_statisticsMutex);
+    m_statistics.recordsAppended++;
+    m_appendMicrosTotal += micros;
+    m_statistics.averageAppendMicros = m_appendMicrosTotal / static_cast<double>(m_statistics.recordsAppended);
+    m_statistics.maxAppendMicros = std::max(m_statistics.maxAppendMicros, micros);
+    return sequence;
+}
+
+uint64_t AlarmJournal::RecordAlarm(int alarmId, bool active, double value, int64_t timestampUs) {
+    return Append(JournalRecord{active ? JournalRecordType::AlarmRaised : JournalRecordType::AlarmCleared, 0,
+                                timestampUs, alarmId, value, std::string()});
+}
+
+uint64_t AlarmJournal::RecordAcknowledgment(int alarmId, const std::string& actor, int64_t timestampUs) {
+    return Append(JournalRecord{JournalRecordType::Acknowledged, 0, timestampUs, alarmId, 0.0, actor});
+}
+
+bool AlarmJournal::WaitDurable(uint64_t sequence, std::chrono::milliseconds timeout) {
+    if (m_durableSequence.load() >= sequence) {
+        return true;
+    }
+
+    if (m_commitThread) {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        m_commitRequested = true;
+        m_pendingCondition.notify_one();
+    } else {
+        Commit();
+    }
+
+    std::unique_lock<std::mutex> lock(m_durableMutex);
+    return m_durableCondition.wait_for(lock, timeout, [this, sequence]() { return m_durableSequence.load() >= sequence; });
+}
+
+uint64_t AlarmJournal::GetDurableSequence() const {
+    return m_durableSequence.load();
+}
+
+std::vector<JournaledAlarm> AlarmJournal::GetRecoveredAlarms() const {
+    std::vector<JournaledAlarm> alarms;
+    alarms.reserve(m_recovered.size());
+    for (const auto& entry : m_recovered) {
+        alarms.push_back(entry.second);
+    }
+    return alarms;
+}
+
+AlarmJournal::Statistics AlarmJournal::GetStatistics() const {
+    std::lock_guard<std::mutex> lock(m_statisticsMutex);
+    return m_statistics;
+}
+
+bool AlarmJournal::Replay(const std::string& path, std::vector<JournalRecord>& records) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    uint64_t end = 0;
+    bool torn = false;
+    records.clear();
+    return ParseJournal(in, records, end, torn);
+}
+
+void AlarmJournal::ApplyRecord(std::map<int, JournaledAlarm>& alarms, const JournalRecord& record) {
+    auto alarm = alarms.find(record.alarmId);
+    switch (record.type) {
+        case JournalRecordType::AlarmRaised:
+            alarms[record.alarmId] = JournaledAlarm{record.alarmId, record.timestampUs, record.value, true, false,
+                                                    std::string(), 0};
+            break;
+        case JournalRecordType::AlarmCleared:
+            if (alarm != alarms.end()) {
+                alarm->second.active = false;
+                alarm->second.value = record.value;
+                if (alarm->second.acknowledged) {
+                    alarms.erase(alarm);
+                }
+            }
+            break;
+        case JournalRecordType::Acknowledged:
+            if (alarm != alarms.end()) {
+                alarm->second.acknowledged = true;
+                alarm->second.acknowledgedBy = record.actor;
+                alarm->second.acknowledgedAtUs = record.timestampUs;
+                if (!alarm->second.active) {
+                    alarms.erase(alarm);
+                }
+            }
+            break;
+    }
+}
+
+// Private methods implementation
+
+void AlarmJournal::CommitLoop() {
+    while (m_running.load()) {
+        {
+            std::unique_lock<std::mutex> lock(m_pendingMutex);
+            m_pendingCondition.wait_for(lock, m_config.commitInterval,
+                                        [this]() { return m_commitRequested || !m_running.load(); });
+        }
+        Commit();
+    }
+}
+
+bool AlarmJournal::Commit() {
+    std::lock_guard<std::mutex> commitLock(m_commitMutex);
+
+    uint64_t lastSequence = 0;
+    size_t records = 0;
+    std::chrono::steady_clock::time_point oldest;
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        m_commitRequested = false;
+        if (m_pending.empty()) {
+            return true;
+        }
+        std::swap(m_pending, m_writing);
+        m_pending.clear();
+        lastSequence = m_pendingLastSequence;
+        records = m_pendingRecords;
+        oldest = m_pendingSince;
+        m_pendingRecords = 0;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    bool ok = EnsureAllocated(m_writing.size()) && WriteAt(m_file, m_tail, m_writing.data(), m_writing.size()) &&
+              (!m_config.syncToDisk || SyncData(m_file));
+    double micros = MicrosSince(start);
+
+    if (!ok) {
+        // Put the batch back in front of anything appended since; the next commit retries at the same offset
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        m_writing.insert(m_writing.end(), m_pending.begin(), m_pending.end());
+        std::swap(m_pending, m_writing);
+        if (m_pendingRecords == 0) {
+            m_pendingLastSequence = lastSequence;
+        }
+        m_pendingRecords += records;
+        m_pendingSince = oldest;
+        m_writing.clear();
+
+        std::lock_guard<std::mutex> statisticsLock(m_statisticsMutex);
+        m_statistics.writeErrors++;
+        return false;
+    }
+
+    m_tail += m_writing.size();
+    {
+        std::lock_guard<std::mutex> lock(m_durableMutex);
+        m_durableSequence.store(lastSequence);
+    }
+    m_durableCondition.notify_all();
+
+    std::lock_guard<std::mutex> lock(m_statisticsMutex);
+    m_statistics.commits++;
+    m_statistics.bytesWritten += m_writing.size();
+    m_commitMicrosTotal += micros;
+    m_statistics.averageCommitMicros = m_commitMicrosTotal / static_cast<double>(m_statistics.commits);
+    m_statistics.maxCommitMicros = std::max(m_statistics.maxCommitMicros, micros);
+    m_statistics.averageBatchRecords +=
+        (static_cast<double>(records) - m_statistics.averageBatchRecords) / static_cast<double>(m_statistics.commits);
+    m_statistics.maxDurabilityLagMicros = std::max(m_statistics.maxDurabilityLagMicros, MicrosSince(oldest));
+    m_writing.clear();
+    return true;
+}
+
+bool AlarmJournal::EnsureAllocated(size_t size) {
+    if (m_tail + size <= m_allocated) {
+        return true;
+    }
+
+    uint64_t target = std::max<uint64_t>(m_allocated + m_config.preallocateBytes, m_tail + size);
+    if (!Extend(m_file, target)) {
+        return false;
+    }
+
+    m_allocated = target;
+    std::lock_guard<std::mutex> lock(m_statisticsMutex);
+    m_statistics.preallocations++;
+    return true;
+}
+
+bool AlarmJournal::ParseJournal(std::istream& in, std::vector<JournalRecord>& records, uint64_t& end, bool& torn) {
+    uint8_t header[HEADER_SIZE];
+    in.read(reinterpret_cast<char*>(header), HEADER_SIZE);
+    if (in.gcount() != static_cast<std::streamsize>(HEADER_SIZE) || LoadLittleEndian(header, 4) != FILE_MAGIC ||
+        LoadLittleEndian(header + 4, 2) != FILE_VERSION) {
+        return false;
+    }
+
+    end = HEADER_SIZE;
+    torn = false;
+    std::vector<uint8_t> body;
+    uint64_t lastSequence = 0;
+
+    while (true) {
+        uint8_t prefix[RECORD_OVERHEAD];
+        in.read(reinterpret_cast<char*>(prefix), RECORD_OVERHEAD);
+        size_t prefixRead = static_cast<size_t>(in.gcount());
+        if (prefixRead < RECORD_OVERHEAD) {
+            torn = std::any_of(prefix, prefix + prefixRead, [](uint8_t byte) { return byte != 0; });
+            break;
+        }
+
+        size_t length = static_cast<size_t>(LoadLittleEndian(prefix, 4));
+        uint32_t crc = static_cast<uint32_t>(LoadLittleEndian(prefix + 4, 4));
+        if (length == 0) {
+            torn = crc != 0;
+            break;  // Preallocated space
+        }
+        if (length < RECORD_BODY_SIZE || length > RECORD_BODY_SIZE + MAX_ACTOR_LENGTH) {
+            torn = true;
+            break;
+        }
+
+        body.resize(length);
+        in.read(reinterpret_cast<char*>(body.data()), static_cast<std::streamsize>(length));
+        if (static_cast<size_t>(in.gcount()) != length || Crc32(body.data(), length) != crc) {
+            torn = true;
+            break;
+        }
+
+        ByteReader reader(body.data(), body.size());
+        JournalRecord record;
+        uint8_t type = static_cast<uint8_t>(reader.Get(1));
+        record.type = static_cast<JournalRecordType>(type);
+        record.sequence = reader.Get(8);
+        record.timestampUs = static_cast<int64_t>(reader.Get(8));
+        record.alarmId = static_cast<int32_t>(reader.Get(4));
+        record.value = reader.GetDouble();
+        size_t actorLength = static_cast<size_t>(reader.Get(2));
+
+        // A sequence break means stale records from before a torn write
+        bool sequenceOk = lastSequence == 0 ? record.sequence > 0 : record.sequence == lastSequence + 1;
+        if (!reader.Ok() || type < 1 || type > 3 || actorLength != reader.Remaining() || !sequenceOk) {
+            torn = true;
+            break;
+        }
+        record.actor.assign(reinterpret_cast<const char*>(body.data()) + RECORD_BODY_SIZE, actorLength);
+
+        lastSequence = record.sequence;
+        end += RECORD_OVERHEAD + length;
+        records.push_back(std::move(record));
+    }
+    return true;
+}
+
+} // namespace Nuclear
\ No newline at end of file
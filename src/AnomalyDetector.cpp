@@ -0,0 +1,226 @@
+#include "AnomalyDetector.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace Nuclear {
+
+namespace {
+
+// Scales MAD to a standard-deviation estimate for normally distributed data
+constexpr double MAD_TO_SIGMA = 1.4826;
+
+double MedianInPlace(double* values, size_t count) {
+    size_t middle = count / 2;
+    std::nth_element(values, values + middle, values + count);
+    double median = values[middle];
+
+    if (count % 2 == 0) {
+        median = 0.5 * (median + *std::max_element(values, values + middle));
+    }
+    return median;
+}
+
+} // namespace
+
+AnomalyDetectorBank::AnomalyDetectorBank() : m_config(DefaultConfig()), m_channelCount(0) {
+}
+
+AnomalyDetectorBank::Config AnomalyDetectorBank::DefaultConfig() {
+    Config config;
+    config.ewmaAlpha = 0.05;
+    config.cusumSlack = 0.5;
+    config.cusumThreshold = 5.0;
+    config.madWindow = 9;
+    config.spikeThreshold = 6.0;
+    config.minDeviation = 1e-6;
+    config.warmupSamples = 20;
+    return config;
+}
+
+void AnomalyDetectorBank::Configure(size_t channelCount, const Config& config) {
+    m_config = config;
+    m_config.ewmaAlpha = std::min(std::max(m_config.ewmaAlpha, 1e-6), 1.0);
+    m_config.madWindow = std::min(std::max<size_t>(m_config.madWindow, 3), MAX_MAD_WINDOW);
+    m_config.warmupSamples = std::max<uint32_t>(m_config.warmupSamples, static_cast<uint32_t>(m_config.madWindow));
+    m_channelCount = channelCount;
+
+    m_mean.assign(channelCount, 0.0);
+    m_variance.assign(channelCount, 0.0);
+    m_cusumHigh.assign(channelCount, 0.0);
+    m_cusumLow.assign(channelCount, 0.0);
+    m_sampleCount.assign(channelCount, 0);
+    m_window.assign(channelCount * m_config.madWindow, 0.0);
+    m_windowPos.assign(channelCount, 0);
+}
+
+void AnomalyDetectorBank::SetConsistencyGroups(std::vector<ConsistencyGroup> groups) {
+    // Drop members outside the configured channel range
+    for (auto& group : groups) {
+        group.channels.erase(std::remove_if(group.channels.begin(), group.channels.end(),
+                                            [this](size_t channel) { return channel >= m_channelCount; }),
+                             group.channels.end());
+    }
+    m_groups = std::move(groups);
+}
+
+size_t AnomalyDetectorBank::Process(const SensorSnapshot& snapshot, AnomalyFlags* flags) {
+    for (size_t i = 0; i < m_channelCount; ++i) {
+        flags[i] = IsQualityUsable(snapshot.quality[i]) ? ProcessSample(i, snapshot.EngineeringValue(i)) : ANOMALY_NONE;
+    }
+
+    CheckConsistency(snapshot, flags);
+
+    size_t anomalous = 0;
+    for (size_t i = 0; i < m_channelCount; ++i) {
+        anomalous += flags[i] != ANOMALY_NONE ? 1 : 0;
+    }
+    return anomalous;
+}
+
+void AnomalyDetectorBank::ResetChannel(size_t channel) {
+    if (channel >= m_channelCount) {
+        return;
+    }
+
+    m_mean[channel] = 0.0;
+    m_variance[channel] = 0.0;
+    m_cusumHigh[channel] = 0.0;
+    m_cusumLow[channel] = 0.0;
+    m_sampleCount[channel] = 0;
+    m_windowPos[channel] = 0;
+}
+
+size_t AnomalyDetectorBank::GetChannelCount() const {
+    return m_channelCount;
+}
+
+void AnomalyDetectorBank::ExportState(std::vector<double>& state) const {
+    const size_t windowSize = m_config.madWindow;
+    state.resize(m_channelCount * (6 + windowSize));
+
+    double* out = state.data();
+    for (size_t channel = 0; channel < m_channelCount; ++channel) {
+        *out++ = m_mean[channel];
+        *out++ = m_variance[channel];
+        *out++ = m_cusumHigh[channel];
+        *out++ = m_cusumLow[channel];
+        *out++ = static_cast<double>(m_sampleCount[channel]);
+        *out++ = static_cast<double>(m_windowPos[channel]);
+        out = std::copy(m_window.begin() + channel * windowSize, m_window.begin() + (channel + 1) * windowSize, out);
+    }
+}
+
+bool AnomalyDetectorBank::ImportState(const std::vector<double>& state) {
+    const size_t windowSize = m_config.madWindow;
+    if (state.size() != m_channelCount * (6 + windowSize)) {
+        return false;
+    }
+
+    const double* in = state.data();
+    for (size_t channel = 0; channel < m_channelCount; ++channel) {
+        m_mean[channel] = *in++;
+        m_variance[channel] = *in++;
+        m_cusumHigh[channel] = *in++;
+        m_cusumLow[channel] = *in++;
+        m_sampleCount[channel] = static_cast<uint32_t>(std::min(std::max(0.0, *in++), 4294967295.0));
+        m_windowPos[channel] = static_cast<uint8_t>(std::min(std::max(0.0, *in++), static_cast<double>(windowSize - 1)));
+        std::copy(in, in + windowSize, m_window.begin() + channel * windowSize);
+        in += windowSize;
+    }
+    return true;
+}
+
+// Private methods implementation
+
+AnomalyFlags AnomalyDetectorBank::ProcessSample(size_t channel, double value) {
+    const size_t windowSize = m_config.madWindow;
+    double* window = &m_window[channel * windowSize];
+    uint32_t count = m_sampleCount[channel];
+
+    if (count == 0) {
+        m_mean[channel] = value;
+    }
+
+    AnomalyFlags flags = ANOMALY_NONE;
+    bool spike = false;
+
+    if (count >= m_config.warmupSamples) {
+        // Spike: robust distance from the recent window's median
+        std::array<double, MAX_MAD_WINDOW> scratch;
+        std::copy(window, window + windowSize, scratch.begin());
+        double median = MedianInPlace(scratch.data(), windowSize);
+
+        for (size_t i = 0; i < windowSize; ++i) {
+            scratch[i] = std::fabs(window[i] - median);
+        }
+        double mad = std::max(MAD_TO_SIGMA * MedianInPlace(scratch.data(), windowSize), m_config.minDeviation);
+
+        if (std::fabs(value - median) > m_config.spikeThreshold * mad) {
+            flags |= ANOMALY_SPIKE;
+            spike = true;
+        }
+
+        // Drift: two-sided CUSUM on the standardized residual
+        double sigma = std::max(std::sqrt(m_variance[channel]), m_config.minDeviation);
+        double z = (value - m_mean[channel]) / sigma;
+        m_cusumHigh[channel] = std::max(0.0, m_cusumHigh[channel] + z - m_config.cusumSlack);
+        m_cusumLow[channel] = std::max(0.0, m_cusumLow[channel] - z - m_config.cusumSlack);
+
+        if (m_cusumHigh[channel] > m_config.cusumThreshold) {
+            flags |= ANOMALY_DRIFT_HIGH;
+            m_cusumHigh[channel] = 0.0;
+        }
+        if (m_cusumLow[channel] > m_config.cusumThreshold) {
+            flags |= ANOMALY_DRIFT_LOW;
+            m_cusumLow[channel] = 0.0;
+        }
+    }
+
+    // Spikes stay out of the baseline but enter the window, so a genuine
+    // step change becomes the new median within half a window
+    if (!spike) {
+        double diff = value - m_mean[channel];
+        m_mean[channel] += m_config.ewmaAlpha * diff;
+        m_variance[channel] = (1.0 - m_config.ewmaAlpha) * (m_variance[channel] + m_config.ewmaAlpha * diff * diff);
+    }
+
+    window[m_windowPos[channel]] = value;
+    m_windowPos[channel] = static_cast<uint8_t>((m_windowPos[channel] + 1) % windowSize);
+
+    if (count < m_config.warmupSamples) {
+        m_sampleCount[channel] = count + 1;
+    }
+
+    return flags;
+}
+
+void AnomalyDetectorBank::CheckConsistency(const SensorSnapshot& snapshot, AnomalyFlags* flags) const {
+    const SensorQuality* quality = snapshot.quality.data();
+    std::array<double, MAX_MAD_WINDOW> scratch;
+
+    for (const auto& group : m_groups) {
+        size_t usable = 0;
+        for (size_t channel : group.channels) {
+            if (IsQualityUsable(quality[channel]) && usable < scratch.size()) {
+                scratch[usable++] = snapshot.EngineeringValue(channel);
+            }
+        }
+
+        // Need a majority reference to say which member disagrees; with two
+        // members the median is their midpoint and both would be flagged
+        if (usable < 3) {
+            continue;
+        }
+
+        double median = MedianInPlace(scratch.data(), usable);
+        for (size_t channel : group.channels) {
+            if (IsQualityUsable(quality[channel]) &&
+                std::fabs(snapshot.EngineeringValue(channel) - median) > group.tolerance) {
+                flags[channel] |= ANOMALY_INCONSISTENT;
+            }
+        }
+    }
+}
+
+} // namespace Nuclear
\ No newline at end of file
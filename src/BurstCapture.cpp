@@ -0,0 +1,302 @@
+#include "BurstCapture.h"
+#include "ByteBuffer.h"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+namespace Nuclear {
+
+BurstCapture::BurstCapture(const std::vector<int>& sensorIds, const std::vector<SensorKind>& kinds,
+                           const std::vector<BurstTrigger>& triggers, const Config& config)
+    : m_config(config), m_preHead(0), m_preCount(0), m_state(State::Armed) {
+    size_t channels = sensorIds.size();
+
+    for (const auto& trigger : triggers) {
+        auto it = std::find(sensorIds.begin(), sensorIds.end(), trigger.sensorId);
+        if (it != sensorIds.end()) {
+            m_triggers.push_back(trigger);
+            m_triggerChannels.push_back(static_cast<size_t>(it - sensorIds.begin()));
+        }
+    }
+    m_triggerOutside.assign(m_triggers.size(), 0);
+
+    m_preTimes.assign(m_config.preTriggerSamples, 0);
+    m_preValues.assign(m_config.preTriggerSamples * channels, 0.0);
+    m_preQuality.assign(m_config.preTriggerSamples * channels, QUALITY_COMM_FAIL);
+
+    long long interval = std::max<long long>(m_config.sampleInterval.count(), 1);
+    m_maxSamples = m_config.preTriggerSamples + static_cast<size_t>(m_config.duration.count() / interval) + 1;
+
+    m_waveform.sensorIds = sensorIds;
+    m_waveform.kinds = kinds;
+    m_waveform.offsetsUs.reserve(m_maxSamples);
+    m_waveform.values.reserve(m_maxSamples * channels);
+    m_waveform.quality.reserve(m_maxSamples * channels);
+    Rearm();
+}
+
+std::unique_ptr<BurstCapture> BurstCapture::Create(const std::vector<int>& sensorIds,
+                                                   const std::vector<SensorKind>& kinds,
+                                                   const std::vector<BurstTrigger>& triggers, const Config& config) {
+    if (sensorIds.empty() || sensorIds.size() > MAX_CHANNELS || kinds.size() != sensorIds.size()) {
+        return nullptr;
+    }
+
+    // The last post-trigger sample may land up to one interval past the duration
+    auto spanUs = std::chrono::duration_cast<std::chrono::microseconds>(config.duration + config.sampleInterval);
+    if (config.duration.count() < 0 || config.sampleInterval.count() < 0 || spanUs.count() > MAX_OFFSET_US) {
+        return nullptr;
+    }
+
+    return std::unique_ptr<BurstCapture>(new BurstCapture(sensorIds, kinds, triggers, config));
+}
+
+BurstCapture::Config BurstCapture::DefaultConfig() {
+    Config config;
+    config.sampleInterval = std::chrono::milliseconds(10);
+    config.duration = std::chrono::milliseconds(2000);
+    config.preTriggerSamples = 10;
+    return config;
+}
+
+BurstCapture::State BurstCapture::Feed(int64_t timeUs, const double* values, const SensorQuality* quality) {
+    size_t channels = m_waveform.sensorIds.size();
+
+    // Track trigger state in every state so a rearm does not refire on a channel still outside
+    size_t fired = CheckTriggers(values, quality);
+
+    if (m_state == State::Armed) {
+        if (fired < m_triggers.size()) {
+            BeginCapture(timeUs, fired, values);
+            m_state = AppendSample(timeUs, values, quality) ? State::Capturing : State::Complete;
+            return m_state;
+        }
+
+        if (!m_preTimes.empty()) {
+            m_preTimes[m_preHead] = timeUs;
+            std::copy(values, values + channels, m_preValues.begin() + m_preHead * channels);
+            std::copy(quality, quality + channels, m_preQuality.begin() + m_preHead * channels);
+            m_preHead = (m_preHead + 1) % m_preTimes.size();
+            m_preCount = std::min(m_preCount + 1, m_preTimes.size());
+        }
+        return m_state;
+    }
+
+    if (m_state == State::Capturing) {
+        // A sample that cannot be stored would leave a gap in the waveform; end the burst instead
+        if (!AppendSample(timeUs, values, quality)) {
+            m_state = State::Complete;
+            return m_state;
+        }
+
+        int64_t durationUs = std::chrono::duration_cast<std::chrono::microseconds>(m_config.duration).count();
+        if (m_waveform.sampleCount >= m_maxSamples || timeUs - m_waveform.triggerTimeUs >= durationUs) {
+            m_state = State::Complete;
+        }
+    }
+
+    return m_state;
+}
+
+void BurstCapture::Rearm() {
+    m_waveform.triggerSensorId = -1;
+    m_waveform.triggerValue = 0.0;
+    m_waveform.triggerTimeUs = 0;
+    m_waveform.preTriggerSamples = 0;
+    m_waveform.sampleCount = 0;
+    m_waveform.droppedSamples = 0;
+    m_waveform.offsetsUs.clear();
+    m_waveform.values.clear();
+    m_waveform.quality.clear();
+
+    m_preHead = 0;
+    m_preCount = 0;
+    m_state = State::Armed;
+}
+
+BurstCapture::State BurstCapture::GetState() const {
+    return m_state;
+}
+
+std::chrono::milliseconds BurstCapture::GetSampleInterval() const {
+    return m_config.sampleInterval;
+}
+
+const std::vector<int>& BurstCapture::GetSensorIds() const {
+    return m_waveform.sensorIds;
+}
+
+const std::vector<SensorKind>& BurstCapture::GetKinds() const {
+    return m_waveform.kinds;
+}
+
+const BurstWaveform& BurstCapture::GetWaveform() const {
+    return m_waveform;
+}
+
+bool BurstCapture::Save(const std::string& path) const {
+    const BurstWaveform& w = m_waveform;
+    size_t channels = w.sensorIds.size();
+
+    std::vector<uint8_t> out;
+    out.reserve(48 + channels * 5 + w.sampleCount * (4 + channels * 5));
+
+    PutU32(out, FILE_MAGIC);
+    PutU16(out, FILE_VERSION);
+    PutU16(out, static_cast<uint16_t>(channels));
+    PutU32(out, static_cast<uint32_t>(w.sampleCount));
+    PutU32(out, static_cast<uint32_t>(w.preTriggerSamples));
+    PutU64(out, static_cast<uint64_t>(w.triggerTimeUs));
+    PutU32(out, static_cast<uint32_t>(w.triggerSensorId));
+    PutDouble(out, w.triggerValue);
+
+    for (size_t c = 0; c < channels; ++c) {
+        PutU32(out, static_cast<uint32_t>(w.sensorIds[c]));
+    }
+    for (size_t c = 0; c < channels; ++c) {
+        out.push_back(static_cast<uint8_t>(w.kinds[c]));
+    }
+
+    for (size_t s = 0; s < w.sampleCount; ++s) {
+        PutU32(out, static_cast<uint32_t>(w.offsetsUs[s]));
+        for (size_t c = 0; c < channels; ++c) {
+            PutFloat(out, w.values[s * channels + c]);
+        }
+        out.insert(out.end(), w.quality.begin() + s * channels, w.quality.begin() + (s + 1) * channels);
+    }
+
+    try {
+        std::ofstream file(path, std::ios::binary);
+        if (!file) {
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(out.data()), static_cast<std::streamsize>(out.size()));
+        return static_cast<bool>(file);
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+bool BurstCapture::Load(const std::string& path, BurstWaveform& waveform) {
+    std::vector<uint8_t> data;
+    try {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            return false;
+        }
+        data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    } catch (const std::exception&) {
+        return false;
+    }
+
+    ByteReader reader(data);
+    if (reader.Get(4) != FILE_MAGIC || reader.Get(2) != FILE_VERSION) {
+        return false;
+    }
+
+    size_t channels = static_cast<size_t>(reader.Get(2));
+    size_t samples = static_cast<size_t>(reader.Get(4));
+    BurstWaveform w;
+    w.preTriggerSamples = static_cast<size_t>(reader.Get(4));
+    w.triggerTimeUs = static_cast<int64_t>(reader.Get(8));
+    w.triggerSensorId = static_cast<int32_t>(static_cast<uint32_t>(reader.Get(4)));
+    w.triggerValue = reader.GetDouble();
+
+    // Reject sizes the file cannot possibly hold before allocating for them
+    if (!reader.Ok() || data.size() < channels * 5 + samples * (4 + channels * 5)) {
+        return false;
+    }
+
+    w.sensorIds.resize(channels);
+    w.kinds.resize(channels);
+    for (size_t c = 0; c < channels; ++c) {
+        w.sensorIds[c] = static_cast<int32_t>(static_cast<uint32_t>(reader.Get(4)));
+    }
+    for (size_t c = 0; c < channels; ++c) {
+        uint8_t kind = static_cast<uint8_t>(reader.Get(1));
+        if (!IsKnownSensorKind(kind)) {
+            return false;
+        }
+        w.kinds[c] = static_cast<SensorKind>(kind);
+    }
+
+    w.sampleCount = samples;
+    w.droppedSamples = 0;
+    w.offsetsUs.resize(samples);
+    w.values.resize(samples * channels);
+    w.quality.resize(samples * channels);
+    for (size_t s = 0; s < samples; ++s) {
+        w.offsetsUs[s] = static_cast<int32_t>(static_cast<uint32_t>(reader.Get(4)));
+        for (size_t c = 0; c < channels; ++c) {
+            w.values[s * channels + c] = reader.GetFloat();
+        }
+        for (size_t c = 0; c < channels; ++c) {
+            w.quality[s * channels + c] = static_cast<SensorQuality>(reader.Get(1));
+        }
+    }
+
+    if (!reader.Ok()) {
+        return false;
+    }
+    waveform = std::move(w);
+    return true;
+}
+
+// Private methods implementation
+
+size_t BurstCapture::CheckTriggers(const double* values, const SensorQuality* quality) {
+    size_t fired = m_triggers.size();
+
+    for (size_t t = 0; t < m_triggers.size(); ++t) {
+        size_t channel = m_triggerChannels[t];
+        if (!IsQualityUsable(quality[channel])) {
+            continue;
+        }
+
+        // Fire on the crossing only; a channel parked outside its limits does not retrigger
+        double value = values[channel];
+        uint8_t outside = (value > m_triggers[t].highLimit || value < m_triggers[t].lowLimit) ? 1 : 0;
+        if (outside && !m_triggerOutside[t] && fired == m_triggers.size()) {
+            fired = t;
+        }
+        m_triggerOutside[t] = outside;
+    }
+
+    return fired;
+}
+
+void BurstCapture::BeginCapture(int64_t timeUs, size_t trigger, const double* values) {
+    size_t channels = m_waveform.sensorIds.size();
+
+    m_waveform.triggerSensorId = m_triggers[trigger].sensorId;
+    m_waveform.triggerValue = values[m_triggerChannels[trigger]];
+    m_waveform.triggerTimeUs = timeUs;
+
+    // Oldest pre-trigger sample sits at the ring head once the ring has wrapped
+    size_t ringSize = m_preTimes.size();
+    size_t oldest = (m_preHead + ringSize - m_preCount) % std::max<size_t>(ringSize, 1);
+    for (size_t i = 0; i < m_preCount; ++i) {
+        size_t slot = (oldest + i) % ringSize;
+        AppendSample(m_preTimes[slot], m_preValues.data() + slot * channels, m_preQuality.data() + slot * channels);
+    }
+    m_waveform.preTriggerSamples = m_waveform.sampleCount;
+}
+
+bool BurstCapture::AppendSample(int64_t timeUs, const double* values, const SensorQuality* quality) {
+    int64_t offsetUs = timeUs - m_waveform.triggerTimeUs;
+    if (m_waveform.sampleCount >= m_maxSamples || offsetUs > MAX_OFFSET_US || offsetUs < -MAX_OFFSET_US) {
+        ++m_waveform.droppedSamples;
+        return false;
+    }
+
+    size_t channels = m_waveform.sensorIds.size();
+    m_waveform.offsetsUs.push_back(static_cast<int32_t>(offsetUs));
+    for (size_t c = 0; c < channels; ++c) {
+        m_waveform.values.push_back(static_cast<float>(values[c]));
+    }
+    m_waveform.quality.insert(m_waveform.quality.end(), quality, quality + channels);
+    ++m_waveform.sampleCount;
+    return true;
+}
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include "ChannelSet.h"
+#include <algorithm>
+
+namespace Nuclear {
+
+namespace {
+
+// Scaling as stored in a ChannelSet: null when no channel is fixed point
+std::shared_ptr<const ChannelScaling> NormalizeScales(std::vector<FixedPointScale> scales) {
+    bool anyFixed = std::any_of(scales.begin(), scales.end(),
+                                [](const FixedPointScale& scale) { return scale.IsFixed(); });
+    return anyFixed ? std::make_shared<const ChannelScaling>(std::move(scales)) : nullptr;
+}
+
+} // namespace
+
+ChannelSet::ChannelSet(uint64_t version, std::vector<int> sensorIds, std::vector<SensorKind> kinds,
+                       std::shared_ptr<const ChannelScaling> scales)
+    : m_version(version), m_sensorIds(std::move(sensorIds)), m_kinds(std::move(kinds)), m_scales(std::move(scales)) {
+    m_channelIndex.reserve(m_sensorIds.size());
+
+    for (size_t i = 0; i < m_sensorIds.size(); ++i) {
+        m_channelIndex.emplace(m_sensorIds[i], i);
+    }
+}
+
+std::shared_ptr<const ChannelSet> ChannelSet::Create(uint64_t version, std::vector<int> sensorIds,
+                                                     std::vector<SensorKind> kinds,
+                                                     std::vector<FixedPointScale> scales) {
+    if (kinds.size() != sensorIds.size() || (!scales.empty() && scales.size() != sensorIds.size()) ||
+        std::any_of(scales.begin(), scales.end(), [](const FixedPointScale& scale) { return scale.scale < 0.0; }) ||
+        std::any_of(kinds.begin(), kinds.end(),
+                    [](SensorKind kind) { return !IsKnownSensorKind(static_cast<uint8_t>(kind)); })) {
+        return nullptr;
+    }
+    std::shared_ptr<const ChannelSet> channels(
+        new ChannelSet(version, std::move(sensorIds), std::move(kinds), NormalizeScales(std::move(scales))));
+
+    // A repeated ID would leave FindChannel resolving to only one of its columns
+    if (channels->m_channelIndex.size() != channels->m_sensorIds.size()) {
+        return nullptr;
+    }
+    return channels;
+}
+
+uint64_t ChannelSet::GetVersion() const {
+    return m_version;
+}
+
+const std::vector<int>& ChannelSet::GetSensorIds() const {
+    return m_sensorIds;
+}
+
+const std::vector<SensorKind>& ChannelSet::GetKinds() const {
+    return m_kinds;
+}
+
+const std::shared_ptr<const ChannelScaling>& ChannelSet::GetScales() const {
+    return m_scales;
+}
+
+size_t ChannelSet::Size() const {
+    return m_sensorIds.size();
+}
+
+bool ChannelSet::FindChannel(int sensorId, size_t& channel) const {
+    auto it = m_channelIndex.find(sensorId);
+    if (it == m_channelIndex.end()) {
+        return false;
+    }
+    channel = it->second;
+    return true;
+}
+
+bool ChannelSet::Matches(const std::vector<int>& sensorIds, const std::vector<SensorKind>& kinds,
+                         const std::vector<FixedPointScale>& scales) const {
+    if (m_sensorIds != sensorIds || m_kinds != kinds) {
+        return false;
+    }
+    if (!m_scales) {
+        return std::none_of(scales.begin(), scales.end(), [](const FixedPointScale& scale) { return scale.IsFixed(); });
+    }
+    return *m_scales == scales;
+}
+
+SensorCatalog::SensorCatalog()
+    : m_current(ChannelSet::Create(0, std::vector<int>(), std::vector<SensorKind>())),
+      m_version(0) {
+}
+
+std::shared_ptr<const ChannelSet> SensorCatalog::Current() const {
+    return std::atomic_load(&m_current);
+}
+
+uint64_t SensorCatalog::GetVersion() const {
+    return m_version.load(std::memory_order_acquire);
+}
+
+bool SensorCatalog::Update(std::vector<int> sensorIds, std::vector<SensorKind> kinds,
+                           std::vector<FixedPointScale> scales) {
+    std::lock_guard<std::mutex> lock(m_updateMutex);
+
+    if (Current()->Matches(sensorIds, kinds, scales)) {
+        return false;  // Unchanged; keep consumers' prepared plans valid
+    }
+
+    uint64_t version = m_version.load(std::memory_order_relaxed) + 1;
+    auto channels = ChannelSet::Create(version, std::move(sensorIds), std::move(kinds), std::move(scales));
+    if (!channels) {
+        return false;  // Rejected; the current set stays published
+    }
+    std::atomic_store(&m_current, std::move(channels));
+    m_version.store(version, std::memory_order_release);
+    return true;
+}
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "Clock.h"
+#include <ctime>
+#include <cstdio>
+
+namespace Nuclear {
+
+std::chrono::steady_clock::time_point SystemClock::SteadyNow() const {
+    return std::chrono::steady_clock::now();
+}
+
+std::chrono::system_clock::time_point SystemClock::SystemNow() const {
+    return std::chrono::system_clock::now();
+}
+
+std::shared_ptr<IClock> SystemClock::Instance() {
+    static std::shared_ptr<IClock> instance = std::make_shared<SystemClock>();
+    return instance;
+}
+
+VirtualClock::VirtualClock(std::chrono::system_clock::time_point systemStart)
+    : m_steadyNanos(0)
+    , m_systemNanos(std::chrono::duration_cast<std::chrono::nanoseconds>(systemStart.time_since_epoch()).count()) {}
+
+std::chrono::steady_clock::time_point VirtualClock::SteadyNow() const {
+    return std::chrono::steady_clock::time_point(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::nanoseconds(m_steadyNanos.load(std::memory_order_acquire))));
+}
+
+std::chrono::system_clock::time_point VirtualClock::SystemNow() const {
+    return std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+        std::chrono::nanoseconds(m_systemNanos.load(std::memory_order_acquire))));
+}
+
+void VirtualClock::Advance(std::chrono::nanoseconds elapsed) {
+    if (elapsed.count() <= 0) {
+        return;
+    }
+    m_steadyNanos.fetch_add(elapsed.count(), std::memory_order_acq_rel);
+    m_systemNanos.fetch_add(elapsed.count(), std::memory_order_acq_rel);
+}
+
+void VirtualClock::SetSystemTime(std::chrono::system_clock::time_point time) {
+    int64_t target = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+    int64_t previous = m_systemNanos.exchange(target, std::memory_order_acq_rel);
+    if (target > previous) {
+        m_steadyNanos.fetch_add(target - previous, std::memory_order_acq_rel);
+    }
+}
+
+CycleContext CycleContext::Capture(const IClock& clock, uint64_t cycleNumber) {
+    CycleContext context;
+    context.cycleNumber = cycleNumber;
+    context.steadyTime = clock.SteadyNow();
+    context.wallTime = clock.SystemNow();
+    context.timestamp = FormatTimestamp(context.wallTime);
+    return context;
+}
+
+std::string FormatTimestamp(std::chrono::system_clock::time_point time) {
+    auto sinceEpoch = time.time_since_epoch();
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(sinceEpoch);
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch - seconds).count();
+    if (millis < 0) {
+        seconds -= std::chrono::seconds(1);
+        millis += 1000;
+    }
+
+    std::time_t raw = static_cast<std::time_t>(seconds.count());
+    std::tm utc{};
+#ifdef _WIN32
+    gmtime_s(&utc, &raw);
+#else
+    gmtime_r(&raw, &utc);
+#endif
+
+    char buffer[96];
+    std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02dT%02d:%02d:%02d.%03dZ",
+                  utc.tm_year + 1900, utc.tm_mon + 1, utc.tm_mday,
+                  utc.tm_hour, utc.tm_min, utc.tm_sec, static_cast<int>(millis));
+    return buffer;
+}
+
+} // namespace Nuclear
\ No newline at end of file
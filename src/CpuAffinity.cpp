@@ -0,0 +1,55 @@
+#include "CpuAffinity.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace Nuclear {
+
+namespace {
+
+#ifdef _WIN32
+bool PinNativeHandle(HANDLE handle, int core) {
+    if (core < 0 || core >= static_cast<int>(GetCoreCount()) || core >= 64) {
+        return false;
+    }
+    return SetThreadAffinityMask(handle, DWORD_PTR(1) << core) != 0;
+}
+#else
+bool PinNativeHandle(pthread_t handle, int core) {
+    if (core < 0 || core >= static_cast<int>(GetCoreCount()) || core >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    return pthread_setaffinity_np(handle, sizeof(set), &set) == 0;
+}
+#endif
+
+} // namespace
+
+unsigned GetCoreCount() {
+    unsigned cores = std::thread::hardware_concurrency();
+    return cores > 0 ? cores : 1;
+}
+
+bool PinCurrentThreadToCore(int core) {
+#ifdef _WIN32
+    return PinNativeHandle(GetCurrentThread(), core);
+#else
+    return PinNativeHandle(pthread_self(), core);
+#endif
+}
+
+bool PinThreadToCore(std::thread& thread, int core) {
+    if (!thread.joinable()) {
+        return false;
+    }
+    return PinNativeHandle(thread.native_handle(), core);
+}
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,454 @@
+#include "DerivedChannelEngine.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <unordered_set>
+
+namespace Nuclear {
+
+namespace {
+
+double Absolute(double x) { return std::fabs(x); }
+double SquareRoot(double x) { return std::sqrt(x); }
+double Minimum(double a, double b) { return std::min(a, b); }
+double Maximum(double a, double b) { return std::max(a, b); }
+
+} // namespace
+
+/**
+ * @brief Recursive-descent parser emitting postfix bytecode for one expression
+ */
+class DerivedChannelEngine::Parser {
+private:
+    DerivedChannelEngine& m_engine;
+    const std::string& m_text;
+    size_t m_position;
+    const std::unordered_map<int, size_t>& m_sensorChannels;
+    const std::unordered_map<std::string, size_t>& m_derivedByName;
+
+    Program& m_program;
+    std::vector<size_t>& m_dependencies;
+    std::string m_error;
+    size_t m_depth;
+
+public:
+    Parser(DerivedChannelEngine& engine, const std::string& text,
+           const std::unordered_map<int, size_t>& sensorChannels,
+           const std::unordered_map<std::string, size_t>& derivedByName,
+           Program& program, std::vector<size_t>& dependencies)
+        : m_engine(engine), m_text(text), m_position(0), m_sensorChannels(sensorChannels),
+          m_derivedByName(derivedByName), m_program(program), m_dependencies(dependencies), m_depth(0) {}
+
+    bool Parse(std::string& error) {
+        m_program.code.clear();
+        m_program.maxStackDepth = 0;
+
+        bool ok = ParseExpression();
+        SkipWhitespace();
+        if (ok && m_position != m_text.size()) {
+            ok = Fail("unexpected '" + std::string(1, m_text[m_position]) + "'");
+        }
+
+        if (!ok) {
+            error = m_error + " at position " + std::to_string(m_position);
+        }
+        return ok;
+    }
+
+private:
+    bool Fail(const std::string& message) {
+        if (m_error.empty()) {
+            m_error = message;
+        }
+        return false;
+    }
+
+    void Emit(OpCode op, uint32_t operand, int stackEffect) {
+        m_program.code.push_back({op, operand});
+        m_depth = static_cast<size_t>(static_cast<long>(m_depth) + stackEffect);
+        m_program.maxStackDepth = std::max(m_program.maxStackDepth, m_depth);
+    }
+
+    void SkipWhitespace() {
+        while (m_position < m_text.size() && std::isspace(static_cast<unsigned char>(m_text[m_position]))) {
+            ++m_position;
+        }
+    }
+
+    bool Accept(char expected) {
+        SkipWhitespace();
+        if (m_position < m_text.size() && m_text[m_position] == expected) {
+            ++m_position;
+            return true;
+        }
+        return false;
+    }
+
+    bool Expect(char expected) {
+        return Accept(expected) || Fail(std::string("expected '") + expected + "'");
+    }
+
+    bool ParseExpression() {
+        if (!ParseTerm()) {
+            return false;
+        }
+        while (true) {
+            if (Accept('+')) {
+                if (!ParseTerm()) return false;
+                Emit(OpCode::Add, 0, -1);
+            } else if (Accept('-')) {
+                if (!ParseTerm()) return false;
+                Emit(OpCode::Subtract, 0, -1);
+            } else {
+                return true;
+            }
+        }
+    }
+
+    bool ParseTerm() {
+        if (!ParseUnary()) {
+            return false;
+        }
+        while (true) {
+            if (Accept('*')) {
+                if (!ParseUnary()) return false;
+                Emit(OpCode::Multiply, 0, -1);
+            } else if (Accept('/')) {
+                if (!ParseUnary()) return false;
+                Emit(OpCode::Divide, 0, -1);
+            } else {
+                return true;
+            }
+        }
+    }
+
+    bool ParseUnary() {
+        if (Accept('-')) {
+            if (!ParseUnary()) return false;
+            Emit(OpCode::Negate, 0, 0);
+            return true;
+        }
+        return ParsePrimary();
+    }
+
+    bool ParsePrimary() {
+        SkipWhitespace();
+        if (m_position >= m_text.size()) {
+            return Fail("unexpected end of expression");
+        }
+
+        char c = m_text[m_position];
+        if (Accept('(')) {
+            return ParseExpression() && Expect(')');
+        }
+        if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {
+            return ParseNumber();
+        }
+        if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+            return ParseIdentifier();
+        }
+        return Fail("unexpected '" + std::string(1, c) + "'");
+    }
+
+    bool ParseNumber() {
+        const char* start = m_text.c_str() + m_position;
+        char* end = nullptr;
+        double value = std::strtod(start, &end);
+        if (end == start) {
+            return Fail("invalid number");
+        }
+        m_position += static_cast<size_t>(end - start);
+
+        m_engine.m_constants.push_back(value);
+        Emit(OpCode::PushConstant, static_cast<uint32_t>(m_engine.m_constants.size() - 1), 1);
+        return true;
+    }
+
+    bool ParseIdentifier() {
+        size_t start = m_position;
+        while (m_position < m_text.size() &&
+               (std::isalnum(static_cast<unsigned char>(m_text[m_position])) || m_text[m_position] == '_')) {
+            ++m_position;
+        }
+        std::string name = m_text.substr(start, m_position - start);
+
+        if (!Accept('(')) {
+            auto derived = m_derivedByName.find(name);
+            if (derived == m_derivedByName.end()) {
+                return Fail("unknown channel '" + name + "'");
+            }
+            m_dependencies.push_back(derived->second);
+            Emit(OpCode::LoadDerived, static_cast<uint32_t>(derived->second), 1);
+            return true;
+        }
+
+        if (name == "sensor") {
+            return ParseSensorReference();
+        }
+        if (name == "rate") {
+            if (!ParseExpression() || !Expect(')')) return false;
+            Emit(OpCode::Rate, static_cast<uint32_t>(m_engine.m_rateStates.size()), 0);
+            m_engine.m_rateStates.push_back({0.0, 0.0, false});
+            return true;
+        }
+
+        auto unary = m_engine.m_unaryFunctions.find(name);
+        if (unary != m_engine.m_unaryFunctions.end()) {
+            if (!ParseExpression() || !Expect(')')) return false;
+            m_engine.m_unaryTable.push_back(unary->second);
+            Emit(OpCode::CallUnary, static_cast<uint32_t>(m_engine.m_unaryTable.size() - 1), 0);
+            return true;
+        }
+
+        auto binary = m_engine.m_binaryFunctions.find(name);
+        if (binary != m_engine.m_binaryFunctions.end()) {
+            if (!ParseExpression() || !Expect(',') || !ParseExpression() || !Expect(')')) return false;
+            m_engine.m_binaryTable.push_back(binary->second);
+            Emit(OpCode::CallBinary, static_cast<uint32_t>(m_engine.m_binaryTable.size() - 1), -1);
+            return true;
+        }
+
+        return Fail("unknown function '" + name + "'");
+    }
+
+    bool ParseSensorReference() {
+        SkipWhitespace();
+        const char* start = m_text.c_str() + m_position;
+        char* end = nullptr;
+        long sensorId = std::strtol(start, &end, 10);
+        if (end == start) {
+            return Fail("expected sensor ID");
+        }
+        m_position += static_cast<size_t>(end - start);
+
+        auto channel = m_sensorChannels.find(static_cast<int>(sensorId));
+        if (channel == m_sensorChannels.end()) {
+            return Fail("unknown sensor " + std::to_string(sensorId));
+        }
+
+        Emit(OpCode::LoadSensor, static_cast<uint32_t>(channel->second), 1);
+        return Expect(')');
+    }
+};
+
+DerivedChannelEngine::DerivedChannelEngine() {
+    RegisterFunction("abs", &Absolute);
+    RegisterFunction("sqrt", &SquareRoot);
+    RegisterFunction("min", &Minimum);
+    RegisterFunction("max", &Maximum);
+}
+
+bool DerivedChannelEngine::RegisterFunction(const std::string& name, UnaryFunction function) {
+    if (!function || m_binaryFunctions.count(name) != 0 || name == "sensor" || name == "rate") {
+        return false;
+    }
+    return m_unaryFunctions.emplace(name, function).second;
+}
+
+bool DerivedChannelEngine::RegisterFunction(const std::string& name, BinaryFunction function) {
+    if (!function || m_unaryFunctions.count(name) != 0 || name == "sensor" || name == "rate") {
+        return false;
+    }
+    return m_binaryFunctions.emplace(name, function).second;
+}
+
+bool DerivedChannelEngine::Compile(const std::vector<DerivedChannelDefinition>& definitions,
+                                   const std::vector<int>& sensorIds, std::string& error) {
+    std::unordered_map<int, size_t> sensorChannels;
+    for (size_t i = 0; i < sensorIds.size(); ++i) {
+        sensorChannels.emplace(sensorIds[i], i);
+    }
+
+    // Derived IDs are appended to the snapshot beside the raw ones, so each must be unique across both
+    std::unordered_map<std::string, size_t> derivedByName;
+    std::unordered_set<int> derivedIds;
+    for (size_t i = 0; i < definitions.size(); ++i) {
+        if (!derivedByName.emplace(definitions[i].name, i).second) {
+            error = "duplicate derived channel '" + definitions[i].name + "'";
+            return false;
+        }
+        int sensorId = definitions[i].sensorId;
+        if (sensorChannels.count(sensorId) != 0 || !derivedIds.insert(sensorId).second) {
+            error = definitions[i].name + ": sensor ID " + std::to_string(sensorId) + " is already in use";
+            return false;
+        }
+    }
+
+    // Compile into fresh tables so a failed compile leaves the engine untouched
+    DerivedChannelEngine compiled;
+    compiled.m_unaryFunctions = m_unaryFunctions;
+    compiled.m_binaryFunctions = m_binaryFunctions;
+
+    std::vector<Program> programs(definitions.size());
+    std::vector<std::vector<size_t>> dependencies(definitions.size());
+    for (size_t i = 0; i < definitions.size(); ++i) {
+        Parser parser(compiled, definitions[i].expression, sensorChannels, derivedByName,
+                      programs[i], dependencies[i]);
+        std::string parseError;
+        if (!parser.Parse(parseError)) {
+            error = definitions[i].name + ": " + parseError;
+            return false;
+        }
+    }
+
+    // Topological order: dependencies first; a leftover node means a cycle
+    std::vector<size_t> pending(definitions.size(), 0);
+    std::vector<std::vector<size_t>> dependents(definitions.size());
+    for (size_t i = 0; i < definitions.size(); ++i) {
+        for (size_t dependency : dependencies[i]) {
+            ++pending[i];
+            dependents[dependency].push_back(i);
+        }
+    }
+
+    std::vector<size_t> order;
+    order.reserve(definitions.size());
+    for (size_t i = 0; i < definitions.size(); ++i) {
+        if (pending[i] == 0) {
+            order.push_back(i);
+        }
+    }
+    for (size_t next = 0; next < order.size(); ++next) {
+        for (size_t dependent : dependents[order[next]]) {
+            if (--pending[dependent] == 0) {
+                order.push_back(dependent);
+            }
+        }
+    }
+    if (order.size() != definitions.size()) {
+        error = "circular dependency between derived channels";
+        return false;
+    }
+
+    std::vector<uint32_t> evaluationSlot(definitions.size());
+    for (size_t slot = 0; slot < order.size(); ++slot) {
+        evaluationSlot[order[slot]] = static_cast<uint32_t>(slot);
+    }
+
+    size_t maxStack = 1;
+    for (size_t original : order) {
+        Program& program = programs[original];
+        for (auto& instruction : program.code) {
+            if (instruction.op == OpCode::LoadDerived) {
+                instruction.operand = evaluationSlot[instruction.operand];
+            }
+        }
+        maxStack = std::max(maxStack, program.maxStackDepth);
+        compiled.m_definitions.push_back(definitions[original]);
+        compiled.m_programs.push_back(std::move(program));
+    }
+
+    m_definitions = std::move(compiled.m_definitions);
+    m_programs = std::move(compiled.m_programs);
+    m_constants = std::move(compiled.m_constants);
+    m_rateStates = std::move(compiled.m_rateStates);
+    m_unaryTable = std::move(compiled.m_unaryTable);
+    m_binaryTable = std::move(compiled.m_binaryTable);
+
+    m_values.assign(m_definitions.size(), 0.0);
+    m_quality.assign(m_definitions.size(), QUALITY_COMM_FAIL);
+    m_valueStack.assign(maxStack, 0.0);
+    m_qualityStack.assign(maxStack, QUALITY_GOOD);
+    return true;
+}
+
+void DerivedChannelEngine::Evaluate(const SensorSnapshot& snapshot, double timeSeconds) {
+    double* vs = m_valueStack.data();
+    SensorQuality* qs = m_qualityStack.data();
+
+    for (size_t channel = 0; channel < m_programs.size(); ++channel) {
+        size_t sp = 0;
+
+        for (const Instruction& instruction : m_programs[channel].code) {
+            switch (instruction.op) {
+                case OpCode::PushConstant:
+                    vs[sp] = m_constants[instruction.operand];
+                    qs[sp++] = QUALITY_GOOD;
+                    break;
+                case OpCode::LoadSensor:
+                    vs[sp] = snapshot.EngineeringValue(instruction.operand);
+                    qs[sp++] = snapshot.quality[instruction.operand];
+                    break;
+                case OpCode::LoadDerived:
+                    vs[sp] = m_values[instruction.operand];
+                    qs[sp++] = m_quality[instruction.operand];
+                    break;
+                case OpCode::Add:
+                    --sp;
+                    vs[sp - 1] += vs[sp];
+                    qs[sp - 1] |= qs[sp];
+                    break;
+                case OpCode::Subtract:
+                    --sp;
+                    vs[sp - 1] -= vs[sp];
+                    qs[sp - 1] |= qs[sp];
+                    break;
+                case OpCode::Multiply:
+                    --sp;
+                    vs[sp - 1] *= vs[sp];
+                    qs[sp - 1] |= qs[sp];
+                    break;
+                case OpCode::Divide:
+                    --sp;
+                    vs[sp - 1] /= vs[sp];
+                    qs[sp - 1] |= qs[sp];
+                    break;
+                case OpCode::Negate:
+                    vs[sp - 1] = -vs[sp - 1];
+                    break;
+                case OpCode::CallUnary:
+                    vs[sp - 1] = m_unaryTable[instruction.operand](vs[sp - 1]);
+                    break;
+                case OpCode::CallBinary:
+                    --sp;
+                    vs[sp - 1] = m_binaryTable[instruction.operand](vs[sp - 1], vs[sp]);
+                    qs[sp - 1] |= qs[sp];
+                    break;
+                case OpCode::Rate: {
+                    RateState& state = m_rateStates[instruction.operand];
+                    double current = vs[sp - 1];
+                    double elapsed = timeSeconds - state.previousTime;
+
+                    if (state.primed && elapsed > 0.0) {
+                        vs[sp - 1] = (current - state.previousValue) / elapsed;
+                    } else {
+                        vs[sp - 1] = 0.0;
+                        qs[sp - 1] |= QUALITY_SUBSTITUTED;  // No history yet
+                    }
+
+                    // Only usable samples advance the rate baseline
+                    if (IsQualityUsable(qs[sp - 1])) {
+                        state.previousValue = current;
+                        state.previousTime = timeSeconds;
+                        state.primed = true;
+                    }
+                    break;
+                }
+            }
+        }
+
+        m_values[channel] = vs[0];
+        m_quality[channel] = std::isfinite(vs[0]) ? qs[0] : static_cast<SensorQuality>(qs[0] | QUALITY_OUT_OF_RANGE);
+    }
+}
+
+void DerivedChannelEngine::AppendTo(SensorSnapshot& snapshot) const {
+    for (size_t i = 0; i < m_definitions.size(); ++i) {
+        snapshot.AppendChannel(m_definitions[i].sensorId, m_definitions[i].kind, m_values[i], m_quality[i]);
+    }
+}
+
+const std::vector<DerivedChannelDefinition>& DerivedChannelEngine::GetDefinitions() const {
+    return m_definitions;
+}
+
+const std::vector<double>& DerivedChannelEngine::GetValues() const {
+    return m_values;
+}
+
+const std::vector<SensorQuality>& DerivedChannelEngine::GetQuality() const {
+    return m_quality;
+}
+
+} // namespace Nuclear
\ No newline at end of file
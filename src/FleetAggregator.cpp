@@ -0,0 +1,409 @@
+#include "FleetAggregator.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace Nuclear {
+
+FleetAggregator::FleetAggregator(std::unique_ptr<SocketManager> downstream, const Config& config)
+    : m_config(config), m_downstream(std::move(downstream)), m_running(false), m_mergeCount(0),
+      m_encoder(config.encoder), m_keyframeDue(false) {}
+
+FleetAggregator::~FleetAggregator() {
+    Stop();
+}
+
+int FleetAggregator::AddUpstream(const std::string& plantId, const std::string& host, int port) {
+    if (m_running.load()) {
+        return -1;
+    }
+
+    auto upstream = std::make_unique<Upstream>();
+    upstream->plantId = plantId;
+    upstream->host = host;
+    upstream->port = port;
+    m_upstreams.push_back(std::move(upstream));
+
+    std::lock_guard<std::mutex> lock(m_fleetMutex);
+    m_views.resize(m_upstreams.size());
+    m_rangeOffset.resize(m_upstreams.size(), 0);
+    m_layoutKnown.resize(m_upstreams.size(), 0);
+    return static_cast<int>(m_upstreams.size() - 1);
+}
+
+bool FleetAggregator::Start() {
+    if (m_running.load() || m_upstreams.empty()) {
+        return false;
+    }
+
+#ifdef _WIN32
+    WSADATA wsaData;
+    if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+        return false;
+    }
+#endif
+
+    if (m_downstream) {
+        m_downstream->SetConnectHandler([this](const std::string&) {
+            m_keyframeDue.store(true);
+        });
+    }
+    if (m_downstream && (!m_downstream->Initialize() || !m_downstream->StartServer())) {
+#ifdef _WIN32
+        WSACleanup();
+#endif
+        return false;
+    }
+
+    m_running = true;
+    for (size_t i = 0; i < m_upstreams.size(); ++i) {
+        m_upstreams[i]->linkThread = std::make_unique<std::thread>(&FleetAggregator::LinkLoop, this, i);
+    }
+    m_publishThread = std::make_unique<std::thread>(&FleetAggregator::PublishLoop, this);
+    return true;
+}
+
+void FleetAggregator::Stop() {
+    if (!m_running.exchange(false)) {
+        return;
+    }
+
+    for (auto& upstream : m_upstreams) {
+        if (upstream->linkThread && upstream->linkThread->joinable()) {
+            upstream->linkThread->join();
+        }
+        upstream->linkThread.reset();
+    }
+    if (m_publishThread && m_publishThread->joinable()) {
+        m_publishThread->join();
+    }
+    m_publishThread.reset();
+
+    if (m_downstream) {
+        m_downstream->StopServer();
+    }
+
+#ifdef _WIN32
+    WSACleanup();
+#endif
+}
+
+bool FleetAggregator::Ingest(size_t upstream, const uint8_t* payload, size_t size) {
+    if (upstream >= m_upstreams.size()) {
+        return false;
+    }
+
+    Upstream& link = *m_upstreams[upstream];
+    SnapshotDeltaDecoder::Result result = link.decoder.Decode(payload, size);
+    link.framesReceived.fetch_add(1, std::memory_order_relaxed);
+
+    if (result == SnapshotDeltaDecoder::Result::Malformed) {
+        return false;
+    }
+    if (result == SnapshotDeltaDecoder::Result::NeedKeyframe) {
+        link.resyncs.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    const SensorSnapshot& snapshot = link.decoder.GetSnapshot();
+    {
+        std::lock_guard<std::mutex> lock(link.mailboxMutex);
+        if (link.dirty) {
+            link.framesConflated.fetch_add(1, std::memory_order_relaxed);
+        }
+        link.latest = snapshot;
+        link.dirty = true;
+    }
+
+    link.lastScanNumber.store(snapshot.scanNumber, std::memory_order_relaxed);
+    link.connected.store(true, std::memory_order_release);
+    return true;
+}
+
+bool FleetAggregator::MergeLatest() {
+    std::lock_guard<std::mutex> lock(m_fleetMutex);
+
+    bool layoutChanged = false;
+    std::vector<size_t> updated;
+    for (size_t i = 0; i < m_upstreams.size(); ++i) {
+        Upstream& link = *m_upstreams[i];
+        std::lock_guard<std::mutex> mailboxLock(link.mailboxMutex);
+        if (!link.dirty) {
+            continue;
+        }
+
+        // Swap rather than copy; the link reuses the old view's buffers for its next snapshot
+        std::swap(link.latest, m_views[i]);
+        link.dirty = false;
+
+        if (m_layoutKnown[i] && m_views[i].sensorIds == link.latest.sensorIds &&
+            m_views[i].kinds == link.latest.kinds) {
+            updated.push_back(i);
+            continue;
+        }
+
+        // A new layout is checked before it is merged, so fleet IDs never alias another upstream's range
+        const std::vector<int>& sensorIds = m_views[i].sensorIds;
+        if (!std::all_of(sensorIds.begin(), sensorIds.end(),
+                         [i](int sensorId) { return FitsFleetIdRange(i, sensorId); })) {
+            link.layoutsRejected.fetch_add(1, std::memory_order_relaxed);
+            m_views[i] = SensorSnapshot();
+            layoutChanged = layoutChanged || m_layoutKnown[i];
+            continue;
+        }
+        updated.push_back(i);
+        layoutChanged = true;
+    }
+
+    bool changed = !updated.empty() || layoutChanged;
+    if (layoutChanged) {
+        RebuildLayout();
+    } else {
+        for (size_t i : updated) {
+            CopyValues(m_views[i], m_rangeOffset[i]);
+        }
+    }
+
+    // Channels of a lost upstream keep their last values but are no longer usable
+    for (size_t i = 0; i < m_upstreams.size(); ++i) {
+        if (!m_layoutKnown[i] || m_upstreams[i]->connected.load(std::memory_order_acquire)) {
+            continue;
+        }
+        auto begin = m_fleet.quality.begin() + m_rangeOffset[i];
+        auto end = begin + m_views[i].Size();
+        if (std::any_of(begin, end, [](SensorQuality quality) { return quality != QUALITY_COMM_FAIL; })) {
+            std::fill(begin, end, QUALITY_COMM_FAIL);
+            changed = true;
+        }
+    }
+
+    if (changed) {
+        m_fleet.scanNumber = ++m_mergeCount;
+        for (size_t i = 0; i < m_views.size(); ++i) {
+            m_fleet.acquiredAt = std::max(m_fleet.acquiredAt, m_views[i].acquiredAt);
+        }
+    }
+    return changed;
+}
+
+SensorSnapshot FleetAggregator::GetFleetSnapshot() const {
+    std::lock_guard<std::mutex> lock(m_fleetMutex);
+    return m_fleet;
+}
+
+std::vector<FleetAggregator::UpstreamStatus> FleetAggregator::GetUpstreamStatus() const {
+    std::vector<UpstreamStatus> status;
+    status.reserve(m_upstreams.size());
+
+    for (const auto& link : m_upstreams) {
+        status.push_back({link->plantId, link->host, link->port,
+                          link->connected.load(std::memory_order_relaxed),
+                          link->framesReceived.load(std::memory_order_relaxed),
+                          link->framesConflated.load(std::memory_order_relaxed),
+                          link->bytesReceived.load(std::memory_order_relaxed),
+                          link->resyncs.load(std::memory_order_relaxed),
+                          link->layoutsRejected.load(std::memory_order_relaxed),
+                          link->lastScanNumber.load(std::memory_order_relaxed)});
+    }
+    return status;
+}
+
+int FleetAggregator::FleetSensorId(size_t upstream, int sensorId) {
+    return static_cast<int>(upstream) * FLEET_ID_STRIDE + sensorId;
+}
+
+bool FleetAggregator::FitsFleetIdRange(size_t upstream, int sensorId) {
+    constexpr size_t maxUpstream = (std::numeric_limits<int>::max() - (FLEET_ID_STRIDE - 1)) / FLEET_ID_STRIDE;
+    return sensorId >= 0 && sensorId < FLEET_ID_STRIDE && upstream <= maxUpstream;
+}
+
+// Private methods implementation
+
+void FleetAggregator::LinkLoop(size_t index) {
+    Upstream& link = *m_upstreams[index];
+    std::vector<uint8_t> receiveBuffer(RECEIVE_BUFFER_SIZE);
+    std::vector<uint8_t> payload;
+    DeltaFrameAssembler assembler;
+
+    while (m_running.load()) {
+        SOCKET socket = ConnectTo(link.host, link.port, m_config.reconnectInterval);
+        if (socket == INVALID_SOCKET) {
+            WaitWhileRunning(m_config.reconnectInterval);
+            continue;
+        }
+
+        size_t requestLength = std::strlen(FEED_REQUEST);
+        if (send(socket, FEED_REQUEST, static_cast<int>(requestLength), 0) != static_cast<int>(requestLength)) {
+            closesocket(socket);
+            WaitWhileRunning(m_config.reconnectInterval);
+            continue;
+        }
+
+        assembler.Reset();
+        link.decoder.Reset();
+
+        bool streamOk = true;
+        while (m_running.load() && streamOk) {
+#ifdef _WIN32
+            WSAPOLLFD pollDescriptor{};
+            pollDescriptor.fd = socket;
+            pollDescriptor.events = POLLRDNORM;
+            int ready = WSAPoll(&pollDescriptor, 1, POLL_TIMEOUT_MS);
+#else
+            pollfd pollDescriptor{};
+            pollDescriptor.fd = socket;
+            pollDescriptor.events = POLLIN;
+            int ready = poll(&pollDescriptor, 1, POLL_TIMEOUT_MS);
+#endif
+            if (ready == 0) {
+                continue;  // Timeout; re-check running flag
+            }
+            if (ready < 0) {
+                break;
+            }
+
+            int received = recv(socket, reinterpret_cast<char*>(receiveBuffer.data()),
+                                static_cast<int>(receiveBuffer.size()), 0);
+            if (received <= 0) {
+                break;
+            }
+
+            link.bytesReceived.fetch_add(static_cast<uint64_t>(received), std::memory_order_relaxed);
+            assembler.Append(receiveBuffer.data(), static_cast<size_t>(received));
+            while (streamOk && assembler.Next(payload)) {
+                streamOk = Ingest(index, payload.data(), payload.size());
+            }
+            streamOk = streamOk && !assembler.IsCorrupt();
+        }
+
+        closesocket(socket);
+        link.connected.store(false, std::memory_order_release);
+        if (m_running.load()) {
+            WaitWhileRunning(m_config.reconnectInterval);
+        }
+    }
+}
+
+SOCKET FleetAggregator::ConnectTo(const std::string& host, int port, std::chrono::milliseconds timeout) {
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(static_cast<uint16_t>(port));
+    if (inet_pton(AF_INET, host.c_str(), &address.sin_addr) != 1) {
+        return INVALID_SOCKET;
+    }
+
+    SOCKET socket = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (socket == INVALID_SOCKET) {
+        return INVALID_SOCKET;
+    }
+
+    // Connect non-blocking so an unreachable plant cannot stall the link (and Stop) for the OS connect timeout
+#ifdef _WIN32
+    u_long nonBlocking = 1;
+    ioctlsocket(socket, FIONBIO, &nonBlocking);
+#else
+    int flags = fcntl(socket, F_GETFL, 0);
+    fcntl(socket, F_SETFL, flags | O_NONBLOCK);
+#endif
+
+    if (connect(socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == SOCKET_ERROR) {
+#ifdef _WIN32
+        bool pending = (WSAGetLastError() == WSAEWOULDBLOCK);
+        WSAPOLLFD pollDescriptor{};
+        pollDescriptor.fd = socket;
+        pollDescriptor.events = POLLWRNORM;
+        int ready = pending ? WSAPoll(&pollDescriptor, 1, static_cast<int>(timeout.count())) : -1;
+#else
+        bool pending = (errno == EINPROGRESS);
+        pollfd pollDescriptor{};
+        pollDescriptor.fd = socket;
+        pollDescriptor.events = POLLOUT;
+        int ready = pending ? poll(&pollDescriptor, 1, static_cast<int>(timeout.count())) : -1;
+#endif
+        int error = 0;
+        socklen_t errorLength = sizeof(error);
+        if (ready <= 0 ||
+            getsockopt(socket, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &errorLength) == SOCKET_ERROR ||
+            error != 0) {
+            closesocket(socket);
+            return INVALID_SOCKET;
+        }
+    }
+
+#ifdef _WIN32
+    nonBlocking = 0;
+    ioctlsocket(socket, FIONBIO, &nonBlocking);
+#else
+    fcntl(socket, F_SETFL, flags);
+#endif
+
+    int noDelay = 1;
+    setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&noDelay), sizeof(noDelay));
+    return socket;
+}
+
+void FleetAggregator::PublishLoop() {
+    while (m_running.load()) {
+        WaitWhileRunning(m_config.publishInterval);
+        if (!m_running.load()) {
+            continue;
+        }
+
+        // A new client still needs its keyframe when every upstream is idle
+        bool merged = MergeLatest();
+        if (!m_downstream || (!merged && !m_keyframeDue.load())) {
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_fleetMutex);
+            m_frame.clear();
+            if (m_keyframeDue.exchange(false)) {
+                m_encoder.ForceKeyframe();
+            }
+            m_encoder.Encode(m_fleet, m_frame);
+        }
+        m_downstream->BroadcastData(std::string(m_frame.begin(), m_frame.end()));
+    }
+}
+
+void FleetAggregator::RebuildLayout() {
+    size_t total = 0;
+    for (size_t i = 0; i < m_views.size(); ++i) {
+        m_rangeOffset[i] = total;
+        m_layoutKnown[i] = m_views[i].Size() > 0 ? 1 : 0;
+        total += m_views[i].Size();
+    }
+
+    m_fleet.Resize(total);
+    for (size_t i = 0; i < m_views.size(); ++i) {
+        const SensorSnapshot& view = m_views[i];
+        size_t offset = m_rangeOffset[i];
+        for (size_t channel = 0; channel < view.Size(); ++channel) {
+            m_fleet.sensorIds[offset + channel] = FleetSensorId(i, view.sensorIds[channel]);
+        }
+        std::copy(view.kinds.begin(), view.kinds.end(), m_fleet.kinds.begin() + offset);
+        CopyValues(view, offset);
+    }
+}
+
+void FleetAggregator::CopyValues(const SensorSnapshot& view, size_t offset) {
+    // The fleet view is floating point; plants sending fixed-point channels are converted here
+    if (!view.HasFixedPoint()) {
+        std::copy(view.values.begin(), view.values.end(), m_fleet.values.begin() + offset);
+    } else {
+        for (size_t channel = 0; channel < view.Size(); ++channel) {
+            m_fleet.values[offset + channel] = view.EngineeringValue(channel);
+        }
+    }
+    std::copy(view.quality.begin(), view.quality.end(), m_fleet.quality.begin() + offset);
+}
+
+void FleetAggregator::WaitWhileRunning(std::chrono::milliseconds interval) const {
+    auto deadline = std::chrono::steady_clock::now() + interval;
+    while (m_running.load() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(std::min<int64_t>(POLL_TIMEOUT_MS, interval.count())));
+    }
+}
+
+} // namespace Nuclear
\ No newline at end of file
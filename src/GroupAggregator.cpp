@@ -0,0 +1,158 @@
+#include "GroupAggregator.h"
+#include <unordered_map>
+#include <set>
+#include <utility>
+#include <limits>
+#include <algorithm>
+
+namespace Nuclear {
+
+namespace {
+
+// Aggregate field per SensorKind, in enum order
+AggregateStats GroupAggregate::* const KIND_FIELDS[] = {
+    &GroupAggregate::temperature,
+    &GroupAggregate::pressure,
+    &GroupAggregate::radiation
+};
+
+void ResetAggregate(AggregateStats& aggregate) {
+    aggregate.count = 0;
+    aggregate.sum = 0.0;
+    aggregate.min = std::numeric_limits<double>::infinity();
+    aggregate.max = -std::numeric_limits<double>::infinity();
+}
+
+void Merge(AggregateStats& into, const AggregateStats& from) {
+    into.count += from.count;
+    into.sum += from.sum;
+    into.min = std::min(into.min, from.min);
+    into.max = std::max(into.max, from.max);
+}
+
+} // namespace
+
+bool GroupAggregator::Configure(std::vector<GroupDefinition> groups, const std::vector<SensorKind>& kinds) {
+    std::unordered_map<int, size_t> slotById;
+    for (size_t i = 0; i < groups.size(); ++i) {
+        if (!slotById.emplace(groups[i].groupId, i).second) {
+            return false;  // Duplicate group ID
+        }
+    }
+
+    // Depth and root of each group; parents must exist and chains must terminate
+    std::vector<size_t> depth(groups.size(), 0);
+    std::vector<size_t> root(groups.size(), 0);
+    for (size_t i = 0; i < groups.size(); ++i) {
+        int parentId = groups[i].parentId;
+        size_t steps = 0;
+        size_t top = i;
+        while (parentId != -1) {
+            auto parent = slotById.find(parentId);
+            if (parent == slotById.end() || ++steps > groups.size()) {
+                return false;
+            }
+            top = parent->second;
+            parentId = groups[top].parentId;
+        }
+        depth[i] = steps;
+        root[i] = top;
+    }
+
+    // Children fold into their ancestors, so a channel listed twice in one
+    // tree would be counted twice at their common ancestor
+    std::set<std::pair<size_t, size_t>> rootChannels;
+    for (size_t i = 0; i < groups.size(); ++i) {
+        for (size_t channel : groups[i].channels) {
+            if (channel >= kinds.size() || !rootChannels.emplace(root[i], channel).second) {
+                return false;
+            }
+        }
+    }
+
+    // Deepest first guarantees every child is reduced before its parent
+    std::vector<size_t> order(groups.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&depth](size_t a, size_t b) { return depth[a] > depth[b]; });
+
+    std::vector<size_t> newSlot(groups.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        newSlot[order[i]] = i;
+    }
+
+    m_groups.clear();
+    m_parentSlot.clear();
+    m_memberOffsets.assign(1, 0);
+    m_memberChannels.clear();
+    m_channelKind.resize(kinds.size());
+    for (size_t i = 0; i < kinds.size(); ++i) {
+        m_channelKind[i] = static_cast<uint8_t>(kinds[i]);
+    }
+
+    for (size_t original : order) {
+        GroupDefinition& group = groups[original];
+        m_memberChannels.insert(m_memberChannels.end(), group.channels.begin(), group.channels.end());
+        m_memberOffsets.push_back(m_memberChannels.size());
+        m_parentSlot.push_back(group.parentId == -1 ? NO_PARENT : newSlot[slotById[group.parentId]]);
+        m_groups.push_back(std::move(group));
+    }
+
+    m_results.resize(m_groups.size());
+    for (size_t i = 0; i < m_groups.size(); ++i) {
+        m_results[i].groupId = m_groups[i].groupId;
+        m_results[i].name = m_groups[i].name;
+        m_results[i].parentId = m_groups[i].parentId;
+    }
+
+    return true;
+}
+
+const std::vector<GroupAggregate>& GroupAggregator::Aggregate(const SensorSnapshot& snapshot) {
+    const SensorQuality* quality = snapshot.quality.data();
+    for (auto& result : m_results) {
+        for (auto field : KIND_FIELDS) {
+            ResetAggregate(result.*field);
+        }
+    }
+
+    for (size_t slot = 0; slot < m_groups.size(); ++slot) {
+        GroupAggregate& result = m_results[slot];
+
+        // Segment of this group's direct members
+        for (size_t m = m_memberOffsets[slot]; m < m_memberOffsets[slot + 1]; ++m) {
+            size_t channel = m_memberChannels[m];
+            if (!IsQualityUsable(quality[channel])) {
+                continue;
+            }
+
+            AggregateStats& aggregate = result.*KIND_FIELDS[m_channelKind[channel]];
+            double value = snapshot.EngineeringValue(channel);
+            aggregate.count += 1;
+            aggregate.sum += value;
+            aggregate.min = std::min(aggregate.min, value);
+            aggregate.max = std::max(aggregate.max, value);
+        }
+
+        // Children are complete by now; fold into the parent
+        if (m_parentSlot[slot] != NO_PARENT) {
+            GroupAggregate& parent = m_results[m_parentSlot[slot]];
+            for (auto field : KIND_FIELDS) {
+                Merge(parent.*field, result.*field);
+            }
+        }
+    }
+
+    return m_results;
+}
+
+const std::vector<GroupAggregate>& GroupAggregator::GetResults() const {
+    return m_results;
+}
+
+size_t GroupAggregator::GetGroupCount() const {
+    return m_groups.size();
+}
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,517 @@
+#include "HistorianExporter.h"
+#include "ByteBuffer.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cctype>
+#include <cstring>
+#include <ostream>
+
+namespace Nuclear {
+
+namespace {
+
+constexpr uint32_t COLUMNAR_MAGIC = 0x5843504E;   // "NPCX"
+constexpr uint32_t ROW_GROUP_MAGIC = 0x50524752;  // "RGRP"
+constexpr uint16_t COLUMNAR_VERSION = 1;
+constexpr size_t ROW_GROUP_HEADER_SIZE = 8;
+constexpr size_t FOOTER_ENTRY_SIZE = 28;
+constexpr size_t TRAILER_SIZE = 16;
+constexpr size_t MAX_CHANNELS = 1 << 20;      // Guards allocation against corrupt headers
+constexpr size_t MAX_ROWS = 1 << 20;
+constexpr size_t OUTPUT_BUFFER_SIZE = 1 << 20;
+
+void AppendNumber(std::string& out, const char* format, double value) {
+    char buffer[32];
+    int length = std::snprintf(buffer, sizeof(buffer), format, value);
+    out.append(buffer, static_cast<size_t>(std::max(length, 0)));
+}
+
+// Days since 1970-01-01 of a proleptic Gregorian date
+int64_t DaysFromCivil(int64_t year, int64_t month, int64_t day) {
+    year -= month <= 2 ? 1 : 0;
+    int64_t era = (year >= 0 ? year : year - 399) / 400;
+    int64_t yearOfEra = year - era * 400;
+    int64_t dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+// Length of a proleptic Gregorian month; month is 1-12
+int DaysInMonth(int year, int month) {
+    static constexpr int DAYS[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    return month == 2 && leap ? 29 : DAYS[month - 1];
+}
+
+} // namespace
+
+HistorianExporter::HistorianExporter(const Options& options) : m_options(options), m_cancelled(false) {
+    size_t workers = options.workers;
+    if (workers == 0) {
+        size_t cores = std::thread::hardware_concurrency();
+        workers = cores > 1 ? cores - 1 : 1;
+    }
+    m_pool = std::make_unique<ThreadPool>(workers);
+}
+
+HistorianExporter::Result HistorianExporter::Export(const std::string& recordingPath, const std::string& outputPath) {
+    ScanRecordingReader reader;
+    if (!reader.Open(recordingPath)) {
+        return Result{false, "Cannot open recording " + recordingPath, 0, 0, 0, 0, 0.0, 0.0};
+    }
+
+    std::vector<char> buffer(OUTPUT_BUFFER_SIZE);
+    std::ofstream out;
+    out.rdbuf()->pubsetbuf(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    out.open(outputPath, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return Result{false, "Cannot create " + outputPath, 0, 0, 0, 0, 0.0, 0.0};
+    }
+
+    Result result = Export(reader, out);
+    out.close();
+    if (result.completed && !out) {
+        result.completed = false;
+        result.error = "Write to " + outputPath + " failed";
+    }
+    return result;
+}
+
+HistorianExporter::Result HistorianExporter::Export(ScanRecordingReader& reader, std::ostream& out) {
+    Result result{false, "", 0, 0, 0, 0, 0.0, 0.0};
+    auto start = std::chrono::steady_clock::now();
+    m_cancelled = false;
+
+    // Resolve the channel selection against the recording layout
+    const std::vector<int>& recorded = reader.GetSensorIds();
+    m_channels.clear();
+    if (m_options.sensorIds.empty()) {
+        for (size_t channel = 0; channel < recorded.size(); ++channel) {
+            m_channels.push_back(channel);
+        }
+    }
+    for (int sensorId : m_options.sensorIds) {
+        auto found = std::find(recorded.begin(), recorded.end(), sensorId);
+        if (found == recorded.end()) {
+            result.error = "Sensor " + std::to_string(sensorId) + " is not in the recording";
+            return result;
+        }
+        m_channels.push_back(static_cast<size_t>(found - recorded.begin()));
+    }
+
+    if (m_options.format == ExportFormat::Csv) {
+        std::string header = CsvHeader(reader);
+        out.write(header.data(), static_cast<std::streamsize>(header.size()));
+        result.bytesWritten += header.size();
+    } else {
+        std::vector<uint8_t> header = ColumnarHeader(reader);
+        out.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+        result.bytesWritten += header.size();
+    }
+
+    std::vector<uint8_t> footer;
+    uint32_t rowGroups = 0;
+    auto writeBatch = [&](Batch& batch) {
+        if (m_options.format == ExportFormat::Csv) {
+            for (const std::string& block : batch.text) {
+                out.write(block.data(), static_cast<std::streamsize>(block.size()));
+                result.bytesWritten += block.size();
+            }
+        } else {
+            PutU64(footer, result.bytesWritten);
+            PutU32(footer, static_cast<uint32_t>(batch.rowCount));
+            PutU64(footer, static_cast<uint64_t>(batch.timestamps[batch.firstRow]));
+            PutU64(footer, static_cast<uint64_t>(batch.timestamps[batch.firstRow + batch.rowCount - 1]));
+            rowGroups++;
+            out.write(reinterpret_cast<const char*>(batch.rowGroup.data()),
+                      static_cast<std::streamsize>(batch.rowGroup.size()));
+            result.bytesWritten += batch.rowGroup.size();
+        }
+        result.rowsExported += batch.rowCount;
+        return static_cast<bool>(out);
+    };
+
+    // Two batches alternate: one is processed by the pool while the other is written and refilled
+    Batch* pending = nullptr;
+    size_t slot = 0;
+    bool writeFailed = false;
+    while (!m_cancelled.load() && !writeFailed) {
+        Batch& batch = m_batches[slot];
+        if (!reader.ReadChunk(batch.chunk)) {
+            break;
+        }
+        result.chunksRead++;
+
+        batch.scanNumbers.resize(batch.chunk.scanCount);
+        batch.timestamps.resize(batch.chunk.scanCount);
+        batch.chunk.DecodeTimes(batch.scanNumbers.data(), batch.timestamps.data());
+        if (!batch.timestamps.empty() && batch.timestamps.front() >= m_options.endUs) {
+            result.chunksSkipped++;
+            break;  // Recordings are in time order; nothing later is in range
+        }
+        if (!StartBatch(batch)) {
+            result.chunksSkipped++;
+            continue;
+        }
+
+        if (pending) {
+            WaitBatch(*pending);
+            writeFailed = !writeBatch(*pending);
+        }
+        pending = &batch;
+        slot = 1 - slot;
+    }
+
+    if (pending) {
+        WaitBatch(*pending);
+        writeFailed = writeFailed || !writeBatch(*pending);
+    }
+
+    if (m_options.format == ExportFormat::Columnar && !writeFailed) {
+        PutU64(footer, result.bytesWritten);
+        PutU32(footer, rowGroups);
+        PutU32(footer, COLUMNAR_MAGIC);
+        out.write(reinterpret_cast<const char*>(footer.data()), static_cast<std::streamsize>(footer.size()));
+        result.bytesWritten += footer.size();
+    }
+    out.flush();
+
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.megabytesPerSecond =
+        result.seconds > 0.0 ? static_cast<double>(result.bytesWritten) / (1024.0 * 1024.0) / result.seconds : 0.0;
+    if (writeFailed || !out) {
+        result.error = "Write failed";
+    } else if (m_cancelled.load()) {
+        result.error = "Cancelled";
+    } else {
+        result.completed = true;
+    }
+    return result;
+}
+
+void HistorianExporter::Cancel() {
+    m_cancelled = true;
+}
+
+bool HistorianExporter::ParseFormat(const std::string& name, ExportFormat& format) {
+    if (name == "csv") {
+        format = ExportFormat::Csv;
+    } else if (name == "columnar") {
+        format = ExportFormat::Columnar;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool HistorianExporter::ParseTime(const std::string& text, int64_t& timestampUs) {
+    if (!text.empty() && std::all_of(text.begin() + (text[0] == '-' ? 1 : 0), text.end(),
+                                     [](char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; })) {
+        try {
+            timestampUs = std::stoll(text);
+            return true;
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+
+    // %2d accepts a sign, so every field is range checked from below as well
+    int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+    char separator = 0;
+    int consumed = 0;
+    if (std::sscanf(text.c_str(), "%4d-%2d-%2d%c%2d:%2d:%2d%n", &year, &month, &day, &separator, &hour, &minute,
+                    &second, &consumed) != 7 ||
+        (separator != 'T' && separator != ' ') || month < 1 || month > 12 || day < 1 ||
+        day > DaysInMonth(year, month) || hour < 0 || hour > 23 || minute < 0 || minute > 59 || second < 0 ||
+        second > 60) {
+        return false;
+    }
+    std::string rest = text.substr(static_cast<size_t>(consumed));
+    if (!rest.empty() && rest != "Z") {
+        return false;
+    }
+
+    int64_t seconds = DaysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second;
+    timestampUs = seconds * 1000000;
+    return true;
+}
+
+// Private methods implementation
+
+bool HistorianExporter::StartBatch(Batch& batch) {
+    const std::vector<int64_t>& times = batch.timestamps;
+    size_t first = static_cast<size_t>(std::lower_bound(times.begin(), times.end(), m_options.startUs) - times.begin());
+    size_t last = static_cast<size_t>(std::lower_bound(times.begin(), times.end(), m_options.endUs) - times.begin());
+    if (first >= last) {
+        return false;
+    }
+
+    batch.firstRow = first;
+    batch.rowCount = last - first;
+    {
+        std::lock_guard<std::mutex> lock(batch.mutex);
+        batch.done = false;
+    }
+
+    const size_t scans = batch.chunk.scanCount;
+    const size_t rows = batch.rowCount;
+    const size_t columns = m_channels.size();
+    const uint8_t* payload = batch.chunk.payload.data();
+
+    if (m_options.format == ExportFormat::Columnar) {
+        batch.rowGroup.resize(ROW_GROUP_HEADER_SIZE + ScanChunk::PayloadSize(rows, columns));
+        uint8_t* group = batch.rowGroup.data();
+        for (int i = 0; i < 4; ++i) {
+            group[i] = static_cast<uint8_t>(ROW_GROUP_MAGIC >> (8 * i));
+            group[4 + i] = static_cast<uint8_t>(rows >> (8 * i));
+        }
+        uint8_t* data = group + ROW_GROUP_HEADER_SIZE;
+        std::memcpy(data, payload + first * 8, rows * 8);
+        std::memcpy(data + rows * 8, payload + scans * 8 + first * 8, rows * 8);
+    } else {
+        batch.values.resize(columns * scans);
+        batch.quality.resize(columns * scans);
+    }
+
+    size_t tasks = TaskCount(columns, 1);
+    if (tasks == 0) {
+        FinishDecode(batch);
+        return true;
+    }
+
+    batch.remaining = tasks;
+    for (size_t task = 0; task < tasks; ++task) {
+        size_t begin = columns * task / tasks;
+        size_t end = columns * (task + 1) / tasks;
+        Dispatch([this, &batch, begin, end, scans, rows, first, payload]() {
+            for (size_t column = begin; column < end; ++column) {
+                size_t channel = m_channels[column];
+                if (m_options.format == ExportFormat::Columnar) {
+                    // Chunk payloads are already column-wise; copy the slice without decoding
+                    const uint8_t* source = payload + scans * 16 + channel * scans * 9;
+                    uint8_t* target = batch.rowGroup.data() + ROW_GROUP_HEADER_SIZE + rows * 16 + column * rows * 9;
+                    std::memcpy(target, source + first * 8, rows * 8);
+                    std::memcpy(target + rows * 8, source + scans * 8 + first, rows);
+                } else {
+                    batch.chunk.DecodeChannel(channel, batch.values.data() + column * scans,
+                                              batch.quality.data() + column * scans);
+                }
+            }
+            if (batch.remaining.fetch_sub(1) == 1) {
+                FinishDecode(batch);
+            }
+        });
+    }
+    return true;
+}
+
+void HistorianExporter::FinishDecode(Batch& batch) {
+    if (m_options.format == ExportFormat::Columnar) {
+        MarkDone(batch);
+        return;
+    }
+
+    const size_t rows = batch.rowCount;
+    size_t tasks = TaskCount(rows, MIN_ROWS_PER_TASK);
+    batch.text.resize(tasks);
+    batch.remaining = tasks;
+    for (size_t task = 0; task < tasks; ++task) {
+        size_t begin = batch.firstRow + rows * task / tasks;
+        size_t end = batch.firstRow + rows * (task + 1) / tasks;
+        Dispatch([this, &batch, task, begin, end]() {
+            const size_t scans = batch.chunk.scanCount;
+            const size_t columns = m_channels.size();
+            std::string& text = batch.text[task];
+            text.clear();
+            text.reserve((end - begin) * (24 + columns * (m_options.includeQuality ? 16 : 12)));
+
+            for (size_t row = begin; row < end; ++row) {
+                text += std::to_string(batch.scanNumbers[row]);
+                text += ',';
+                text += std::to_string(batch.timestamps[row]);
+                for (size_t column = 0; column < columns; ++column) {
+                    SensorQuality quality = batch.quality[column * scans + row];
+                    text += ',';
+                    if (IsQualityUsable(quality)) {
+                        AppendNumber(text, "%.10g", batch.values[column * scans + row]);
+                    }
+                    if (m_options.includeQuality) {
+                        text += ',';
+                        text += std::to_string(static_cast<unsigned>(quality));
+                    }
+                }
+                text += '\n';
+            }
+
+            if (batch.remaining.fetch_sub(1) == 1) {
+                MarkDone(batch);
+            }
+        });
+    }
+}
+
+void HistorianExporter::MarkDone(Batch& batch) {
+    std::lock_guard<std::mutex> lock(batch.mutex);
+    batch.done = true;
+    batch.condition.notify_all();
+}
+
+void HistorianExporter::WaitBatch(Batch& batch) {
+    std::unique_lock<std::mutex> lock(batch.mutex);
+    batch.condition.wait(lock, [&batch]() { return batch.done; });
+}
+
+void HistorianExporter::Dispatch(ThreadPool::Task task) {
+    ThreadPool::Task fallback = task;
+    if (!m_pool->Submit(std::move(task))) {
+        fallback();
+    }
+}
+
+size_t HistorianExporter::TaskCount(size_t items, size_t minimum) const {
+    if (items == 0) {
+        return 0;
+    }
+    size_t byMinimum = (items + minimum - 1) / minimum;
+    return std::max<size_t>(1, std::min(byMinimum, m_pool->GetShardCount() * 2));
+}
+
+std::string HistorianExporter::CsvHeader(const ScanRecordingReader& reader) const {
+    std::string header = "scan,timestamp_us";
+    for (size_t channel : m_channels) {
+        std::string id = std::to_string(reader.GetSensorIds()[channel]);
+        header += "," + id;
+        if (m_options.includeQuality) {
+            header += "," + id + "_quality";
+        }
+    }
+    return header + "\n";
+}
+
+std::vector<uint8_t> HistorianExporter::ColumnarHeader(const ScanRecordingReader& reader) const {
+    std::vector<uint8_t> header;
+    PutU32(header, COLUMNAR_MAGIC);
+    PutU16(header, COLUMNAR_VERSION);
+    PutU16(header, 0);
+    PutU32(header, static_cast<uint32_t>(m_channels.size()));
+    for (size_t channel : m_channels) {
+        PutU32(header, static_cast<uint32_t>(reader.GetSensorIds()[channel]));
+    }
+    for (size_t channel : m_channels) {
+        header.push_back(static_cast<uint8_t>(reader.GetKinds()[channel]));
+    }
+    return header;
+}
+
+// ColumnarExportReader
+
+bool ColumnarExportReader::Open(const std::string& path) {
+    m_file.close();
+    m_file.clear();
+    m_rowGroups.clear();
+    m_file.open(path, std::ios::binary | std::ios::ate);
+    if (!m_file) {
+        return false;
+    }
+    uint64_t fileSize = static_cast<uint64_t>(m_file.tellg());
+    m_file.seekg(0);
+
+    uint8_t fixed[12];
+    if (!m_file.read(reinterpret_cast<char*>(fixed), sizeof(fixed))) {
+        return false;
+    }
+    ByteReader header(fixed, sizeof(fixed));
+    if (header.Get(4) != COLUMNAR_MAGIC || header.Get(2) != COLUMNAR_VERSION) {
+        return false;
+    }
+    header.Get(2);
+    size_t channels = static_cast<size_t>(header.Get(4));
+    if (channels > MAX_CHANNELS) {
+        return false;
+    }
+
+    std::vector<uint8_t> layout(channels * 5);
+    if (!m_file.read(reinterpret_cast<char*>(layout.data()), static_cast<std::streamsize>(layout.size()))) {
+        return false;
+    }
+    ByteReader layoutReader(layout);
+    m_sensorIds.resize(channels);
+    m_kinds.resize(channels);
+    for (size_t c = 0; c < channels; ++c) {
+        m_sensorIds[c] = static_cast<int32_t>(static_cast<uint32_t>(layoutReader.Get(4)));
+    }
+    for (size_t c = 0; c < channels; ++c) {
+        uint8_t kind = static_cast<uint8_t>(layoutReader.Get(1));
+        if (!IsKnownSensorKind(kind)) {
+            return false;
+        }
+        m_kinds[c] = static_cast<SensorKind>(kind);
+    }
+
+    uint8_t trailerBytes[TRAILER_SIZE];
+    if (fileSize < TRAILER_SIZE || !m_file.seekg(static_cast<std::streamoff>(fileSize - TRAILER_SIZE)) ||
+        !m_file.read(reinterpret_cast<char*>(trailerBytes), TRAILER_SIZE)) {
+        return false;
+    }
+    ByteReader trailer(trailerBytes, TRAILER_SIZE);
+    uint64_t footerOffset = trailer.Get(8);
+    size_t groups = static_cast<size_t>(trailer.Get(4));
+    if (trailer.Get(4) != COLUMNAR_MAGIC || footerOffset + groups * FOOTER_ENTRY_SIZE + TRAILER_SIZE != fileSize) {
+        return false;
+    }
+
+    std::vector<uint8_t> footer(groups * FOOTER_ENTRY_SIZE);
+    m_file.seekg(static_cast<std::streamoff>(footerOffset));
+    if (!m_file.read(reinterpret_cast<char*>(footer.data()), static_cast<std::streamsize>(footer.size()))) {
+        return false;
+    }
+    ByteReader entries(footer);
+    for (size_t i = 0; i < groups; ++i) {
+        RowGroupInfo info;
+        info.offset = entries.Get(8);
+        info.rows = static_cast<size_t>(entries.Get(4));
+        info.firstUs = static_cast<int64_t>(entries.Get(8));
+        info.lastUs = static_cast<int64_t>(entries.Get(8));
+        m_rowGroups.push_back(info);
+    }
+    return entries.Ok() && layoutReader.Ok();
+}
+
+const std::vector<int>& ColumnarExportReader::GetSensorIds() const {
+    return m_sensorIds;
+}
+
+const std::vector<SensorKind>& ColumnarExportReader::GetKinds() const {
+    return m_kinds;
+}
+
+const std::vector<ColumnarExportReader::RowGroupInfo>& ColumnarExportReader::GetRowGroups() const {
+    return m_rowGroups;
+}
+
+bool ColumnarExportReader::ReadRowGroup(size_t index, ScanChunk& chunk) {
+    if (index >= m_rowGroups.size() || m_rowGroups[index].rows > MAX_ROWS) {
+        return false;
+    }
+
+    const RowGroupInfo& info = m_rowGroups[index];
+    uint8_t headerBytes[ROW_GROUP_HEADER_SIZE];
+    m_file.clear();
+    m_file.seekg(static_cast<std::streamoff>(info.offset));
+    if (!m_file.read(reinterpret_cast<char*>(headerBytes), ROW_GROUP_HEADER_SIZE)) {
+        return false;
+    }
+    ByteReader header(headerBytes, ROW_GROUP_HEADER_SIZE);
+    if (header.Get(4) != ROW_GROUP_MAGIC || header.Get(4) != info.rows) {
+        return false;
+    }
+
+    chunk.scanCount = info.rows;
+    chunk.channelCount = m_sensorIds.size();
+    chunk.payload.resize(ScanChunk::PayloadSize(info.rows, m_sensorIds.size()));
+    return static_cast<bool>(m_file.read(reinterpret_cast<char*>(chunk.payload.data()),
+                                         static_cast<std::streamsize>(chunk.payload.size())));
+}
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,340 @@
+#include "MetricsRegistry.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace Nuclear {
+
+namespace {
+
+uint64_t ToBits(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+double FromBits(uint64_t bits) {
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+void AddToBits(std::atomic<uint64_t>& target, double delta) {
+    uint64_t current = target.load(std::memory_order_relaxed);
+    while (!target.compare_exchange_weak(current, ToBits(FromBits(current) + delta), std::memory_order_relaxed)) {
+    }
+}
+
+void AppendDouble(std::string& out, double value) {
+    if (std::isnan(value)) {
+        out += "NaN";
+        return;
+    }
+    if (std::isinf(value)) {
+        out += value > 0 ? "+Inf" : "-Inf";
+        return;
+    }
+
+    // Shortest of 15 or 17 digits that reads back exactly, so bounds like 0.1 stay readable
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.15g", value);
+    if (std::strtod(buffer, nullptr) != value) {
+        std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+    }
+    out += buffer;
+}
+
+void AppendEscaped(std::string& out, const std::string& text, bool escapeQuotes) {
+    for (char c : text) {
+        if (c == '\\') {
+            out += "\\\\";
+        } else if (c == '\n') {
+            out += "\\n";
+        } else if (c == '"' && escapeQuotes) {
+            out += "\\\"";
+        } else {
+            out += c;
+        }
+    }
+}
+
+void AppendSeriesName(std::string& out, const std::string& name, const char* suffix, const std::string& labels,
+                      const std::string& extraLabel) {
+    out += name;
+    out += suffix;
+    if (labels.empty() && extraLabel.empty()) {
+        return;
+    }
+    out += '{';
+    out += labels;
+    if (!labels.empty() && !extraLabel.empty()) {
+        out += ',';
+    }
+    out += extraLabel;
+    out += '}';
+}
+
+const char* TypeName(MetricsRegistry::MetricType type) {
+    switch (type) {
+        case MetricsRegistry::MetricType::Counter: return "counter";
+        case MetricsRegistry::MetricType::Gauge: return "gauge";
+        case MetricsRegistry::MetricType::Histogram: return "histogram";
+    }
+    return "untyped";
+}
+
+} // namespace
+
+void MetricGauge::Set(double value) {
+    m_bits.store(ToBits(value), std::memory_order_relaxed);
+}
+
+void MetricGauge::Add(double delta) {
+    AddToBits(m_bits, delta);
+}
+
+double MetricGauge::Get() const {
+    return FromBits(m_bits.load(std::memory_order_relaxed));
+}
+
+MetricHistogram::MetricHistogram(std::vector<double> bounds)
+    : m_bounds(std::move(bounds)), m_buckets(new std::atomic<uint64_t>[m_bounds.size() + 1]) {
+    for (size_t i = 0; i <= m_bounds.size(); ++i) {
+        m_buckets[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void MetricHistogram::Observe(double value) {
+    size_t bucket = static_cast<size_t>(std::lower_bound(m_bounds.begin(), m_bounds.end(), value) - m_bounds.begin());
+    m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    AddToBits(m_sumBits, value);
+}
+
+MetricHistogram::Snapshot MetricHistogram::Read() const {
+    Snapshot snapshot;
+    snapshot.bounds = m_bounds;
+    snapshot.cumulative.resize(m_bounds.size() + 1);
+
+    // Count is derived from the buckets so that it always matches +Inf, even mid-update
+    uint64_t running = 0;
+    for (size_t i = 0; i <= m_bounds.size(); ++i) {
+        running += m_buckets[i].load(std::memory_order_relaxed);
+        snapshot.cumulative[i] = running;
+    }
+    snapshot.count = running;
+    snapshot.sum = FromBits(m_sumBits.load(std::memory_order_relaxed));
+    return snapshot;
+}
+
+MetricsRegistry::MetricsRegistry() : m_table(std::make_shared<FamilyTable>()) {}
+
+MetricCounter* MetricsRegistry::GetCounter(const std::string& name, const std::string& help, const Labels& labels) {
+    Series series;
+    auto create = [](Series& created) { created.counter = std::make_shared<MetricCounter>(); };
+    if (!FindOrAdd(name, help, MetricType::Counter, labels, create, false, series)) {
+        return nullptr;
+    }
+    return series.counter.get();
+}
+
+MetricGauge* MetricsRegistry::GetGauge(const std::string& name, const std::string& help, const Labels& labels) {
+    Series series;
+    auto create = [](Series& created) { created.gauge = std::make_shared<MetricGauge>(); };
+    if (!FindOrAdd(name, help, MetricType::Gauge, labels, create, false, series)) {
+        return nullptr;
+    }
+    return series.gauge.get();
+}
+
+MetricHistogram* MetricsRegistry::GetHistogram(const std::string& name, const std::string& help,
+                                               const std::vector<double>& bounds, const Labels& labels) {
+    if (bounds.empty() || !std::is_sorted(bounds.begin(), bounds.end()) ||
+        std::adjacent_find(bounds.begin(), bounds.end()) != bounds.end() || std::isnan(bounds.front()) ||
+        std::isinf(bounds.back())) {
+        return nullptr;
+    }
+    for (const auto& label : labels) {
+        if (label.first == "le") {
+            return nullptr;
+        }
+    }
+
+    Series series;
+    auto create = [&bounds](Series& created) { created.histogram = std::make_shared<MetricHistogram>(bounds); };
+    if (!FindOrAdd(name, help, MetricType::Histogram, labels, create, false, series)) {
+        return nullptr;
+    }
+    return series.histogram.get();
+}
+
+bool MetricsRegistry::RegisterFunction(const std::string& name, const std::string& help, MetricType type,
+                                       const Labels& labels, ValueFunction function) {
+    if (type == MetricType::Histogram || !function) {
+        return false;
+    }
+
+    Series series;
+    auto create = [&function](Series& created) { created.function = std::move(function); };
+    return FindOrAdd(name, help, type, labels, create, true, series);
+}
+
+std::string MetricsRegistry::Render() const {
+    std::shared_ptr<const FamilyTable> table = std::atomic_load(&m_table);
+
+    std::string out;
+    out.reserve(256 * table->size());
+    for (const Family& family : *table) {
+        out += "# HELP ";
+        out += family.name;
+        out += ' ';
+        AppendEscaped(out, family.help, false);
+        out += "\n# TYPE ";
+        out += family.name;
+        out += ' ';
+        out += TypeName(family.type);
+        out += '\n';
+
+        for (const Series& series : family.series) {
+            if (series.histogram) {
+                MetricHistogram::Snapshot snapshot = series.histogram->Read();
+                for (size_t i = 0; i <= snapshot.bounds.size(); ++i) {
+                    std::string le = "le=\"";
+                    AppendDouble(le, i < snapshot.bounds.size() ? snapshot.bounds[i] : HUGE_VAL);
+                    le += '"';
+                    AppendSeriesName(out, family.name, "_bucket", series.labels, le);
+                    out += ' ';
+                    out += std::to_string(snapshot.cumulative[i]);
+                    out += '\n';
+                }
+                AppendSeriesName(out, family.name, "_sum", series.labels, "");
+                out += ' ';
+                AppendDouble(out, snapshot.sum);
+                out += '\n';
+                AppendSeriesName(out, family.name, "_count", series.labels, "");
+                out += ' ';
+                out += std::to_string(snapshot.count);
+                out += '\n';
+                continue;
+            }
+
+            AppendSeriesName(out, family.name, "", series.labels, "");
+            out += ' ';
+            if (series.counter) {
+                out += std::to_string(series.counter->Get());
+            } else if (series.gauge) {
+                AppendDouble(out, series.gauge->Get());
+            } else {
+                AppendDouble(out, series.function());
+            }
+            out += '\n';
+        }
+    }
+    return out;
+}
+
+size_t MetricsRegistry::GetSeriesCount() const {
+    std::shared_ptr<const FamilyTable> table = std::atomic_load(&m_table);
+    size_t count = 0;
+    for (const Family& family : *table) {
+        count += family.series.size();
+    }
+    return count;
+}
+
+std::vector<double> MetricsRegistry::ExponentialBuckets(double start, double factor, size_t count) {
+    std::vector<double> bounds;
+    if (start <= 0.0 || factor <= 1.0) {
+        return bounds;
+    }
+    bounds.reserve(count);
+    double bound = start;
+    for (size_t i = 0; i < count; ++i) {
+        bounds.push_back(bound);
+        bound *= factor;
+    }
+    return bounds;
+}
+
+std::vector<double> MetricsRegistry::LatencyBuckets() {
+    return ExponentialBuckets(50e-6, 2.0, 16);
+}
+
+// Private methods implementation
+
+bool MetricsRegistry::FindOrAdd(const std::string& name, const std::string& help, MetricType type,
+                                const Labels& labels, const std::function<void(Series&)>& create, bool mustBeNew,
+                                Series& series) {
+    if (!IsValidName(name, true)) {
+        return false;
+    }
+
+    std::string rendered;
+    for (const auto& label : labels) {
+        if (!IsValidName(label.first, false) || label.first.compare(0, 2, "__") == 0) {
+            return false;
+        }
+        if (!rendered.empty()) {
+            rendered += ',';
+        }
+        rendered += label.first;
+        rendered += "=\"";
+        AppendEscaped(rendered, label.second, true);
+        rendered += '"';
+    }
+
+    std::lock_guard<std::mutex> lock(m_registrationMutex);
+    std::shared_ptr<const FamilyTable> current = std::atomic_load(&m_table);
+
+    auto family = std::find_if(current->begin(), current->end(),
+                               [&name](const Family& existing) { return existing.name == name; });
+    if (family != current->end()) {
+        if (family->type != type) {
+            return false;
+        }
+        auto existing = std::find_if(family->series.begin(), family->series.end(),
+                                     [&rendered](const Series& candidate) { return candidate.labels == rendered; });
+        if (existing != family->series.end()) {
+            // A function and a stored metric must not share a series
+            if (mustBeNew || static_cast<bool>(existing->function)) {
+                return false;
+            }
+            series = *existing;
+            return true;
+        }
+    }
+
+    series = Series();
+    series.labels = rendered;
+    create(series);
+
+    auto table = std::make_shared<FamilyTable>(*current);
+    auto target = std::find_if(table->begin(), table->end(),
+                               [&name](const Family& existing) { return existing.name == name; });
+    if (target == table->end()) {
+        table->push_back(Family{name, help, type, {}});
+        target = table->end() - 1;
+    }
+    target->series.push_back(series);
+
+    std::atomic_store(&m_table, std::shared_ptr<const FamilyTable>(std::move(table)));
+    return true;
+}
+
+bool MetricsRegistry::IsValidName(const std::string& name, bool allowColon) {
+    if (name.empty()) {
+        return false;
+    }
+    for (size_t i = 0; i < name.size(); ++i) {
+        char c = name[i];
+        bool valid = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || (allowColon && c == ':') ||
+                     (i > 0 && c >= '0' && c <= '9');
+        if (!valid) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,263 @@
+#include "MetricsServer.h"
+#include <algorithm>
+#include <cstring>
+
+namespace Nuclear {
+
+namespace {
+
+constexpr const char* EXPOSITION_CONTENT_TYPE = "text/plain; version=0.0.4; charset=utf-8";
+
+#ifdef MSG_NOSIGNAL
+constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+constexpr int SEND_FLAGS = 0;
+#endif
+
+int PollReadable(SOCKET socket, int timeoutMs) {
+#ifdef _WIN32
+    WSAPOLLFD pollDescriptor{};
+    pollDescriptor.fd = socket;
+    pollDescriptor.events = POLLRDNORM;
+    return WSAPoll(&pollDescriptor, 1, timeoutMs);
+#else
+    pollfd pollDescriptor{};
+    pollDescriptor.fd = socket;
+    pollDescriptor.events = POLLIN;
+    return poll(&pollDescriptor, 1, timeoutMs);
+#endif
+}
+
+int PollWritable(SOCKET socket, int timeoutMs) {
+#ifdef _WIN32
+    WSAPOLLFD pollDescriptor{};
+    pollDescriptor.fd = socket;
+    pollDescriptor.events = POLLWRNORM;
+    return WSAPoll(&pollDescriptor, 1, timeoutMs);
+#else
+    pollfd pollDescriptor{};
+    pollDescriptor.fd = socket;
+    pollDescriptor.events = POLLOUT;
+    return poll(&pollDescriptor, 1, timeoutMs);
+#endif
+}
+
+bool WouldBlock() {
+#ifdef _WIN32
+    return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+    return errno == EAGAIN || errno == EWOULDBLOCK;
+#endif
+}
+
+int RemainingMs(std::chrono::steady_clock::time_point deadline) {
+    return static_cast<int>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count());
+}
+
+} // namespace
+
+MetricsServer::MetricsServer(const MetricsRegistry& registry, const Config& config)
+    : m_registry(registry), m_config(config), m_listenSocket(INVALID_SOCKET), m_boundPort(-1), m_running(false),
+      m_scrapes(0), m_notFound(0), m_badRequests(0), m_bytesServed(0), m_timedOut(0), m_lastRenderMicros(0.0),
+      m_maxRenderMicros(0.0) {}
+
+MetricsServer::~MetricsServer() {
+    Stop();
+}
+
+bool MetricsServer::Start() {
+    if (m_running.load()) {
+        return false;
+    }
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(static_cast<uint16_t>(m_config.port));
+    if (m_config.port < 0 || m_config.port > 65535 ||
+        inet_pton(AF_INET, m_config.bindAddress.c_str(), &address.sin_addr) != 1) {
+        return false;
+    }
+
+#ifdef _WIN32
+    WSADATA wsaData;
+    if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+        return false;
+    }
+#endif
+
+    m_listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    int enable = 1;
+    if (m_listenSocket == INVALID_SOCKET ||
+        setsockopt(m_listenSocket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&enable),
+                   sizeof(enable)) == SOCKET_ERROR ||
+        bind(m_listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == SOCKET_ERROR ||
+        listen(m_listenSocket, 8) == SOCKET_ERROR) {
+        if (m_listenSocket != INVALID_SOCKET) {
+            closesocket(m_listenSocket);
+            m_listenSocket = INVALID_SOCKET;
+        }
+#ifdef _WIN32
+        WSACleanup();
+#endif
+        return false;
+    }
+
+    socklen_t length = sizeof(address);
+    if (getsockname(m_listenSocket, reinterpret_cast<sockaddr*>(&address), &length) == 0) {
+        m_boundPort = ntohs(address.sin_port);
+    }
+
+    m_running = true;
+    m_serveThread = std::make_unique<std::thread>(&MetricsServer::ServeLoop, this);
+    return true;
+}
+
+void MetricsServer::Stop() {
+    if (!m_running.exchange(false)) {
+        return;
+    }
+
+    if (m_serveThread && m_serveThread->joinable()) {
+        m_serveThread->join();
+    }
+    m_serveThread.reset();
+
+    closesocket(m_listenSocket);
+    m_listenSocket = INVALID_SOCKET;
+    m_boundPort = -1;
+
+#ifdef _WIN32
+    WSACleanup();
+#endif
+}
+
+bool MetricsServer::IsRunning() const {
+    return m_running.load();
+}
+
+int MetricsServer::GetPort() const {
+    return m_boundPort;
+}
+
+MetricsServer::Statistics MetricsServer::GetStatistics() const {
+    return Statistics{m_scrapes.load(), m_notFound.load(), m_badRequests.load(), m_bytesServed.load(),
+                      m_timedOut.load(), m_lastRenderMicros.load(), m_maxRenderMicros.load()};
+}
+
+// Private methods implementation
+
+void MetricsServer::ServeLoop() {
+    while (m_running.load()) {
+        if (PollReadable(m_listenSocket, POLL_INTERVAL_MS) <= 0) {
+            continue;
+        }
+
+        SOCKET client = accept(m_listenSocket, nullptr, nullptr);
+        if (client == INVALID_SOCKET) {
+            continue;
+        }
+        // Non-blocking so a partial send never parks the thread past the response deadline
+#ifdef _WIN32
+        u_long nonBlocking = 1;
+        ioctlsocket(client, FIONBIO, &nonBlocking);
+#else
+        fcntl(client, F_SETFL, fcntl(client, F_GETFL, 0) | O_NONBLOCK);
+#endif
+        HandleConnection(client);
+        closesocket(client);
+    }
+}
+
+void MetricsServer::HandleConnection(SOCKET client) {
+    // Read the request head; the body of a GET is never needed
+    std::string request;
+    auto deadline = std::chrono::steady_clock::now() + m_config.requestTimeout;
+    char buffer[1024];
+    while (request.find("\r\n\r\n") == std::string::npos && request.find("\n\n") == std::string::npos) {
+        int remainingMs = RemainingMs(deadline);
+        if (remainingMs <= 0 || request.size() > m_config.maxRequestBytes || !m_running.load()) {
+            m_badRequests++;
+            SendResponse(client, "400 Bad Request", "text/plain", "Bad request\n");
+            return;
+        }
+        if (PollReadable(client, remainingMs) <= 0) {
+            continue;
+        }
+        int received = recv(client, buffer, sizeof(buffer), 0);
+        if (received <= 0) {
+            m_badRequests++;
+            return;
+        }
+        request.append(buffer, static_cast<size_t>(received));
+    }
+
+    std::string requestLine = request.substr(0, request.find_first_of("\r\n"));
+    size_t methodEnd = requestLine.find(' ');
+    size_t targetEnd = methodEnd == std::string::npos ? std::string::npos : requestLine.find(' ', methodEnd + 1);
+    if (targetEnd == std::string::npos || requestLine.compare(targetEnd + 1, 5, "HTTP/") != 0) {
+        m_badRequests++;
+        SendResponse(client, "400 Bad Request", "text/plain", "Bad request\n");
+        return;
+    }
+
+    std::string method = requestLine.substr(0, methodEnd);
+    std::string target = requestLine.substr(methodEnd + 1, targetEnd - methodEnd - 1);
+    target = target.substr(0, target.find('?'));
+    if (method != "GET" || target != "/metrics") {
+        m_notFound++;
+        SendResponse(client, "404 Not Found", "text/plain", "Metrics are served at /metrics\n");
+        return;
+    }
+
+    auto renderStart = std::chrono::steady_clock::now();
+    std::string body = m_registry.Render();
+    double renderMicros =
+        std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - renderStart).count();
+
+    m_lastRenderMicros = renderMicros;
+    if (renderMicros > m_maxRenderMicros.load()) {
+        m_maxRenderMicros = renderMicros;
+    }
+    if (SendResponse(client, "200 OK", EXPOSITION_CONTENT_TYPE, body)) {
+        m_scrapes++;
+    }
+}
+
+bool MetricsServer::SendResponse(SOCKET client, const char* status, const char* contentType, const std::string& body) {
+    std::string response = "HTTP/1.1 ";
+    response += status;
+    response += "\r\nContent-Type: ";
+    response += contentType;
+    response += "\r\nContent-Length: ";
+    response += std::to_string(body.size());
+    response += "\r\nConnection: close\r\n\r\n";
+    response += body;
+
+    // Only send once poll reports space, so a client that stops reading costs at most responseTimeout
+    auto deadline = std::chrono::steady_clock::now() + m_config.responseTimeout;
+    size_t sent = 0;
+    while (sent < response.size()) {
+        int remainingMs = RemainingMs(deadline);
+        if (remainingMs <= 0 || !m_running.load()) {
+            m_timedOut++;
+            m_bytesServed += sent;
+            return false;
+        }
+        if (PollWritable(client, std::min(remainingMs, POLL_INTERVAL_MS)) <= 0) {
+            continue;
+        }
+        int result = send(client, response.data() + sent, static_cast<int>(response.size() - sent), SEND_FLAGS);
+        if (result < 0 && WouldBlock()) {
+            continue;
+        }
+        if (result <= 0) {
+            return false;
+        }
+        sent += static_cast<size_t>(result);
+    }
+    m_bytesServed += sent;
+    return true;
+}
+
+} // namespace Nuclear
\ No newline at end of file
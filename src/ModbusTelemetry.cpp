@@ -0,0 +1,284 @@
+#include "ModbusTelemetry.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace Nuclear {
+
+namespace {
+
+constexpr uint8_t EXCEPTION_ACKNOWLEDGE = 0x05;
+constexpr uint8_t EXCEPTION_SERVER_BUSY = 0x06;
+constexpr double DIAGNOSIS_RATE = 0.05;        // Recent timeout or busy share worth reporting
+
+const char* Diagnose(const ModbusDeviceStats& stats) {
+    if (stats.failures > 0 && stats.responses == 0 && stats.exceptions == 0) {
+        return "UNREACHABLE";
+    }
+    if (stats.timeoutRate >= DIAGNOSIS_RATE) {
+        return "TIMEOUTS (network)";
+    }
+    if (stats.busyRate >= DIAGNOSIS_RATE) {
+        return "BUSY (PLC overloaded)";
+    }
+    if (stats.slow) {
+        return "SLOW (RTT above baseline)";
+    }
+    return "OK";
+}
+
+} // namespace
+
+ModbusTelemetry::ModbusTelemetry(const Config& config) : m_config(config), m_registry(nullptr) {
+    for (double bound : MetricsRegistry::LatencyBuckets()) {
+        m_bounds.push_back(bound * 1e6);
+    }
+}
+
+size_t ModbusTelemetry::AddDevice(const std::string& device) {
+    Device added;
+    added.stats = ModbusDeviceStats{device, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+                                    std::vector<uint64_t>(m_bounds.size() + 1, 0), 0.0, 0.0, false, 0};
+    m_devices.push_back(std::move(added));
+    if (m_registry) {
+        RegisterDevice(m_devices.back());
+    }
+    return m_devices.size() - 1;
+}
+
+void ModbusTelemetry::Clear() {
+    m_devices.clear();
+}
+
+void ModbusTelemetry::SetSlowDeviceHandler(SlowDeviceHandler handler) {
+    m_slowHandler = std::move(handler);
+}
+
+void ModbusTelemetry::RecordRequest(size_t device, size_t bytes) {
+    if (device >= m_devices.size()) {
+        return;
+    }
+
+    Device& tracked = m_devices[device];
+    tracked.stats.requests++;
+    tracked.stats.bytesSent += bytes;
+    if (tracked.metrics.requests) {
+        tracked.metrics.requests->Increment();
+        tracked.metrics.bytesSent->Increment(bytes);
+    }
+}
+
+void ModbusTelemetry::RecordResponse(size_t device, size_t bytes, std::chrono::microseconds rtt) {
+    if (device >= m_devices.size()) {
+        return;
+    }
+
+    Device& tracked = m_devices[device];
+    double rttMicros = static_cast<double>(rtt.count());
+    tracked.stats.responses++;
+    tracked.stats.bytesReceived += bytes;
+    if (tracked.metrics.rttSeconds) {
+        tracked.metrics.bytesReceived->Increment(bytes);
+        tracked.metrics.rttSeconds->Observe(rttMicros * 1e-6);
+    }
+
+    AddOutcome(tracked, false, false);
+    AddRttSample(tracked, rttMicros);
+}
+
+void ModbusTelemetry::RecordException(size_t device, size_t bytes, uint8_t exceptionCode) {
+    if (device >= m_devices.size()) {
+        return;
+    }
+
+    Device& tracked = m_devices[device];
+    bool busy = exceptionCode == EXCEPTION_ACKNOWLEDGE || exceptionCode == EXCEPTION_SERVER_BUSY;
+    tracked.stats.exceptions++;
+    tracked.stats.busyExceptions += busy ? 1 : 0;
+    tracked.stats.bytesReceived += bytes;
+    tracked.stats.lastExceptionCode = exceptionCode;
+    if (tracked.metrics.exceptions) {
+        tracked.metrics.exceptions->Increment();
+        tracked.metrics.bytesReceived->Increment(bytes);
+    }
+
+    AddOutcome(tracked, false, busy);
+}
+
+void ModbusTelemetry::RecordTimeout(size_t device) {
+    if (device >= m_devices.size()) {
+        return;
+    }
+
+    Device& tracked = m_devices[device];
+    tracked.stats.timeouts++;
+    if (tracked.metrics.timeouts) {
+        tracked.metrics.timeouts->Increment();
+    }
+
+    AddOutcome(tracked, true, false);
+}
+
+void ModbusTelemetry::RecordFailure(size_t device) {
+    if (device >= m_devices.size()) {
+        return;
+    }
+
+    Device& tracked = m_devices[device];
+    tracked.stats.failures++;
+    if (tracked.metrics.failures) {
+        tracked.metrics.failures->Increment();
+    }
+}
+
+bool ModbusTelemetry::IsSlow(size_t device) const {
+    return device < m_devices.size() && m_devices[device].stats.slow;
+}
+
+ModbusDeviceStats ModbusTelemetry::GetDeviceStats(size_t device) const {
+    if (device >= m_devices.size()) {
+        return ModbusDeviceStats{};
+    }
+
+    const Device& tracked = m_devices[device];
+    ModbusDeviceStats stats = tracked.stats;
+    stats.averageRttMicros = tracked.rttSamples > 0 ? tracked.rttMicrosTotal / tracked.rttSamples : 0.0;
+    stats.p50RttMicros = Percentile(tracked, 0.50);
+    stats.p99RttMicros = Percentile(tracked, 0.99);
+    return stats;
+}
+
+std::vector<ModbusDeviceStats> ModbusTelemetry::GetAllStats() const {
+    std::vector<ModbusDeviceStats> all;
+    all.reserve(m_devices.size());
+    for (size_t i = 0; i < m_devices.size(); ++i) {
+        all.push_back(GetDeviceStats(i));
+    }
+    return all;
+}
+
+std::string ModbusTelemetry::FormatStatus() const {
+    std::string status;
+    char line[320];
+    for (const ModbusDeviceStats& stats : GetAllStats()) {
+        std::snprintf(line, sizeof(line),
+                      "%-21s req %llu exc %llu busy %llu tmo %llu fail %llu | rtt avg %.2f p99 %.2f "
+                      "recent %.2f base %.2f ms | %s\n",
+                      stats.device.c_str(), static_cast<unsigned long long>(stats.requests),
+                      static_cast<unsigned long long>(stats.exceptions),
+                      static_cast<unsigned long long>(stats.busyExceptions),
+                      static_cast<unsigned long long>(stats.timeouts),
+                      static_cast<unsigned long long>(stats.failures), stats.averageRttMicros / 1000.0,
+                      stats.p99RttMicros / 1000.0, stats.recentRttMicros / 1000.0,
+                      stats.baselineRttMicros / 1000.0, Diagnose(stats));
+        status += line;
+    }
+    return status;
+}
+
+void ModbusTelemetry::RegisterMetrics(MetricsRegistry& registry) {
+    m_registry = &registry;
+    for (Device& device : m_devices) {
+        RegisterDevice(device);
+    }
+}
+
+const std::vector<double>& ModbusTelemetry::GetRttBounds() const {
+    return m_bounds;
+}
+
+// Private methods implementation
+
+void ModbusTelemetry::AddRttSample(Device& device, double rttMicros) {
+    ModbusDeviceStats& stats = device.stats;
+    size_t bucket = static_cast<size_t>(std::lower_bound(m_bounds.begin(), m_bounds.end(), rttMicros) -
+                                        m_bounds.begin());
+    stats.rttBuckets[bucket]++;
+    stats.maxRttMicros = std::max(stats.maxRttMicros, rttMicros);
+    device.rttMicrosTotal += rttMicros;
+    device.rttSamples++;
+
+    // The baseline is a plain mean until warm-up ends so a slow first connect does not linger in it
+    if (device.rttSamples == 1) {
+        stats.recentRttMicros = rttMicros;
+    } else {
+        stats.recentRttMicros += m_config.recentWeight * (rttMicros - stats.recentRttMicros);
+    }
+    if (device.rttSamples <= m_config.warmupResponses) {
+        stats.baselineRttMicros = device.rttMicrosTotal / device.rttSamples;
+        return;
+    }
+    // Outliers stay out of the baseline, otherwise a step change would drag it up before being flagged
+    if (!stats.slow && rttMicros <= stats.baselineRttMicros * m_config.slowRatio) {
+        stats.baselineRttMicros += m_config.baselineWeight * (rttMicros - stats.baselineRttMicros);
+    }
+
+    double floor = static_cast<double>(m_config.slowFloor.count());
+    bool slow = stats.slow;
+    if (!slow && stats.recentRttMicros > stats.baselineRttMicros * m_config.slowRatio &&
+        stats.recentRttMicros > floor) {
+        slow = true;
+    } else if (slow && (stats.recentRttMicros < stats.baselineRttMicros * m_config.recoverRatio ||
+                        stats.recentRttMicros < floor)) {
+        slow = false;
+    }
+
+    if (slow != stats.slow) {
+        stats.slow = slow;
+        stats.slowTransitions += slow ? 1 : 0;
+        if (device.metrics.slow) {
+            device.metrics.slow->Set(slow ? 1.0 : 0.0);
+        }
+        if (m_slowHandler) {
+            m_slowHandler(stats.device, slow);
+        }
+    }
+}
+
+void ModbusTelemetry::AddOutcome(Device& device, bool timedOut, bool busy) {
+    ModbusDeviceStats& stats = device.stats;
+    stats.timeoutRate += m_config.recentWeight * ((timedOut ? 1.0 : 0.0) - stats.timeoutRate);
+    stats.busyRate += m_config.recentWeight * ((busy ? 1.0 : 0.0) - stats.busyRate);
+}
+
+void ModbusTelemetry::RegisterDevice(Device& device) {
+    MetricsRegistry::Labels labels = {{"device", device.stats.device}};
+    DeviceMetrics metrics;
+    metrics.requests = m_registry->GetCounter("npm_modbus_requests_total", "Modbus requests sent", labels);
+    metrics.exceptions =
+        m_registry->GetCounter("npm_modbus_exceptions_total", "Modbus exception responses", labels);
+    metrics.timeouts = m_registry->GetCounter("npm_modbus_timeouts_total", "Modbus requests that timed out", labels);
+    metrics.failures =
+        m_registry->GetCounter("npm_modbus_failures_total", "Modbus send errors and dropped connections", labels);
+    metrics.bytesSent = m_registry->GetCounter("npm_modbus_sent_bytes_total", "Modbus request bytes", labels);
+    metrics.bytesReceived =
+        m_registry->GetCounter("npm_modbus_received_bytes_total", "Modbus response bytes", labels);
+    metrics.rttSeconds = m_registry->GetHistogram("npm_modbus_rtt_seconds", "Modbus request round-trip time",
+                                                  MetricsRegistry::LatencyBuckets(), labels);
+    metrics.slow = m_registry->GetGauge("npm_modbus_device_slow", "1 while the device's RTT is degraded", labels);
+
+    // Record calls test one pointer per group, so attach only a complete set
+    if (metrics.requests && metrics.exceptions && metrics.timeouts && metrics.failures && metrics.bytesSent &&
+        metrics.bytesReceived && metrics.rttSeconds && metrics.slow) {
+        metrics.slow->Set(device.stats.slow ? 1.0 : 0.0);
+        device.metrics = metrics;
+    }
+}
+
+double ModbusTelemetry::Percentile(const Device& device, double fraction) const {
+    if (device.rttSamples == 0) {
+        return 0.0;
+    }
+
+    uint64_t target = static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(device.rttSamples)));
+    uint64_t running = 0;
+    for (size_t i = 0; i < m_bounds.size(); ++i) {
+        running += device.stats.rttBuckets[i];
+        if (running >= target) {
+            return m_bounds[i];
+        }
+    }
+    return device.stats.maxRttMicros;
+}
+
+} // namespace Nuclear
\ No newline at end of file
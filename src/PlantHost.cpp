@@ -0,0 +1,203 @@
+#include "PlantHost.h"
+#include "CpuAffinity.h"
+#include <algorithm>
+#include <sstream>
+
+namespace Nuclear {
+
+PlantHost::PlantHost(std::unique_ptr<SocketManager> frontEnd)
+    : m_frontEnd(std::move(frontEnd)), m_running(false) {}
+
+PlantHost::~PlantHost() {
+    Stop();
+}
+
+bool PlantHost::AddPlant(std::unique_ptr<PlantMonitor> monitor, const PlantConfig& config) {
+    std::lock_guard<std::mutex> lock(m_hostMutex);
+    if (m_running || !monitor || config.scanIntervalMs <= 0) {
+        return false;
+    }
+
+    if (!m_router.RegisterPlant(monitor->GetPlantId())) {
+        return false;
+    }
+
+    m_plants.push_back({std::move(monitor), config});
+    return true;
+}
+
+bool PlantHost::Start() {
+    std::lock_guard<std::mutex> lock(m_hostMutex);
+    if (m_running || m_plants.empty() || !m_frontEnd) {
+        return false;
+    }
+
+    m_frontEnd->SetDataHandler([this](const std::string& clientId, const std::string& data) {
+        HandleClientData(clientId, data);
+    });
+    m_frontEnd->SetDisconnectHandler([this](const std::string& clientId) {
+        m_router.RemoveClient(clientId);
+    });
+    if (!m_frontEnd->Initialize() || !m_frontEnd->StartServer()) {
+        return false;
+    }
+
+    m_workers = std::make_unique<ThreadPool>(WorkerShardCount(m_plants.size()), MAX_QUEUED_PER_WORKER);
+
+    for (size_t i = 0; i < m_plants.size(); ++i) {
+        PlantMonitor& monitor = *m_plants[i].monitor;
+        const PlantConfig& config = m_plants[i].config;
+
+        monitor.SetCoreAffinity(ResolveCore(config, i));
+        monitor.SetWorkerPool(m_workers.get());
+        monitor.SetPublisher([this](const std::string& plantId, const std::string& data) {
+            return PublishPlantData(plantId, data);
+        });
+        monitor.SetDeltaPublisher([this](const std::string& plantId, const std::string& frame) {
+            return PublishDeltaFrame(plantId, frame);
+        });
+
+        if (!monitor.Initialize(config.configFile) || !monitor.StartMonitoring(config.scanIntervalMs)) {
+            StopPlants();
+            m_frontEnd->StopServer();
+            m_workers->Shutdown();
+            m_workers.reset();
+            return false;
+        }
+    }
+
+    m_running = true;
+    return true;
+}
+
+void PlantHost::Stop() {
+    std::lock_guard<std::mutex> lock(m_hostMutex);
+    if (!m_running) {
+        return;
+    }
+
+    StopPlants();
+    m_frontEnd->StopServer();
+    m_workers->Shutdown();
+    m_running = false;
+}
+
+bool PlantHost::IsRunning() const {
+    return m_running;
+}
+
+size_t PlantHost::GetPlantCount() const {
+    std::lock_guard<std::mutex> lock(m_hostMutex);
+    return m_plants.size();
+}
+
+PlantMonitor* PlantHost::GetPlant(const std::string& plantId) const {
+    std::lock_guard<std::mutex> lock(m_hostMutex);
+    for (const HostedPlant& plant : m_plants) {
+        if (plant.monitor->GetPlantId() == plantId) {
+            return plant.monitor.get();
+        }
+    }
+    return nullptr;
+}
+
+std::string PlantHost::GetStatus() const {
+    std::lock_guard<std::mutex> lock(m_hostMutex);
+    std::ostringstream status;
+    status << "{\"running\":" << (m_running ? "true" : "false") << ",\"plants\":[";
+
+    for (size_t i = 0; i < m_plants.size(); ++i) {
+        const HostedPlant& plant = m_plants[i];
+        auto subscribers = m_router.GetSubscribers(plant.monitor->GetPlantId());
+
+        status << (i > 0 ? "," : "")
+               << "{\"plantId\":\"" << plant.monitor->GetPlantId() << "\""
+               << ",\"core\":" << ResolveCore(plant.config, i)
+               << ",\"subscribers\":" << (subscribers ? subscribers->size() : 0)
+               << ",\"status\":" << plant.monitor->GetSystemStatus() << "}";
+    }
+
+    status << "]}";
+    return status.str();
+}
+
+const SubscriptionRouter& PlantHost::GetRouter() const {
+    return m_router;
+}
+
+size_t PlantHost::WorkerShardCount(size_t plantCount) {
+    size_t wanted = plantCount * WORKERS_PER_PLANT + FRONT_END_WORKERS;
+    return std::max<size_t>(1, std::min<size_t>(wanted, GetCoreCount()));
+}
+
+int PlantHost::ResolveCore(const PlantConfig& config, size_t plantIndex) {
+    if (config.core >= 0) {
+        return config.core;
+    }
+    if (config.core == NO_PINNING) {
+        return -1;
+    }
+
+    unsigned cores = GetCoreCount();
+    if (cores < 2) {
+        return -1;
+    }
+    return 1 + static_cast<int>(plantIndex % (cores - 1));
+}
+
+// Private methods implementation
+
+void PlantHost::HandleClientData(const std::string& clientId, const std::string& data) {
+    std::string response;
+    std::string deltaPlantId;
+    if (!m_router.HandleCommand(clientId, data, response, &deltaPlantId)) {
+        response = "ERROR expected SUBSCRIBE <plantId>, UNSUBSCRIBE <plantId> or SUBSCRIBE_DELTA [plantId]";
+    }
+
+    // A delta subscriber gets no text reply; its feed starts with the keyframe requested here.
+    // m_plants is fixed while running, and taking m_hostMutex here would deadlock Stop joining the front-end.
+    if (!deltaPlantId.empty()) {
+        for (HostedPlant& plant : m_plants) {
+            if (plant.monitor->GetPlantId() == deltaPlantId) {
+                plant.monitor->RequestDeltaKeyframe();
+            }
+        }
+        return;
+    }
+    m_frontEnd->SendToClient(clientId, response);
+}
+
+int PlantHost::PublishPlantData(const std::string& plantId, const std::string& data) {
+    return PublishToFeed(plantId, data, SubscriptionRouter::Feed::Reports);
+}
+
+int PlantHost::PublishDeltaFrame(const std::string& plantId, const std::string& frame) {
+    return PublishToFeed(plantId, frame, SubscriptionRouter::Feed::Delta);
+}
+
+int PlantHost::PublishToFeed(const std::string& plantId, const std::string& data, SubscriptionRouter::Feed feed) {
+    auto subscribers = m_router.GetSubscribers(plantId, feed);
+    if (!subscribers) {
+        return 0;
+    }
+
+    int delivered = 0;
+    for (const std::string& clientId : *subscribers) {
+        if (m_frontEnd->SendToClient(clientId, data)) {
+            ++delivered;
+        } else if (m_frontEnd->GetClientHandle(clientId) == INVALID_SLOT_HANDLE) {
+            m_router.RemoveClient(clientId);
+        }
+    }
+    return delivered;
+}
+
+void PlantHost::StopPlants() {
+    for (HostedPlant& plant : m_plants) {
+        if (plant.monitor->IsMonitoring()) {
+            plant.monitor->StopMonitoring();
+        }
+    }
+}
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,158 @@
+#include "RecordedSensorReader.h"
+
+namespace Nuclear {
+
+RecordedSensorReader::RecordedSensorReader() : m_hasScan(false), m_exhausted(false), m_scansServed(0) {}
+
+bool RecordedSensorReader::Open(const std::string& path) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_reader.Open(path)) {
+        return false;
+    }
+
+    m_channelSet = ChannelSet::Create(1, m_reader.GetSensorIds(), m_reader.GetKinds());
+    if (!m_channelSet) {
+        return false;
+    }
+    m_hasScan = false;
+    m_exhausted = false;
+    m_scansServed = 0;
+    return true;
+}
+
+bool RecordedSensorReader::AdvanceScan() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_channelSet || m_exhausted) {
+        return false;
+    }
+
+    if (!m_reader.ReadNext(m_current)) {
+        m_exhausted = true;
+        return false;
+    }
+
+    m_hasScan = true;
+    ++m_scansServed;
+    return true;
+}
+
+void RecordedSensorReader::Rewind() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_reader.Rewind();
+    m_hasScan = false;
+    m_exhausted = false;
+    m_scansServed = 0;
+}
+
+SensorSnapshot RecordedSensorReader::GetCurrentSnapshot() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_current;
+}
+
+bool RecordedSensorReader::IsExhausted() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_exhausted;
+}
+
+uint64_t RecordedSensorReader::GetScansServed() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_scansServed;
+}
+
+double RecordedSensorReader::ReadTemperature(int sensorId) const {
+    return ReadRecorded(sensorId);
+}
+
+double RecordedSensorReader::ReadPressure(int sensorId) const {
+    return ReadRecorded(sensorId);
+}
+
+double RecordedSensorReader::ReadRadiationLevel(int sensorId) const {
+    return ReadRecorded(sensorId);
+}
+
+bool RecordedSensorReader::IsSensorOnline(int sensorId) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t channel = 0;
+    return FindCurrent(sensorId, channel) && IsQualityUsable(m_current.quality[channel]);
+}
+
+std::vector<int> RecordedSensorReader::GetAvailableSensors() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_channelSet ? m_channelSet->GetSensorIds() : std::vector<int>();
+}
+
+std::shared_ptr<const ChannelSet> RecordedSensorReader::GetChannelSet() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_channelSet;
+}
+
+size_t RecordedSensorReader::ReadChannels(const std::vector<int>& sensorIds, const std::vector<SensorKind>& kinds,
+                                          double* values, SensorQuality* quality) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    size_t usable = 0;
+    for (size_t i = 0; i < sensorIds.size(); ++i) {
+        size_t channel = 0;
+        if (i < kinds.size() && FindCurrent(sensorIds[i], kinds[i], channel)) {
+            values[i] = m_current.values[channel];
+            quality[i] = m_current.quality[channel];
+        } else {
+            values[i] = -1.0;
+            quality[i] = QUALITY_COMM_FAIL;
+        }
+        usable += IsQualityUsable(quality[i]) ? 1 : 0;
+    }
+    return usable;
+}
+
+size_t RecordedSensorReader::ReadSnapshot(const ChannelSet& channels, SensorSnapshot& snapshot) const {
+    if (!channels.Matches(snapshot.sensorIds, snapshot.kinds) || snapshot.Size() != channels.Size()) {
+        snapshot.sensorIds = channels.GetSensorIds();
+        snapshot.kinds = channels.GetKinds();
+        snapshot.values.resize(channels.Size());
+        snapshot.quality.resize(channels.Size());
+    }
+    snapshot.SetScaling(nullptr);   // Recordings hold engineering values
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_hasScan && m_channelSet && m_channelSet->Matches(channels.GetSensorIds(), channels.GetKinds())) {
+        snapshot.values.assign(m_current.values.begin(), m_current.values.end());
+        snapshot.quality.assign(m_current.quality.begin(), m_current.quality.end());
+        return snapshot.Size() - snapshot.CountUnusable();
+    }
+
+    const std::vector<int>& sensorIds = channels.GetSensorIds();
+    const std::vector<SensorKind>& kinds = channels.GetKinds();
+    size_t usable = 0;
+    for (size_t i = 0; i < sensorIds.size(); ++i) {
+        size_t channel = 0;
+        if (FindCurrent(sensorIds[i], kinds[i], channel)) {
+            snapshot.values[i] = m_current.values[channel];
+            snapshot.quality[i] = m_current.quality[channel];
+        } else {
+            snapshot.values[i] = -1.0;
+            snapshot.quality[i] = QUALITY_COMM_FAIL;
+        }
+        usable += IsQualityUsable(snapshot.quality[i]) ? 1 : 0;
+    }
+    return usable;
+}
+
+// Private methods implementation
+
+bool RecordedSensorReader::FindCurrent(int sensorId, size_t& channel) const {
+    return m_hasScan && m_channelSet && m_channelSet->FindChannel(sensorId, channel);
+}
+
+bool RecordedSensorReader::FindCurrent(int sensorId, SensorKind kind, size_t& channel) const {
+    return FindCurrent(sensorId, channel) && m_channelSet->GetKinds()[channel] == kind;
+}
+
+double RecordedSensorReader::ReadRecorded(int sensorId) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t channel = 0;
+    return FindCurrent(sensorId, channel) ? m_current.values[channel] : -1.0;
+}
+
+} // namespace Nuclear
\ No newline at end of file
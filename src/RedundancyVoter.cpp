@@ -0,0 +1,159 @@
+#include "RedundancyVoter.h"
+#include <algorithm>
+#include <limits>
+
+namespace Nuclear {
+
+RedundancyVoter::RedundancyVoter() : m_channelCount(0), m_statistics{0, 0, 0, 0} {
+}
+
+size_t RedundancyVoter::Configure(std::vector<RedundancyGroup> groups, const std::vector<SensorKind>& kinds) {
+    const size_t channelCount = kinds.size();
+    m_channelCount = channelCount;
+    m_groups.clear();
+    m_indexA.clear();
+    m_indexB.clear();
+    m_indexC.clear();
+    m_hasC.clear();
+    m_selectLow.clear();
+    m_tolerance.clear();
+    m_isMember.assign(channelCount, 0);
+    m_statistics = Statistics{0, 0, 0, 0};
+
+    for (auto& group : groups) {
+        group.channels.erase(std::remove_if(group.channels.begin(), group.channels.end(),
+                                            [channelCount](size_t channel) { return channel >= channelCount; }),
+                             group.channels.end());
+        if (group.channels.size() < 2 || group.channels.size() > 3) {
+            continue;
+        }
+        // A repeated channel would vote one sensor as two independent inputs
+        std::vector<size_t> sorted = group.channels;
+        std::sort(sorted.begin(), sorted.end());
+        if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) {
+            continue;
+        }
+        if (std::any_of(group.channels.begin(), group.channels.end(),
+                        [&](size_t channel) { return kinds[channel] != group.kind; })) {
+            continue;
+        }
+
+        m_indexA.push_back(group.channels[0]);
+        m_indexB.push_back(group.channels[1]);
+        // Two-channel groups reuse A for C and mask it out permanently
+        m_indexC.push_back(group.channels.size() == 3 ? group.channels[2] : group.channels[0]);
+        m_hasC.push_back(group.channels.size() == 3 ? 1 : 0);
+        m_selectLow.push_back(group.degradedSelect == DegradedSelect::Low ? 1 : 0);
+        m_tolerance.push_back(group.discrepancyTolerance);
+
+        for (size_t channel : group.channels) {
+            m_isMember[channel] = 1;
+        }
+        m_groups.push_back(std::move(group));
+    }
+
+    size_t count = m_groups.size();
+    m_a.assign(count, 0.0);
+    m_b.assign(count, 0.0);
+    m_c.assign(count, 0.0);
+    m_maskA.assign(count, 0.0);
+    m_maskB.assign(count, 0.0);
+    m_maskC.assign(count, 0.0);
+    m_voted.assign(count, std::numeric_limits<double>::quiet_NaN());
+    m_votedQuality.assign(count, QUALITY_COMM_FAIL);
+    m_discrepancy.assign(count, 0);
+
+    return count;
+}
+
+size_t RedundancyVoter::Vote(const SensorSnapshot& snapshot) {
+    const SensorQuality* quality = snapshot.quality.data();
+    const size_t count = m_groups.size();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+
+    // Gather: the only indexed loads in the pass
+    for (size_t g = 0; g < count; ++g) {
+        m_a[g] = snapshot.EngineeringValue(m_indexA[g]);
+        m_b[g] = snapshot.EngineeringValue(m_indexB[g]);
+        m_c[g] = snapshot.EngineeringValue(m_indexC[g]);
+        m_maskA[g] = IsQualityUsable(quality[m_indexA[g]]) ? 1.0 : 0.0;
+        m_maskB[g] = IsQualityUsable(quality[m_indexB[g]]) ? 1.0 : 0.0;
+        m_maskC[g] = (m_hasC[g] && IsQualityUsable(quality[m_indexC[g]])) ? 1.0 : 0.0;
+    }
+
+    // Vote: straight-line selects over contiguous arrays
+    size_t discrepancies = 0;
+    size_t degraded = 0;
+    size_t failed = 0;
+    for (size_t g = 0; g < count; ++g) {
+        double ma = m_maskA[g];
+        double mb = m_maskB[g];
+        double mc = m_maskC[g];
+        double usable = ma + mb + mc;
+
+        double a = ma > 0.0 ? m_a[g] : 0.0;
+        double b = mb > 0.0 ? m_b[g] : 0.0;
+        double c = mc > 0.0 ? m_c[g] : 0.0;
+        double fill = usable > 0.0 ? (a + b + c) / usable : nan;
+
+        // 1oo2 select over survivors; unusable slots can never win
+        double highest = std::max(ma > 0.0 ? a : -inf, std::max(mb > 0.0 ? b : -inf, mc > 0.0 ? c : -inf));
+        double lowest = std::min(ma > 0.0 ? a : inf, std::min(mb > 0.0 ? b : inf, mc > 0.0 ? c : inf));
+        double survivor = m_selectLow[g] ? lowest : highest;
+
+        a = ma > 0.0 ? a : fill;
+        b = mb > 0.0 ? b : fill;
+        c = mc > 0.0 ? c : fill;
+
+        double low = std::min(a, b);
+        double high = std::max(a, b);
+        double median = std::max(low, std::min(high, c));
+        double spread = std::max(high, c) - std::min(low, c);
+
+        uint8_t expected = static_cast<uint8_t>(2 + m_hasC[g]);
+        uint8_t discrepancy = spread > m_tolerance[g] ? 1 : 0;
+
+        m_voted[g] = usable == 0.0 ? nan : usable < expected ? survivor : median;
+        m_discrepancy[g] = discrepancy;
+        m_votedQuality[g] = usable == 0.0 ? QUALITY_COMM_FAIL
+                          : usable < expected ? QUALITY_SUBSTITUTED
+                          : QUALITY_GOOD;
+
+        discrepancies += discrepancy;
+        degraded += (usable > 0.0 && usable < expected) ? 1 : 0;
+        failed += usable == 0.0 ? 1 : 0;
+    }
+
+    m_statistics.groupsVoted += count;
+    m_statistics.degradedGroups += degraded;
+    m_statistics.failedGroups += failed;
+    m_statistics.discrepancies += discrepancies;
+    return discrepancies;
+}
+
+const std::vector<RedundancyGroup>& RedundancyVoter::GetGroups() const {
+    return m_groups;
+}
+
+const std::vector<double>& RedundancyVoter::GetVotedValues() const {
+    return m_voted;
+}
+
+const std::vector<SensorQuality>& RedundancyVoter::GetVotedQuality() const {
+    return m_votedQuality;
+}
+
+const std::vector<uint8_t>& RedundancyVoter::GetDiscrepancies() const {
+    return m_discrepancy;
+}
+
+bool RedundancyVoter::IsVotedChannel(size_t channel) const {
+    return channel < m_isMember.size() && m_isMember[channel] != 0;
+}
+
+RedundancyVoter::Statistics RedundancyVoter::GetStatistics() const {
+    return m_statistics;
+}
+
+} // namespace Nuclear
\ No newline at end of file
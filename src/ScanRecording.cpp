@@ -0,0 +1,310 @@
+#include "ScanRecording.h"
+#include "ByteBuffer.h"
+#include <algorithm>
+
+namespace Nuclear {
+
+namespace {
+
+constexpr uint32_t FILE_MAGIC = 0x5253504E;   // "NPSR"
+constexpr uint32_t CHUNK_MAGIC = 0x4B4E4843;  // "CHNK"
+constexpr uint16_t FILE_VERSION = 1;
+constexpr size_t CHUNK_HEADER_SIZE = 16;
+constexpr size_t MAX_CHUNK_SCANS = 1 << 20;  // Guards allocation against corrupt headers
+constexpr size_t MAX_CHANNELS = 1 << 20;
+constexpr size_t MAX_CHUNK_BYTES = 256 * 1024 * 1024;
+
+int64_t ToMicros(std::chrono::system_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count();
+}
+
+std::chrono::system_clock::time_point FromMicros(int64_t micros) {
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::microseconds(micros)));
+}
+
+double LoadDouble(const uint8_t* data) {
+    uint64_t bits = LoadLittleEndian(data, 8);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+} // namespace
+
+// ScanChunk
+
+size_t ScanChunk::PayloadSize(size_t scans, size_t channels) {
+    return scans * 16 + channels * scans * 9;
+}
+
+void ScanChunk::DecodeTimes(uint64_t* scanNumbers, int64_t* timestampsUs) const {
+    const uint8_t* numbers = payload.data();
+    const uint8_t* times = numbers + scanCount * 8;
+    for (size_t i = 0; i < scanCount; ++i) {
+        scanNumbers[i] = LoadLittleEndian(numbers + i * 8, 8);
+        timestampsUs[i] = static_cast<int64_t>(LoadLittleEndian(times + i * 8, 8));
+    }
+}
+
+void ScanChunk::DecodeChannel(size_t channel, double* values, SensorQuality* quality) const {
+    const uint8_t* column = payload.data() + scanCount * 16 + channel * scanCount * 9;
+    const uint8_t* flags = column + scanCount * 8;
+    for (size_t i = 0; i < scanCount; ++i) {
+        values[i] = LoadDouble(column + i * 8);
+    }
+    std::copy(flags, flags + scanCount, quality);
+}
+
+// ScanRecordingWriter
+
+ScanRecordingWriter::ScanRecordingWriter() : m_chunkScans(DEFAULT_CHUNK_SCANS), m_pendingScans(0), m_scansWritten(0) {}
+
+ScanRecordingWriter::~ScanRecordingWriter() {
+    Close();
+}
+
+bool ScanRecordingWriter::Open(const std::string& path, const std::vector<int>& sensorIds,
+                               const std::vector<SensorKind>& kinds, size_t chunkScans) {
+    Close();
+    // Never write a chunk the reader would refuse
+    if (sensorIds.size() != kinds.size() || chunkScans == 0 || chunkScans > MAX_CHUNK_SCANS ||
+        sensorIds.size() > MAX_CHANNELS || ScanChunk::PayloadSize(chunkScans, sensorIds.size()) > MAX_CHUNK_BYTES) {
+        return false;
+    }
+
+    m_file.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_file) {
+        return false;
+    }
+
+    m_sensorIds = sensorIds;
+    m_kinds = kinds;
+    m_chunkScans = chunkScans;
+    m_pendingScans = 0;
+    m_scansWritten = 0;
+
+    m_scanNumbers.resize(chunkScans);
+    m_timestamps.resize(chunkScans);
+    m_values.resize(chunkScans * sensorIds.size());
+    m_quality.resize(chunkScans * sensorIds.size());
+
+    std::vector<uint8_t> header;
+    PutU32(header, FILE_MAGIC);
+    PutU16(header, FILE_VERSION);
+    PutU16(header, 0);
+    PutU32(header, static_cast<uint32_t>(sensorIds.size()));
+    PutU32(header, static_cast<uint32_t>(chunkScans));
+    for (int sensorId : sensorIds) {
+        PutU32(header, static_cast<uint32_t>(sensorId));
+    }
+    for (SensorKind kind : kinds) {
+        header.push_back(static_cast<uint8_t>(kind));
+    }
+
+    m_file.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+    return static_cast<bool>(m_file);
+}
+
+bool ScanRecordingWriter::Append(const SensorSnapshot& snapshot) {
+    if (!m_file.is_open() || snapshot.sensorIds != m_sensorIds || snapshot.kinds != m_kinds ||
+        snapshot.quality.size() != snapshot.Size()) {
+        return false;
+    }
+
+    size_t row = m_pendingScans;
+    m_scanNumbers[row] = snapshot.scanNumber;
+    m_timestamps[row] = ToMicros(snapshot.acquiredAt);
+    for (size_t channel = 0; channel < m_sensorIds.size(); ++channel) {
+        m_values[channel * m_chunkScans + row] = snapshot.EngineeringValue(channel);
+        m_quality[channel * m_chunkScans + row] = snapshot.quality[channel];
+    }
+
+    ++m_pendingScans;
+    ++m_scansWritten;
+    return m_pendingScans < m_chunkScans || WriteChunk();
+}
+
+bool ScanRecordingWriter::Flush() {
+    if (!m_file.is_open()) {
+        return false;
+    }
+    if (m_pendingScans > 0 && !WriteChunk()) {
+        return false;
+    }
+    m_file.flush();
+    return static_cast<bool>(m_file);
+}
+
+void ScanRecordingWriter::Close() {
+    if (m_file.is_open()) {
+        Flush();
+        m_file.close();
+    }
+}
+
+uint64_t ScanRecordingWriter::GetScanCount() const {
+    return m_scansWritten;
+}
+
+// Private methods implementation
+
+bool ScanRecordingWriter::WriteChunk() {
+    size_t scans = m_pendingScans;
+    size_t channels = m_sensorIds.size();
+    size_t payloadSize = ScanChunk::PayloadSize(scans, channels);
+
+    std::vector<uint8_t> out;
+    out.reserve(CHUNK_HEADER_SIZE + payloadSize);
+    PutU32(out, CHUNK_MAGIC);
+    PutU32(out, static_cast<uint32_t>(scans));
+    PutU64(out, payloadSize);
+
+    for (size_t i = 0; i < scans; ++i) {
+        PutU64(out, m_scanNumbers[i]);
+    }
+    for (size_t i = 0; i < scans; ++i) {
+        PutU64(out, static_cast<uint64_t>(m_timestamps[i]));
+    }
+    for (size_t channel = 0; channel < channels; ++channel) {
+        const double* values = m_values.data() + channel * m_chunkScans;
+        const SensorQuality* quality = m_quality.data() + channel * m_chunkScans;
+        for (size_t i = 0; i < scans; ++i) {
+            PutDouble(out, values[i]);
+        }
+        out.insert(out.end(), quality, quality + scans);
+    }
+
+    m_pendingScans = 0;
+    m_file.write(reinterpret_cast<const char*>(out.data()), static_cast<std::streamsize>(out.size()));
+    return static_cast<bool>(m_file);
+}
+
+// ScanRecordingReader
+
+ScanRecordingReader::ScanRecordingReader() : m_nextScan(0) {}
+
+bool ScanRecordingReader::Open(const std::string& path) {
+    m_file.close();
+    m_file.clear();
+    m_file.open(path, std::ios::binary);
+    if (!m_file) {
+        return false;
+    }
+
+    std::vector<uint8_t> fixed(16);
+    if (!m_file.read(reinterpret_cast<char*>(fixed.data()), static_cast<std::streamsize>(fixed.size()))) {
+        return false;
+    }
+
+    ByteReader header(fixed);
+    if (header.Get(4) != FILE_MAGIC || header.Get(2) != FILE_VERSION) {
+        return false;
+    }
+    header.Get(2);
+    size_t channels = static_cast<size_t>(header.Get(4));
+    header.Get(4);  // Writer chunk size; chunks carry their own scan count
+    if (channels > MAX_CHANNELS) {
+        return false;
+    }
+
+    std::vector<uint8_t> layout(channels * 5);
+    if (!m_file.read(reinterpret_cast<char*>(layout.data()), static_cast<std::streamsize>(layout.size()))) {
+        return false;
+    }
+
+    ByteReader reader(layout);
+    m_sensorIds.resize(channels);
+    m_kinds.resize(channels);
+    for (size_t c = 0; c < channels; ++c) {
+        m_sensorIds[c] = static_cast<int32_t>(static_cast<uint32_t>(reader.Get(4)));
+    }
+    for (size_t c = 0; c < channels; ++c) {
+        uint8_t kind = static_cast<uint8_t>(reader.Get(1));
+        if (!IsKnownSensorKind(kind)) {
+            return false;
+        }
+        m_kinds[c] = static_cast<SensorKind>(kind);
+    }
+
+    m_dataStart = m_file.tellg();
+    m_chunk.scanCount = 0;
+    m_nextScan = 0;
+    return reader.Ok();
+}
+
+const std::vector<int>& ScanRecordingReader::GetSensorIds() const {
+    return m_sensorIds;
+}
+
+const std::vector<SensorKind>& ScanRecordingReader::GetKinds() const {
+    return m_kinds;
+}
+
+bool ScanRecordingReader::ReadChunk(ScanChunk& chunk) {
+    uint8_t headerBytes[CHUNK_HEADER_SIZE];
+    if (!m_file.read(reinterpret_cast<char*>(headerBytes), CHUNK_HEADER_SIZE)) {
+        return false;
+    }
+
+    ByteReader header(headerBytes, CHUNK_HEADER_SIZE);
+    uint32_t magic = static_cast<uint32_t>(header.Get(4));
+    size_t scans = static_cast<size_t>(header.Get(4));
+    uint64_t payloadSize = header.Get(8);
+    if (magic != CHUNK_MAGIC || scans == 0 || scans > MAX_CHUNK_SCANS ||
+        ScanChunk::PayloadSize(scans, m_sensorIds.size()) > MAX_CHUNK_BYTES ||
+        payloadSize != ScanChunk::PayloadSize(scans, m_sensorIds.size())) {
+        return false;
+    }
+
+    chunk.scanCount = scans;
+    chunk.channelCount = m_sensorIds.size();
+    chunk.payload.resize(static_cast<size_t>(payloadSize));
+    return static_cast<bool>(m_file.read(reinterpret_cast<char*>(chunk.payload.data()),
+                                         static_cast<std::streamsize>(payloadSize)));
+}
+
+bool ScanRecordingReader::ReadNext(SensorSnapshot& snapshot) {
+    if (m_nextScan >= m_chunk.scanCount) {
+        if (!ReadChunk(m_chunk)) {
+            m_chunk.scanCount = 0;
+            return false;
+        }
+
+        size_t scans = m_chunk.scanCount;
+        m_scanNumbers.resize(scans);
+        m_timestamps.resize(scans);
+        m_values.resize(scans * m_sensorIds.size());
+        m_quality.resize(scans * m_sensorIds.size());
+
+        m_chunk.DecodeTimes(m_scanNumbers.data(), m_timestamps.data());
+        for (size_t channel = 0; channel < m_sensorIds.size(); ++channel) {
+            m_chunk.DecodeChannel(channel, m_values.data() + channel * scans, m_quality.data() + channel * scans);
+        }
+        m_nextScan = 0;
+    }
+
+    size_t scans = m_chunk.scanCount;
+    size_t row = m_nextScan++;
+
+    snapshot.scanNumber = m_scanNumbers[row];
+    snapshot.acquiredAt = FromMicros(m_timestamps[row]);
+    snapshot.sensorIds = m_sensorIds;
+    snapshot.kinds = m_kinds;
+    snapshot.values.resize(m_sensorIds.size());
+    snapshot.quality.resize(m_sensorIds.size());
+    for (size_t channel = 0; channel < m_sensorIds.size(); ++channel) {
+        snapshot.values[channel] = m_values[channel * scans + row];
+        snapshot.quality[channel] = m_quality[channel * scans + row];
+    }
+    return true;
+}
+
+void ScanRecordingReader::Rewind() {
+    m_file.clear();
+    m_file.seekg(m_dataStart);
+    m_chunk.scanCount = 0;
+    m_nextScan = 0;
+}
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,209 @@
+#include "ScanTracer.h"
+#include <algorithm>
+#include <fstream>
+#include <ostream>
+#include <cstdio>
+
+namespace Nuclear {
+
+namespace {
+
+constexpr int TRACE_PROCESS_ID = 1;
+
+void WriteMicros(std::ostream& out, int64_t nanoseconds) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.3f", static_cast<double>(nanoseconds) / 1000.0);
+    out << buffer;
+}
+
+void WriteJsonString(std::ostream& out, const char* text) {
+    out << '"';
+    for (const char* c = text ? text : ""; *c; ++c) {
+        if (*c == '"' || *c == '\\') {
+            out << '\\';
+        }
+        out << *c;
+    }
+    out << '"';
+}
+
+void WriteEvent(std::ostream& out, const char* name, const char* category, int64_t startNs, int64_t durationNs,
+                uint32_t threadId) {
+    out << "{\"name\":";
+    WriteJsonString(out, name);
+    out << ",\"cat\":";
+    WriteJsonString(out, category);
+    out << ",\"ph\":\"X\",\"ts\":";
+    WriteMicros(out, startNs);
+    out << ",\"dur\":";
+    WriteMicros(out, durationNs);
+    out << ",\"pid\":" << TRACE_PROCESS_ID << ",\"tid\":" << threadId;
+}
+
+} // namespace
+
+thread_local uint32_t ScopedSpan::t_depth = 0;
+
+ScanTracer::ScanTracer(const Config& config)
+    : m_config(config), m_epoch(std::chrono::steady_clock::now()), m_cycleOpen(false), m_spanCount(0),
+      m_scratch(config.maxSpansPerCycle), m_cycleNumber(0), m_cycleThreadId(0), m_cycleStartNs(0),
+      m_ring(config.ringCycles), m_ringNext(0), m_ringSize(0), m_statistics{0, 0, 0, 0.0, 0.0} {
+    // Captures copy into preallocated slots, so an overrunning cycle does not also allocate
+    for (CycleTrace& slot : m_ring) {
+        slot.spans.reserve(config.maxSpansPerCycle);
+    }
+}
+
+bool ScanTracer::SetConfig(const Config& config) {
+    if (m_cycleOpen.load()) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_ringMutex);
+    if (config.ringCycles != m_config.ringCycles || config.maxSpansPerCycle != m_config.maxSpansPerCycle) {
+        m_scratch.assign(config.maxSpansPerCycle, TraceSpan{});
+        m_ring.assign(config.ringCycles, CycleTrace{});
+        for (CycleTrace& slot : m_ring) {
+            slot.spans.reserve(config.maxSpansPerCycle);
+        }
+        m_ringNext = 0;
+        m_ringSize = 0;
+    }
+    m_config = config;
+    return true;
+}
+
+const ScanTracer::Config& ScanTracer::GetConfig() const {
+    return m_config;
+}
+
+void ScanTracer::BeginCycle(uint64_t cycleNumber) {
+    if (m_config.mode == Mode::Off) {
+        return;
+    }
+
+    m_cycleNumber = cycleNumber;
+    m_cycleThreadId = CurrentThreadId();
+    m_cycleStartNs = ToNs(std::chrono::steady_clock::now());
+    m_spanCount.store(0, std::memory_order_relaxed);
+    m_cycleOpen.store(true, std::memory_order_release);
+}
+
+bool ScanTracer::EndCycle() {
+    if (!m_cycleOpen.exchange(false, std::memory_order_acq_rel)) {
+        return false;
+    }
+
+    int64_t durationNs = ToNs(std::chrono::steady_clock::now()) - m_cycleStartNs;
+    size_t recorded = m_spanCount.load(std::memory_order_acquire);
+    size_t kept = std::min(recorded, m_scratch.size());
+    bool capture = !m_ring.empty() &&
+                   (m_config.mode == Mode::Always ||
+                    durationNs >= std::chrono::duration_cast<std::chrono::nanoseconds>(m_config.overrunThreshold).count());
+
+    std::lock_guard<std::mutex> lock(m_ringMutex);
+    double durationMicros = static_cast<double>(durationNs) / 1000.0;
+    m_statistics.cyclesTraced++;
+    m_statistics.spansDropped += recorded - kept;
+    m_statistics.maxCycleMicros = std::max(m_statistics.maxCycleMicros, durationMicros);
+    if (!capture) {
+        return false;
+    }
+
+    CycleTrace& slot = m_ring[m_ringNext];
+    slot.cycleNumber = m_cycleNumber;
+    slot.threadId = m_cycleThreadId;
+    slot.startNs = m_cycleStartNs;
+    slot.durationNs = durationNs;
+    slot.spansDropped = static_cast<uint32_t>(recorded - kept);
+    slot.spans.assign(m_scratch.begin(), m_scratch.begin() + static_cast<std::ptrdiff_t>(kept));
+
+    m_ringNext = (m_ringNext + 1) % m_ring.size();
+    m_ringSize = std::min(m_ringSize + 1, m_ring.size());
+    m_statistics.cyclesCaptured++;
+    m_statistics.lastCaptureMicros = durationMicros;
+    return true;
+}
+
+void ScanTracer::RecordSpan(const char* name, const char* category, std::chrono::steady_clock::time_point start,
+                            std::chrono::steady_clock::time_point end, uint32_t depth) {
+    if (!IsRecording()) {
+        return;
+    }
+
+    // Overflowing spans only advance the count; EndCycle reports them as dropped
+    size_t index = m_spanCount.fetch_add(1, std::memory_order_acq_rel);
+    if (index >= m_scratch.size()) {
+        return;
+    }
+
+    int64_t startNs = ToNs(start);
+    m_scratch[index] = TraceSpan{name, category, startNs, ToNs(end) - startNs, CurrentThreadId(), depth};
+}
+
+std::vector<CycleTrace> ScanTracer::GetCapturedCycles() const {
+    std::lock_guard<std::mutex> lock(m_ringMutex);
+    std::vector<CycleTrace> cycles;
+    cycles.reserve(m_ringSize);
+    size_t oldest = (m_ringNext + m_ring.size() - m_ringSize) % std::max<size_t>(m_ring.size(), 1);
+    for (size_t i = 0; i < m_ringSize; ++i) {
+        cycles.push_back(m_ring[(oldest + i) % m_ring.size()]);
+    }
+    return cycles;
+}
+
+void ScanTracer::ClearCaptured() {
+    std::lock_guard<std::mutex> lock(m_ringMutex);
+    m_ringNext = 0;
+    m_ringSize = 0;
+}
+
+size_t ScanTracer::WriteChromeTrace(std::ostream& out) const {
+    std::vector<CycleTrace> cycles = GetCapturedCycles();
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const CycleTrace& cycle : cycles) {
+        out << (first ? "\n" : ",\n");
+        first = false;
+        WriteEvent(out, "cycle", "cycle", cycle.startNs, cycle.durationNs, cycle.threadId);
+        out << ",\"args\":{\"cycle\":" << cycle.cycleNumber << ",\"spans\":" << cycle.spans.size()
+            << ",\"dropped\":" << cycle.spansDropped << "}}";
+
+        for (const TraceSpan& span : cycle.spans) {
+            out << ",\n";
+            WriteEvent(out, span.name, span.category, span.startNs, span.durationNs, span.threadId);
+            out << ",\"args\":{\"cycle\":" << cycle.cycleNumber << ",\"depth\":" << span.depth << "}}";
+        }
+    }
+    out << "\n]}\n";
+    return cycles.size();
+}
+
+bool ScanTracer::DumpChromeTrace(const std::string& path) const {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+    WriteChromeTrace(file);
+    return static_cast<bool>(file);
+}
+
+ScanTracer::Statistics ScanTracer::GetStatistics() const {
+    std::lock_guard<std::mutex> lock(m_ringMutex);
+    return m_statistics;
+}
+
+uint32_t ScanTracer::CurrentThreadId() {
+    static std::atomic<uint32_t> nextThreadId{1};
+    thread_local uint32_t threadId = nextThreadId.fetch_add(1, std::memory_order_relaxed);
+    return threadId;
+}
+
+// Private methods implementation
+
+int64_t ScanTracer::ToNs(std::chrono::steady_clock::time_point time) const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time - m_epoch).count();
+}
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "SensorHealth.h"
+#include <limits>
+#include <algorithm>
+#include <cmath>
+
+namespace Nuclear {
+
+SensorHealthTracker::SensorHealthTracker() : m_eventRecorder(nullptr) {
+    m_config.staleAfter = std::chrono::milliseconds(5000);
+    m_config.substituteLastGood = true;
+}
+
+void SensorHealthTracker::SetConfig(const Config& config) {
+    m_config = config;
+}
+
+void SensorHealthTracker::SetEventRecorder(SequenceOfEventsRecorder* recorder) {
+    m_eventRecorder = recorder;
+}
+
+void SensorHealthTracker::Reset(const std::vector<int>& sensorIds) {
+    size_t channelCount = sensorIds.size();
+    m_sensorIds = sensorIds;
+
+    m_channelIndex.clear();
+    m_channelIndex.reserve(channelCount);
+    for (size_t i = 0; i < channelCount; ++i) {
+        m_channelIndex[sensorIds[i]] = i;
+    }
+
+    m_minValue.assign(channelCount, -std::numeric_limits<double>::infinity());
+    m_maxValue.assign(channelCount, std::numeric_limits<double>::infinity());
+    m_lastGoodValue.assign(channelCount, std::numeric_limits<double>::quiet_NaN());
+    m_lastGoodTime.assign(channelCount, Clock::time_point());
+    m_hasGoodValue.assign(channelCount, 0);
+    m_online.assign(channelCount, 0);
+    m_lastQuality.assign(channelCount, QUALITY_COMM_FAIL);
+    m_classified.assign(channelCount, 0);
+}
+
+void SensorHealthTracker::SetRange(size_t channel, double minValue, double maxValue) {
+    if (channel >= m_minValue.size()) {
+        return;
+    }
+    m_minValue[channel] = minValue;
+    m_maxValue[channel] = maxValue;
+}
+
+SensorQuality SensorHealthTracker::Classify(size_t channel, bool readOk, double& value, Clock::time_point now) {
+    if (channel >= m_online.size()) {
+        return QUALITY_COMM_FAIL;
+    }
+
+    m_online[channel] = readOk ? 1 : 0;
+    SensorQuality quality = Evaluate(channel, readOk, value, now);
+
+    if (m_eventRecorder && m_classified[channel] && quality != m_lastQuality[channel]) {
+        m_eventRecorder->Record(m_sensorIds[channel], m_lastQuality[channel], quality, EventCause::QualityChange);
+    }
+
+    m_lastQuality[channel] = quality;
+    m_classified[channel] = 1;
+    return quality;
+}
+
+SensorQuality SensorHealthTracker::Evaluate(size_t channel, bool readOk, double& value, Clock::time_point now) {
+    if (readOk) {
+        // NaN fails both comparisons and is treated as out of range
+        if (!(value >= m_minValue[channel] && value <= m_maxValue[channel])) {
+            return QUALITY_OUT_OF_RANGE;
+        }
+
+        m_lastGoodValue[channel] = value;
+        m_lastGoodTime[channel] = now;
+        m_hasGoodValue[channel] = 1;
+        return QUALITY_GOOD;
+    }
+
+    SensorQuality quality = QUALITY_COMM_FAIL;
+    if (!m_hasGoodValue[channel]) {
+        value = std::numeric_limits<double>::quiet_NaN();
+        return quality;
+    }
+
+    if (m_config.substituteLastGood) {
+        value = m_lastGoodValue[channel];
+        quality |= QUALITY_SUBSTITUTED;
+    }
+
+    if (now - m_lastGoodTime[channel] > m_config.staleAfter) {
+        quality |= QUALITY_STALE;
+    }
+
+    return quality;
+}
+
+void SensorHealthTracker::ClassifySnapshot(SensorSnapshot& snapshot, const std::vector<uint8_t>& readOk,
+                                           Clock::time_point now) {
+    size_t channelCount = std::min(snapshot.Size(), readOk.size());
+    snapshot.quality.resize(snapshot.Size(), QUALITY_COMM_FAIL);
+
+    for (size_t i = 0; i < channelCount; ++i) {
+        if (!snapshot.IsFixedPoint(i)) {
+            snapshot.quality[i] = Classify(i, readOk[i] != 0, snapshot.values[i], now);
+            continue;
+        }
+
+        // Fixed-point channels are classified in engineering units; a substituted hold value goes back to counts
+        double acquired = snapshot.EngineeringValue(i);
+        double value = acquired;
+        snapshot.quality[i] = Classify(i, readOk[i] != 0, value, now);
+        if (value != acquired && std::isfinite(value)) {
+            snapshot.counts[i] = snapshot.Scale(i).ToCounts(value);
+        }
+    }
+}
+
+SensorQuality SensorHealthTracker::GetLastQuality(size_t channel) const {
+    return channel < m_lastQuality.size() ? m_lastQuality[channel] : QUALITY_COMM_FAIL;
+}
+
+bool SensorHealthTracker::IsOnline(size_t channel) const {
+    return channel < m_online.size() && m_online[channel] != 0;
+}
+
+bool SensorHealthTracker::IsSensorOnline(int sensorId) const {
+    size_t channel = 0;
+    return FindChannel(sensorId, channel) && IsOnline(channel);
+}
+
+bool SensorHealthTracker::FindChannel(int sensorId, size_t& channel) const {
+    auto it = m_channelIndex.find(sensorId);
+    if (it == m_channelIndex.end()) {
+        return false;
+    }
+    channel = it->second;
+    return true;
+}
+
+size_t SensorHealthTracker::GetChannelCount() const {
+    return m_sensorIds.size();
+}
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include "SensorKernels.h"
+#include <algorithm>
+
+namespace Nuclear {
+
+namespace {
+
+// Default safety thresholds, matching DataProcessor's defaults
+constexpr double DEFAULT_MAX_TEMPERATURE = 350.0;
+constexpr double DEFAULT_MAX_PRESSURE = 2200.0;
+constexpr double DEFAULT_MAX_RADIATION = 1.0;
+
+} // namespace
+
+SensorKernelPlan::SensorKernelPlan()
+    : m_thresholds{{{ThresholdPolicy::HighLimit, {0.0, DEFAULT_MAX_TEMPERATURE}},
+                    {ThresholdPolicy::HighLimit, {0.0, DEFAULT_MAX_PRESSURE}},
+                    {ThresholdPolicy::HighLimit, {0.0, DEFAULT_MAX_RADIATION}}}} {
+}
+
+void SensorKernelPlan::SetThreshold(SensorKind kind, const KindThreshold& threshold) {
+    if (!IsKnownSensorKind(static_cast<uint8_t>(kind))) {
+        return;
+    }
+    m_thresholds[static_cast<size_t>(kind)] = threshold;
+    for (Group& group : m_groups) {
+        if (group.kind == kind) {
+            group.kernel = GetSensorKernel(kind, threshold.policy);
+            group.fixedKernel = group.scale.IsFixed() ? GetFixedPointKernel(kind, threshold.policy) : nullptr;
+        }
+    }
+}
+
+const SensorKernelPlan::KindThreshold& SensorKernelPlan::GetThreshold(SensorKind kind) const {
+    return m_thresholds[static_cast<size_t>(kind)];
+}
+
+void SensorKernelPlan::Build(const std::vector<SensorKind>& kinds,
+                             const std::shared_ptr<const ChannelScaling>& scales) {
+    m_kinds = kinds;
+    m_scales = scales;
+    m_groups.clear();
+    for (size_t i = 0; i < kinds.size(); ++i) {
+        bool fixed = scales && i < scales->size() && (*scales)[i].IsFixed();
+        FixedPointScale scale = fixed ? (*scales)[i] : FixedPointScale();
+        if (!m_groups.empty() && m_groups.back().kind == kinds[i] && m_groups.back().scale == scale) {
+            m_groups.back().count++;
+            continue;
+        }
+        if (!IsKnownSensorKind(static_cast<uint8_t>(kinds[i]))) {
+            m_groups.push_back(Group{i, 1, kinds[i], scale, nullptr, nullptr});
+            continue;
+        }
+        ThresholdPolicy policy = GetThreshold(kinds[i]).policy;
+        m_groups.push_back(Group{i, 1, kinds[i], scale, GetSensorKernel(kinds[i], policy),
+                                 scale.IsFixed() ? GetFixedPointKernel(kinds[i], policy) : nullptr});
+    }
+}
+
+bool SensorKernelPlan::Matches(const std::vector<SensorKind>& kinds,
+                               const std::shared_ptr<const ChannelScaling>& scales) const {
+    if (kinds != m_kinds) {
+        return false;
+    }
+    return scales == m_scales || (scales && m_scales && *scales == *m_scales);
+}
+
+SensorKernelPlan::ScanResult SensorKernelPlan::Run(const SensorSnapshot& snapshot, std::vector<uint8_t>& flags) {
+    ScanResult result{{{KernelResult::Empty(), KernelResult::Empty(), KernelResult::Empty()}}, 0};
+    flags.resize(snapshot.Size());
+    if (snapshot.kinds.size() != snapshot.Size() || snapshot.quality.size() != snapshot.Size() ||
+        (snapshot.HasFixedPoint() && snapshot.counts.size() != snapshot.Size())) {
+        return result;
+    }
+
+    if (!Matches(snapshot.kinds, snapshot.scales)) {
+        Build(snapshot.kinds, snapshot.scales);
+    }
+    for (const Group& group : m_groups) {
+        if (!group.kernel) {
+            std::fill(flags.begin() + static_cast<std::ptrdiff_t>(group.offset),
+                      flags.begin() + static_cast<std::ptrdiff_t>(group.offset + group.count), CHANNEL_UNUSABLE);
+            continue;
+        }
+        const ThresholdLimits& limits = GetThreshold(group.kind).limits;
+        KernelResult groupResult =
+            group.fixedKernel
+                ? group.fixedKernel(snapshot.counts.data() + group.offset, snapshot.quality.data() + group.offset,
+                                    group.count, group.scale, limits, flags.data() + group.offset)
+                : group.kernel(snapshot.values.data() + group.offset, snapshot.quality.data() + group.offset,
+                               group.count, limits, flags.data() + group.offset);
+        result.byKind[static_cast<size_t>(group.kind)].Merge(groupResult);
+        result.alarms += groupResult.alarms;
+    }
+    return result;
+}
+
+const std::vector<SensorKernelPlan::Group>& SensorKernelPlan::GetGroups() const {
+    return m_groups;
+}
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include "SensorSnapshot.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Nuclear {
+
+namespace {
+
+// One past the int32 range either way, so clamped limits still compare correctly with any count
+constexpr double MIN_COUNT_LIMIT = static_cast<double>(std::numeric_limits<int32_t>::min()) - 1.0;
+constexpr double MAX_COUNT_LIMIT = static_cast<double>(std::numeric_limits<int32_t>::max()) + 1.0;
+
+double ClampCounts(double counts) {
+    return std::isnan(counts) ? 0.0 : std::fmin(std::fmax(counts, MIN_COUNT_LIMIT), MAX_COUNT_LIMIT);
+}
+
+} // namespace
+
+const char* SensorKindName(SensorKind kind) {
+    switch (kind) {
+        case SensorKind::Temperature:
+            return "temperature";
+        case SensorKind::Pressure:
+            return "pressure";
+        case SensorKind::Radiation:
+            return "radiation";
+    }
+    return "unknown";
+}
+
+bool ParseSensorKind(const std::string& name, SensorKind& kind) {
+    if (name == "temperature") {
+        kind = SensorKind::Temperature;
+    } else if (name == "pressure") {
+        kind = SensorKind::Pressure;
+    } else if (name == "radiation") {
+        kind = SensorKind::Radiation;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+int64_t FixedPointScale::CountsFloor(double value) const {
+    double counts = ClampCounts(std::floor((value - offset) / scale));
+    // Division can round across an integer; step back until the count really maps at or below value
+    while (counts > MIN_COUNT_LIMIT && ToEngineering(static_cast<int64_t>(counts)) > value) {
+        counts -= 1.0;
+    }
+    return static_cast<int64_t>(counts);
+}
+
+int64_t FixedPointScale::CountsCeil(double value) const {
+    double counts = ClampCounts(std::ceil((value - offset) / scale));
+    while (counts < MAX_COUNT_LIMIT && ToEngineering(static_cast<int64_t>(counts)) < value) {
+        counts += 1.0;
+    }
+    return static_cast<int64_t>(counts);
+}
+
+int32_t FixedPointScale::ToCounts(double value) const {
+    double counts = std::round((value - offset) / scale);
+    if (std::isnan(counts)) {
+        return 0;
+    }
+    counts = std::fmin(std::fmax(counts, static_cast<double>(std::numeric_limits<int32_t>::min())),
+                       static_cast<double>(std::numeric_limits<int32_t>::max()));
+    return static_cast<int32_t>(counts);
+}
+
+void SensorSnapshot::Resize(size_t channelCount) {
+    sensorIds.resize(channelCount);
+    kinds.resize(channelCount);
+    quality.assign(channelCount, QUALITY_COMM_FAIL);
+    if (HasFixedPoint()) {
+        counts.resize(channelCount);
+    }
+    ResizeValues();
+}
+
+void SensorSnapshot::AppendChannel(int sensorId, SensorKind kind, double value, SensorQuality flags) {
+    values.resize(Size(), std::numeric_limits<double>::quiet_NaN());
+    sensorIds.push_back(sensorId);
+    kinds.push_back(kind);
+    values.push_back(value);
+    quality.push_back(flags);
+    if (HasFixedPoint()) {
+        counts.push_back(0);   // Past the end of the scaling, so floating point
+    }
+}
+
+void SensorSnapshot::SetScaling(std::shared_ptr<const ChannelScaling> scaling) {
+    if (scaling && scaling == scales && counts.size() == Size()) {
+        return;  // Same layout as the last scan; columns are already sized for it
+    }
+    scales = std::move(scaling);
+    if (scales) {
+        counts.resize(Size());
+    } else {
+        counts.clear();
+    }
+    ResizeValues();
+}
+
+bool SensorSnapshot::SetFixedPoint(size_t channel, const FixedPointScale& scale) {
+    if (channel >= Size() || scale.scale < 0.0) {
+        return false;
+    }
+
+    auto copy = std::make_shared<ChannelScaling>(scales ? *scales : ChannelScaling());
+    copy->resize(std::max(copy->size(), Size()));
+    (*copy)[channel] = scale;
+    SetScaling(std::move(copy));
+    return true;
+}
+
+bool SensorSnapshot::SameScaling(const SensorSnapshot& other) const {
+    if (scales == other.scales) {
+        return true;
+    }
+    if (HasFixedPoint() != other.HasFixedPoint()) {
+        return false;
+    }
+    for (size_t i = 0; i < Size(); ++i) {
+        bool fixed = IsFixedPoint(i);
+        if (fixed != other.IsFixedPoint(i) || (fixed && Scale(i) != other.Scale(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SensorSnapshot::AllFixedPoint(size_t channelCount) const {
+    return scales && scales->size() >= channelCount &&
+           std::all_of(scales->begin(), scales->begin() + static_cast<std::ptrdiff_t>(channelCount),
+                       [](const FixedPointScale& scale) { return scale.IsFixed(); });
+}
+
+void SensorSnapshot::ResizeValues() {
+    if (Size() > 0 && AllFixedPoint(Size())) {
+        std::vector<double>().swap(values);
+    } else {
+        // Fixed-point entries of a mixed layout stay unpopulated
+        values.resize(Size(), std::numeric_limits<double>::quiet_NaN());
+    }
+}
+
+std::vector<SensorReading> SensorSnapshot::ToReadings(const std::string& timestamp) const {
+    std::vector<SensorReading> readings;
+    readings.reserve(Size());
+
+    for (size_t i = 0; i < Size(); ++i) {
+        SensorReading reading;
+        reading.sensorId = sensorIds[i];
+        reading.value = EngineeringValue(i);
+        reading.timestamp = timestamp;
+        reading.sensorType = SensorKindName(kinds[i]);
+        reading.quality = quality[i];
+        readings.push_back(std::move(reading));
+    }
+
+    return readings;
+}
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,345 @@
+#include "SequenceOfEventsRecorder.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+namespace Nuclear {
+
+namespace {
+
+size_t RoundUpToPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+uint32_t CauseBit(EventCause cause) {
+    return 1u << static_cast<uint32_t>(cause);
+}
+
+} // namespace
+
+const char* EventCauseName(EventCause cause) {
+    switch (cause) {
+        case EventCause::QualityChange: return "QUALITY_CHANGE";
+        case EventCause::LimitCrossed: return "LIMIT_CROSSED";
+        case EventCause::AlarmRaised: return "ALARM_RAISED";
+        case EventCause::AlarmCleared: return "ALARM_CLEARED";
+        case EventCause::Trip: return "TRIP";
+        case EventCause::Operator: return "OPERATOR";
+        case EventCause::Custom: return "CUSTOM";
+    }
+    return "UNKNOWN";
+}
+
+SequenceOfEventsRecorder::SequenceOfEventsRecorder(const Config& config)
+    : m_config(config), m_writeIndex(0), m_state(ARMED), m_triggerIndex(0), m_triggerTimeUs(0),
+      m_triggerChannel(-1), m_triggerCause(0), m_triggerCauseMask(CauseBit(EventCause::Trip)),
+      m_recorded(0), m_dropped(0), m_captures(0), m_freezeDue(false), m_running(false) {
+    size_t window = m_config.preTriggerEvents + m_config.postTriggerEvents;
+    m_config.capacity = RoundUpToPowerOfTwo(std::max(m_config.capacity, std::max<size_t>(2 * window, 2)));
+    m_mask = m_config.capacity - 1;
+
+    m_slots.reset(new Slot[m_config.capacity]);
+    for (size_t i = 0; i < m_config.capacity; ++i) {
+        m_slots[i].stamp.store(0, std::memory_order_relaxed);
+    }
+}
+
+SequenceOfEventsRecorder::~SequenceOfEventsRecorder() {
+    Stop();
+}
+
+SequenceOfEventsRecorder::Config SequenceOfEventsRecorder::DefaultConfig() {
+    Config config;
+    config.capacity = 16384;
+    config.preTriggerEvents = 4096;
+    config.postTriggerEvents = 4096;
+    config.postTriggerWindow = std::chrono::milliseconds(10000);
+    return config;
+}
+
+bool SequenceOfEventsRecorder::Start(DumpHandler handler) {
+    if (m_running.exchange(true)) {
+        return false;
+    }
+
+    m_dumpHandler = std::move(handler);
+    m_dumpThread = std::thread(&SequenceOfEventsRecorder::DumpLoop, this);
+    return true;
+}
+
+void SequenceOfEventsRecorder::Stop() {
+    if (!m_running.exchange(false)) {
+        return;
+    }
+
+    m_dumpCondition.notify_all();
+    if (m_dumpThread.joinable()) {
+        m_dumpThread.join();
+    }
+
+    // Deliver a capture that was still collecting post-trigger events
+    int triggered = TRIGGERED;
+    if (m_state.compare_exchange_strong(triggered, FROZEN) || triggered == FROZEN) {
+        SequenceCapture capture = ExtractCapture();
+        if (m_dumpHandler) {
+            try {
+                m_dumpHandler(capture);
+            } catch (const std::exception&) {
+                // Handler failures must not escape shutdown
+            }
+        }
+    }
+}
+
+bool SequenceOfEventsRecorder::Record(int channel, double oldValue, double newValue, EventCause cause,
+                                      int64_t timestampUs) {
+    if (m_state.load(std::memory_order_acquire) == FROZEN) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    uint64_t index = m_writeIndex.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = m_slots[index & m_mask];
+
+    // Seqlock write: odd stamp, payload, even stamp
+    slot.stamp.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.timestampUs.store(timestampUs, std::memory_order_relaxed);
+    slot.channel.store(channel, std::memory_order_relaxed);
+    slot.oldValue.store(oldValue, std::memory_order_relaxed);
+    slot.newValue.store(newValue, std::memory_order_relaxed);
+    slot.cause.store(static_cast<uint8_t>(cause), std::memory_order_relaxed);
+    slot.stamp.store(2 * index + 2, std::memory_order_release);
+    m_recorded.fetch_add(1, std::memory_order_release);
+
+    if (m_triggerCauseMask.load(std::memory_order_relaxed) & CauseBit(cause)) {
+        BeginCapture(index, timestampUs, channel, cause);
+    }
+
+    if (m_state.load(std::memory_order_relaxed) == TRIGGERED &&
+        index + 1 >= m_triggerIndex.load(std::memory_order_relaxed) + m_config.postTriggerEvents &&
+        !m_freezeDue.load(std::memory_order_relaxed)) {
+        m_freezeDue.store(true, std::memory_order_relaxed);
+    }
+
+    return true;
+}
+
+bool SequenceOfEventsRecorder::Trigger(const std::string& reason) {
+    std::lock_guard<std::mutex> lock(m_triggerMutex);
+    if (!BeginCapture(m_writeIndex.load(std::memory_order_relaxed), NowMicros(), -1, EventCause::Trip)) {
+        return false;
+    }
+    m_triggerReason = reason;
+    m_dumpCondition.notify_one();
+    return true;
+}
+
+void SequenceOfEventsRecorder::SetTriggerCauses(const std::vector<EventCause>& causes) {
+    uint32_t mask = 0;
+    for (EventCause cause : causes) {
+        mask |= CauseBit(cause);
+    }
+    m_triggerCauseMask.store(mask, std::memory_order_relaxed);
+}
+
+bool SequenceOfEventsRecorder::IsCapturing() const {
+    return m_state.load(std::memory_order_acquire) != ARMED;
+}
+
+std::vector<SequenceEvent> SequenceOfEventsRecorder::GetRecentEvents(size_t maxEvents) const {
+    uint64_t last = m_writeIndex.load(std::memory_order_acquire);
+    uint64_t count = std::min<uint64_t>({maxEvents, m_config.capacity, last});
+
+    std::vector<SequenceEvent> events;
+    events.reserve(static_cast<size_t>(count));
+    CopyEvents(last - count, last, events);
+    return events;
+}
+
+SequenceOfEventsRecorder::Statistics SequenceOfEventsRecorder::GetStatistics() const {
+    Statistics stats;
+    stats.recorded = m_recorded.load(std::memory_order_relaxed);
+    stats.dropped = m_dropped.load(std::memory_order_relaxed);
+    stats.captures = m_captures.load(std::memory_order_relaxed);
+    return stats;
+}
+
+bool SequenceOfEventsRecorder::WriteCapture(const SequenceCapture& capture, const std::string& path) {
+    try {
+        std::ofstream file(path);
+        if (!file) {
+            return false;
+        }
+
+        file << "# reason: " << capture.reason << "\n";
+        file << "# trigger_time_us: " << capture.triggerTimeUs << "\n";
+        file << "sequence,timestamp_us,channel,old_value,new_value,cause,phase\n";
+        file << std::setprecision(10);
+
+        for (size_t i = 0; i < capture.events.size(); ++i) {
+            const SequenceEvent& event = capture.events[i];
+            file << event.sequence << ',' << event.timestampUs << ',' << event.channel << ','
+                 << event.oldValue << ',' << event.newValue << ',' << EventCauseName(event.cause) << ','
+                 << (i < capture.triggerPosition ? "PRE" : "POST") << '\n';
+        }
+
+        return static_cast<bool>(file);
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+int64_t SequenceOfEventsRecorder::NowMicros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// Private methods implementation
+
+bool SequenceOfEventsRecorder::BeginCapture(uint64_t index, int64_t timestampUs, int channel, EventCause cause) {
+    int armed = ARMED;
+    if (!m_state.compare_exchange_strong(armed, ARMING, std::memory_order_acq_rel)) {
+        return false;
+    }
+
+    m_triggerIndex.store(index, std::memory_order_relaxed);
+    m_triggerTimeUs.store(timestampUs, std::memory_order_relaxed);
+    m_triggerChannel.store(channel, std::memory_order_relaxed);
+    m_triggerCause.store(static_cast<uint8_t>(cause), std::memory_order_relaxed);
+    m_state.store(TRIGGERED, std::memory_order_release);
+    return true;
+}
+
+bool SequenceOfEventsRecorder::CheckFreeze() {
+    int state = m_state.load(std::memory_order_acquire);
+    if (state == FROZEN) {
+        return true;
+    }
+    if (state != TRIGGERED) {
+        return false;
+    }
+
+    uint64_t written = m_writeIndex.load(std::memory_order_relaxed) - m_triggerIndex.load(std::memory_order_relaxed);
+    int64_t elapsedUs = NowMicros() - m_triggerTimeUs.load(std::memory_order_relaxed);
+    int64_t windowUs = std::chrono::duration_cast<std::chrono::microseconds>(m_config.postTriggerWindow).count();
+
+    if (written < m_config.postTriggerEvents && elapsedUs < windowUs) {
+        return false;
+    }
+
+    m_state.store(FROZEN, std::memory_order_release);
+    return true;
+}
+
+void SequenceOfEventsRecorder::CopyEvents(uint64_t first, uint64_t last, std::vector<SequenceEvent>& events) const {
+    for (uint64_t index = first; index < last; ++index) {
+        const Slot& slot = m_slots[index & m_mask];
+        uint64_t expected = 2 * index + 2;
+
+        // Seqlock read: a slot rewritten or still being written is skipped
+        if (slot.stamp.load(std::memory_order_acquire) != expected) {
+            continue;
+        }
+
+        SequenceEvent event;
+        event.sequence = index;
+        event.timestampUs = slot.timestampUs.load(std::memory_order_relaxed);
+        event.channel = slot.channel.load(std::memory_order_relaxed);
+        event.oldValue = slot.oldValue.load(std::memory_order_relaxed);
+        event.newValue = slot.newValue.load(std::memory_order_relaxed);
+        event.cause = static_cast<EventCause>(slot.cause.load(std::memory_order_relaxed));
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.stamp.load(std::memory_order_relaxed) == expected) {
+            events.push_back(event);
+        }
+    }
+}
+
+SequenceCapture SequenceOfEventsRecorder::ExtractCapture() {
+    // Writers that passed the frozen check before the freeze finish within a few stores
+    for (int spin = 0; spin < 1000; ++spin) {
+        if (m_recorded.load(std::memory_order_acquire) == m_writeIndex.load(std::memory_order_acquire)) {
+            break;
+        }
+        std::this_thread::yield();
+    }
+
+    uint64_t end = m_writeIndex.load(std::memory_order_acquire);
+    uint64_t triggerIndex = m_triggerIndex.load(std::memory_order_relaxed);
+    uint64_t last = std::min<uint64_t>(end, triggerIndex + m_config.postTriggerEvents);
+    uint64_t first = triggerIndex > m_config.preTriggerEvents ? triggerIndex - m_config.preTriggerEvents : 0;
+    if (end > m_config.capacity) {
+        first = std::max<uint64_t>(first, end - m_config.capacity);
+    }
+
+    SequenceCapture capture;
+    capture.triggerTimeUs = m_triggerTimeUs.load(std::memory_order_relaxed);
+    capture.events.reserve(static_cast<size_t>(last > first ? last - first : 0));
+    CopyEvents(first, last, capture.events);
+
+    // Producers on different threads may stamp slightly out of ring order
+    std::stable_sort(capture.events.begin(), capture.events.end(),
+                     [](const SequenceEvent& a, const SequenceEvent& b) { return a.timestampUs < b.timestampUs; });
+
+    // The sort may move the trigger event; locate it, or its time if its slot was lost
+    auto trigger = std::find_if(capture.events.begin(), capture.events.end(),
+                                [triggerIndex](const SequenceEvent& event) { return event.sequence == triggerIndex; });
+    if (trigger == capture.events.end()) {
+        trigger = std::lower_bound(capture.events.begin(), capture.events.end(), capture.triggerTimeUs,
+                                   [](const SequenceEvent& event, int64_t timeUs) { return event.timestampUs < timeUs; });
+    }
+    capture.triggerPosition = static_cast<size_t>(trigger - capture.events.begin());
+
+    {
+        std::lock_guard<std::mutex> lock(m_triggerMutex);
+        if (m_triggerReason.empty()) {
+            EventCause cause = static_cast<EventCause>(m_triggerCause.load(std::memory_order_relaxed));
+            capture.reason = std::string(EventCauseName(cause)) + " on channel " +
+                             std::to_string(m_triggerChannel.load(std::memory_order_relaxed));
+        } else {
+            capture.reason = m_triggerReason;
+        }
+        m_triggerReason.clear();
+        m_freezeDue.store(false, std::memory_order_relaxed);
+        m_state.store(ARMED, std::memory_order_release);
+    }
+
+    m_captures.fetch_add(1, std::memory_order_relaxed);
+    return capture;
+}
+
+void SequenceOfEventsRecorder::DumpLoop() {
+    while (m_running.load()) {
+        if (!m_freezeDue.load(std::memory_order_relaxed)) {
+            std::unique_lock<std::mutex> lock(m_triggerMutex);
+            m_dumpCondition.wait_for(lock, DUMP_POLL_INTERVAL);
+        }
+
+        if (!m_running.load()) {
+            continue;
+        }
+        if (!CheckFreeze()) {
+            // A flag raised just as the previous capture re-armed is stale
+            m_freezeDue.store(false, std::memory_order_relaxed);
+            continue;
+        }
+
+        // Copy out and re-arm first so recording resumes before the slow dump
+        SequenceCapture capture = ExtractCapture();
+        if (m_dumpHandler) {
+            try {
+                m_dumpHandler(capture);
+            } catch (const std::exception&) {
+                // A failed dump must not stop future captures
+            }
+        }
+    }
+}
+
+} // namespace Nuclear
\ No newline at end of file
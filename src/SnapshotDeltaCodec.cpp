@@ -0,0 +1,437 @@
+#include "SnapshotDeltaCodec.h"
+#include "ByteBuffer.h"
+#include <cmath>
+#include <cstring>
+#include <memory>
+
+namespace Nuclear {
+
+namespace {
+
+constexpr uint32_t FRAME_MAGIC = 0x4644504E;   // "NPDF"
+constexpr uint8_t FRAME_KEYFRAME = 1;
+constexpr uint8_t FRAME_DELTA = 2;
+constexpr uint8_t FRAME_SCALED_KEYFRAME = 3;
+constexpr uint8_t FRAME_SCALED_DELTA = 4;
+constexpr size_t HEADER_SIZE = 33;
+constexpr size_t KEYFRAME_ENTRY_SIZE = 14;
+constexpr size_t DELTA_ENTRY_SIZE = 13;
+
+// Scaled frames: entry sizes by channel format
+constexpr uint8_t FORMAT_FLOAT = 0;
+constexpr uint8_t FORMAT_FIXED = 1;
+constexpr size_t SCALED_KEYFRAME_FLOAT_SIZE = 15;
+constexpr size_t SCALED_KEYFRAME_FIXED_SIZE = 27;
+constexpr size_t SCALED_DELTA_FLOAT_SIZE = 13;
+constexpr size_t SCALED_DELTA_FIXED_SIZE = 9;
+constexpr size_t MAX_CHANNELS = 1 << 20;       // Guards allocation against corrupt headers
+
+int64_t ToMicros(std::chrono::system_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count();
+}
+
+std::chrono::system_clock::time_point FromMicros(int64_t micros) {
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::microseconds(micros)));
+}
+
+void PutHeader(std::vector<uint8_t>& out, uint8_t type, const SensorSnapshot& snapshot, uint64_t baseScan) {
+    PutU32(out, FRAME_MAGIC);
+    out.push_back(type);
+    PutU64(out, snapshot.scanNumber);
+    PutU64(out, baseScan);
+    PutU64(out, static_cast<uint64_t>(ToMicros(snapshot.acquiredAt)));
+    PutU32(out, static_cast<uint32_t>(snapshot.Size()));
+}
+
+size_t KeyframeBytes(const SensorSnapshot& snapshot) {
+    if (!snapshot.HasFixedPoint()) {
+        return snapshot.Size() * KEYFRAME_ENTRY_SIZE;
+    }
+
+    size_t bytes = 0;
+    for (size_t channel = 0; channel < snapshot.Size(); ++channel) {
+        bytes += snapshot.IsFixedPoint(channel) ? SCALED_KEYFRAME_FIXED_SIZE : SCALED_KEYFRAME_FLOAT_SIZE;
+    }
+    return bytes;
+}
+
+int32_t GetI32(ByteReader& reader) {
+    return static_cast<int32_t>(static_cast<uint32_t>(reader.Get(4)));
+}
+
+bool DecodeScaledKeyframe(ByteReader& reader, size_t channelCount, SensorSnapshot& snapshot) {
+    snapshot.Resize(channelCount);
+    auto scaling = std::make_shared<ChannelScaling>(channelCount);
+    snapshot.counts.assign(channelCount, 0);
+
+    for (size_t channel = 0; channel < channelCount; ++channel) {
+        snapshot.sensorIds[channel] = GetI32(reader);
+        uint8_t kind = static_cast<uint8_t>(reader.Get(1));
+        snapshot.kinds[channel] = static_cast<SensorKind>(kind);
+        snapshot.quality[channel] = static_cast<SensorQuality>(reader.Get(1));
+        uint8_t format = static_cast<uint8_t>(reader.Get(1));
+        if (!IsKnownSensorKind(kind)) {
+            return false;
+        }
+        if (format == FORMAT_FLOAT) {
+            snapshot.values[channel] = reader.GetDouble();
+            continue;
+        }
+
+        FixedPointScale scale;
+        scale.scale = reader.GetDouble();
+        scale.offset = reader.GetDouble();
+        if (format != FORMAT_FIXED || !scale.IsFixed()) {
+            return false;
+        }
+        (*scaling)[channel] = scale;
+        snapshot.counts[channel] = GetI32(reader);
+    }
+    snapshot.SetScaling(std::move(scaling));
+    return reader.Ok() && reader.Remaining() == 0;
+}
+
+// With apply false the entries are only checked, so a bad frame can be rejected before any channel changes
+bool DecodeScaledDelta(ByteReader reader, size_t changedCount, SensorSnapshot& snapshot, bool apply) {
+    for (size_t i = 0; i < changedCount; ++i) {
+        size_t channel = static_cast<size_t>(reader.Get(4));
+        SensorQuality quality = static_cast<SensorQuality>(reader.Get(1));
+        if (!reader.Ok() || channel >= snapshot.Size()) {
+            return false;
+        }
+        if (snapshot.IsFixedPoint(channel)) {
+            int32_t counts = GetI32(reader);
+            if (apply) {
+                snapshot.counts[channel] = counts;
+            }
+        } else {
+            double value = reader.GetDouble();
+            if (apply) {
+                snapshot.values[channel] = value;
+            }
+        }
+        if (apply) {
+            snapshot.quality[channel] = quality;
+        }
+    }
+    return reader.Ok() && reader.Remaining() == 0;
+}
+
+bool DecodeDelta(ByteReader reader, size_t changedCount, SensorSnapshot& snapshot, bool apply) {
+    for (size_t i = 0; i < changedCount; ++i) {
+        size_t channel = static_cast<size_t>(reader.Get(4));
+        double value = reader.GetDouble();
+        SensorQuality quality = static_cast<SensorQuality>(reader.Get(1));
+        if (!reader.Ok() || channel >= snapshot.Size()) {
+            return false;
+        }
+        if (apply) {
+            snapshot.values[channel] = value;
+            snapshot.quality[channel] = quality;
+        }
+    }
+    return reader.Ok();
+}
+
+} // namespace
+
+SnapshotDeltaEncoder::SnapshotDeltaEncoder(const Config& config)
+    : m_config(config), m_hasReference(false), m_framesSinceKeyframe(0), m_keyframeBytes(0),
+      m_statistics{0, 0, 0, 0} {}
+
+size_t SnapshotDeltaEncoder::Encode(const SensorSnapshot& snapshot, std::vector<uint8_t>& frame) {
+    size_t start = frame.size();
+    PutU32(frame, 0);  // Length, patched below
+
+    bool keyframe = !m_hasReference ||
+                    snapshot.sensorIds != m_reference.sensorIds || snapshot.kinds != m_reference.kinds ||
+                    !snapshot.SameScaling(m_reference) ||
+                    (m_config.keyframeInterval > 0 && m_framesSinceKeyframe >= m_config.keyframeInterval);
+
+    if (!keyframe) {
+        m_changed.clear();
+        size_t deltaBytes = 4;
+        for (size_t channel = 0; channel < snapshot.Size(); ++channel) {
+            if (ChannelChanged(snapshot, channel)) {
+                m_changed.push_back(static_cast<uint32_t>(channel));
+                deltaBytes += !snapshot.HasFixedPoint()        ? DELTA_ENTRY_SIZE
+                              : snapshot.IsFixedPoint(channel) ? SCALED_DELTA_FIXED_SIZE
+                                                               : SCALED_DELTA_FLOAT_SIZE;
+            }
+        }
+        keyframe = deltaBytes >= m_keyframeBytes;
+    }
+
+    if (keyframe) {
+        EncodeKeyframe(snapshot, frame);
+    } else {
+        EncodeDelta(snapshot, frame);
+    }
+
+    uint32_t payloadSize = static_cast<uint32_t>(frame.size() - start - 4);
+    for (int i = 0; i < 4; ++i) {
+        frame[start + i] = static_cast<uint8_t>(payloadSize >> (8 * i));
+    }
+
+    m_statistics.bytesEncoded += frame.size() - start;
+    return frame.size() - start;
+}
+
+void SnapshotDeltaEncoder::ForceKeyframe() {
+    m_hasReference = false;
+}
+
+SnapshotDeltaEncoder::Statistics SnapshotDeltaEncoder::GetStatistics() const {
+    return m_statistics;
+}
+
+// Private methods implementation
+
+void SnapshotDeltaEncoder::EncodeKeyframe(const SensorSnapshot& snapshot, std::vector<uint8_t>& frame) {
+    m_keyframeBytes = KeyframeBytes(snapshot);
+    frame.reserve(frame.size() + HEADER_SIZE + m_keyframeBytes);
+
+    if (!snapshot.HasFixedPoint()) {
+        PutHeader(frame, FRAME_KEYFRAME, snapshot, 0);
+        for (size_t channel = 0; channel < snapshot.Size(); ++channel) {
+            PutU32(frame, static_cast<uint32_t>(snapshot.sensorIds[channel]));
+            frame.push_back(static_cast<uint8_t>(snapshot.kinds[channel]));
+            PutDouble(frame, snapshot.values[channel]);
+            frame.push_back(snapshot.quality[channel]);
+        }
+        m_deadbandCounts.clear();
+    } else {
+        PutHeader(frame, FRAME_SCALED_KEYFRAME, snapshot, 0);
+        m_deadbandCounts.assign(snapshot.Size(), 0);
+        for (size_t channel = 0; channel < snapshot.Size(); ++channel) {
+            PutU32(frame, static_cast<uint32_t>(snapshot.sensorIds[channel]));
+            frame.push_back(static_cast<uint8_t>(snapshot.kinds[channel]));
+            frame.push_back(snapshot.quality[channel]);
+            if (!snapshot.IsFixedPoint(channel)) {
+                frame.push_back(FORMAT_FLOAT);
+                PutDouble(frame, snapshot.values[channel]);
+                continue;
+            }
+
+            const FixedPointScale& scale = snapshot.Scale(channel);
+            frame.push_back(FORMAT_FIXED);
+            PutDouble(frame, scale.scale);
+            PutDouble(frame, scale.offset);
+            PutU32(frame, static_cast<uint32_t>(snapshot.counts[channel]));
+            // Largest count step whose engineering change is still within the deadband
+            m_deadbandCounts[channel] = FixedPointScale{scale.scale, 0.0}.CountsFloor(m_config.deadband);
+        }
+    }
+
+    m_reference = snapshot;
+    m_hasReference = true;
+    m_framesSinceKeyframe = 0;
+    m_statistics.keyframes++;
+    m_statistics.channelsSent += snapshot.Size();
+}
+
+void SnapshotDeltaEncoder::EncodeDelta(const SensorSnapshot& snapshot, std::vector<uint8_t>& frame) {
+    frame.reserve(frame.size() + HEADER_SIZE + 4 + m_changed.size() * DELTA_ENTRY_SIZE);
+    bool scaled = snapshot.HasFixedPoint();
+    PutHeader(frame, scaled ? FRAME_SCALED_DELTA : FRAME_DELTA, snapshot, m_reference.scanNumber);
+    PutU32(frame, static_cast<uint32_t>(m_changed.size()));
+
+    for (uint32_t channel : m_changed) {
+        PutU32(frame, channel);
+        if (!scaled) {
+            PutDouble(frame, snapshot.values[channel]);
+            frame.push_back(snapshot.quality[channel]);
+        } else {
+            frame.push_back(snapshot.quality[channel]);
+            if (snapshot.IsFixedPoint(channel)) {
+                PutU32(frame, static_cast<uint32_t>(snapshot.counts[channel]));
+            } else {
+                PutDouble(frame, snapshot.values[channel]);
+            }
+        }
+
+        // Reference tracks the last value sent, so deadband error never accumulates
+        if (snapshot.IsFixedPoint(channel)) {
+            m_reference.counts[channel] = snapshot.counts[channel];
+        } else {
+            m_reference.values[channel] = snapshot.values[channel];
+        }
+        m_reference.quality[channel] = snapshot.quality[channel];
+    }
+
+    m_reference.scanNumber = snapshot.scanNumber;
+    m_reference.acquiredAt = snapshot.acquiredAt;
+    m_framesSinceKeyframe++;
+    m_statistics.deltas++;
+    m_statistics.channelsSent += m_changed.size();
+}
+
+bool SnapshotDeltaEncoder::ChannelChanged(const SensorSnapshot& snapshot, size_t channel) const {
+    if (snapshot.quality[channel] != m_reference.quality[channel]) {
+        return true;
+    }
+
+    if (snapshot.IsFixedPoint(channel)) {
+        int64_t change = static_cast<int64_t>(snapshot.counts[channel]) - m_reference.counts[channel];
+        return (change < 0 ? -change : change) > m_deadbandCounts[channel];
+    }
+
+    double value = snapshot.values[channel];
+    double reference = m_reference.values[channel];
+    if (std::memcmp(&value, &reference, sizeof(value)) == 0) {
+        return false;
+    }
+    if (std::isnan(value) || std::isnan(reference)) {
+        return true;
+    }
+    return std::fabs(value - reference) > m_config.deadband;
+}
+
+SnapshotDeltaDecoder::SnapshotDeltaDecoder() : m_hasSnapshot(false) {}
+
+SnapshotDeltaDecoder::Result SnapshotDeltaDecoder::Decode(const uint8_t* payload, size_t size) {
+    ByteReader reader(payload, size);
+    uint32_t magic = static_cast<uint32_t>(reader.Get(4));
+    uint8_t type = static_cast<uint8_t>(reader.Get(1));
+    uint64_t scanNumber = reader.Get(8);
+    uint64_t baseScan = reader.Get(8);
+    int64_t acquiredAt = static_cast<int64_t>(reader.Get(8));
+    size_t channelCount = static_cast<size_t>(reader.Get(4));
+
+    if (!reader.Ok() || magic != FRAME_MAGIC || channelCount > MAX_CHANNELS) {
+        return Result::Malformed;
+    }
+
+    if (type == FRAME_SCALED_KEYFRAME) {
+        if (reader.Remaining() < channelCount * SCALED_KEYFRAME_FLOAT_SIZE) {
+            return Result::Malformed;
+        }
+
+        SensorSnapshot decoded;
+        if (!DecodeScaledKeyframe(reader, channelCount, decoded)) {
+            return Result::Malformed;
+        }
+        m_snapshot = std::move(decoded);
+        m_snapshot.scanNumber = scanNumber;
+        m_snapshot.acquiredAt = FromMicros(acquiredAt);
+        m_hasSnapshot = true;
+        return Result::Keyframe;
+    }
+
+    if (type == FRAME_KEYFRAME) {
+        if (reader.Remaining() != channelCount * KEYFRAME_ENTRY_SIZE) {
+            return Result::Malformed;
+        }
+
+        // Check every kind before the held snapshot is overwritten
+        ByteReader kinds = reader;
+        for (size_t channel = 0; channel < channelCount; ++channel) {
+            kinds.Get(4);
+            bool known = IsKnownSensorKind(static_cast<uint8_t>(kinds.Get(1)));
+            kinds.Get(8);
+            kinds.Get(1);
+            if (!known) {
+                return Result::Malformed;
+            }
+        }
+
+        m_snapshot.SetScaling(nullptr);
+        m_snapshot.Resize(channelCount);
+        for (size_t channel = 0; channel < channelCount; ++channel) {
+            m_snapshot.sensorIds[channel] = static_cast<int32_t>(reader.Get(4));
+            m_snapshot.kinds[channel] = static_cast<SensorKind>(reader.Get(1));
+            m_snapshot.values[channel] = reader.GetDouble();
+            m_snapshot.quality[channel] = static_cast<SensorQuality>(reader.Get(1));
+        }
+        m_snapshot.scanNumber = scanNumber;
+        m_snapshot.acquiredAt = FromMicros(acquiredAt);
+        m_hasSnapshot = true;
+        return Result::Keyframe;
+    }
+
+    if (type != FRAME_DELTA && type != FRAME_SCALED_DELTA) {
+        return Result::Malformed;
+    }
+
+    bool scaled = type == FRAME_SCALED_DELTA;
+    size_t changedCount = static_cast<size_t>(reader.Get(4));
+    size_t minEntrySize = scaled ? SCALED_DELTA_FIXED_SIZE : DELTA_ENTRY_SIZE;
+    if (!reader.Ok() || changedCount > channelCount ||
+        (scaled ? reader.Remaining() < changedCount * minEntrySize
+                : reader.Remaining() != changedCount * minEntrySize)) {
+        return Result::Malformed;
+    }
+    if (!m_hasSnapshot || baseScan != m_snapshot.scanNumber || channelCount != m_snapshot.Size() ||
+        scaled != m_snapshot.HasFixedPoint()) {
+        return Result::NeedKeyframe;
+    }
+
+    // Validate the whole frame, then apply it; a rejected frame leaves the snapshot untouched
+    auto decode = scaled ? DecodeScaledDelta : DecodeDelta;
+    if (!decode(reader, changedCount, m_snapshot, false)) {
+        return Result::Malformed;
+    }
+    decode(reader, changedCount, m_snapshot, true);
+    m_snapshot.scanNumber = scanNumber;
+    m_snapshot.acquiredAt = FromMicros(acquiredAt);
+    return Result::Delta;
+}
+
+const SensorSnapshot& SnapshotDeltaDecoder::GetSnapshot() const {
+    return m_snapshot;
+}
+
+bool SnapshotDeltaDecoder::HasSnapshot() const {
+    return m_hasSnapshot;
+}
+
+void SnapshotDeltaDecoder::Reset() {
+    m_snapshot = SensorSnapshot();
+    m_hasSnapshot = false;
+}
+
+DeltaFrameAssembler::DeltaFrameAssembler() : m_readOffset(0), m_corrupt(false) {}
+
+void DeltaFrameAssembler::Append(const uint8_t* data, size_t size) {
+    if (m_readOffset > 0 && m_readOffset == m_buffer.size()) {
+        m_buffer.clear();
+        m_readOffset = 0;
+    } else if (m_readOffset > m_buffer.size() / 2) {
+        m_buffer.erase(m_buffer.begin(), m_buffer.begin() + static_cast<std::ptrdiff_t>(m_readOffset));
+        m_readOffset = 0;
+    }
+    m_buffer.insert(m_buffer.end(), data, data + size);
+}
+
+bool DeltaFrameAssembler::Next(std::vector<uint8_t>& payload) {
+    if (m_corrupt || m_buffer.size() - m_readOffset < 4) {
+        return false;
+    }
+
+    uint32_t length = static_cast<uint32_t>(LoadLittleEndian(m_buffer.data() + m_readOffset, 4));
+    if (length > MAX_FRAME_SIZE) {
+        m_corrupt = true;
+        return false;
+    }
+    if (m_buffer.size() - m_readOffset - 4 < length) {
+        return false;
+    }
+
+    const uint8_t* begin = m_buffer.data() + m_readOffset + 4;
+    payload.assign(begin, begin + length);
+    m_readOffset += 4 + length;
+    return true;
+}
+
+bool DeltaFrameAssembler::IsCorrupt() const {
+    return m_corrupt;
+}
+
+void DeltaFrameAssembler::Reset() {
+    m_buffer.clear();
+    m_readOffset = 0;
+    m_corrupt = false;
+}
+
+} // namespace Nuclear
\ No newline at end of file
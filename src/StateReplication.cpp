@@ -0,0 +1,876 @@
+#include "StateReplication.h"
+#include <algorithm>
+#include <cstring>
+
+#ifndef _WIN32
+#include <sys/un.h>
+#endif
+
+namespace Nuclear {
+
+namespace {
+
+constexpr uint8_t MESSAGE_SCAN = 1;
+constexpr uint8_t MESSAGE_HEARTBEAT = 2;
+constexpr uint8_t MESSAGE_FENCE = 3;
+constexpr uint8_t SCAN_FULL_SYNC = 0x01;
+constexpr size_t MAX_BLOCK_SIZE = 1 << 24;     // Guards allocation against corrupt messages
+
+#ifdef MSG_NOSIGNAL
+constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+constexpr int SEND_FLAGS = 0;
+#endif
+
+struct Endpoint {
+    bool local = false;
+    std::string host;
+    int port = 0;
+    std::string path;
+};
+
+bool ParseEndpoint(const std::string& text, Endpoint& endpoint) {
+    if (text.compare(0, 5, "unix:") == 0) {
+#ifdef _WIN32
+        return false;
+#else
+        endpoint.local = true;
+        endpoint.path = text.substr(5);
+        return !endpoint.path.empty() && endpoint.path.size() < sizeof(sockaddr_un::sun_path);
+#endif
+    }
+
+    size_t colon = text.rfind(':');
+    if (colon == std::string::npos) {
+        return false;
+    }
+    endpoint.host = text.substr(0, colon);
+    try {
+        endpoint.port = std::stoi(text.substr(colon + 1));
+    } catch (const std::exception&) {
+        return false;
+    }
+    return endpoint.port >= 0 && endpoint.port <= 65535;
+}
+
+SOCKET OpenSocket(const Endpoint& endpoint, bool listening, int& boundPort) {
+    boundPort = -1;
+#ifndef _WIN32
+    if (endpoint.local) {
+        SOCKET socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socket == INVALID_SOCKET) {
+            return INVALID_SOCKET;
+        }
+
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, endpoint.path.c_str(), sizeof(address.sun_path) - 1);
+        if (listening) {
+            ::unlink(endpoint.path.c_str());
+        }
+
+        int result = listening ? bind(socket, reinterpret_cast<sockaddr*>(&address), sizeof(address))
+                               : connect(socket, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        if (result == SOCKET_ERROR || (listening && listen(socket, 1) == SOCKET_ERROR)) {
+            closesocket(socket);
+            return INVALID_SOCKET;
+        }
+        return socket;
+    }
+#endif
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(static_cast<uint16_t>(endpoint.port));
+    if (inet_pton(AF_INET, endpoint.host.c_str(), &address.sin_addr) != 1) {
+        return INVALID_SOCKET;
+    }
+
+    SOCKET socket = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (socket == INVALID_SOCKET) {
+        return INVALID_SOCKET;
+    }
+
+    int enable = 1;
+    if (listening) {
+        setsockopt(socket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&enable), sizeof(enable));
+        if (bind(socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == SOCKET_ERROR ||
+            listen(socket, 1) == SOCKET_ERROR) {
+            closesocket(socket);
+            return INVALID_SOCKET;
+        }
+
+        socklen_t length = sizeof(address);
+        if (getsockname(socket, reinterpret_cast<sockaddr*>(&address), &length) == 0) {
+            boundPort = ntohs(address.sin_port);
+        }
+    } else if (connect(socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == SOCKET_ERROR) {
+        closesocket(socket);
+        return INVALID_SOCKET;
+    }
+
+    setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&enable), sizeof(enable));
+    return socket;
+}
+
+int PollReadable(SOCKET socket, int timeoutMs) {
+#ifdef _WIN32
+    WSAPOLLFD pollDescriptor{};
+    pollDescriptor.fd = socket;
+    pollDescriptor.events = POLLRDNORM;
+    return WSAPoll(&pollDescriptor, 1, timeoutMs);
+#else
+    pollfd pollDescriptor{};
+    pollDescriptor.fd = socket;
+    pollDescriptor.events = POLLIN;
+    return poll(&pollDescriptor, 1, timeoutMs);
+#endif
+}
+
+int64_t ToMicros(std::chrono::system_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count();
+}
+
+double MicrosSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+void PatchLength(std::vector<uint8_t>& frame, size_t start) {
+    uint32_t payloadSize = static_cast<uint32_t>(frame.size() - start - 4);
+    for (int i = 0; i < 4; ++i) {
+        frame[start + i] = static_cast<uint8_t>(payloadSize >> (8 * i));
+    }
+}
+
+bool SameBits(double a, double b) {
+    return std::memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+// Common header of every frame; the length prefix is patched by the caller
+void PutHeader(std::vector<uint8_t>& frame, uint8_t type, uint64_t epoch, uint64_t scanNumber,
+               std::chrono::system_clock::time_point sentAt) {
+    PutU32(frame, 0);
+    frame.push_back(type);
+    PutU64(frame, epoch);
+    PutU64(frame, scanNumber);
+    PutU64(frame, static_cast<uint64_t>(ToMicros(sentAt)));
+}
+
+bool SendAll(SOCKET socket, const std::vector<uint8_t>& frame) {
+    size_t offset = 0;
+    while (offset < frame.size()) {
+        int sent = send(socket, reinterpret_cast<const char*>(frame.data() + offset),
+                        static_cast<int>(frame.size() - offset), SEND_FLAGS);
+        if (sent <= 0) {
+            return false;
+        }
+        offset += static_cast<size_t>(sent);
+    }
+    return true;
+}
+
+/**
+ * Connect to a primary that was taken over, send it a fence frame and wait
+ * for it to hang up (or for the wait to pass). Whatever it streams in the
+ * meantime is drained, so closing never resets the connection under the
+ * unread fence.
+ */
+bool SendFence(const Endpoint& endpoint, uint64_t epoch, uint64_t scanNumber,
+               std::chrono::system_clock::time_point now, std::chrono::milliseconds wait,
+               const std::atomic<bool>& running) {
+    int unusedPort = 0;
+    SOCKET socket = OpenSocket(endpoint, false, unusedPort);
+    if (socket == INVALID_SOCKET) {
+        return false;
+    }
+
+    std::vector<uint8_t> frame;
+    PutHeader(frame, MESSAGE_FENCE, epoch, scanNumber, now);
+    PatchLength(frame, 0);
+    bool sent = SendAll(socket, frame);
+
+    char drain[4096];
+    auto deadline = std::chrono::steady_clock::now() + wait;
+    while (sent && running.load() && std::chrono::steady_clock::now() < deadline) {
+        int ready = PollReadable(socket, 10);
+        if (ready < 0 || (ready > 0 && recv(socket, drain, sizeof(drain), 0) <= 0)) {
+            break;
+        }
+    }
+
+    closesocket(socket);
+    return sent;
+}
+
+} // namespace
+
+StateReplicator::StateReplicator(const Config& config, std::shared_ptr<IClock> clock)
+    : m_config(config), m_clock(clock ? std::move(clock) : SystemClock::Instance()),
+      m_epoch(config.epoch != 0 ? config.epoch : static_cast<uint64_t>(ToMicros(m_clock->SystemNow()))),
+      m_listenSocket(INVALID_SOCKET), m_standbySocket(INVALID_SOCKET), m_boundPort(-1), m_running(false),
+      m_fenced(false), m_stagedPending(false), m_encoder(SnapshotDeltaEncoder::Config{0, config.valueDeadband}),
+      m_inputBuffer(INPUT_BUFFER_SIZE), m_statistics{0, 0, 0, 0, 0, 0, 0.0, 0.0, 0.0, 0.0, false},
+      m_publishMicrosTotal(0.0), m_encodeMicrosTotal(0.0) {}
+
+StateReplicator::~StateReplicator() {
+    Stop();
+}
+
+void StateReplicator::SetFencedHandler(FencedHandler handler) {
+    m_fencedHandler = std::move(handler);
+}
+
+bool StateReplicator::Start() {
+    if (m_running.load() || m_fenced.load()) {
+        return false;
+    }
+
+    Endpoint endpoint;
+    if (!ParseEndpoint(m_config.endpoint, endpoint)) {
+        return false;
+    }
+
+    m_listenSocket = OpenSocket(endpoint, true, m_boundPort);
+    if (m_listenSocket == INVALID_SOCKET) {
+        return false;
+    }
+
+    m_running = true;
+    m_senderThread = std::make_unique<std::thread>(&StateReplicator::SenderLoop, this);
+    return true;
+}
+
+void StateReplicator::Stop() {
+    if (!m_running.exchange(false)) {
+        return;
+    }
+
+    m_stagingCondition.notify_all();
+    if (m_senderThread && m_senderThread->joinable()) {
+        m_senderThread->join();
+    }
+    m_senderThread.reset();
+
+    DisconnectStandby();
+    closesocket(m_listenSocket);
+    m_listenSocket = INVALID_SOCKET;
+}
+
+int StateReplicator::GetPort() const {
+    return m_boundPort;
+}
+
+uint64_t StateReplicator::GetEpoch() const {
+    return m_epoch;
+}
+
+bool StateReplicator::IsFenced() const {
+    return m_fenced.load();
+}
+
+void StateReplicator::PublishScan(const ReplicatedState& state) {
+    auto start = std::chrono::steady_clock::now();
+    bool conflated = false;
+    {
+        std::lock_guard<std::mutex> lock(m_stagingMutex);
+        conflated = m_stagedPending;
+        m_staging.values = state.values;
+        m_staging.alarms = state.alarms;
+        m_staging.blocks = state.blocks;
+        m_stagedPending = true;
+    }
+    m_stagingCondition.notify_one();
+
+    double micros = MicrosSince(start);
+    std::lock_guard<std::mutex> lock(m_statisticsMutex);
+    m_statistics.scansPublished++;
+    m_statistics.scansConflated += conflated ? 1 : 0;
+    m_publishMicrosTotal += micros;
+    m_statistics.averagePublishMicros = m_publishMicrosTotal / static_cast<double>(m_statistics.scansPublished);
+    m_statistics.maxPublishMicros = std::max(m_statistics.maxPublishMicros, micros);
+}
+
+size_t StateReplicator::EncodeScan(const ReplicatedState& state, bool fullSync, std::vector<uint8_t>& frame) {
+    size_t start = frame.size();
+    PutHeader(frame, MESSAGE_SCAN, m_epoch, state.values.scanNumber, m_clock->SystemNow());
+    frame.push_back(fullSync ? SCAN_FULL_SYNC : 0);
+
+    // Values: the snapshot delta payload without its own length prefix
+    if (fullSync) {
+        m_encoder.ForceKeyframe();
+        m_sentAlarms.clear();
+        m_sentBlocks.clear();
+    }
+    m_snapshotFrame.clear();
+    m_encoder.Encode(state.values, m_snapshotFrame);
+    PutU32(frame, static_cast<uint32_t>(m_snapshotFrame.size() - 4));
+    frame.insert(frame.end(), m_snapshotFrame.begin() + 4, m_snapshotFrame.end());
+
+    // Alarms: entries that differ from what the standby holds; absent means inactive
+    size_t alarmCountOffset = frame.size();
+    PutU32(frame, 0);
+    uint32_t alarmCount = 0;
+    for (const auto& alarm : state.alarms) {
+        auto sent = m_sentAlarms.find(alarm.first);
+        bool previous = sent != m_sentAlarms.end() && sent->second;
+        if (fullSync || previous != alarm.second) {
+            PutU32(frame, static_cast<uint32_t>(alarm.first));
+            frame.push_back(alarm.second ? 1 : 0);
+            m_sentAlarms[alarm.first] = alarm.second;
+            ++alarmCount;
+        }
+    }
+    for (auto& sent : m_sentAlarms) {
+        if (sent.second && state.alarms.find(sent.first) == state.alarms.end()) {
+            PutU32(frame, static_cast<uint32_t>(sent.first));
+            frame.push_back(0);
+            sent.second = false;
+            ++alarmCount;
+        }
+    }
+    for (int i = 0; i < 4; ++i) {
+        frame[alarmCountOffset + i] = static_cast<uint8_t>(alarmCount >> (8 * i));
+    }
+
+    // Blocks: whole block on a full sync, when new or when resized, otherwise changed elements.
+    // An empty block must still go out whole once, since the standby only patches blocks it holds.
+    PutU16(frame, static_cast<uint16_t>(state.blocks.size()));
+    for (const ReplicatedState::Block& block : state.blocks) {
+        PutU16(frame, static_cast<uint16_t>(block.name.size()));
+        frame.insert(frame.end(), block.name.begin(), block.name.end());
+        PutU32(frame, static_cast<uint32_t>(block.data.size()));
+
+        auto held = m_sentBlocks.find(block.name);
+        bool known = held != m_sentBlocks.end();
+        std::vector<double>& sent = known ? held->second : m_sentBlocks[block.name];
+        if (fullSync || !known || sent.size() != block.data.size()) {
+            frame.push_back(1);
+            for (double value : block.data) {
+                PutDouble(frame, value);
+            }
+            sent = block.data;
+            continue;
+        }
+
+        frame.push_back(0);
+        size_t changedCountOffset = frame.size();
+        PutU32(frame, 0);
+        uint32_t changedCount = 0;
+        for (size_t i = 0; i < block.data.size(); ++i) {
+            if (!SameBits(block.data[i], sent[i])) {
+                PutU32(frame, static_cast<uint32_t>(i));
+                PutDouble(frame, block.data[i]);
+                sent[i] = block.data[i];
+                ++changedCount;
+            }
+        }
+        for (int i = 0; i < 4; ++i) {
+            frame[changedCountOffset + i] = static_cast<uint8_t>(changedCount >> (8 * i));
+        }
+    }
+
+    PatchLength(frame, start);
+    return frame.size() - start;
+}
+
+size_t StateReplicator::EncodeHeartbeat(uint64_t scanNumber, std::vector<uint8_t>& frame) const {
+    size_t start = frame.size();
+    PutHeader(frame, MESSAGE_HEARTBEAT, m_epoch, scanNumber, m_clock->SystemNow());
+    PatchLength(frame, start);
+    return frame.size() - start;
+}
+
+StateReplicator::Statistics StateReplicator::GetStatistics() const {
+    std::lock_guard<std::mutex> lock(m_statisticsMutex);
+    return m_statistics;
+}
+
+// Private methods implementation
+
+void StateReplicator::SenderLoop() {
+    bool needFullSync = true;
+    uint64_t lastScan = 0;
+    uint64_t scanBytesTotal = 0;
+    uint64_t fenceEpoch = 0;
+
+    while (m_running.load()) {
+        if (m_standbySocket == INVALID_SOCKET) {
+            if (!AcceptStandby(ACCEPT_POLL_MS)) {
+                // No standby: drop staged scans so a late standby starts from a full sync
+                std::lock_guard<std::mutex> lock(m_stagingMutex);
+                m_stagedPending = false;
+                continue;
+            }
+            needFullSync = true;
+        } else if (AcceptStandby(0)) {
+            needFullSync = true;
+        }
+
+        bool pending = false;
+        {
+            std::unique_lock<std::mutex> lock(m_stagingMutex);
+            m_stagingCondition.wait_for(lock, m_config.heartbeatInterval,
+                                        [this]() { return m_stagedPending || !m_running.load(); });
+            if (m_stagedPending) {
+                std::swap(m_staging, m_sending);
+                m_stagedPending = false;
+                pending = true;
+            }
+        }
+        if (!m_running.load()) {
+            break;
+        }
+
+        fenceEpoch = ReadStandbyInput();
+        if (fenceEpoch != 0) {
+            break;
+        }
+        if (m_standbySocket == INVALID_SOCKET) {
+            continue;
+        }
+
+        m_frame.clear();
+        if (pending) {
+            auto start = std::chrono::steady_clock::now();
+            EncodeScan(m_sending, needFullSync, m_frame);
+            double micros = MicrosSince(start);
+            lastScan = m_sending.values.scanNumber;
+
+            if (SendFrame()) {
+                std::lock_guard<std::mutex> lock(m_statisticsMutex);
+                m_statistics.scansSent++;
+                m_statistics.fullSyncs += needFullSync ? 1 : 0;
+                m_encodeMicrosTotal += micros;
+                m_statistics.averageEncodeMicros = m_encodeMicrosTotal / static_cast<double>(m_statistics.scansSent);
+                scanBytesTotal += m_frame.size();
+                m_statistics.averageBytesPerScan =
+                    static_cast<double>(scanBytesTotal) / static_cast<double>(m_statistics.scansSent);
+                needFullSync = false;
+            }
+        } else {
+            EncodeHeartbeat(lastScan, m_frame);
+            if (SendFrame()) {
+                std::lock_guard<std::mutex> lock(m_statisticsMutex);
+                m_statistics.heartbeatsSent++;
+            }
+        }
+    }
+
+    // Fenced: a standby has taken over with a higher epoch, so this primary stops streaming for good
+    if (fenceEpoch != 0) {
+        m_fenced = true;
+        DisconnectStandby();
+        if (m_fencedHandler) {
+            m_fencedHandler(fenceEpoch);
+        }
+    }
+}
+
+bool StateReplicator::AcceptStandby(int timeoutMs) {
+    if (PollReadable(m_listenSocket, timeoutMs) <= 0) {
+        return false;
+    }
+
+    SOCKET socket = accept(m_listenSocket, nullptr, nullptr);
+    if (socket == INVALID_SOCKET) {
+        return false;
+    }
+
+    DisconnectStandby();
+    m_standbySocket = socket;
+    std::lock_guard<std::mutex> lock(m_statisticsMutex);
+    m_statistics.standbyConnected = true;
+    return true;
+}
+
+uint64_t StateReplicator::ReadStandbyInput() {
+    while (m_standbySocket != INVALID_SOCKET && PollReadable(m_standbySocket, 0) > 0) {
+        int received = recv(m_standbySocket, reinterpret_cast<char*>(m_inputBuffer.data()),
+                            static_cast<int>(m_inputBuffer.size()), 0);
+        if (received <= 0) {
+            DisconnectStandby();
+            return 0;
+        }
+
+        m_standbyInput.Append(m_inputBuffer.data(), static_cast<size_t>(received));
+        while (m_standbyInput.Next(m_inputPayload)) {
+            ByteReader reader(m_inputPayload.data(), m_inputPayload.size());
+            uint8_t type = static_cast<uint8_t>(reader.Get(1));
+            uint64_t epoch = reader.Get(8);
+            if (reader.Ok() && type == MESSAGE_FENCE && epoch > m_epoch) {
+                return epoch;
+            }
+        }
+        if (m_standbyInput.IsCorrupt()) {
+            DisconnectStandby();
+        }
+    }
+    return 0;
+}
+
+void StateReplicator::DisconnectStandby() {
+    m_standbyInput.Reset();
+    if (m_standbySocket == INVALID_SOCKET) {
+        return;
+    }
+
+    closesocket(m_standbySocket);
+    m_standbySocket = INVALID_SOCKET;
+    std::lock_guard<std::mutex> lock(m_statisticsMutex);
+    m_statistics.standbyConnected = false;
+}
+
+bool StateReplicator::SendFrame() {
+    if (!SendAll(m_standbySocket, m_frame)) {
+        DisconnectStandby();
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_statisticsMutex);
+    m_statistics.bytesSent += m_frame.size();
+    return true;
+}
+
+StandbyReceiver::StandbyReceiver(const Config& config, std::shared_ptr<IClock> clock)
+    : m_config(config), m_clock(clock ? std::move(clock) : SystemClock::Instance()),
+      m_running(false), m_takenOver(false), m_handedOver(false), m_synchronized(false),
+      m_everSynchronized(false), m_epoch(0), m_progressScan(0),
+      m_statistics{0, 0, 0, 0, 0, 0, 0, 0, 0.0, 0.0, 0.0, false, false}, m_applyMicrosTotal(0.0) {}
+
+StandbyReceiver::~StandbyReceiver() {
+    Stop();
+}
+
+void StandbyReceiver::SetTakeoverHandler(TakeoverHandler handler) {
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+    m_takeoverHandler = std::move(handler);
+}
+
+bool StandbyReceiver::Start() {
+    if (m_running.load() || m_takenOver.load()) {
+        return false;
+    }
+
+    m_running = true;
+    m_receiveThread = std::make_unique<std::thread>(&StandbyReceiver::ReceiveLoop, this);
+    return true;
+}
+
+void StandbyReceiver::Stop() {
+    m_running = false;
+    if (m_receiveThread && m_receiveThread->joinable() && m_receiveThread->get_id() != std::this_thread::get_id()) {
+        m_receiveThread->join();
+        m_receiveThread.reset();
+    }
+}
+
+bool StandbyReceiver::Ingest(const uint8_t* payload, size_t size) {
+    auto start = std::chrono::steady_clock::now();
+    ByteReader reader(payload, size);
+    uint8_t type = static_cast<uint8_t>(reader.Get(1));
+    uint64_t epoch = reader.Get(8);
+    uint64_t scanNumber = reader.Get(8);
+    int64_t sentAt = static_cast<int64_t>(reader.Get(8));
+    if (!reader.Ok() || (type != MESSAGE_SCAN && type != MESSAGE_HEARTBEAT)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+    if (m_takenOver.load()) {
+        return true;  // No longer following
+    }
+    if (epoch < m_epoch) {
+        m_statistics.staleFrames++;
+        return false;  // A primary that has since been replaced; it proves nothing about the current one
+    }
+
+    auto now = m_clock->SteadyNow();
+    m_lastHeard = now;
+    m_statistics.bytesReceived += size + 4;
+    double lag = static_cast<double>(ToMicros(m_clock->SystemNow()) - sentAt);
+    m_statistics.lastLagMicros = lag;
+    m_statistics.maxLagMicros = std::max(m_statistics.maxLagMicros, lag);
+
+    if (type == MESSAGE_HEARTBEAT) {
+        m_statistics.heartbeats++;
+        if (epoch == m_epoch && scanNumber > m_progressScan) {
+            m_progressScan = scanNumber;
+            m_lastProgress = now;
+        }
+        return true;
+    }
+
+    bool fullSync = (reader.Get(1) & SCAN_FULL_SYNC) != 0;
+    if (!fullSync && (!m_synchronized || epoch != m_epoch)) {
+        m_statistics.resyncs++;
+        return false;  // Reconnect to get a full sync
+    }
+
+    // A full sync is built into fresh copies and swapped in; a delta is validated in full and then
+    // applied in place, so either way a message that fails leaves the held state as it was
+    bool applied = false;
+    if (fullSync) {
+        ReplicatedState state;
+        SnapshotDeltaDecoder decoder;
+        applied = ApplyScan(reader, state, decoder, true);
+        if (applied) {
+            m_state = std::move(state);
+            m_decoder = std::move(decoder);
+        }
+    } else {
+        applied = ApplyScan(reader, m_state, m_decoder, false) && ApplyScan(reader, m_state, m_decoder, true);
+    }
+    if (!applied) {
+        m_synchronized = false;
+        m_statistics.synchronized = false;
+        m_statistics.resyncs++;
+        return false;
+    }
+
+    // A full sync restarts progress tracking: a restarted primary counts scans from its own start
+    if (fullSync || scanNumber > m_progressScan) {
+        m_progressScan = scanNumber;
+        m_lastProgress = now;
+    }
+    m_epoch = epoch;
+    m_statistics.epoch = epoch;
+
+    m_synchronized = true;
+    m_everSynchronized = true;
+    m_statistics.synchronized = true;
+    m_statistics.scansApplied++;
+    m_statistics.lastScanNumber = scanNumber;
+    m_applyMicrosTotal += MicrosSince(start);
+    m_statistics.averageApplyMicros = m_applyMicrosTotal / static_cast<double>(m_statistics.scansApplied);
+    return true;
+}
+
+bool StandbyReceiver::CheckTakeover() {
+    TakeoverHandler handler;
+    ReplicatedState state;
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        if (m_takenOver.load() || !m_everSynchronized) {
+            return false;
+        }
+
+        // Heartbeats alone only show the link is up; the scan number must advance too
+        auto now = m_clock->SteadyNow();
+        bool silent = now - m_lastHeard >= m_config.takeoverTimeout;
+        bool stalled = now - m_lastProgress >= m_config.takeoverTimeout;
+        if (!silent && !stalled) {
+            return false;
+        }
+
+        m_takenOver = true;
+        m_statistics.takenOver = true;
+        handler = m_takeoverHandler;
+        state = m_state;
+        state.values = m_decoder.GetSnapshot();
+    }
+
+    if (handler) {
+        handler(state);
+    }
+    m_handedOver = true;
+    return true;
+}
+
+ReplicatedState StandbyReceiver::GetState() const {
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+    ReplicatedState state = m_state;
+    state.values = m_decoder.GetSnapshot();
+    return state;
+}
+
+bool StandbyReceiver::IsSynchronized() const {
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+    return m_synchronized;
+}
+
+bool StandbyReceiver::HasTakenOver() const {
+    return m_handedOver.load();
+}
+
+StandbyReceiver::Statistics StandbyReceiver::GetStatistics() const {
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+    return m_statistics;
+}
+
+// Private methods implementation
+
+void StandbyReceiver::ReceiveLoop() {
+    std::vector<uint8_t> receiveBuffer(RECEIVE_BUFFER_SIZE);
+    std::vector<uint8_t> payload;
+    DeltaFrameAssembler assembler;
+    auto nextAttempt = std::chrono::steady_clock::now();
+
+    Endpoint endpoint;
+    bool endpointOk = ParseEndpoint(m_config.endpoint, endpoint);
+
+    while (m_running.load()) {
+        CheckTakeover();
+        if (!endpointOk || std::chrono::steady_clock::now() < nextAttempt) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(RECEIVE_POLL_MS));
+            continue;
+        }
+        nextAttempt = std::chrono::steady_clock::now() + m_config.reconnectInterval;
+
+        // After takeover, keep fencing the old primary until stopped; it may only become reachable later
+        if (m_takenOver.load()) {
+            uint64_t fenceEpoch = 0;
+            uint64_t lastScan = 0;
+            {
+                std::lock_guard<std::mutex> lock(m_stateMutex);
+                fenceEpoch = m_epoch + 1;
+                lastScan = m_statistics.lastScanNumber;
+            }
+            if (SendFence(endpoint, fenceEpoch, lastScan, m_clock->SystemNow(), m_config.reconnectInterval, m_running)) {
+                std::lock_guard<std::mutex> lock(m_stateMutex);
+                m_statistics.fencesSent++;
+            }
+            continue;
+        }
+
+        int unusedPort = 0;
+        SOCKET socket = OpenSocket(endpoint, false, unusedPort);
+        if (socket == INVALID_SOCKET) {
+            continue;
+        }
+
+        assembler.Reset();
+        {
+            std::lock_guard<std::mutex> lock(m_stateMutex);
+            m_synchronized = false;     // The primary opens every connection with a full sync
+        }
+
+        bool streamOk = true;
+        while (m_running.load() && streamOk) {
+            if (CheckTakeover()) {
+                break;
+            }
+
+            int ready = PollReadable(socket, RECEIVE_POLL_MS);
+            if (ready == 0) {
+                continue;
+            }
+            if (ready < 0) {
+                break;
+            }
+
+            int received = recv(socket, reinterpret_cast<char*>(receiveBuffer.data()),
+                                static_cast<int>(receiveBuffer.size()), 0);
+            if (received <= 0) {
+                break;
+            }
+
+            assembler.Append(receiveBuffer.data(), static_cast<size_t>(received));
+            while (streamOk && assembler.Next(payload)) {
+                streamOk = Ingest(payload.data(), payload.size());
+            }
+            streamOk = streamOk && !assembler.IsCorrupt();
+        }
+
+        closesocket(socket);
+    }
+}
+
+bool StandbyReceiver::ApplyScan(ByteReader reader, ReplicatedState& state, SnapshotDeltaDecoder& decoder, bool apply) {
+    // Values: the decoder validates a frame in full before applying it, so it runs first in the apply pass
+    size_t snapshotSize = static_cast<size_t>(reader.Get(4));
+    if (!reader.Ok() || snapshotSize > reader.Remaining()) {
+        return false;
+    }
+    if (apply) {
+        m_snapshotPayload.resize(snapshotSize);
+        for (size_t i = 0; i < snapshotSize; ++i) {
+            m_snapshotPayload[i] = static_cast<uint8_t>(reader.Get(1));
+        }
+        SnapshotDeltaDecoder::Result result = decoder.Decode(m_snapshotPayload.data(), m_snapshotPayload.size());
+        if (result != SnapshotDeltaDecoder::Result::Keyframe && result != SnapshotDeltaDecoder::Result::Delta) {
+            return false;
+        }
+    } else {
+        for (size_t i = 0; i < snapshotSize; ++i) {
+            reader.Get(1);
+        }
+    }
+
+    // Alarms
+    size_t alarmCount = static_cast<size_t>(reader.Get(4));
+    if (!reader.Ok() || alarmCount * 5 > reader.Remaining()) {
+        return false;
+    }
+    for (size_t i = 0; i < alarmCount; ++i) {
+        int id = static_cast<int32_t>(reader.Get(4));
+        bool active = reader.Get(1) != 0;
+        if (apply) {
+            state.alarms[id] = active;
+        }
+    }
+
+    // Blocks
+    size_t blockCount = static_cast<size_t>(reader.Get(2));
+    for (size_t b = 0; b < blockCount && reader.Ok(); ++b) {
+        size_t nameLength = static_cast<size_t>(reader.Get(2));
+        if (!reader.Ok() || nameLength > reader.Remaining()) {
+            return false;
+        }
+        std::string name(nameLength, '\0');
+        for (size_t i = 0; i < nameLength; ++i) {
+            name[i] = static_cast<char>(reader.Get(1));
+        }
+
+        size_t size = static_cast<size_t>(reader.Get(4));
+        bool full = reader.Get(1) != 0;
+        if (!reader.Ok() || size > MAX_BLOCK_SIZE) {
+            return false;
+        }
+
+        auto block = std::find_if(state.blocks.begin(), state.blocks.end(),
+                                  [&name](const ReplicatedState::Block& existing) { return existing.name == name; });
+        if (block == state.blocks.end() && !full) {
+            return false;
+        }
+
+        if (full) {
+            if (size * 8 > reader.Remaining()) {
+                return false;
+            }
+            if (!apply) {
+                for (size_t i = 0; i < size; ++i) {
+                    reader.GetDouble();
+                }
+                continue;
+            }
+            if (block == state.blocks.end()) {
+                state.blocks.push_back({name, {}});
+                block = state.blocks.end() - 1;
+            }
+            block->data.resize(size);
+            for (double& value : block->data) {
+                value = reader.GetDouble();
+            }
+            continue;
+        }
+
+        size_t changedCount = static_cast<size_t>(reader.Get(4));
+        if (!reader.Ok() || block->data.size() != size || changedCount * 12 > reader.Remaining()) {
+            return false;
+        }
+        for (size_t i = 0; i < changedCount; ++i) {
+            size_t index = static_cast<size_t>(reader.Get(4));
+            double value = reader.GetDouble();
+            if (index >= size) {
+                return false;
+            }
+            if (apply) {
+                block->data[index] = value;
+            }
+        }
+    }
+
+    return reader.Ok() && reader.Remaining() == 0;
+}
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,193 @@
+#include "SteamTable.h"
+#include "DerivedChannelEngine.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Nuclear {
+
+namespace {
+
+// IAPWS-IF97 region 4 coefficients n1..n10
+constexpr double N[10] = {
+     0.11670521452767e4, -0.72421316703206e6, -0.17073846940092e2,
+     0.12020824702470e5, -0.32325550322333e7,  0.14915108613530e2,
+    -0.48232657361591e4,  0.40511340542057e6, -0.23855557567849,
+     0.65017534844798e3
+};
+
+constexpr double TRIPLE_POINT_K = 273.16;
+
+double Interpolate(const std::vector<double>& table, double position) {
+    // Clamp before converting; a NaN position collapses to 0 and is masked by the caller
+    double maxPosition = static_cast<double>(table.size() - 1);
+    position = std::min(std::max(0.0, position), maxPosition);
+    size_t index = std::min(static_cast<size_t>(position), table.size() - 2);
+    double fraction = position - static_cast<double>(index);
+    return table[index] + fraction * (table[index + 1] - table[index]);
+}
+
+double TableSaturationTemperature(double pressurePsi) {
+    return GetDefaultSteamTable().SaturationTemperature(pressurePsi);
+}
+
+double TableSaturationPressure(double temperatureC) {
+    return GetDefaultSteamTable().SaturationPressure(temperatureC);
+}
+
+double TableSubcoolingMargin(double temperatureC, double pressurePsi) {
+    return GetDefaultSteamTable().SubcoolingMargin(temperatureC, pressurePsi);
+}
+
+double ConvertCelsiusToFahrenheit(double value) { return CelsiusToFahrenheit(value); }
+double ConvertFahrenheitToCelsius(double value) { return FahrenheitToCelsius(value); }
+double ConvertPsiToMPa(double value) { return PsiToMPa(value); }
+double ConvertMPaToPsi(double value) { return MPaToPsi(value); }
+
+} // namespace
+
+SteamTable::SteamTable(const Config& config)
+    : m_config(config), m_maxTemperatureError(0.0), m_maxPressureError(0.0) {
+    double triplePressurePsi = MPaToPsi(ExactSaturationPressure(TRIPLE_POINT_K));
+    double criticalPressurePsi = MPaToPsi(CRITICAL_PRESSURE_MPA);
+
+    m_config.minPressurePsi = std::max(m_config.minPressurePsi, triplePressurePsi);
+    m_config.maxPressurePsi = std::min(m_config.maxPressurePsi, criticalPressurePsi);
+    m_config.minTemperatureC = std::max(m_config.minTemperatureC, KelvinToCelsius(TRIPLE_POINT_K));
+    m_config.maxTemperatureC = std::min(m_config.maxTemperatureC, KelvinToCelsius(CRITICAL_TEMPERATURE_K));
+    m_config.points = std::max<size_t>(m_config.points, 2);
+
+    const size_t points = m_config.points;
+    const double steps = static_cast<double>(points - 1);
+
+    // Tsat against p^0.25, the variable the IF97 backward equation is written in
+    m_pressureRootMin = std::sqrt(std::sqrt(m_config.minPressurePsi));
+    m_pressureRootMax = std::sqrt(std::sqrt(m_config.maxPressurePsi));
+    m_pressureRootScale = steps / (m_pressureRootMax - m_pressureRootMin);
+
+    m_temperatureTable.resize(points);
+    for (size_t i = 0; i < points; ++i) {
+        double root = m_pressureRootMin + static_cast<double>(i) / m_pressureRootScale;
+        m_temperatureTable[i] = KelvinToCelsius(ExactSaturationTemperature(PsiToMPa(root * root * root * root)));
+    }
+
+    // p^0.25 against T; a quartic of the lerp tracks the exponential curve closely
+    m_temperatureScale = steps / (m_config.maxTemperatureC - m_config.minTemperatureC);
+
+    m_pressureRootTable.resize(points);
+    for (size_t i = 0; i < points; ++i) {
+        double temperature = m_config.minTemperatureC + static_cast<double>(i) / m_temperatureScale;
+        m_pressureRootTable[i] = std::sqrt(std::sqrt(MPaToPsi(ExactSaturationPressure(CelsiusToKelvin(temperature)))));
+    }
+
+    // Interpolation error peaks between grid points; measure it there
+    for (size_t i = 0; i + 1 < points; ++i) {
+        double root = m_pressureRootMin + (static_cast<double>(i) + 0.5) / m_pressureRootScale;
+        double pressure = root * root * root * root;
+        double exactTemperature = KelvinToCelsius(ExactSaturationTemperature(PsiToMPa(pressure)));
+        m_maxTemperatureError = std::max(m_maxTemperatureError,
+                                         std::fabs(SaturationTemperature(pressure) - exactTemperature));
+
+        double temperature = m_config.minTemperatureC + (static_cast<double>(i) + 0.5) / m_temperatureScale;
+        double exactPressure = MPaToPsi(ExactSaturationPressure(CelsiusToKelvin(temperature)));
+        m_maxPressureError = std::max(m_maxPressureError,
+                                      std::fabs(SaturationPressure(temperature) - exactPressure) / exactPressure);
+    }
+}
+
+SteamTable::Config SteamTable::DefaultConfig() {
+    Config config;
+    config.minPressurePsi = 1.0;
+    config.maxPressurePsi = 3200.0;
+    config.minTemperatureC = 1.0;
+    config.maxTemperatureC = 373.0;
+    config.points = 1024;
+    return config;
+}
+
+double SteamTable::SaturationTemperature(double pressurePsi) const {
+    double position = (std::sqrt(std::sqrt(pressurePsi)) - m_pressureRootMin) * m_pressureRootScale;
+    double temperature = Interpolate(m_temperatureTable, position);
+
+    bool inRange = pressurePsi >= m_config.minPressurePsi && pressurePsi <= m_config.maxPressurePsi;
+    return inRange ? temperature : std::numeric_limits<double>::quiet_NaN();
+}
+
+double SteamTable::SaturationPressure(double temperatureC) const {
+    double position = (temperatureC - m_config.minTemperatureC) * m_temperatureScale;
+    double root = Interpolate(m_pressureRootTable, position);
+    double squared = root * root;
+
+    bool inRange = temperatureC >= m_config.minTemperatureC && temperatureC <= m_config.maxTemperatureC;
+    return inRange ? squared * squared : std::numeric_limits<double>::quiet_NaN();
+}
+
+double SteamTable::SubcoolingMargin(double temperatureC, double pressurePsi) const {
+    return SaturationTemperature(pressurePsi) - temperatureC;
+}
+
+void SteamTable::SaturationTemperature(const double* pressurePsi, double* temperatureC, size_t count) const {
+    for (size_t i = 0; i < count; ++i) {
+        temperatureC[i] = SaturationTemperature(pressurePsi[i]);
+    }
+}
+
+void SteamTable::SaturationPressure(const double* temperatureC, double* pressurePsi, size_t count) const {
+    for (size_t i = 0; i < count; ++i) {
+        pressurePsi[i] = SaturationPressure(temperatureC[i]);
+    }
+}
+
+double SteamTable::ExactSaturationTemperature(double pressureMPa) {
+    double beta = std::sqrt(std::sqrt(pressureMPa));
+    double e = beta * beta + N[2] * beta + N[5];
+    double f = N[0] * beta * beta + N[3] * beta + N[6];
+    double g = N[1] * beta * beta + N[4] * beta + N[7];
+    double d = 2.0 * g / (-f - std::sqrt(f * f - 4.0 * e * g));
+    return (N[9] + d - std::sqrt((N[9] + d) * (N[9] + d) - 4.0 * (N[8] + N[9] * d))) / 2.0;
+}
+
+double SteamTable::ExactSaturationPressure(double temperatureK) {
+    double theta = temperatureK + N[8] / (temperatureK - N[9]);
+    double a = theta * theta + N[0] * theta + N[1];
+    double b = N[2] * theta * theta + N[3] * theta + N[4];
+    double c = N[5] * theta * theta + N[6] * theta + N[7];
+    double root = 2.0 * c / (-b + std::sqrt(b * b - 4.0 * a * c));
+    return root * root * root * root;
+}
+
+double SteamTable::GetMaxTemperatureError() const {
+    return m_maxTemperatureError;
+}
+
+double SteamTable::GetMaxPressureError() const {
+    return m_maxPressureError;
+}
+
+const SteamTable::Config& SteamTable::GetConfig() const {
+    return m_config;
+}
+
+const SteamTable& GetDefaultSteamTable() {
+    static const SteamTable table;
+    return table;
+}
+
+bool RegisterSteamTableFunctions(DerivedChannelEngine& engine) {
+    using Unary = DerivedChannelEngine::UnaryFunction;
+    using Binary = DerivedChannelEngine::BinaryFunction;
+
+    // Build the table now rather than on the first scan that needs it
+    GetDefaultSteamTable();
+
+    bool ok = engine.RegisterFunction("tsat", static_cast<Unary>(&TableSaturationTemperature));
+    ok = engine.RegisterFunction("psat", static_cast<Unary>(&TableSaturationPressure)) && ok;
+    ok = engine.RegisterFunction("subcooling", static_cast<Binary>(&TableSubcoolingMargin)) && ok;
+    ok = engine.RegisterFunction("c_to_f", static_cast<Unary>(&ConvertCelsiusToFahrenheit)) && ok;
+    ok = engine.RegisterFunction("f_to_c", static_cast<Unary>(&ConvertFahrenheitToCelsius)) && ok;
+    ok = engine.RegisterFunction("psi_to_mpa", static_cast<Unary>(&ConvertPsiToMPa)) && ok;
+    ok = engine.RegisterFunction("mpa_to_psi", static_cast<Unary>(&ConvertMPaToPsi)) && ok;
+    return ok;
+}
+
+} // namespace Nuclear
\ No newline at end of file
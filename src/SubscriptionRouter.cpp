@@ -0,0 +1,171 @@
+#include "SubscriptionRouter.h"
+#include <algorithm>
+
+namespace Nuclear {
+
+SubscriptionRouter::SubscriptionRouter()
+    : m_routes(std::make_shared<const RouteTable>()), m_deltaRoutes(std::make_shared<const RouteTable>()) {}
+
+bool SubscriptionRouter::RegisterPlant(const std::string& plantId) {
+    if (plantId.empty()) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_updateMutex);
+    RouteTable routes = *CurrentRoutes();
+    if (!routes.emplace(plantId, std::make_shared<const SubscriberList>()).second) {
+        return false;
+    }
+    RouteTable deltaRoutes = *CurrentRoutes(Feed::Delta);
+    deltaRoutes.emplace(plantId, std::make_shared<const SubscriberList>());
+
+    PublishRoutes(std::move(routes));
+    PublishRoutes(std::move(deltaRoutes), Feed::Delta);
+    return true;
+}
+
+bool SubscriptionRouter::Subscribe(const std::string& clientId, const std::string& plantId, Feed feed) {
+    std::lock_guard<std::mutex> lock(m_updateMutex);
+    std::shared_ptr<const RouteTable> current = CurrentRoutes(feed);
+    auto it = current->find(plantId);
+    if (it == current->end()) {
+        return false;
+    }
+
+    const SubscriberList& subscribers = *it->second;
+    if (std::find(subscribers.begin(), subscribers.end(), clientId) != subscribers.end()) {
+        return true;
+    }
+
+    auto updated = std::make_shared<SubscriberList>(subscribers);
+    updated->push_back(clientId);
+
+    RouteTable routes = *current;
+    routes[plantId] = std::move(updated);
+    PublishRoutes(std::move(routes), feed);
+    return true;
+}
+
+bool SubscriptionRouter::Unsubscribe(const std::string& clientId, const std::string& plantId, Feed feed) {
+    std::lock_guard<std::mutex> lock(m_updateMutex);
+    std::shared_ptr<const RouteTable> current = CurrentRoutes(feed);
+    auto it = current->find(plantId);
+    if (it == current->end()) {
+        return false;
+    }
+
+    auto updated = std::make_shared<SubscriberList>(*it->second);
+    auto removed = std::remove(updated->begin(), updated->end(), clientId);
+    if (removed == updated->end()) {
+        return false;
+    }
+    updated->erase(removed, updated->end());
+
+    RouteTable routes = *current;
+    routes[plantId] = std::move(updated);
+    PublishRoutes(std::move(routes), feed);
+    return true;
+}
+
+size_t SubscriptionRouter::RemoveClient(const std::string& clientId) {
+    std::lock_guard<std::mutex> lock(m_updateMutex);
+
+    size_t removedCount = 0;
+    for (Feed feed : {Feed::Reports, Feed::Delta}) {
+        RouteTable routes = *CurrentRoutes(feed);
+        size_t feedRemoved = 0;
+        for (auto& route : routes) {
+            const SubscriberList& subscribers = *route.second;
+            if (std::find(subscribers.begin(), subscribers.end(), clientId) == subscribers.end()) {
+                continue;
+            }
+
+            auto updated = std::make_shared<SubscriberList>(subscribers);
+            updated->erase(std::remove(updated->begin(), updated->end(), clientId), updated->end());
+            route.second = std::move(updated);
+            ++feedRemoved;
+        }
+
+        if (feedRemoved > 0) {
+            PublishRoutes(std::move(routes), feed);
+            removedCount += feedRemoved;
+        }
+    }
+    return removedCount;
+}
+
+std::shared_ptr<const SubscriptionRouter::SubscriberList>
+SubscriptionRouter::GetSubscribers(const std::string& plantId, Feed feed) const {
+    std::shared_ptr<const RouteTable> routes = CurrentRoutes(feed);
+    auto it = routes->find(plantId);
+    return it == routes->end() ? nullptr : it->second;
+}
+
+std::vector<std::string> SubscriptionRouter::GetPlantIds() const {
+    std::shared_ptr<const RouteTable> routes = CurrentRoutes();
+    std::vector<std::string> plantIds;
+    plantIds.reserve(routes->size());
+    for (const auto& route : *routes) {
+        plantIds.push_back(route.first);
+    }
+    return plantIds;
+}
+
+bool SubscriptionRouter::HandleCommand(const std::string& clientId, const std::string& message, std::string& response,
+                                       std::string* deltaPlantId) {
+    size_t last = message.find_last_not_of(" \r\n");
+    std::string trimmed = last == std::string::npos ? std::string() : message.substr(0, last + 1);
+
+    size_t separator = trimmed.find(' ');
+    std::string command = trimmed.substr(0, separator);
+    if (command != "SUBSCRIBE" && command != "UNSUBSCRIBE" && command != "SUBSCRIBE_DELTA") {
+        return false;
+    }
+
+    std::string plantId;
+    if (separator != std::string::npos) {
+        size_t begin = trimmed.find_first_not_of(' ', separator);
+        if (begin != std::string::npos) {
+            plantId = trimmed.substr(begin);
+        }
+    }
+
+    if (command == "SUBSCRIBE_DELTA") {
+        // A single-plant host is addressed like a standalone monitor, without a plant ID
+        std::vector<std::string> plantIds = GetPlantIds();
+        if (plantId.empty() && plantIds.size() == 1) {
+            plantId = plantIds.front();
+        }
+        if (plantId.empty()) {
+            response = "ERROR SUBSCRIBE_DELTA requires a plant ID on a multi-plant host";
+        } else if (!Subscribe(clientId, plantId, Feed::Delta)) {
+            response = "ERROR unknown plant " + plantId;
+        } else {
+            Unsubscribe(clientId, plantId);
+            response.clear();
+            if (deltaPlantId) {
+                *deltaPlantId = plantId;
+            }
+        }
+    } else if (plantId.empty()) {
+        response = "ERROR " + command + " requires a plant ID";
+    } else if (command == "SUBSCRIBE") {
+        response = Subscribe(clientId, plantId) ? "SUBSCRIBED " + plantId : "ERROR unknown plant " + plantId;
+    } else {
+        response = Unsubscribe(clientId, plantId) ? "UNSUBSCRIBED " + plantId : "ERROR not subscribed to " + plantId;
+    }
+    return true;
+}
+
+// Private methods implementation
+
+std::shared_ptr<const SubscriptionRouter::RouteTable> SubscriptionRouter::CurrentRoutes(Feed feed) const {
+    return std::atomic_load(feed == Feed::Delta ? &m_deltaRoutes : &m_routes);
+}
+
+void SubscriptionRouter::PublishRoutes(RouteTable routes, Feed feed) {
+    std::atomic_store(feed == Feed::Delta ? &m_deltaRoutes : &m_routes,
+                      std::shared_ptr<const RouteTable>(std::make_shared<RouteTable>(std::move(routes))));
+}
+
+} // namespace Nuclear
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+namespace Nuclear {
+
+ThreadPool::ThreadPool(size_t shardCount, size_t maxQueuedPerShard)
+    : m_running(true), m_nextShard(0), m_pendingTasks(0),
+      m_maxQueuedPerShard(std::max<size_t>(maxQueuedPerShard, 1)) {
+    shardCount = std::max<size_t>(shardCount, 1);
+    m_shards.reserve(shardCount);
+
+    for (size_t i = 0; i < shardCount; ++i) {
+        m_shards.push_back(std::make_unique<Shard>());
+    }
+
+    // Start workers only after every shard exists
+    for (auto& shard : m_shards) {
+        Shard* target = shard.get();
+        shard->worker = std::make_unique<std::thread>([this, target]() { WorkerLoop(*target); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    Shutdown();
+}
+
+bool ThreadPool::Submit(Task task) {
+    size_t index = m_nextShard.fetch_add(1, std::memory_order_relaxed) % m_shards.size();
+    return Enqueue(*m_shards[index], std::move(task));
+}
+
+bool ThreadPool::SubmitTo(size_t shardKey, Task task) {
+    return Enqueue(*m_shards[shardKey % m_shards.size()], std::move(task));
+}
+
+void ThreadPool::Shutdown() {
+    if (!m_running.exchange(false)) {
+        return;
+    }
+
+    for (auto& shard : m_shards) {
+        {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+        }
+        shard->condition.notify_all();
+    }
+
+    for (auto& shard : m_shards) {
+        if (shard->worker && shard->worker->joinable()) {
+            shard->worker->join();
+        }
+    }
+}
+
+size_t ThreadPool::GetShardCount() const {
+    return m_shards.size();
+}
+
+size_t ThreadPool::GetPendingTasks() const {
+    return m_pendingTasks.load(std::memory_order_relaxed);
+}
+
+// Private methods implementation
+
+void ThreadPool::WorkerLoop(Shard& shard) {
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(shard.mutex);
+            shard.condition.wait(lock, [this, &shard]() {
+                return !shard.queue.empty() || !m_running.load();
+            });
+
+            if (shard.queue.empty()) {
+                return;  // Stopped and drained
+            }
+
+            task = std::move(shard.queue.front());
+            shard.queue.pop_front();
+        }
+
+        try {
+            task();
+        } catch (const std::exception&) {
+            // A failing task must never take the worker down with it
+        }
+
+        m_pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+bool ThreadPool::Enqueue(Shard& shard, Task task) {
+    if (!task) {
+        return false;
+    }
+
+    {
+        // Checked under the shard lock so a stopping worker cannot strand the task
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (!m_running.load() || shard.queue.size() >= m_maxQueuedPerShard) {
+            return false;
+        }
+        shard.queue.push_back(std::move(task));
+        m_pendingTasks.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    shard.condition.notify_one();
+    return true;
+}
+
+} // namespace Nuclear
\ No newline at end of file
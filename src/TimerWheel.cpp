@@ -0,0 +1,231 @@
+#include "TimerWheel.h"
+#include <algorithm>
+
+namespace Nuclear {
+
+TimerWheel::TimerWheel(std::chrono::milliseconds tickDuration, size_t initialCapacity,
+                       Clock::time_point startTime)
+    : m_freeList(NO_ENTRY), m_startTime(startTime),
+      m_tickDuration(std::max(tickDuration, std::chrono::milliseconds(1))),
+      m_currentTick(0), m_activeTimers(0) {
+    for (auto& level : m_slots) {
+        level.fill(NO_ENTRY);
+    }
+
+    m_entries.reserve(initialCapacity);
+}
+
+TimerWheel::TimerId TimerWheel::Schedule(std::chrono::milliseconds delay, Callback callback) {
+    if (!callback) {
+        return INVALID_TIMER;
+    }
+
+    uint32_t index = AllocateEntry();
+    TimerEntry& entry = m_entries[index];
+    entry.expiryTick = ExpiryTick(delay);
+    entry.callback = std::move(callback);
+    entry.active = true;
+    Link(index);
+    ++m_activeTimers;
+
+    // Generation is never zero, so a valid ID never equals INVALID_TIMER
+    return (static_cast<TimerId>(entry.generation) << 32) | index;
+}
+
+bool TimerWheel::Cancel(TimerId timerId) {
+    uint32_t index = Resolve(timerId);
+    if (index == NO_ENTRY) {
+        return false;
+    }
+
+    Unlink(index);
+    ReleaseEntry(index);
+    --m_activeTimers;
+    return true;
+}
+
+bool TimerWheel::Reschedule(TimerId timerId, std::chrono::milliseconds delay) {
+    uint32_t index = Resolve(timerId);
+    if (index == NO_ENTRY) {
+        return false;
+    }
+
+    Unlink(index);
+    m_entries[index].expiryTick = ExpiryTick(delay);
+    Link(index);
+    return true;
+}
+
+bool TimerWheel::IsPending(TimerId timerId) const {
+    return Resolve(timerId) != NO_ENTRY;
+}
+
+size_t TimerWheel::Advance(Clock::time_point now) {
+    if (now <= m_startTime) {
+        return 0;
+    }
+
+    uint64_t targetTick = static_cast<uint64_t>((now - m_startTime) / m_tickDuration);
+    size_t fired = 0;
+
+    while (m_currentTick < targetTick) {
+        if (m_activeTimers == 0) {
+            m_currentTick = targetTick;  // Nothing to fire; skip idle ticks
+            break;
+        }
+
+        ++m_currentTick;
+
+        // Pull down timers from higher levels whose range starts at this tick
+        for (int level = 1; level < LEVELS; ++level) {
+            uint64_t lowerBits = m_currentTick & ((uint64_t(1) << (SLOT_BITS * level)) - 1);
+            if (lowerBits != 0) {
+                break;
+            }
+            Cascade(level, static_cast<uint32_t>((m_currentTick >> (SLOT_BITS * level)) & SLOT_MASK));
+        }
+
+        // Pop one timer at a time so callbacks may cancel or schedule others;
+        // anything they schedule lands in a later slot
+        uint32_t slot = static_cast<uint32_t>(m_currentTick & SLOT_MASK);
+        while (m_slots[0][slot] != NO_ENTRY) {
+            uint32_t index = m_slots[0][slot];
+            Unlink(index);
+            Callback callback = std::move(m_entries[index].callback);
+            ReleaseEntry(index);
+            --m_activeTimers;
+            ++fired;
+
+            callback();
+        }
+    }
+
+    return fired;
+}
+
+size_t TimerWheel::GetActiveTimers() const {
+    return m_activeTimers;
+}
+
+std::chrono::milliseconds TimerWheel::GetTickDuration() const {
+    return m_tickDuration;
+}
+
+// Private methods implementation
+
+uint32_t TimerWheel::AllocateEntry() {
+    if (m_freeList != NO_ENTRY) {
+        uint32_t index = m_freeList;
+        m_freeList = m_entries[index].next;
+        return index;
+    }
+
+    TimerEntry entry;
+    entry.expiryTick = 0;
+    entry.generation = 1;
+    entry.next = NO_ENTRY;
+    entry.prev = NO_ENTRY;
+    entry.level = 0;
+    entry.slot = 0;
+    entry.active = false;
+    m_entries.push_back(std::move(entry));
+    return static_cast<uint32_t>(m_entries.size() - 1);
+}
+
+void TimerWheel::ReleaseEntry(uint32_t index) {
+    TimerEntry& entry = m_entries[index];
+    entry.active = false;
+    entry.callback = nullptr;
+    entry.prev = NO_ENTRY;
+
+    // Invalidate outstanding IDs for this entry, skipping generation zero
+    if (++entry.generation == 0) {
+        entry.generation = 1;
+    }
+
+    entry.next = m_freeList;
+    m_freeList = index;
+}
+
+void TimerWheel::Link(uint32_t index) {
+    TimerEntry& entry = m_entries[index];
+    uint64_t delta = entry.expiryTick - m_currentTick;
+
+    int level = 0;
+    while (level < LEVELS - 1 && delta >= (uint64_t(1) << (SLOT_BITS * (level + 1)))) {
+        ++level;
+    }
+
+    uint64_t expiry = entry.expiryTick;
+    if (level == LEVELS - 1 && delta >= (uint64_t(1) << (SLOT_BITS * LEVELS))) {
+        // Beyond wheel range: park in the furthest slot and re-file on cascade
+        expiry = m_currentTick + (uint64_t(1) << (SLOT_BITS * LEVELS)) - 1;
+    }
+
+    uint32_t slot = static_cast<uint32_t>((expiry >> (SLOT_BITS * level)) & SLOT_MASK);
+    entry.level = static_cast<uint16_t>(level);
+    entry.slot = static_cast<uint16_t>(slot);
+    entry.prev = NO_ENTRY;
+    entry.next = m_slots[level][slot];
+
+    if (entry.next != NO_ENTRY) {
+        m_entries[entry.next].prev = index;
+    }
+    m_slots[level][slot] = index;
+}
+
+void TimerWheel::Unlink(uint32_t index) {
+    TimerEntry& entry = m_entries[index];
+
+    if (entry.prev != NO_ENTRY) {
+        m_entries[entry.prev].next = entry.next;
+    } else {
+        m_slots[entry.level][entry.slot] = entry.next;
+    }
+
+    if (entry.next != NO_ENTRY) {
+        m_entries[entry.next].prev = entry.prev;
+    }
+
+    entry.next = NO_ENTRY;
+    entry.prev = NO_ENTRY;
+}
+
+void TimerWheel::Cascade(int level, uint32_t slot) {
+    uint32_t index = m_slots[level][slot];
+    m_slots[level][slot] = NO_ENTRY;
+
+    while (index != NO_ENTRY) {
+        uint32_t next = m_entries[index].next;
+        Link(index);
+        index = next;
+    }
+}
+
+uint64_t TimerWheel::ExpiryTick(std::chrono::milliseconds delay) const {
+    if (delay.count() <= 0) {
+        return m_currentTick + 1;
+    }
+
+    // Round up so a timer never fires before its delay has elapsed
+    uint64_t ticks = static_cast<uint64_t>((delay.count() + m_tickDuration.count() - 1) / m_tickDuration.count());
+    return m_currentTick + std::max<uint64_t>(ticks, 1);
+}
+
+uint32_t TimerWheel::Resolve(TimerId timerId) const {
+    uint32_t index = static_cast<uint32_t>(timerId & 0xFFFFFFFFu);
+    uint32_t generation = static_cast<uint32_t>(timerId >> 32);
+
+    if (index >= m_entries.size()) {
+        return NO_ENTRY;
+    }
+
+    const TimerEntry& entry = m_entries[index];
+    if (!entry.active || entry.generation != generation) {
+        return NO_ENTRY;
+    }
+
+    return index;
+}
+
+} // namespace Nuclear
\ No newline at end of file
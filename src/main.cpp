@@ -3,10 +3,19 @@
 #include "DataProcessor.h"
 #include "SecurityManager.h"
 #include "SocketManager.h"
+#include "RecordedSensorReader.h"
+#include "PlantHost.h"
+#include "HistorianExporter.h"
+#include "MetricsServer.h"
 #include <iostream>
 #include <memory>
 #include <csignal>
 #include <atomic>
+#include <thread>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <sstream>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -20,6 +29,10 @@ using namespace Nuclear;
 // Global variables for signal handling
 std::atomic<bool> g_running{true};
 std::unique_ptr<PlantMonitor> g_monitor;
+std::unique_ptr<PlantHost> g_host;
+MetricsRegistry g_metricsRegistry;
+std::unique_ptr<MetricsServer> g_metricsServer;
+std::unique_ptr<StandbyReceiver> g_standby;     // Fences the old primary after takeover
 
 /**
  * @brief Signal handler for graceful shutdown
@@ -31,6 +44,9 @@ void SignalHandler(int signal) {
     if (g_monitor) {
         g_monitor->StopMonitoring();
     }
+    if (g_host) {
+        g_host->Stop();
+    }
 }
 
 /**
@@ -55,28 +71,67 @@ void DisplayHelp() {
     std::cout << "  status  - Display current system status\n";
     std::cout << "  clients - Show connected monitoring clients\n";
     std::cout << "  config  - Display current configuration\n";
+    std::cout << "  trace <file> - Write captured overrun traces (Chrome trace format)\n";
     std::cout << "  help    - Show this help message\n";
     std::cout << "  quit    - Shutdown monitoring system\n";
     std::cout << "\nPress Enter after typing command.\n\n";
 }
 
+/**
+ * @brief Display command line usage
+ */
+void DisplayUsage() {
+    std::cout << "Usage: NuclearPlantMonitor [--replay <recording> [--speed <factor>] | --plants <id,id,...> |\n";
+    std::cout << "                            --replicate <endpoint> | --standby <endpoint>] [--journal <path>]\n";
+    std::cout << "                            [--metrics <port>] [--trace-overruns <ms>]\n";
+    std::cout << "  --replay  Replay a scan recording through the processing pipeline\n";
+    std::cout << "  --speed   Replay speed relative to recorded time (default 100, 0 = unthrottled)\n";
+    std::cout << "  --plants  Host several units in one process; each reads config/<id>.ini\n";
+    std::cout << "  --replicate  Stream state to a hot standby via this endpoint (host:port or unix:/path)\n";
+    std::cout << "  --standby    Follow a primary's endpoint and take over when its heartbeats or scans stop\n";
+    std::cout << "  --journal    Journal alarms and acknowledgments to this file and restore them on start\n";
+    std::cout << "               (<path>.<id> per unit with --plants; not allowed with --replay)\n";
+    std::cout << "  --metrics    Serve Prometheus metrics at http://127.0.0.1:<port>/metrics\n";
+    std::cout << "  --trace-overruns  Trace cycles longer than this many milliseconds ('trace <file>' dumps them;\n";
+    std::cout << "                    a replay writes <recording>.trace.json when it ends)\n";
+    std::cout << "\n       NuclearPlantMonitor --export <recording> <output> [--format csv|columnar]\n";
+    std::cout << "                           [--channels <id,id,...>] [--from <time>] [--to <time>] [--quality]\n";
+    std::cout << "  --export  Stream a scan recording to CSV or a columnar file and exit\n";
+    std::cout << "            Times are YYYY-MM-DDTHH:MM:SSZ (UTC) or microseconds since the epoch\n";
+}
+
 /**
  * @brief Create and configure the monitoring system with dependency injection
+ * @param replayFile Scan recording to replay instead of live Modbus acquisition, or empty
+ * @param plantId Unique identifier for the plant
+ * @param hosted true if a PlantHost front-end publishes for this plant
  * @return Configured PlantMonitor instance
  */
-std::unique_ptr<PlantMonitor> CreateMonitoringSystem() {
+std::unique_ptr<PlantMonitor> CreateMonitoringSystem(const std::string& replayFile = "",
+                                                     const std::string& plantId = "WESTINGHOUSE_REACTOR_001",
+                                                     bool hosted = false) {
     try {
         // Create dependencies using SOLID principles (Dependency Inversion)
-        auto sensorReader = std::make_unique<ModbusHandler>();
+        std::unique_ptr<ISensorReader> sensorReader;
         auto dataProcessor = std::make_unique<DataProcessor>();
         auto securityManager = std::make_unique<SecurityManager>();
-        auto socketManager = std::make_unique<SocketManager>(8080);
+        auto socketManager = hosted ? nullptr : std::make_unique<SocketManager>(8080);
         
-        // Configure Modbus devices (simulated for demo)
-        auto modbusHandler = static_cast<ModbusHandler*>(sensorReader.get());
-        modbusHandler->AddDevice("192.168.1.100");  // Primary reactor sensors
-        modbusHandler->AddDevice("192.168.1.101");  // Secondary cooling sensors
-        modbusHandler->AddDevice("192.168.1.102");  // Radiation monitoring sensors
+        if (replayFile.empty()) {
+            // Configure Modbus devices (simulated for demo)
+            auto modbusHandler = std::make_unique<ModbusHandler>();
+            modbusHandler->AddDevice("192.168.1.100");  // Primary reactor sensors
+            modbusHandler->AddDevice("192.168.1.101");  // Secondary cooling sensors
+            modbusHandler->AddDevice("192.168.1.102");  // Radiation monitoring sensors
+            sensorReader = std::move(modbusHandler);
+        } else {
+            auto recordedReader = std::make_unique<RecordedSensorReader>();
+            if (!recordedReader->Open(replayFile)) {
+                std::cerr << "Failed to open recording: " << replayFile << std::endl;
+                return nullptr;
+            }
+            sensorReader = std::move(recordedReader);
+        }
         
         // Configure safety thresholds
         auto processor = static_cast<DataProcessor*>(dataProcessor.get());
@@ -87,7 +142,6 @@ std::unique_ptr<PlantMonitor> CreateMonitoringSystem() {
         );
         
         // Create main monitoring system with dependency injection
-        std::string plantId = "WESTINGHOUSE_REACTOR_001";
         auto monitor = std::make_unique<PlantMonitor>(
             std::move(sensorReader),
             std::move(dataProcessor),
@@ -124,6 +178,13 @@ bool ProcessCommand(const std::string& command) {
     } else if (command == "config") {
         std::cout << "Plant ID: " << (g_monitor ? g_monitor->GetPlantId() : "Not initialized") << std::endl;
         std::cout << "Monitoring: " << (g_monitor && g_monitor->IsMonitoring() ? "ACTIVE" : "INACTIVE") << std::endl;
+    } else if (command.compare(0, 6, "trace ") == 0) {
+        std::string path = command.substr(6);
+        if (g_monitor && g_monitor->DumpScanTraces(path)) {
+            std::cout << "Overrun traces written to " << path << std::endl;
+        } else {
+            std::cout << "Failed to write traces to " << path << std::endl;
+        }
     } else if (command == "help") {
         DisplayHelp();
     } else if (!command.empty()) {
@@ -132,13 +193,310 @@ bool ProcessCommand(const std::string& command) {
     return true;
 }
 
+/**
+ * @brief Apply --metrics and --trace-overruns to one monitor
+ * @param monitor Monitor to configure; must not be running
+ * @param metricsPort Metrics port, or -1 when metrics are off
+ * @param traceThresholdMs Overrun threshold, or -1 when tracing is off
+ * @return false if the monitor's metrics could not be registered
+ *
+ * Journal and replication must be enabled first so their series are included.
+ */
+bool EnableDiagnostics(PlantMonitor& monitor, int metricsPort, int traceThresholdMs) {
+    if (metricsPort >= 0 && !monitor.RegisterMetrics(g_metricsRegistry)) {
+        return false;
+    }
+    
+    if (traceThresholdMs >= 0) {
+        ScanTracer::Config config = ScanTracer::DefaultConfig();
+        config.overrunThreshold = std::chrono::milliseconds(traceThresholdMs);
+        monitor.EnableScanTracing(config);
+    }
+    return true;
+}
+
+/**
+ * @brief Start the metrics listener once every monitor is registered
+ * @param metricsPort Metrics port, or -1 when metrics are off
+ * @return false if the listener could not be started
+ */
+bool StartMetricsServer(int metricsPort) {
+    if (metricsPort < 0) {
+        return true;
+    }
+    
+    MetricsServer::Config config = MetricsServer::DefaultConfig();
+    config.port = metricsPort;
+    g_metricsServer = std::make_unique<MetricsServer>(g_metricsRegistry, config);
+    if (!g_metricsServer->Start()) {
+        std::cerr << "Failed to start metrics listener on port " << metricsPort << ". Exiting.\n";
+        return false;
+    }
+    std::cout << "Serving metrics at http://127.0.0.1:" << g_metricsServer->GetPort() << "/metrics\n";
+    return true;
+}
+
+/**
+ * @brief Replay a recording and report throughput
+ * @param speedup Replay speed relative to recorded time
+ * @param tracePath File to write overrun traces to when the replay ends, or empty
+ * @return Process exit code
+ */
+int RunReplay(double speedup, const std::string& tracePath) {
+    if (!g_monitor->StartReplay(speedup)) {
+        std::cerr << "Failed to start replay. Exiting.\n";
+        return 1;
+    }
+    
+    std::cout << "Replaying recording at " << speedup << "x...\n";
+    while (g_running && !g_monitor->GetReplayStatistics().finished) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+    g_monitor->StopMonitoring();
+    
+    PlantMonitor::ReplayStatistics stats = g_monitor->GetReplayStatistics();
+    std::cout << "Replayed " << stats.scansReplayed << " scans at " << stats.scansPerSecond << " scans/s\n";
+    
+    if (!tracePath.empty()) {
+        if (!g_monitor->DumpScanTraces(tracePath)) {
+            std::cerr << "Failed to write traces to " << tracePath << std::endl;
+            return 1;
+        }
+        std::cout << "Overrun traces written to " << tracePath << std::endl;
+    }
+    return 0;
+}
+
+/**
+ * @brief Export a recording for offline analysis without starting monitoring
+ * @param args Arguments following --export
+ * @return Process exit code
+ */
+int RunExport(const std::vector<std::string>& args) {
+    if (args.size() < 2) {
+        DisplayUsage();
+        return 1;
+    }
+    
+    HistorianExporter::Options options = HistorianExporter::DefaultOptions();
+    for (size_t i = 2; i < args.size(); ++i) {
+        bool hasValue = i + 1 < args.size();
+        bool ok = true;
+        if (args[i] == "--format" && hasValue) {
+            ok = HistorianExporter::ParseFormat(args[++i], options.format);
+        } else if (args[i] == "--from" && hasValue) {
+            ok = HistorianExporter::ParseTime(args[++i], options.startUs);
+        } else if (args[i] == "--to" && hasValue) {
+            ok = HistorianExporter::ParseTime(args[++i], options.endUs);
+        } else if (args[i] == "--channels" && hasValue) {
+            std::istringstream list(args[++i]);
+            std::string sensorId;
+            while (ok && std::getline(list, sensorId, ',')) {
+                try {
+                    options.sensorIds.push_back(std::stoi(sensorId));
+                } catch (const std::exception&) {
+                    ok = false;
+                }
+            }
+        } else if (args[i] == "--quality") {
+            options.includeQuality = true;
+        } else {
+            ok = false;
+        }
+        
+        if (!ok) {
+            DisplayUsage();
+            return 1;
+        }
+    }
+    
+    std::cout << "Exporting " << args[0] << " to " << args[1] << "...\n";
+    HistorianExporter exporter(options);
+    HistorianExporter::Result result = exporter.Export(args[0], args[1]);
+    if (!result.completed) {
+        std::cerr << "Export failed: " << result.error << std::endl;
+        return 1;
+    }
+    
+    std::cout << "Exported " << result.rowsExported << " scans (" << result.bytesWritten << " bytes) in "
+              << result.seconds << " s, " << result.megabytesPerSecond << " MB/s\n";
+    return 0;
+}
+
+/**
+ * @brief Follow a primary until it goes silent or stops scanning, then seed the local monitor with its state
+ * @param endpoint Primary's replication endpoint
+ * @return true if takeover happened, false if shut down first
+ *
+ * After takeover the receiver is kept in g_standby until shutdown, fencing
+ * the old primary whenever it can be reached.
+ */
+bool WaitForTakeover(const std::string& endpoint) {
+    StandbyReceiver::Config config = StandbyReceiver::DefaultConfig();
+    config.endpoint = endpoint;
+    g_standby = std::make_unique<StandbyReceiver>(config);
+    
+    auto restored = std::make_shared<std::atomic<bool>>(false);
+    g_standby->SetTakeoverHandler([restored](const ReplicatedState& state) {
+        *restored = g_monitor->RestoreState(state);
+    });
+    if (!g_standby->Start()) {
+        g_standby.reset();
+        return false;
+    }
+    
+    std::cout << "Standing by for primary at " << endpoint << "...\n";
+    while (g_running && !g_standby->HasTakenOver()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    
+    if (!g_standby->HasTakenOver()) {
+        g_standby.reset();
+        return false;
+    }
+    StandbyReceiver::Statistics stats = g_standby->GetStatistics();
+    std::cout << "Primary lost; taking over at scan " << stats.lastScanNumber
+              << (*restored ? "" : " (state not restored, starting cold)") << "\n";
+    return true;
+}
+
+/**
+ * @brief Run several units in one process behind a shared front-end
+ * @param plantIds Units to host
+ * @param journalPath Journal path prefix; each unit journals to <path>.<id>, or empty
+ * @param metricsPort Metrics port shared by all units, or -1
+ * @param traceThresholdMs Overrun threshold for every unit, or -1
+ * @return Process exit code
+ */
+int RunHost(const std::vector<std::string>& plantIds, const std::string& journalPath, int metricsPort,
+            int traceThresholdMs) {
+    g_host = std::make_unique<PlantHost>(std::make_unique<SocketManager>(8080));
+    
+    for (const std::string& plantId : plantIds) {
+        auto monitor = CreateMonitoringSystem("", plantId, true);
+        if (monitor && !journalPath.empty() && !monitor->EnableAlarmJournal(journalPath + "." + plantId)) {
+            std::cerr << "Failed to open alarm journal " << journalPath << "." << plantId << ". Exiting.\n";
+            return 1;
+        }
+        
+        PlantHost::PlantConfig config;
+        config.configFile = "config/" + plantId + ".ini";
+        if (!monitor || !EnableDiagnostics(*monitor, metricsPort, traceThresholdMs) ||
+            !g_host->AddPlant(std::move(monitor), config)) {
+            std::cerr << "Failed to add plant " << plantId << ". Exiting.\n";
+            return 1;
+        }
+    }
+    
+    if (!StartMetricsServer(metricsPort)) {
+        return 1;
+    }
+    
+    std::cout << "Starting " << plantIds.size() << " hosted plants...\n";
+    if (!g_host->Start()) {
+        std::cerr << "Failed to start plant host. Exiting.\n";
+        return 1;
+    }
+    
+    std::cout << "Clients select units with SUBSCRIBE <plantId>. Type 'status', 'trace <file>' or 'quit'.\n\n";
+    std::string command;
+    while (g_running) {
+        std::cout << "NPM> ";
+        std::getline(std::cin, command);
+        
+        if (command == "quit" || command == "exit") {
+            break;
+        } else if (command == "status") {
+            std::cout << g_host->GetStatus() << std::endl;
+        } else if (command.rfind("trace ", 0) == 0) {
+            // One trace file per unit: <file>.<id>
+            for (const std::string& plantId : plantIds) {
+                std::string path = command.substr(6) + "." + plantId;
+                PlantMonitor* monitor = g_host->GetPlant(plantId);
+                std::cout << (monitor && monitor->DumpScanTraces(path) ? "Overrun traces written to "
+                                                                       : "Failed to write traces to ")
+                          << path << std::endl;
+            }
+        } else if (!command.empty()) {
+            std::cout << "Unknown command: " << command
+                      << ". Hosted mode supports 'status', 'trace <file>' and 'quit'.\n";
+        }
+    }
+    
+    g_host->Stop();
+    g_host.reset();
+    if (g_metricsServer) {
+        g_metricsServer->Stop();
+    }
+    std::cout << "Shutdown complete. Goodbye.\n";
+    return 0;
+}
+
 /**
  * @brief Main application entry point
  */
-int main() {
+int main(int argc, char* argv[]) {
+    // Offline export runs alone; it never touches a live plant
+    if (argc > 1 && std::string(argv[1]) == "--export") {
+        return RunExport(std::vector<std::string>(argv + 2, argv + argc));
+    }
+    
     // Display application banner
     DisplayBanner();
     
+    std::string replayFile;
+    double replaySpeed = 100.0;
+    std::vector<std::string> plantIds;
+    std::string replicateEndpoint;
+    std::string standbyEndpoint;
+    std::string journalPath;
+    int metricsPort = -1;
+    int traceThresholdMs = -1;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--replay" && i + 1 < argc) {
+            replayFile = argv[++i];
+        } else if (arg == "--speed" && i + 1 < argc) {
+            try {
+                replaySpeed = std::stod(argv[++i]);
+            } catch (const std::exception&) {
+                DisplayUsage();
+                return 1;
+            }
+        } else if (arg == "--plants" && i + 1 < argc) {
+            std::istringstream list(argv[++i]);
+            std::string plantId;
+            while (std::getline(list, plantId, ',')) {
+                if (!plantId.empty()) {
+                    plantIds.push_back(plantId);
+                }
+            }
+        } else if (arg == "--replicate" && i + 1 < argc) {
+            replicateEndpoint = argv[++i];
+        } else if (arg == "--standby" && i + 1 < argc) {
+            standbyEndpoint = argv[++i];
+        } else if (arg == "--journal" && i + 1 < argc) {
+            journalPath = argv[++i];
+        } else if (arg == "--metrics" && i + 1 < argc) {
+            try {
+                metricsPort = std::stoi(argv[++i]);
+            } catch (const std::exception&) {
+                DisplayUsage();
+                return 1;
+            }
+        } else if (arg == "--trace-overruns" && i + 1 < argc) {
+            try {
+                traceThresholdMs = std::stoi(argv[++i]);
+            } catch (const std::exception&) {
+                DisplayUsage();
+                return 1;
+            }
+        } else {
+            DisplayUsage();
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+    
     // Set up signal handlers for graceful shutdown
     std::signal(SIGINT, SignalHandler);
     std::signal(SIGTERM, SignalHandler);
@@ -150,9 +508,23 @@ int main() {
 #endif
     
     try {
+        if (!plantIds.empty()) {
+            if (!replayFile.empty() || !replicateEndpoint.empty() || !standbyEndpoint.empty()) {
+                DisplayUsage();
+                return 1;
+            }
+            return RunHost(plantIds, journalPath, metricsPort, traceThresholdMs);
+        }
+        
+        // A replay must not persist recorded alarms into, or restore them from, a live journal
+        if (!replayFile.empty() && !journalPath.empty()) {
+            std::cerr << "--journal cannot be used with --replay. Exiting.\n";
+            return 1;
+        }
+        
         // Create monitoring system
         std::cout << "Initializing Nuclear Plant Monitoring System...\n";
-        g_monitor = CreateMonitoringSystem();
+        g_monitor = CreateMonitoringSystem(replayFile);
         
         if (!g_monitor) {
             std::cerr << "Failed to create monitoring system. Exiting.\n";
@@ -165,6 +537,47 @@ int main() {
             return 1;
         }
         
+        if (!replayFile.empty()) {
+            if (!EnableDiagnostics(*g_monitor, metricsPort, traceThresholdMs) || !StartMetricsServer(metricsPort)) {
+                std::cerr << "Failed to enable diagnostics for replay. Exiting.\n";
+                return 1;
+            }
+            int result = RunReplay(replaySpeed, traceThresholdMs >= 0 ? replayFile + ".trace.json" : "");
+            if (g_metricsServer) {
+                g_metricsServer->Stop();
+            }
+            g_monitor.reset();
+            return result;
+        }
+        
+        if (!standbyEndpoint.empty() && !WaitForTakeover(standbyEndpoint)) {
+            g_monitor.reset();
+            std::cout << "Shutdown complete. Goodbye.\n";
+            return 0;
+        }
+        
+        if (!journalPath.empty() && !g_monitor->EnableAlarmJournal(journalPath)) {
+            std::cerr << "Failed to open alarm journal " << journalPath << ". Exiting.\n";
+            return 1;
+        }
+        
+        if (!replicateEndpoint.empty()) {
+            StateReplicator::Config config = StateReplicator::DefaultConfig();
+            config.endpoint = replicateEndpoint;
+            if (!g_monitor->EnableReplication(config)) {
+                std::cerr << "Failed to open replication endpoint " << replicateEndpoint << ". Exiting.\n";
+                return 1;
+            }
+        }
+        
+        if (!EnableDiagnostics(*g_monitor, metricsPort, traceThresholdMs)) {
+            std::cerr << "Failed to register metrics. Exiting.\n";
+            return 1;
+        }
+        if (!StartMetricsServer(metricsPort)) {
+            return 1;
+        }
+        
         // Start monitoring operations
         std::cout << "Starting monitoring operations...\n";
         if (!g_monitor->StartMonitoring(1000)) {  // 1 second scan interval
@@ -193,10 +606,14 @@ int main() {
     
     // Cleanup
     std::cout << "\nShutting down Nuclear Plant Monitoring System...\n";
+    if (g_metricsServer) {
+        g_metricsServer->Stop();
+    }
     if (g_monitor) {
         g_monitor->StopMonitoring();
         g_monitor.reset();
     }
+    g_standby.reset();
     
     std::cout << "Shutdown complete. Goodbye.\n";
     return 0;
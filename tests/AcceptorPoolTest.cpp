@@ -0,0 +1,319 @@
+#include "AcceptorPool.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <set>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+
+#if defined(__linux__)
+#include <sys/resource.h>
+#include <sys/syscall.h>
+
+// Errors the next accept4 calls report instead of accepting, so the test can
+// produce an aborted connection the kernel would otherwise hand over intact
+static std::atomic<int> g_injectedAcceptAborts(0);
+
+extern "C" int accept4(int socket, sockaddr* address, socklen_t* length, int flags) {
+    int expected = g_injectedAcceptAborts.load();
+    while (expected > 0 && !g_injectedAcceptAborts.compare_exchange_weak(expected, expected - 1)) {
+    }
+    if (expected > 0) {
+        errno = ECONNABORTED;
+        return -1;
+    }
+    return static_cast<int>(syscall(SYS_accept4, socket, address, length, flags));
+}
+#endif
+
+using namespace Nuclear;
+
+class AcceptorPoolTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+public:
+    AcceptorPoolTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== AcceptorPool Unit Tests ===" << std::endl;
+
+        TestBatchedAccept();
+        TestAcceptAcrossShards();
+        TestDrainsAfterAbortedAccept();
+        TestBacksOffWhenDescriptorsExhausted();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All AcceptorPool tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some AcceptorPool tests failed!" << std::endl;
+        }
+    }
+
+private:
+    // Gate that parks the connection handler so later connections queue up behind it
+    struct HandlerGate {
+        std::mutex mutex;
+        std::condition_variable changed;
+        bool holding = false;
+        bool held = false;
+
+        void Hold() {
+            std::lock_guard<std::mutex> lock(mutex);
+            holding = true;
+            held = false;
+        }
+
+        void PassThrough() {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!holding) {
+                return;
+            }
+            held = true;
+            changed.notify_all();
+            changed.wait(lock, [this]() { return !holding; });
+        }
+
+        bool WaitUntilHeld() {
+            std::unique_lock<std::mutex> lock(mutex);
+            return changed.wait_for(lock, std::chrono::seconds(5), [this]() { return held; });
+        }
+
+        void Release() {
+            std::lock_guard<std::mutex> lock(mutex);
+            holding = false;
+            changed.notify_all();
+        }
+    };
+
+    static int FreePort() {
+        SOCKET probe = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(address);
+        int port = -1;
+        if (bind(probe, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0 &&
+            getsockname(probe, reinterpret_cast<sockaddr*>(&address), &length) == 0) {
+            port = ntohs(address.sin_port);
+        }
+        closesocket(probe);
+        return port;
+    }
+
+    static SOCKET Connect(int port, SOCKET client = INVALID_SOCKET) {
+        if (client == INVALID_SOCKET) {
+            client = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        }
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<uint16_t>(port));
+        inet_pton(AF_INET, "127.0.0.1", &address.sin_addr);
+        if (connect(client, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == SOCKET_ERROR) {
+            closesocket(client);
+            return INVALID_SOCKET;
+        }
+        return client;
+    }
+
+    static bool WaitFor(const std::function<bool()>& condition) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!condition()) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    static void CloseAll(std::vector<SOCKET>& sockets) {
+        for (SOCKET s : sockets) {
+            if (s != INVALID_SOCKET) {
+                closesocket(s);
+            }
+        }
+        sockets.clear();
+    }
+
+    void TestBatchedAccept() {
+        HandlerGate gate;
+        std::atomic<size_t> handled(0);
+        int port = FreePort();
+        AcceptorPool pool(port, 1);
+        pool.SetConnectionHandler([&](SOCKET client, const std::string&) {
+            gate.PassThrough();
+            closesocket(client);
+            handled.fetch_add(1);
+        });
+        if (!Assert(pool.Start() && pool.GetShardCount() == 1, "Batch_Start", "Single shard should listen")) {
+            return;
+        }
+
+        // Park the shard on the first connection; the rest complete their handshake and queue
+        std::vector<SOCKET> clients;
+        gate.Hold();
+        clients.push_back(Connect(port));
+        bool parked = gate.WaitUntilHeld();
+        for (int i = 0; i < 20; ++i) {
+            clients.push_back(Connect(port));
+        }
+        gate.Release();
+
+        bool drained = WaitFor([&]() { return handled.load() == 21 && pool.GetStatistics().acceptBatches > 0; });
+        AcceptorPool::Statistics stats = pool.GetStatistics();
+        Assert(parked && drained && stats.acceptedConnections == 21, "Batch_AllAccepted",
+               "Every queued connection should be accepted");
+        Assert(stats.acceptBatches == 1 && stats.largestBatch == 21 && stats.acceptErrors == 0, "Batch_OneDrain",
+               "Connections queued while the shard was busy should be drained in one batch");
+
+        pool.Stop();
+        CloseAll(clients);
+    }
+
+    void TestAcceptAcrossShards() {
+        std::mutex threadsMutex;
+        std::set<std::thread::id> threads;
+        std::atomic<size_t> handled(0);
+        std::atomic<size_t> loopback(0);
+        int port = FreePort();
+        AcceptorPool pool(port, 4);
+        pool.SetConnectionHandler([&](SOCKET client, const std::string& address) {
+            closesocket(client);
+            {
+                std::lock_guard<std::mutex> lock(threadsMutex);
+                threads.insert(std::this_thread::get_id());
+            }
+            loopback.fetch_add(address == "127.0.0.1" ? 1 : 0);
+            handled.fetch_add(1);
+        });
+        if (!Assert(pool.Start() && pool.GetShardCount() == 4, "Shards_Start", "Every shard should listen")) {
+            return;
+        }
+
+        std::vector<SOCKET> clients;
+        for (int i = 0; i < 200; ++i) {
+            clients.push_back(Connect(port));
+        }
+        bool drained = WaitFor([&]() { return handled.load() == 200; });
+        pool.Stop();
+
+        std::lock_guard<std::mutex> lock(threadsMutex);
+        Assert(drained && pool.GetStatistics().acceptedConnections == 200 && loopback.load() == 200,
+               "Shards_AllAccepted", "Every connection should be accepted with its peer address");
+        Assert(threads.size() > 1, "Shards_Spread", "The kernel should spread connections over several listeners");
+        CloseAll(clients);
+    }
+
+    void TestDrainsAfterAbortedAccept() {
+#if defined(__linux__)
+        HandlerGate gate;
+        std::atomic<size_t> handled(0);
+        int port = FreePort();
+        AcceptorPool pool(port, 1);
+        pool.SetConnectionHandler([&](SOCKET client, const std::string&) {
+            gate.PassThrough();
+            closesocket(client);
+            handled.fetch_add(1);
+        });
+        pool.Start();
+
+        // The accept after the parked connection reports ECONNABORTED; the two behind it must still be taken
+        std::vector<SOCKET> clients;
+        gate.Hold();
+        clients.push_back(Connect(port));
+        bool parked = gate.WaitUntilHeld();
+        clients.push_back(Connect(port));
+        clients.push_back(Connect(port));
+        g_injectedAcceptAborts = 1;
+        gate.Release();
+
+        bool drained = WaitFor([&]() { return handled.load() == 3 && pool.GetStatistics().acceptBatches > 0; });
+        AcceptorPool::Statistics stats = pool.GetStatistics();
+        Assert(parked && drained && g_injectedAcceptAborts.load() == 0, "Aborted_LaterAccepted",
+               "Connections queued behind an aborted one should be accepted");
+        Assert(stats.acceptBatches == 1 && stats.largestBatch == 3 && stats.acceptErrors == 0, "Aborted_SameBatch",
+               "An aborted accept should neither end the batch nor count as an error");
+
+        pool.Stop();
+        CloseAll(clients);
+#endif
+    }
+
+    void TestBacksOffWhenDescriptorsExhausted() {
+#if defined(__linux__)
+        std::atomic<size_t> handled(0);
+        std::atomic<size_t> errors(0);
+        int port = FreePort();
+        AcceptorPool pool(port, 1);
+        pool.SetConnectionHandler([&](SOCKET client, const std::string&) {
+            closesocket(client);
+            handled.fetch_add(1);
+        });
+        pool.SetErrorHandler([&](const std::string&) { errors.fetch_add(1); });
+        pool.Start();
+
+        // Cap the descriptor limit at the next free descriptor so the server side of the
+        // connection cannot be accepted; the client socket is created before the cap
+        SOCKET client = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        int nextDescriptor = dup(client);
+        closesocket(nextDescriptor);
+        rlimit original{};
+        getrlimit(RLIMIT_NOFILE, &original);
+        rlimit capped = original;
+        capped.rlim_cur = static_cast<rlim_t>(nextDescriptor);
+        bool limited = setrlimit(RLIMIT_NOFILE, &capped) == 0;
+
+        client = Connect(port, client);
+        std::this_thread::sleep_for(std::chrono::milliseconds(350));
+        size_t errorsWhileExhausted = errors.load();
+        size_t acceptedWhileExhausted = handled.load();
+        setrlimit(RLIMIT_NOFILE, &original);
+
+        // Without a back-off the listener stays readable and accept would fail in a tight loop
+        Assert(limited && client != INVALID_SOCKET && acceptedWhileExhausted == 0 && errorsWhileExhausted >= 1 &&
+               errorsWhileExhausted <= 8, "Exhausted_BacksOff",
+               "EMFILE should be reported and retried after a pause, got " + std::to_string(errorsWhileExhausted));
+
+        bool recovered = WaitFor([&]() { return handled.load() == 1; });
+        Assert(recovered, "Exhausted_Recovers", "The queued connection should be accepted once descriptors are free");
+
+        pool.Stop();
+        if (client != INVALID_SOCKET) {
+            closesocket(client);
+        }
+#endif
+    }
+};
+
+// Function to run acceptor pool tests
+void RunAcceptorPoolTests() {
+    AcceptorPoolTest test;
+    test.RunAllTests();
+}
@@ -0,0 +1,225 @@
+#include "AlarmJournal.h"
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <chrono>
+
+using namespace Nuclear;
+
+class AlarmJournalTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+    std::string m_path;
+
+public:
+    AlarmJournalTest() : testsRun(0), testsPassed(0), testsFailed(0), m_path("alarm_journal_test.npaj") {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== AlarmJournal Unit Tests ===" << std::endl;
+
+        TestReplayRestoresAlarms();
+        TestGroupCommit();
+        TestSynchronousCommit();
+        TestTornTail();
+        TestStaleRecordsAfterTear();
+        TestCommitBatching();
+
+        std::remove(m_path.c_str());
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All AlarmJournal tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some AlarmJournal tests failed!" << std::endl;
+        }
+    }
+
+private:
+    AlarmJournal::Config MakeConfig(int commitIntervalMs) {
+        AlarmJournal::Config config = AlarmJournal::DefaultConfig();
+        config.commitInterval = std::chrono::milliseconds(commitIntervalMs);
+        config.preallocateBytes = 64 * 1024;
+        return config;
+    }
+
+    uint64_t FileSize(const std::string& path) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        return file ? static_cast<uint64_t>(file.tellg()) : 0;
+    }
+
+    void TestReplayRestoresAlarms() {
+        std::remove(m_path.c_str());
+        {
+            AlarmJournal journal(MakeConfig(20));
+            Assert(journal.Open(m_path) && FileSize(m_path) >= 64 * 1024, "Journal_Preallocated",
+                   "A new journal should be created and preallocated");
+
+            journal.RecordAlarm(101, true, 612.0, 1000);      // Raised, acknowledged, still active
+            journal.RecordAcknowledgment(101, "operator-1", 2000);
+            journal.RecordAlarm(102, true, 15.8, 3000);       // Raised and cleared, never acknowledged
+            journal.RecordAlarm(102, false, 15.1, 4000);
+            journal.RecordAlarm(103, true, 2.5, 5000);        // Raised, acknowledged and cleared
+            journal.RecordAcknowledgment(103, "operator-2", 6000);
+            journal.RecordAlarm(103, false, 1.0, 7000);
+        }
+
+        AlarmJournal reopened(MakeConfig(20));
+        bool opened = reopened.Open(m_path);
+        std::vector<JournaledAlarm> alarms = reopened.GetRecoveredAlarms();
+        bool restored = alarms.size() == 2 && alarms[0].alarmId == 101 && alarms[0].active &&
+                        alarms[0].acknowledged && alarms[0].acknowledgedBy == "operator-1" &&
+                        alarms[1].alarmId == 102 && !alarms[1].active && !alarms[1].acknowledged;
+        Assert(opened && restored, "Journal_ReplayState",
+               "Replay should restore active and unacknowledged alarms and drop resolved ones");
+
+        uint64_t sequence = reopened.RecordAlarm(104, true, 9.0, 8000);
+        Assert(sequence == 8 && reopened.GetStatistics().recordsRecovered == 7, "Journal_SequenceContinues",
+               "Appends after a reopen should continue the sequence");
+        reopened.Close();
+
+        std::vector<JournalRecord> records;
+        Assert(AlarmJournal::Replay(m_path, records) && records.size() == 8 && records.back().alarmId == 104,
+               "Journal_ReplayRecords", "Replay should return every record in order");
+    }
+
+    void TestGroupCommit() {
+        std::remove(m_path.c_str());
+        AlarmJournal journal(MakeConfig(30));
+        journal.Open(m_path);
+
+        uint64_t last = 0;
+        for (int i = 0; i < 500; ++i) {
+            last = journal.RecordAlarm(200 + i % 50, i % 2 == 0, static_cast<double>(i), 10000 + i);
+        }
+        bool durable = journal.WaitDurable(last, std::chrono::milliseconds(2000));
+
+        AlarmJournal::Statistics stats = journal.GetStatistics();
+        Assert(durable && journal.GetDurableSequence() == 500, "Journal_WaitDurable",
+               "WaitDurable should return once the record is committed");
+        Assert(stats.commits < 50 && stats.averageBatchRecords > 10.0, "Journal_GroupCommit",
+               "Many appends should share few syncs (" + std::to_string(stats.commits) + " commits)");
+    }
+
+    void TestSynchronousCommit() {
+        std::remove(m_path.c_str());
+        AlarmJournal journal(MakeConfig(0));
+        journal.Open(m_path);
+
+        uint64_t sequence = journal.RecordAcknowledgment(301, "operator-3", 20000);
+        Assert(sequence == 1 && journal.GetDurableSequence() == 1 && journal.GetStatistics().commits == 1,
+               "Journal_SynchronousCommit", "A zero interval should make each append durable before returning");
+
+        std::string longActor(300, 'x');
+        Assert(journal.RecordAcknowledgment(301, longActor, 20001) == 0, "Journal_ActorLimit",
+               "An oversized actor should be refused");
+    }
+
+    void TestTornTail() {
+        std::remove(m_path.c_str());
+        {
+            AlarmJournal journal(MakeConfig(0));
+            journal.Open(m_path);
+            for (int i = 0; i < 5; ++i) {
+                journal.RecordAlarm(400 + i, true, 1.0, 30000 + i);
+            }
+        }
+
+        // Damage the last record's body, as a crash mid-write would
+        std::vector<JournalRecord> before;
+        AlarmJournal::Replay(m_path, before);
+        std::fstream file(m_path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(8 + 4 * 39 + 20);
+        file.put(static_cast<char>(0x5A));
+        file.close();
+
+        AlarmJournal journal(MakeConfig(0));
+        bool opened = journal.Open(m_path);
+        AlarmJournal::Statistics stats = journal.GetStatistics();
+        Assert(opened && before.size() == 5 && stats.recordsRecovered == 4 && stats.tornTailDiscarded,
+               "Journal_TornTail", "A record with a bad CRC should end the journal");
+
+        journal.RecordAlarm(499, true, 2.0, 40000);
+        journal.Close();
+        std::vector<JournalRecord> after;
+        AlarmJournal::Replay(m_path, after);
+        Assert(after.size() == 5 && after.back().alarmId == 499 && after.back().sequence == 5, "Journal_AppendAfterTorn",
+               "New records should overwrite the torn tail");
+    }
+
+    void TestStaleRecordsAfterTear() {
+        std::remove(m_path.c_str());
+        {
+            AlarmJournal journal(MakeConfig(0));
+            journal.Open(m_path);
+            for (int i = 0; i < 5; ++i) {
+                journal.RecordAlarm(450 + i, true, 1.0, 35000 + i);
+            }
+        }
+
+        // Tear the third record; records 4 and 5 stay intact behind it
+        std::fstream file(m_path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(8 + 2 * 39 + 20);
+        file.put(static_cast<char>(0x5A));
+        file.close();
+
+        {
+            AlarmJournal journal(MakeConfig(0));
+            journal.Open(m_path);
+            journal.RecordAlarm(499, false, 3.0, 36000);   // Same size as the torn record, sequence 3
+        }
+
+        std::vector<JournalRecord> records;
+        AlarmJournal::Replay(m_path, records);
+        Assert(records.size() == 3 && records.back().alarmId == 499, "Journal_StaleTailTruncated",
+               "Records past a torn tail must not reappear after new records overwrite it");
+    }
+
+    void TestCommitBatching() {
+        // Synchronous commit syncs once per append; group commit keeps the disk off the append path
+        const uint64_t records = 200;
+        uint64_t commits[2] = {0, 0};
+        int intervals[2] = {0, 1000};
+        for (int mode = 0; mode < 2; ++mode) {
+            std::remove(m_path.c_str());
+            AlarmJournal journal(MakeConfig(intervals[mode]));
+            journal.Open(m_path);
+            for (uint64_t i = 0; i < records; ++i) {
+                journal.RecordAlarm(500 + static_cast<int>(i % 20), i % 2 == 0, 1.0, 50000 + static_cast<int64_t>(i));
+            }
+            journal.Close();
+            commits[mode] = journal.GetStatistics().commits;
+        }
+
+        Assert(commits[0] == records && commits[1] < records / 10, "Journal_GroupCommitBatches",
+               "Group commit should share one sync among many appends (" + std::to_string(commits[1]) + " commits)");
+    }
+};
+
+// Function to run alarm journal tests
+void RunAlarmJournalTests() {
+    AlarmJournalTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
@@ -0,0 +1,160 @@
+#include "AnomalyDetector.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+
+using namespace Nuclear;
+
+class AnomalyDetectorTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+public:
+    AnomalyDetectorTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== AnomalyDetector Unit Tests ===" << std::endl;
+
+        TestSteadySignalQuiet();
+        TestSpikeDetection();
+        TestDriftDetection();
+        TestUnusableQualitySkipped();
+        TestConsistencyGroup();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All AnomalyDetector tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some AnomalyDetector tests failed!" << std::endl;
+        }
+    }
+
+private:
+    // Floating-point scan built from plain columns
+    static SensorSnapshot Scan(const std::vector<double>& values, const std::vector<SensorQuality>& quality) {
+        SensorSnapshot snapshot;
+        snapshot.Resize(values.size());
+        snapshot.values = values;
+        snapshot.quality = quality;
+        return snapshot;
+    }
+
+    // Deterministic small noise around a base value
+    static double Noisy(double base, int sample) {
+        return base + 0.2 * std::sin(sample * 1.7) + 0.1 * std::cos(sample * 0.3);
+    }
+
+    AnomalyFlags Feed(AnomalyDetectorBank& bank, double value, SensorQuality quality = QUALITY_GOOD) {
+        AnomalyFlags flags = ANOMALY_NONE;
+        bank.Process(Scan({value}, {quality}), &flags);
+        return flags;
+    }
+
+    void TestSteadySignalQuiet() {
+        AnomalyDetectorBank bank;
+        bank.Configure(1, AnomalyDetectorBank::DefaultConfig());
+
+        int flagged = 0;
+        for (int i = 0; i < 500; ++i) {
+            flagged += Feed(bank, Noisy(300.0, i)) != ANOMALY_NONE ? 1 : 0;
+        }
+        Assert(flagged == 0, "Steady_NoFalseAlarms", "Stationary noisy signal should not be flagged");
+    }
+
+    void TestSpikeDetection() {
+        AnomalyDetectorBank bank;
+        bank.Configure(1, AnomalyDetectorBank::DefaultConfig());
+        for (int i = 0; i < 100; ++i) {
+            Feed(bank, Noisy(300.0, i));
+        }
+
+        AnomalyFlags flags = Feed(bank, 340.0);
+        Assert((flags & ANOMALY_SPIKE) != 0, "Spike_Detected", "Single large excursion should be flagged as spike");
+
+        AnomalyFlags after = Feed(bank, Noisy(300.0, 101));
+        Assert((after & ANOMALY_SPIKE) == 0, "Spike_Recovers", "Normal sample after spike should not be flagged");
+    }
+
+    void TestDriftDetection() {
+        AnomalyDetectorBank bank;
+        bank.Configure(1, AnomalyDetectorBank::DefaultConfig());
+        for (int i = 0; i < 200; ++i) {
+            Feed(bank, Noisy(300.0, i));
+        }
+
+        bool driftHigh = false;
+        bool spiked = false;
+        for (int i = 0; i < 100 && !driftHigh; ++i) {
+            AnomalyFlags flags = Feed(bank, Noisy(300.0 + 0.02 * i, 200 + i));
+            driftHigh = (flags & ANOMALY_DRIFT_HIGH) != 0;
+            spiked = spiked || (flags & ANOMALY_SPIKE) != 0;
+        }
+        Assert(driftHigh, "Drift_Detected", "Slow upward ramp should trigger CUSUM drift");
+        Assert(!spiked, "Drift_NotSpike", "Slow ramp should not be reported as spikes");
+    }
+
+    void TestUnusableQualitySkipped() {
+        AnomalyDetectorBank bank;
+        bank.Configure(1, AnomalyDetectorBank::DefaultConfig());
+        for (int i = 0; i < 100; ++i) {
+            Feed(bank, Noisy(300.0, i));
+        }
+
+        AnomalyFlags flags = Feed(bank, -1.0, QUALITY_COMM_FAIL);
+        Assert(flags == ANOMALY_NONE, "Quality_CommFailSkipped", "Failed reads should not be analysed");
+
+        AnomalyFlags next = Feed(bank, Noisy(300.0, 101));
+        Assert(next == ANOMALY_NONE, "Quality_StateUntouched", "Skipped sample should not disturb detector state");
+    }
+
+    void TestConsistencyGroup() {
+        AnomalyDetectorBank bank;
+        bank.Configure(3, AnomalyDetectorBank::DefaultConfig());
+        bank.SetConsistencyGroups({{{0, 1, 2}, 2.0}});
+
+        std::vector<double> values = {300.1, 299.8, 306.0};
+        std::vector<SensorQuality> quality = {QUALITY_GOOD, QUALITY_GOOD, QUALITY_GOOD};
+        std::vector<AnomalyFlags> flags(3);
+
+        bank.Process(Scan(values, quality), flags.data());
+        Assert((flags[2] & ANOMALY_INCONSISTENT) != 0, "Consistency_OutlierFlagged", "Disagreeing redundant channel should be flagged");
+        Assert((flags[0] & ANOMALY_INCONSISTENT) == 0 && (flags[1] & ANOMALY_INCONSISTENT) == 0,
+               "Consistency_MajorityClean", "Agreeing channels should not be flagged");
+
+        // One member failed: two disagreeing survivors have no majority
+        values = {300.1, 299.8, 320.0};
+        quality = {QUALITY_GOOD, QUALITY_COMM_FAIL, QUALITY_GOOD};
+        flags.assign(3, ANOMALY_NONE);
+        bank.Process(Scan(values, quality), flags.data());
+        Assert((flags[0] & ANOMALY_INCONSISTENT) == 0 && (flags[2] & ANOMALY_INCONSISTENT) == 0,
+               "Consistency_TwoUsableSkipped", "Two usable members should not be judged against each other");
+    }
+};
+
+// Function to run anomaly detector tests
+void RunAnomalyDetectorTests() {
+    AnomalyDetectorTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
@@ -0,0 +1,226 @@
+#include "BurstCapture.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <memory>
+#include <fstream>
+#include <iterator>
+
+using namespace Nuclear;
+
+class BurstCaptureTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+public:
+    BurstCaptureTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== BurstCapture Unit Tests ===" << std::endl;
+
+        TestTriggerAndPreHistory();
+        TestCompletesAfterDuration();
+        TestNoRetriggerWhileOutside();
+        TestSaveLoadRoundTrip();
+        TestCreateRejectsInvalid();
+        TestStalePreHistoryDropped();
+        TestClockJumpEndsCapture();
+        TestLoadRejectsUnknownKind();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All BurstCapture tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some BurstCapture tests failed!" << std::endl;
+        }
+    }
+
+private:
+    BurstCapture::Config SmallConfig() {
+        BurstCapture::Config config;
+        config.sampleInterval = std::chrono::milliseconds(10);
+        config.duration = std::chrono::milliseconds(100);
+        config.preTriggerSamples = 3;
+        return config;
+    }
+
+    std::unique_ptr<BurstCapture> MakeCapture() {
+        return BurstCapture::Create({2001, 2002}, {SensorKind::Pressure, SensorKind::Pressure},
+                                    {BurstTrigger{2002, 1800.0, 2300.0}}, SmallConfig());
+    }
+
+    BurstCapture::State Feed(BurstCapture& capture, int64_t timeUs, double a, double b) {
+        double values[2] = {a, b};
+        SensorQuality quality[2] = {QUALITY_GOOD, QUALITY_GOOD};
+        return capture.Feed(timeUs, values, quality);
+    }
+
+    void TestTriggerAndPreHistory() {
+        std::unique_ptr<BurstCapture> capture = MakeCapture();
+        for (int i = 0; i < 5; ++i) {
+            Feed(*capture, i * 1000000, 2250.0, 2250.0 + i);
+        }
+        BurstCapture::State state = Feed(*capture, 5000000, 2250.0, 2350.0);
+
+        const BurstWaveform& w = capture->GetWaveform();
+        Assert(state == BurstCapture::State::Capturing, "Trigger_HighCrossing", "Crossing the high limit should start a burst");
+        Assert(w.preTriggerSamples == 3 && w.sampleCount == 4, "Trigger_PreHistory",
+               "Burst should start with the most recent pre-trigger scans");
+        Assert(w.offsetsUs[0] == -3000000 && w.offsetsUs[3] == 0 && w.values[3 * 2 + 1] == 2350.0f,
+               "Trigger_Offsets", "Offsets should be relative to the trigger sample");
+        Assert(w.triggerSensorId == 2002, "Trigger_Sensor", "Trigger sensor should be recorded");
+    }
+
+    void TestCompletesAfterDuration() {
+        std::unique_ptr<BurstCapture> capture = MakeCapture();
+        Feed(*capture, 0, 2250.0, 1700.0);
+
+        BurstCapture::State state = BurstCapture::State::Capturing;
+        int64_t time = 0;
+        while (state == BurstCapture::State::Capturing) {
+            time += 10000;
+            state = Feed(*capture, time, 2250.0, 1700.0);
+        }
+
+        Assert(state == BurstCapture::State::Complete && time == 100000, "Burst_Completes",
+               "Burst should complete once its duration has elapsed");
+
+        capture->Rearm();
+        Assert(capture->GetState() == BurstCapture::State::Armed && capture->GetWaveform().sampleCount == 0,
+               "Burst_Rearm", "Rearm should discard the waveform");
+    }
+
+    void TestNoRetriggerWhileOutside() {
+        std::unique_ptr<BurstCapture> capture = MakeCapture();
+        Feed(*capture, 0, 2250.0, 2400.0);
+        capture->Rearm();
+
+        BurstCapture::State parked = Feed(*capture, 1000000, 2250.0, 2400.0);
+        Feed(*capture, 2000000, 2250.0, 2250.0);
+        BurstCapture::State recrossed = Feed(*capture, 3000000, 2250.0, 2400.0);
+
+        Assert(parked == BurstCapture::State::Armed, "Retrigger_Parked", "Channel parked outside should not retrigger");
+        Assert(recrossed == BurstCapture::State::Capturing, "Retrigger_NewCrossing", "A new crossing should trigger");
+    }
+
+    void TestSaveLoadRoundTrip() {
+        std::unique_ptr<BurstCapture> capture = MakeCapture();
+        Feed(*capture, 0, 2250.0, 2250.0);
+        Feed(*capture, 1000000, 2251.5, 2310.25);
+        Feed(*capture, 1010000, 2252.0, 2320.0);
+
+        std::string path = "burst_capture_test.bin";
+        bool saved = capture->Save(path);
+
+        BurstWaveform loaded;
+        bool ok = BurstCapture::Load(path, loaded);
+        std::remove(path.c_str());
+
+        const BurstWaveform& w = capture->GetWaveform();
+        Assert(saved && ok, "Persist_RoundTrip", "Saved waveform should load");
+        Assert(ok && loaded.sampleCount == w.sampleCount && loaded.values == w.values && loaded.quality == w.quality &&
+               loaded.offsetsUs == w.offsetsUs && loaded.sensorIds == w.sensorIds &&
+               loaded.triggerTimeUs == w.triggerTimeUs && loaded.triggerValue == w.triggerValue,
+               "Persist_Identical", "Loaded waveform should match the capture");
+
+        BurstWaveform missing;
+        Assert(!BurstCapture::Load("does_not_exist.bin", missing), "Persist_Missing", "Missing file should fail to load");
+    }
+
+    void TestCreateRejectsInvalid() {
+        std::vector<BurstTrigger> triggers = {BurstTrigger{2002, 1800.0, 2300.0}};
+        Assert(!BurstCapture::Create({2001, 2002}, {SensorKind::Pressure}, triggers, SmallConfig()),
+               "Create_RejectsKindMismatch", "Kinds must match the group's channels");
+
+        std::vector<int> huge(BurstCapture::MAX_CHANNELS + 1);
+        std::vector<SensorKind> hugeKinds(huge.size(), SensorKind::Pressure);
+        Assert(!BurstCapture::Create(huge, hugeKinds, triggers, SmallConfig()), "Create_RejectsTooManyChannels",
+               "Groups too large for the file header should be rejected");
+
+        BurstCapture::Config longBurst = SmallConfig();
+        longBurst.duration = std::chrono::hours(1);
+        Assert(!BurstCapture::Create({2001, 2002}, {SensorKind::Pressure, SensorKind::Pressure}, triggers, longBurst),
+               "Create_RejectsLongDuration", "Durations beyond the int32 offset range should be rejected");
+    }
+
+    void TestStalePreHistoryDropped() {
+        std::unique_ptr<BurstCapture> capture = MakeCapture();
+
+        // A scan from an hour ago cannot be expressed as an int32 offset
+        Feed(*capture, 0, 2250.0, 2250.0);
+        Feed(*capture, 3600000000LL, 2250.0, 2250.0);
+        Feed(*capture, 3601000000LL, 2250.0, 2350.0);
+
+        const BurstWaveform& w = capture->GetWaveform();
+        Assert(w.preTriggerSamples == 1 && w.sampleCount == 2 && w.offsetsUs[0] == -1000000 &&
+               w.droppedSamples == 1, "Trigger_StalePreHistoryDropped",
+               "Pre-trigger samples beyond the offset range should be left out and counted");
+    }
+
+    void TestClockJumpEndsCapture() {
+        std::unique_ptr<BurstCapture> capture = MakeCapture();
+        Feed(*capture, 0, 2250.0, 2350.0);
+        Feed(*capture, 10000, 2250.0, 2350.0);
+
+        // A sample past the int32 offset range cannot be stored; the burst ends instead of skipping it
+        BurstCapture::State state = Feed(*capture, 3600000000LL, 2250.0, 2350.0);
+        const BurstWaveform& w = capture->GetWaveform();
+        Assert(state == BurstCapture::State::Complete && w.sampleCount == 2 && w.droppedSamples == 1,
+               "Burst_ClockJumpCompletes", "An unstorable sample should end the capture and be counted");
+
+        capture->Rearm();
+        Assert(capture->GetWaveform().droppedSamples == 0, "Burst_RearmClearsDrops", "Rearm should reset the drop count");
+    }
+
+    void TestLoadRejectsUnknownKind() {
+        std::unique_ptr<BurstCapture> capture = MakeCapture();
+        Feed(*capture, 0, 2250.0, 2350.0);
+
+        std::string path = "burst_capture_kind_test.bin";
+        capture->Save(path);
+        std::vector<char> bytes;
+        {
+            std::ifstream in(path, std::ios::binary);
+            bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+        // Header is 36 bytes followed by two u32 sensor IDs; the first kind byte follows
+        bytes[44] = static_cast<char>(0xEE);
+        {
+            std::ofstream out(path, std::ios::binary);
+            out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        }
+
+        BurstWaveform loaded;
+        bool ok = BurstCapture::Load(path, loaded);
+        std::remove(path.c_str());
+        Assert(!ok, "Persist_RejectsUnknownKind", "A file naming an unknown sensor kind should not load");
+    }
+};
+
+// Function to run burst capture tests
+void RunBurstCaptureTests() {
+    BurstCaptureTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
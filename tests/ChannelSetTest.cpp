@@ -0,0 +1,169 @@
+#include "ChannelSet.h"
+#include <iostream>
+#include <vector>
+#include <string>
+
+using namespace Nuclear;
+
+class ChannelSetTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+public:
+    ChannelSetTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== ChannelSet Unit Tests ===" << std::endl;
+
+        TestCreate();
+        TestCreateRejectsMismatch();
+        TestCreateRejectsDuplicatesAndUnknownKinds();
+        TestCatalogVersioning();
+        TestCatalogRejectsMismatch();
+        TestScaling();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All ChannelSet tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some ChannelSet tests failed!" << std::endl;
+        }
+    }
+
+private:
+    void TestCreate() {
+        auto channels = ChannelSet::Create(3, {101, 205, 310}, {SensorKind::Temperature, SensorKind::Pressure,
+                                                                 SensorKind::Radiation});
+        size_t channel = 0;
+        Assert(channels && channels->GetVersion() == 3 && channels->Size() == 3 &&
+               channels->FindChannel(205, channel) && channel == 1 && !channels->FindChannel(999, channel),
+               "ChannelSet_Create", "Sensors should map to their channel index");
+
+        Assert(channels && channels->Matches({101, 205, 310}, {SensorKind::Temperature, SensorKind::Pressure,
+                                                                SensorKind::Radiation}) &&
+               !channels->Matches({101, 205, 310}, {SensorKind::Temperature, SensorKind::Temperature,
+                                                     SensorKind::Radiation}) &&
+               !channels->Matches({101, 205}, {SensorKind::Temperature, SensorKind::Pressure}),
+               "ChannelSet_Matches", "Matches should compare both IDs and kinds");
+    }
+
+    void TestCreateRejectsMismatch() {
+        Assert(!ChannelSet::Create(1, {101, 205}, {SensorKind::Temperature}) &&
+               !ChannelSet::Create(1, {101}, {SensorKind::Temperature, SensorKind::Pressure}),
+               "ChannelSet_RejectsMismatch", "A kind list of a different length should be rejected");
+    }
+
+    void TestCreateRejectsDuplicatesAndUnknownKinds() {
+        Assert(!ChannelSet::Create(1, {101, 205, 101}, {SensorKind::Temperature, SensorKind::Pressure,
+                                                        SensorKind::Temperature}),
+               "ChannelSet_RejectsDuplicateId", "A sensor ID listed twice should be rejected");
+        Assert(!ChannelSet::Create(1, {101, 205}, {SensorKind::Temperature, static_cast<SensorKind>(7)}),
+               "ChannelSet_RejectsUnknownKind", "A kind outside SensorKind should be rejected");
+    }
+
+    void TestCatalogVersioning() {
+        SensorCatalog catalog;
+        Assert(catalog.GetVersion() == 0 && catalog.Current()->Size() == 0,
+               "Catalog_Empty", "A new catalog should publish an empty set at version 0");
+
+        bool published = catalog.Update({101, 205}, {SensorKind::Temperature, SensorKind::Pressure});
+        auto first = catalog.Current();
+        Assert(published && catalog.GetVersion() == 1 && first->GetVersion() == 1 && first->Size() == 2,
+               "Catalog_Publish", "A changed channel list should publish a new version");
+
+        published = catalog.Update({101, 205}, {SensorKind::Temperature, SensorKind::Pressure});
+        Assert(!published && catalog.GetVersion() == 1 && catalog.Current() == first,
+               "Catalog_Unchanged", "An identical channel list should keep the current set");
+
+        published = catalog.Update({101, 205}, {SensorKind::Temperature, SensorKind::Radiation});
+        Assert(published && catalog.GetVersion() == 2 && catalog.Current()->GetVersion() == 2 &&
+               first->GetVersion() == 1 && first->GetKinds()[1] == SensorKind::Pressure,
+               "Catalog_KindChange", "A kind change should publish a new version without touching the old set");
+    }
+
+    void TestCatalogRejectsMismatch() {
+        SensorCatalog catalog;
+        catalog.Update({101, 205}, {SensorKind::Temperature, SensorKind::Pressure});
+        auto current = catalog.Current();
+
+        bool published = catalog.Update({101, 205, 310}, {SensorKind::Temperature, SensorKind::Pressure});
+        Assert(!published && catalog.GetVersion() == 1 && catalog.Current() == current,
+               "Catalog_RejectsMismatch", "A kind list of a different length should not be published");
+    }
+
+    void TestScaling() {
+        auto floating = ChannelSet::Create(1, {101, 205}, {SensorKind::Temperature, SensorKind::Pressure},
+                                           {FixedPointScale(), FixedPointScale()});
+        auto scaled = ChannelSet::Create(1, {101, 205}, {SensorKind::Temperature, SensorKind::Pressure},
+                                         {FixedPointScale(), FixedPointScale{0.5, 0.0}});
+        Assert(floating && !floating->GetScales() && scaled && scaled->GetScales() &&
+               !ChannelSet::Create(1, {101, 205}, {SensorKind::Temperature, SensorKind::Pressure},
+                                   {FixedPointScale{-0.5, 0.0}, FixedPointScale()}) &&
+               !ChannelSet::Create(1, {101, 205}, {SensorKind::Temperature, SensorKind::Pressure},
+                                   {FixedPointScale()}),
+               "ChannelSet_Scaling", "Scaling should be kept only when a channel is fixed point, and validated");
+
+        SensorCatalog catalog;
+        catalog.Update({101, 205}, {SensorKind::Temperature, SensorKind::Pressure});
+        bool rescaled = catalog.Update({101, 205}, {SensorKind::Temperature, SensorKind::Pressure},
+                                       {FixedPointScale(), FixedPointScale{0.5, 0.0}});
+        bool unchanged = !catalog.Update({101, 205}, {SensorKind::Temperature, SensorKind::Pressure},
+                                         {FixedPointScale(), FixedPointScale{0.5, 0.0}});
+        Assert(rescaled && unchanged && catalog.GetVersion() == 2, "Catalog_ScaleChange",
+               "A scale change should publish a new version");
+
+        // Every scan read through the set shares its scaling
+        auto current = catalog.Current();
+        SensorSnapshot first;
+        SensorSnapshot second;
+        first.Resize(2);
+        second.Resize(2);
+        first.SetScaling(current->GetScales());
+        second.SetScaling(current->GetScales());
+        first.counts[1] = 10;
+        Assert(first.scales == second.scales && first.IsFixedPoint(1) && !first.IsFixedPoint(0) &&
+               first.counts.size() == 2 && first.EngineeringValue(1) == 5.0 && first.SameScaling(second),
+               "Snapshot_SharedScaling", "Snapshots should share the layout's scaling and convert through it");
+
+        // A layout that is fixed point throughout carries no values column
+        auto fixed = ChannelSet::Create(1, {101, 205}, {SensorKind::Temperature, SensorKind::Pressure},
+                                        {FixedPointScale{0.25, 0.0}, FixedPointScale{0.5, 0.0}});
+        SensorSnapshot counted;
+        counted.Resize(2);
+        counted.SetScaling(fixed->GetScales());
+        counted.SetEngineeringValue(0, 2.5);
+        counted.AppendChannel(900, SensorKind::Temperature, 7.0, QUALITY_GOOD);
+        bool appended = counted.Size() == 3 && counted.values.size() == 3 && counted.EngineeringValue(2) == 7.0;
+        counted.Resize(2);
+        Assert(counted.values.empty() && counted.counts[0] == 10 && counted.EngineeringValue(0) == 2.5 && appended,
+               "Snapshot_FixedDropsValues",
+               "An all fixed-point layout should keep counts only and restore values for appended channels");
+    }
+};
+
+// Function to run channel set tests
+void RunChannelSetTests() {
+    ChannelSetTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
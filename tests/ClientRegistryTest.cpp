@@ -0,0 +1,202 @@
+#include "ClientRegistry.h"
+#include <iostream>
+#include <vector>
+#include <string>
+
+using namespace Nuclear;
+
+class ClientRegistryTest {
+private:
+    struct TestClient {
+        SOCKET socket;
+        std::string clientId;
+        bool authenticated;
+    };
+
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+    std::vector<SOCKET> m_closed;       // Test sockets are plain numbers; record closes instead
+
+public:
+    ClientRegistryTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== ClientRegistry Unit Tests ===" << std::endl;
+
+        TestSlotMapStableHandles();
+        TestSlotMapStaleHandle();
+        TestLookupById();
+        TestDuplicateId();
+        TestBroadcastListSnapshot();
+        TestSocketOutlivesSnapshot();
+        TestManyClients();
+        TestMassDisconnectPublishesOnce();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All ClientRegistry tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some ClientRegistry tests failed!" << std::endl;
+        }
+    }
+
+private:
+    ClientRegistry<TestClient>::SocketCloser RecordClose() {
+        return [this](SOCKET socket) { m_closed.push_back(socket); };
+    }
+
+    TestClient MakeClient(int socket, const std::string& clientId, bool authenticated = true) {
+        return TestClient{static_cast<SOCKET>(socket), clientId, authenticated};
+    }
+
+    void TestSlotMapStableHandles() {
+        SlotMap<int> slotMap;
+        SlotHandle a = slotMap.Insert(1);
+        SlotHandle b = slotMap.Insert(2);
+        SlotHandle c = slotMap.Insert(3);
+
+        // Erasing from the front swaps the last value into the hole
+        slotMap.Erase(a);
+
+        Assert(slotMap.Size() == 2, "SlotMap_Size", "Erase should shrink map");
+        Assert(slotMap.Get(b) && *slotMap.Get(b) == 2, "SlotMap_HandleB", "Handle should survive other erasures");
+        Assert(slotMap.Get(c) && *slotMap.Get(c) == 3, "SlotMap_HandleC", "Moved value should stay reachable by handle");
+    }
+
+    void TestSlotMapStaleHandle() {
+        SlotMap<int> slotMap;
+        SlotHandle first = slotMap.Insert(10);
+        slotMap.Erase(first);
+        SlotHandle second = slotMap.Insert(20);
+
+        Assert(first.index == second.index, "SlotMap_SlotReused", "Freed slot should be reused");
+        Assert(slotMap.Get(first) == nullptr, "SlotMap_StaleHandle", "Stale handle should not resolve to new value");
+        Assert(!slotMap.Erase(first), "SlotMap_StaleErase", "Stale handle should not erase new value");
+    }
+
+    void TestLookupById() {
+        ClientRegistry<TestClient> registry(0, RecordClose());
+        registry.Add(MakeClient(5, "client-a"));
+        SlotHandle handleB = registry.Add(MakeClient(6, "client-b"));
+
+        Assert(registry.Find("client-b") != nullptr && registry.Find("client-b")->socket == 6,
+               "Registry_FindById", "Client should be found by ID");
+        Assert(registry.FindHandle("client-b") == handleB, "Registry_FindHandle", "Handle lookup should match Add result");
+
+        Assert(registry.Remove("client-a"), "Registry_Remove", "Registered client should be removed");
+        Assert(registry.Find("client-a") == nullptr, "Registry_Removed", "Removed client should not be found");
+        Assert(registry.Get(handleB) != nullptr, "Registry_HandleStable", "Other handles should survive removal");
+    }
+
+    void TestDuplicateId() {
+        ClientRegistry<TestClient> registry(0, RecordClose());
+        registry.Add(MakeClient(5, "client-a"));
+        SlotHandle duplicate = registry.Add(MakeClient(7, "client-a"));
+
+        Assert(!duplicate.IsValid(), "Registry_DuplicateRejected", "Duplicate client ID should be rejected");
+        Assert(registry.Size() == 1, "Registry_DuplicateSize", "Rejected client should not be counted");
+    }
+
+    void TestBroadcastListSnapshot() {
+        ClientRegistry<TestClient> registry(0, RecordClose());
+        registry.Add(MakeClient(5, "client-a"));
+        registry.Add(MakeClient(6, "pending", false));
+        registry.PublishPending();
+
+        auto snapshot = registry.GetBroadcastList();
+        Assert(snapshot->size() == 1, "Broadcast_AuthenticatedOnly", "Unauthenticated clients should not receive broadcasts");
+
+        registry.Find("pending")->authenticated = true;
+        registry.Publish();
+
+        Assert(snapshot->size() == 1, "Broadcast_SnapshotImmutable", "Held snapshot should not change under the reader");
+        Assert(registry.GetBroadcastList()->size() == 2, "Broadcast_Republished", "New snapshot should include newly authenticated client");
+    }
+
+    void TestSocketOutlivesSnapshot() {
+        m_closed.clear();
+        ClientRegistry<TestClient> registry(0, RecordClose());
+        registry.Add(MakeClient(5, "client-a"));
+        registry.Add(MakeClient(6, "client-b"));
+        registry.PublishPending();
+
+        auto snapshot = registry.GetBroadcastList();
+        registry.Remove("client-a");
+        registry.PublishPending();
+        bool heldOpen = m_closed.empty() && registry.GetBroadcastList()->size() == 1;
+        snapshot.reset();
+        Assert(heldOpen && m_closed.size() == 1 && m_closed[0] == 5, "Broadcast_SocketOutlivesSnapshot",
+               "A removed client's socket should close only after the last snapshot listing it is released");
+
+        registry.Find("client-b")->socket = 9;
+        registry.Publish();
+        Assert(m_closed.size() == 2 && m_closed[1] == 6 && registry.GetBroadcastList()->at(0).socket == 9,
+               "Broadcast_SocketReplaced", "A socket replaced in place should be closed once unreferenced");
+    }
+
+    void TestManyClients() {
+        ClientRegistry<TestClient> registry(4096, RecordClose());
+        for (int i = 0; i < 4000; ++i) {
+            registry.Add(MakeClient(i + 100, "client-" + std::to_string(i)));
+        }
+        for (int i = 0; i < 4000; i += 2) {
+            registry.Remove("client-" + std::to_string(i));
+        }
+
+        bool allOddPresent = true;
+        for (int i = 1; i < 4000; i += 2) {
+            TestClient* client = registry.Find("client-" + std::to_string(i));
+            allOddPresent = allOddPresent && client != nullptr && client->socket == static_cast<SOCKET>(i + 100);
+        }
+
+        Assert(registry.Size() == 2000, "ManyClients_Count", "Half of the clients should remain");
+        Assert(allOddPresent, "ManyClients_Lookup", "Remaining clients should keep their sockets");
+    }
+
+    void TestMassDisconnectPublishesOnce() {
+        m_closed.clear();
+        ClientRegistry<TestClient> registry(0, RecordClose());
+        for (int i = 0; i < 100; ++i) {
+            registry.Add(MakeClient(i + 100, "client-" + std::to_string(i)));
+        }
+        registry.PublishPending();
+
+        auto before = registry.GetBroadcastList();
+        for (int i = 0; i < 100; ++i) {
+            registry.Remove("client-" + std::to_string(i));
+        }
+        bool deferred = registry.GetBroadcastList() == before && registry.Size() == 0 && m_closed.empty();
+        before.reset();
+
+        bool published = registry.PublishPending();
+        Assert(deferred && published && registry.GetBroadcastList()->empty() && m_closed.size() == 100,
+               "Registry_BatchedPublish", "Removals should be published together on the next PublishPending");
+        Assert(!registry.PublishPending(), "Registry_NothingPending", "An unchanged registry should not republish");
+    }
+};
+
+// Function to run client registry tests
+void RunClientRegistryTests() {
+    ClientRegistryTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include "Clock.h"
+#include <iostream>
+#include <string>
+
+using namespace Nuclear;
+
+class ClockTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+public:
+    ClockTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== Clock Unit Tests ===" << std::endl;
+
+        TestVirtualClockAdvance();
+        TestVirtualClockSetSystemTime();
+        TestCycleContext();
+        TestFormatTimestamp();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All Clock tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some Clock tests failed!" << std::endl;
+        }
+    }
+
+private:
+    static std::chrono::system_clock::time_point At(int64_t milliseconds) {
+        return std::chrono::system_clock::time_point(std::chrono::milliseconds(milliseconds));
+    }
+
+    void TestVirtualClockAdvance() {
+        VirtualClock clock(At(1000));
+        auto steadyStart = clock.SteadyNow();
+
+        Assert(clock.SteadyNow() == steadyStart && clock.SystemNow() == At(1000), "Virtual_Frozen",
+               "Virtual time should not move on its own");
+
+        clock.Advance(std::chrono::milliseconds(250));
+        Assert(clock.SystemNow() == At(1250) && clock.SteadyNow() - steadyStart == std::chrono::milliseconds(250),
+               "Virtual_Advance", "Advance should move both clocks by the same amount");
+
+        clock.Advance(std::chrono::milliseconds(-100));
+        Assert(clock.SystemNow() == At(1250), "Virtual_NegativeIgnored", "Negative advances should be ignored");
+    }
+
+    void TestVirtualClockSetSystemTime() {
+        VirtualClock clock(At(5000));
+        auto steadyStart = clock.SteadyNow();
+
+        clock.SetSystemTime(At(7000));
+        Assert(clock.SteadyNow() - steadyStart == std::chrono::seconds(2), "Virtual_SetForward",
+               "Setting a later wall time should advance steady time by the difference");
+
+        clock.SetSystemTime(At(6000));
+        Assert(clock.SystemNow() == At(6000) && clock.SteadyNow() - steadyStart == std::chrono::seconds(2),
+               "Virtual_SetBackward", "Steady time should not move backwards with wall time");
+    }
+
+    void TestCycleContext() {
+        VirtualClock clock(At(1700000000123));
+        CycleContext cycle = CycleContext::Capture(clock, 42);
+
+        Assert(cycle.cycleNumber == 42 && cycle.wallTime == clock.SystemNow() && cycle.steadyTime == clock.SteadyNow(),
+               "Cycle_Capture", "Context should hold the clock values at capture");
+        Assert(cycle.timestamp == "2023-11-14T22:13:20.123Z", "Cycle_Timestamp",
+               "Context timestamp should be formatted at capture, got " + cycle.timestamp);
+    }
+
+    void TestFormatTimestamp() {
+        Assert(FormatTimestamp(At(0)) == "1970-01-01T00:00:00.000Z", "Format_Epoch", "Epoch should format as UTC");
+        Assert(FormatTimestamp(At(-1)) == "1969-12-31T23:59:59.999Z", "Format_BeforeEpoch",
+               "Milliseconds should borrow from seconds before the epoch");
+    }
+};
+
+// Function to run clock tests
+void RunClockTests() {
+    ClockTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
@@ -0,0 +1,180 @@
+#include "DerivedChannelEngine.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+
+using namespace Nuclear;
+
+class DerivedChannelEngineTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+public:
+    DerivedChannelEngineTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== DerivedChannelEngine Unit Tests ===" << std::endl;
+
+        TestArithmeticAndPrecedence();
+        TestDependencyOrdering();
+        TestQualityPropagation();
+        TestRate();
+        TestRegisteredFunction();
+        TestCompileErrors();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All DerivedChannelEngine tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some DerivedChannelEngine tests failed!" << std::endl;
+        }
+    }
+
+private:
+    // Floating-point scan built from plain columns
+    static SensorSnapshot Scan(const std::vector<double>& values, const std::vector<SensorQuality>& quality) {
+        SensorSnapshot snapshot;
+        snapshot.Resize(values.size());
+        snapshot.values = values;
+        snapshot.quality = quality;
+        return snapshot;
+    }
+
+    DerivedChannelDefinition Define(int sensorId, const std::string& name, const std::string& expression) {
+        return DerivedChannelDefinition{sensorId, name, SensorKind::Temperature, expression};
+    }
+
+    void TestArithmeticAndPrecedence() {
+        DerivedChannelEngine engine;
+        std::string error;
+        bool ok = engine.Compile({Define(9001, "deltaT", "sensor(1002) - sensor(1001)"),
+                                  Define(9002, "mix", "-(2 + sensor(1001)) * 3 / 2 + max(1, 4)")},
+                                 {1001, 1002}, error);
+        Assert(ok, "Compile_Valid", "Valid expressions should compile: " + error);
+
+        std::vector<double> values = {290.0, 325.5};
+        std::vector<SensorQuality> quality(2, QUALITY_GOOD);
+        engine.Evaluate(Scan(values, quality), 0.0);
+
+        Assert(engine.GetValues()[0] == 35.5, "Evaluate_DeltaT", "Delta-T should be outlet minus inlet");
+        Assert(engine.GetValues()[1] == -(2.0 + 290.0) * 3.0 / 2.0 + 4.0, "Evaluate_Precedence",
+               "Operators should follow standard precedence");
+    }
+
+    void TestDependencyOrdering() {
+        DerivedChannelEngine engine;
+        std::string error;
+        // Defined before the channel it depends on
+        bool ok = engine.Compile({Define(9002, "doubled", "deltaT * 2"),
+                                  Define(9001, "deltaT", "sensor(2) - sensor(1)")},
+                                 {1, 2}, error);
+
+        std::vector<double> values = {10.0, 15.0};
+        std::vector<SensorQuality> quality(2, QUALITY_GOOD);
+        engine.Evaluate(Scan(values, quality), 0.0);
+
+        Assert(ok && engine.GetDefinitions()[0].name == "deltaT", "Order_DependencyFirst",
+               "Dependencies should be evaluated first");
+        Assert(engine.GetValues()[1] == 10.0, "Order_UsesCurrentScan", "Dependent channel should see this scan's value");
+    }
+
+    void TestQualityPropagation() {
+        DerivedChannelEngine engine;
+        std::string error;
+        engine.Compile({Define(9001, "sum", "sensor(1) + sensor(2)"),
+                        Define(9002, "ratio", "sensor(1) / sensor(3)")},
+                       {1, 2, 3}, error);
+
+        std::vector<double> values = {5.0, -1.0, 0.0};
+        std::vector<SensorQuality> quality = {QUALITY_GOOD, QUALITY_COMM_FAIL, QUALITY_GOOD};
+        engine.Evaluate(Scan(values, quality), 0.0);
+
+        Assert(engine.GetQuality()[0] == QUALITY_COMM_FAIL, "Quality_Union", "Bad input should flag the derived value");
+        Assert((engine.GetQuality()[1] & QUALITY_OUT_OF_RANGE) != 0, "Quality_NonFinite",
+               "Division by zero should flag OUT_OF_RANGE");
+
+        SensorSnapshot snapshot;
+        engine.AppendTo(snapshot);
+        Assert(snapshot.Size() == 2 && snapshot.sensorIds[0] == 9001, "AppendTo_Snapshot",
+               "Derived channels should append to the snapshot");
+    }
+
+    void TestRate() {
+        DerivedChannelEngine engine;
+        std::string error;
+        engine.Compile({Define(9001, "heatup", "rate(sensor(1))")}, {1}, error);
+
+        std::vector<double> values = {100.0};
+        std::vector<SensorQuality> quality(1, QUALITY_GOOD);
+        engine.Evaluate(Scan(values, quality), 10.0);
+        Assert(engine.GetValues()[0] == 0.0 && engine.GetQuality()[0] == QUALITY_SUBSTITUTED, "Rate_FirstSample",
+               "First sample has no history and should be SUBSTITUTED");
+
+        values[0] = 106.0;
+        engine.Evaluate(Scan(values, quality), 12.0);
+        Assert(engine.GetValues()[0] == 3.0 && engine.GetQuality()[0] == QUALITY_GOOD, "Rate_PerSecond",
+               "Rate should be change per second");
+    }
+
+    void TestRegisteredFunction() {
+        DerivedChannelEngine engine;
+        bool registered = engine.RegisterFunction("half", +[](double x) { return x / 2.0; });
+        bool duplicate = engine.RegisterFunction("abs", +[](double x) { return x; });
+
+        std::string error;
+        bool ok = engine.Compile({Define(9001, "h", "half(sqrt(sensor(1)))")}, {1}, error);
+
+        std::vector<double> values = {16.0};
+        std::vector<SensorQuality> quality(1, QUALITY_GOOD);
+        engine.Evaluate(Scan(values, quality), 0.0);
+
+        Assert(registered && !duplicate, "Register_Function", "New names register, existing names are rejected");
+        Assert(ok && engine.GetValues()[0] == 2.0, "Register_Evaluate", "Registered function should be callable");
+    }
+
+    void TestCompileErrors() {
+        DerivedChannelEngine engine;
+        std::string error;
+
+        Assert(!engine.Compile({Define(9001, "a", "sensor(99)")}, {1}, error) && !error.empty(),
+               "Error_UnknownSensor", "Unknown sensor should fail to compile");
+        Assert(!engine.Compile({Define(9001, "a", "foo(1)")}, {1}, error), "Error_UnknownFunction",
+               "Unknown function should fail to compile");
+        Assert(!engine.Compile({Define(9001, "a", "(1 + 2")}, {1}, error), "Error_Syntax",
+               "Unbalanced parentheses should fail to compile");
+        Assert(!engine.Compile({Define(9001, "a", "b + 1"), Define(9002, "b", "a * 2")}, {1}, error), "Error_Cycle",
+               "Circular references should fail to compile");
+        Assert(!engine.Compile({Define(1, "a", "sensor(1) * 2")}, {1}, error), "Error_IdTakenByRawSensor",
+               "A derived ID equal to a raw sensor ID should fail to compile");
+        Assert(!engine.Compile({Define(9001, "a", "sensor(1)"), Define(9001, "b", "sensor(1)")}, {1}, error),
+               "Error_DuplicateDerivedId", "Two derived channels with one ID should fail to compile");
+    }
+};
+
+// Function to run derived channel engine tests
+void RunDerivedChannelEngineTests() {
+    DerivedChannelEngineTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
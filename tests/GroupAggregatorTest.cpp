@@ -0,0 +1,167 @@
+#include "GroupAggregator.h"
+#include <iostream>
+#include <vector>
+#include <string>
+
+using namespace Nuclear;
+
+class GroupAggregatorTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+public:
+    GroupAggregatorTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== GroupAggregator Unit Tests ===" << std::endl;
+
+        TestNestedReduction();
+        TestUnusableSkipped();
+        TestDoubleListingRejected();
+        TestChannelOutOfRangeRejected();
+        TestHierarchyRejected();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All GroupAggregator tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some GroupAggregator tests failed!" << std::endl;
+        }
+    }
+
+private:
+    // Floating-point scan built from plain columns
+    static SensorSnapshot Scan(const std::vector<double>& values, const std::vector<SensorQuality>& quality) {
+        SensorSnapshot snapshot;
+        snapshot.Resize(values.size());
+        snapshot.values = values;
+        snapshot.quality = quality;
+        return snapshot;
+    }
+
+    // Plant (1) <- Loop A (2) <- SG-1 (3); channels 0..4
+    std::vector<GroupDefinition> PlantGroups() {
+        return {
+            {3, "SG-1", 2, {2, 3}},
+            {1, "Plant", -1, {4}},
+            {2, "Loop A", 1, {0, 1}},
+        };
+    }
+
+    std::vector<SensorKind> Kinds() {
+        return {SensorKind::Temperature, SensorKind::Pressure, SensorKind::Temperature,
+                SensorKind::Temperature, SensorKind::Radiation};
+    }
+
+    const GroupAggregate* Find(const std::vector<GroupAggregate>& results, int groupId) {
+        for (const auto& result : results) {
+            if (result.groupId == groupId) {
+                return &result;
+            }
+        }
+        return nullptr;
+    }
+
+    void TestNestedReduction() {
+        GroupAggregator aggregator;
+        bool configured = aggregator.Configure(PlantGroups(), Kinds());
+
+        std::vector<double> values = {300.0, 15.5, 280.0, 290.0, 0.2};
+        std::vector<SensorQuality> quality(5, QUALITY_GOOD);
+        const auto& results = aggregator.Aggregate(Scan(values, quality));
+
+        const GroupAggregate* sg = Find(results, 3);
+        const GroupAggregate* loop = Find(results, 2);
+        const GroupAggregate* plant = Find(results, 1);
+        Assert(configured && aggregator.GetGroupCount() == 3 && sg && loop && plant,
+               "Nested_Configured", "A three-level hierarchy should configure");
+        if (!sg || !loop || !plant) {
+            return;
+        }
+
+        Assert(sg->temperature.count == 2 && sg->temperature.sum == 570.0 && sg->pressure.count == 0,
+               "Nested_Leaf", "A leaf group should reduce only its own channels");
+        Assert(loop->temperature.count == 3 && loop->temperature.min == 280.0 && loop->temperature.max == 300.0 &&
+               loop->pressure.count == 1 && loop->pressure.sum == 15.5,
+               "Nested_Child", "A group should include its children's channels");
+        Assert(plant->temperature.count == 3 && plant->pressure.count == 1 && plant->radiation.count == 1 &&
+               plant->radiation.sum == 0.2, "Nested_Root", "The root should include every descendant exactly once");
+    }
+
+    void TestUnusableSkipped() {
+        GroupAggregator aggregator;
+        aggregator.Configure(PlantGroups(), Kinds());
+
+        std::vector<double> values = {300.0, 15.5, 999.0, 290.0, 0.2};
+        std::vector<SensorQuality> quality = {QUALITY_GOOD, QUALITY_GOOD, QUALITY_COMM_FAIL, QUALITY_GOOD, QUALITY_GOOD};
+        const GroupAggregate* plant = Find(aggregator.Aggregate(Scan(values, quality)), 1);
+
+        Assert(plant && plant->temperature.count == 2 && plant->temperature.max == 300.0,
+               "Nested_UnusableSkipped", "Unusable channels should not contribute");
+    }
+
+    void TestDoubleListingRejected() {
+        GroupAggregator aggregator;
+        aggregator.Configure(PlantGroups(), Kinds());
+
+        auto groups = PlantGroups();
+        groups[1].channels.push_back(2);   // Plant also lists SG-1's channel
+        Assert(!aggregator.Configure(groups, Kinds()) && aggregator.GetGroupCount() == 3,
+               "Configure_RejectsAncestorListing", "A channel in both a group and its ancestor should be rejected");
+
+        groups = PlantGroups();
+        groups.push_back({4, "SG-2", 2, {3}});   // Sibling of SG-1 sharing a channel
+        Assert(!aggregator.Configure(groups, Kinds()), "Configure_RejectsSiblingListing",
+               "A channel in two groups of one tree should be rejected");
+
+        groups = PlantGroups();
+        groups.push_back({9, "Containment", -1, {4}});   // Separate tree
+        Assert(aggregator.Configure(groups, Kinds()), "Configure_AllowsSeparateTrees",
+               "Independent trees may share channels");
+    }
+
+    void TestChannelOutOfRangeRejected() {
+        GroupAggregator aggregator;
+        auto groups = PlantGroups();
+        groups[0].channels.push_back(5);
+        Assert(!aggregator.Configure(groups, Kinds()), "Configure_RejectsOutOfRange",
+               "A channel index beyond the kinds list should be rejected");
+    }
+
+    void TestHierarchyRejected() {
+        GroupAggregator aggregator;
+        Assert(!aggregator.Configure({{1, "A", 2, {0}}, {2, "B", 1, {1}}}, Kinds()), "Configure_RejectsCycle",
+               "A cyclic hierarchy should be rejected");
+        Assert(!aggregator.Configure({{1, "A", 7, {0}}}, Kinds()), "Configure_RejectsUnknownParent",
+               "An unknown parent should be rejected");
+        Assert(!aggregator.Configure({{1, "A", -1, {0}}, {1, "B", -1, {1}}}, Kinds()), "Configure_RejectsDuplicateId",
+               "Duplicate group IDs should be rejected");
+    }
+};
+
+// Function to run group aggregator tests
+void RunGroupAggregatorTests() {
+    GroupAggregatorTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
@@ -0,0 +1,249 @@
+#include "HistorianExporter.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cmath>
+
+using namespace Nuclear;
+
+class HistorianExporterTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+    std::string m_recordingPath;
+    std::string m_exportPath;
+
+public:
+    HistorianExporterTest()
+        : testsRun(0), testsPassed(0), testsFailed(0), m_recordingPath("historian_export_test.npsr"),
+          m_exportPath("historian_export_test.out") {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== HistorianExporter Unit Tests ===" << std::endl;
+
+        if (Assert(WriteRecording(1000, 64), "Export_Setup", "Test recording should be written")) {
+            TestCsvExport();
+            TestCsvSelectionAndRange();
+            TestColumnarExport();
+            TestUnknownSensor();
+        }
+        TestParseTime();
+
+        std::remove(m_recordingPath.c_str());
+        std::remove(m_exportPath.c_str());
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All HistorianExporter tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some HistorianExporter tests failed!" << std::endl;
+        }
+    }
+
+private:
+    static constexpr size_t CHANNELS = 12;
+    static constexpr int64_t START_SECONDS = 1700000000;
+
+    SensorSnapshot MakeSnapshot(uint64_t scan) {
+        SensorSnapshot snapshot;
+        snapshot.Resize(CHANNELS);
+        snapshot.scanNumber = scan;
+        snapshot.acquiredAt = std::chrono::system_clock::time_point(std::chrono::seconds(START_SECONDS + scan));
+        for (size_t i = 0; i < CHANNELS; ++i) {
+            snapshot.sensorIds[i] = 1001 + static_cast<int>(i);
+            snapshot.kinds[i] = static_cast<SensorKind>(i % 3);
+            snapshot.values[i] = 100.0 * static_cast<double>(i) + 0.25 * static_cast<double>(scan);
+            snapshot.quality[i] = (scan + i) % 50 == 0 ? QUALITY_COMM_FAIL : QUALITY_GOOD;
+        }
+        return snapshot;
+    }
+
+    bool WriteRecording(size_t scans, size_t chunkScans) {
+        SensorSnapshot first = MakeSnapshot(0);
+        ScanRecordingWriter writer;
+        if (!writer.Open(m_recordingPath, first.sensorIds, first.kinds, chunkScans)) {
+            return false;
+        }
+        for (uint64_t scan = 0; scan < scans; ++scan) {
+            if (!writer.Append(MakeSnapshot(scan))) {
+                return false;
+            }
+        }
+        writer.Close();
+        return true;
+    }
+
+    std::vector<std::string> ReadLines(const std::string& path) {
+        std::ifstream file(path);
+        std::vector<std::string> lines;
+        std::string line;
+        while (std::getline(file, line)) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    std::vector<std::string> SplitCsv(const std::string& line) {
+        std::vector<std::string> cells;
+        std::stringstream stream(line);
+        std::string cell;
+        while (std::getline(stream, cell, ',')) {
+            cells.push_back(cell);
+        }
+        if (!line.empty() && line.back() == ',') {
+            cells.push_back("");
+        }
+        return cells;
+    }
+
+    void TestCsvExport() {
+        HistorianExporter::Options options = HistorianExporter::DefaultOptions();
+        options.workers = 4;
+        HistorianExporter exporter(options);
+        HistorianExporter::Result result = exporter.Export(m_recordingPath, m_exportPath);
+
+        std::vector<std::string> lines = ReadLines(m_exportPath);
+        Assert(result.completed && result.rowsExported == 1000 && result.chunksRead == 16 && lines.size() == 1001,
+               "Csv_AllRows", "Every scan should become one row after the header");
+
+        std::vector<std::string> header = SplitCsv(lines[0]);
+        std::vector<std::string> row = SplitCsv(lines[1 + 123]);
+        bool rowOk = header.size() == 2 + CHANNELS && header[2] == "1001" && row.size() == 2 + CHANNELS &&
+                     row[0] == "123" && row[1] == std::to_string((START_SECONDS + 123) * 1000000) &&
+                     std::fabs(std::stod(row[2 + 5]) - (500.0 + 0.25 * 123)) < 1e-9;
+        Assert(rowOk, "Csv_Values", "Rows should carry scan, timestamp and values in order across chunk boundaries");
+
+        // Scan 150 has channel 0 COMM_FAIL ((150 + 0) % 50 == 0)
+        std::vector<std::string> failed = SplitCsv(lines[1 + 150]);
+        Assert(failed.size() == 2 + CHANNELS && failed[2].empty() && !failed[3].empty(), "Csv_UnusableEmpty",
+               "Unusable samples should be written as empty cells");
+    }
+
+    void TestCsvSelectionAndRange() {
+        HistorianExporter::Options options = HistorianExporter::DefaultOptions();
+        options.sensorIds = {1010, 1002};
+        options.startUs = (START_SECONDS + 100) * 1000000;
+        options.endUs = (START_SECONDS + 300) * 1000000;
+        options.includeQuality = true;
+        options.workers = 3;
+        HistorianExporter exporter(options);
+        HistorianExporter::Result result = exporter.Export(m_recordingPath, m_exportPath);
+
+        std::vector<std::string> lines = ReadLines(m_exportPath);
+        std::vector<std::string> first = SplitCsv(lines.size() > 1 ? lines[1] : "");
+        bool ok = result.completed && result.rowsExported == 200 && lines.size() == 201 &&
+                  lines[0] == "scan,timestamp_us,1010,1010_quality,1002,1002_quality" && first.size() == 6 &&
+                  first[0] == "100" && std::fabs(std::stod(first[2]) - (900.0 + 25.0)) < 1e-9;
+        Assert(ok, "Csv_SelectionAndRange", "Selected channels and the time range should bound the export");
+        Assert(result.chunksSkipped >= 1 && result.chunksRead < 16, "Csv_SkipsChunks",
+               "Chunks outside the range should be skipped and reading should stop past the end");
+    }
+
+    void TestColumnarExport() {
+        HistorianExporter::Options options = HistorianExporter::DefaultOptions();
+        options.format = ExportFormat::Columnar;
+        options.sensorIds = {1003, 1012};
+        options.startUs = (START_SECONDS + 10) * 1000000;
+        options.workers = 2;
+        HistorianExporter exporter(options);
+        HistorianExporter::Result result = exporter.Export(m_recordingPath, m_exportPath);
+
+        ColumnarExportReader reader;
+        bool opened = reader.Open(m_exportPath);
+        Assert(result.completed && opened && reader.GetSensorIds() == std::vector<int>{1003, 1012} &&
+               reader.GetRowGroups().size() == 16, "Columnar_Footer", "Header and footer index should be readable");
+
+        size_t rows = 0;
+        bool identical = true;
+        ScanChunk chunk;
+        for (size_t group = 0; group < reader.GetRowGroups().size(); ++group) {
+            if (!reader.ReadRowGroup(group, chunk)) {
+                identical = false;
+                break;
+            }
+            std::vector<uint64_t> scans(chunk.scanCount);
+            std::vector<int64_t> times(chunk.scanCount);
+            std::vector<double> values(chunk.scanCount);
+            std::vector<SensorQuality> quality(chunk.scanCount);
+            chunk.DecodeTimes(scans.data(), times.data());
+            chunk.DecodeChannel(1, values.data(), quality.data());
+            for (size_t i = 0; i < chunk.scanCount; ++i) {
+                SensorSnapshot expected = MakeSnapshot(scans[i]);
+                identical = identical && values[i] == expected.values[11] && quality[i] == expected.quality[11];
+            }
+            identical = identical && times.front() == reader.GetRowGroups()[group].firstUs;
+            rows += chunk.scanCount;
+        }
+        Assert(identical && rows == 990 && result.rowsExported == 990, "Columnar_RoundTrip",
+               "Row groups should reproduce the selected columns exactly");
+
+        // The first kind byte follows the 12-byte fixed header and two u32 sensor IDs
+        std::fstream file(m_exportPath, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(20);
+        file.put(static_cast<char>(0xEE));
+        file.close();
+        ColumnarExportReader corrupt;
+        Assert(!corrupt.Open(m_exportPath), "Columnar_RejectsUnknownKind",
+               "An export naming an unknown sensor kind should not open");
+    }
+
+    void TestUnknownSensor() {
+        HistorianExporter::Options options = HistorianExporter::DefaultOptions();
+        options.sensorIds = {4242};
+        options.workers = 1;
+        HistorianExporter exporter(options);
+        HistorianExporter::Result result = exporter.Export(m_recordingPath, m_exportPath);
+        Assert(!result.completed && !result.error.empty(), "Export_UnknownSensor",
+               "Selecting a sensor missing from the recording should fail");
+    }
+
+    void TestParseTime() {
+        int64_t iso = 0;
+        int64_t raw = 0;
+        ExportFormat format = ExportFormat::Csv;
+        Assert(HistorianExporter::ParseTime("2023-11-14T22:13:20Z", iso) && iso == START_SECONDS * 1000000 &&
+               HistorianExporter::ParseTime("1700000000000000", raw) && raw == iso &&
+               !HistorianExporter::ParseTime("2023-13-01T00:00:00", raw), "Export_ParseTime",
+               "ISO UTC times and raw microseconds should parse; invalid dates should not");
+        int64_t leap = 0;
+        Assert(!HistorianExporter::ParseTime("2024-01-01T-1:-5:00", raw) &&
+               !HistorianExporter::ParseTime("2024-01-01T00:00:-1", raw) &&
+               !HistorianExporter::ParseTime("2023-04-31T00:00:00", raw) &&
+               !HistorianExporter::ParseTime("2023-02-29T00:00:00", raw) &&
+               !HistorianExporter::ParseTime("1900-02-29T00:00:00", raw) &&
+               HistorianExporter::ParseTime("2024-02-29T00:00:00Z", leap) &&
+               HistorianExporter::ParseTime("2000-02-29T00:00:00Z", raw) && leap == 1709164800LL * 1000000,
+               "Export_ParseTimeRanges", "Negative fields and days past the month's end should not parse");
+        Assert(HistorianExporter::ParseFormat("columnar", format) && format == ExportFormat::Columnar &&
+               !HistorianExporter::ParseFormat("parquet", format), "Export_ParseFormat", "Only known formats should parse");
+    }
+};
+
+// Function to run historian exporter tests
+void RunHistorianExporterTests() {
+    HistorianExporterTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
@@ -0,0 +1,275 @@
+#include "MetricsRegistry.h"
+#include "MetricsServer.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <thread>
+#include <chrono>
+
+using namespace Nuclear;
+
+class MetricsRegistryTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+public:
+    MetricsRegistryTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== MetricsRegistry Unit Tests ===" << std::endl;
+
+        TestCounterAndGauge();
+        TestRegistration();
+        TestHistogram();
+        TestConcurrentUpdates();
+        TestRenderFormat();
+        TestHttpScrape();
+        TestStalledScraperDropped();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All MetricsRegistry tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some MetricsRegistry tests failed!" << std::endl;
+        }
+    }
+
+private:
+    bool Contains(const std::string& text, const std::string& line) {
+        return text.find(line + "\n") != std::string::npos;
+    }
+
+    void TestCounterAndGauge() {
+        MetricsRegistry registry;
+        MetricCounter* counter = registry.GetCounter("npm_scans_total", "Completed scans");
+        MetricGauge* gauge = registry.GetGauge("npm_clients", "Connected clients");
+        counter->Increment();
+        counter->Increment(4);
+        gauge->Set(3.0);
+        gauge->Add(-1.5);
+        Assert(counter->Get() == 5 && gauge->Get() == 1.5, "Metrics_CounterGauge",
+               "Counters should accumulate and gauges should hold the last value");
+    }
+
+    void TestRegistration() {
+        MetricsRegistry registry;
+        MetricsRegistry::Labels pump = {{"device", "pump_1"}};
+        MetricCounter* first = registry.GetCounter("npm_requests_total", "Requests", pump);
+        MetricCounter* again = registry.GetCounter("npm_requests_total", "Requests", pump);
+        MetricCounter* other = registry.GetCounter("npm_requests_total", "Requests", {{"device", "valve_2"}});
+        Assert(first != nullptr && first == again && other != first && registry.GetSeriesCount() == 2,
+               "Metrics_SameSeries", "The same name and labels should return the same metric");
+
+        Assert(registry.GetGauge("npm_requests_total", "Requests") == nullptr &&
+               registry.GetCounter("9bad", "Bad") == nullptr &&
+               registry.GetCounter("npm_bad_label", "Bad", {{"bad-label", "x"}}) == nullptr &&
+               registry.GetHistogram("npm_bad_hist", "Bad", {0.2, 0.1}) == nullptr &&
+               registry.GetHistogram("npm_le_hist", "Bad", {0.1}, {{"le", "x"}}) == nullptr,
+               "Metrics_Invalid", "Type conflicts, bad names, labels and bounds should be refused");
+
+        double depth = 7.0;
+        bool registered = registry.RegisterFunction("npm_queue_depth", "Queue depth", MetricsRegistry::MetricType::Gauge,
+                                                    {{"client", "12"}}, [&depth]() { return depth; });
+        bool duplicate = registry.RegisterFunction("npm_queue_depth", "Queue depth", MetricsRegistry::MetricType::Gauge,
+                                                   {{"client", "12"}}, [&depth]() { return depth; });
+        depth = 9.0;
+        Assert(registered && !duplicate && Contains(registry.Render(), "npm_queue_depth{client=\"12\"} 9") &&
+               registry.GetGauge("npm_queue_depth", "Queue depth", {{"client", "12"}}) == nullptr,
+               "Metrics_Function", "Function metrics should be evaluated at render time and not be shadowed");
+    }
+
+    void TestHistogram() {
+        MetricsRegistry registry;
+        MetricHistogram* histogram = registry.GetHistogram("npm_rtt_seconds", "RTT", {0.001, 0.01, 0.1});
+        for (double value : {0.0005, 0.001, 0.005, 0.05, 0.05, 2.0}) {
+            histogram->Observe(value);
+        }
+        MetricHistogram::Snapshot snapshot = histogram->Read();
+        Assert(snapshot.cumulative == std::vector<uint64_t>{2, 3, 5, 6} && snapshot.count == 6 &&
+               snapshot.sum > 2.1064 && snapshot.sum < 2.1066, "Metrics_HistogramBuckets",
+               "Buckets should be cumulative with inclusive upper bounds");
+
+        std::vector<double> latency = MetricsRegistry::LatencyBuckets();
+        Assert(latency.size() == 16 && latency.front() == 50e-6 && latency.back() > 1.0 && latency.back() < 2.0,
+               "Metrics_LatencyBuckets", "Default latency buckets should span 50 us to over a second");
+    }
+
+    void TestConcurrentUpdates() {
+        MetricsRegistry registry;
+        MetricCounter* counter = registry.GetCounter("npm_drops_total", "Drops");
+        MetricHistogram* histogram = registry.GetHistogram("npm_stage_seconds", "Stage", {0.5});
+
+        const int threads = 4;
+        const int iterations = 20000;
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&]() {
+                for (int i = 0; i < iterations; ++i) {
+                    counter->Increment();
+                    histogram->Observe(0.25);
+                }
+            });
+        }
+        // Scrape while updates are in flight; the lock-free paths must stay consistent
+        bool consistent = true;
+        for (int i = 0; i < 50; ++i) {
+            MetricHistogram::Snapshot snapshot = histogram->Read();
+            consistent = consistent && snapshot.count == snapshot.cumulative.back();
+            registry.Render();
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        MetricHistogram::Snapshot snapshot = histogram->Read();
+        Assert(consistent && counter->Get() == threads * iterations && snapshot.count == threads * iterations &&
+               snapshot.sum == 0.25 * threads * iterations, "Metrics_Concurrent",
+               "Concurrent updates should not be lost");
+    }
+
+    void TestRenderFormat() {
+        MetricsRegistry registry;
+        registry.GetCounter("npm_exceptions_total", "Exceptions\nby \\device", {{"device", "a\"b"}})->Increment(3);
+        registry.GetHistogram("npm_scan_seconds", "Scan stage time", {0.1, 0.5}, {{"stage", "acquire"}})->Observe(0.2);
+
+        std::string text = registry.Render();
+        bool ok = Contains(text, "# HELP npm_exceptions_total Exceptions\\nby \\\\device") &&
+                  Contains(text, "# TYPE npm_exceptions_total counter") &&
+                  Contains(text, "npm_exceptions_total{device=\"a\\\"b\"} 3") &&
+                  Contains(text, "# TYPE npm_scan_seconds histogram") &&
+                  Contains(text, "npm_scan_seconds_bucket{stage=\"acquire\",le=\"0.1\"} 0") &&
+                  Contains(text, "npm_scan_seconds_bucket{stage=\"acquire\",le=\"0.5\"} 1") &&
+                  Contains(text, "npm_scan_seconds_bucket{stage=\"acquire\",le=\"+Inf\"} 1") &&
+                  Contains(text, "npm_scan_seconds_sum{stage=\"acquire\"} 0.2") &&
+                  Contains(text, "npm_scan_seconds_count{stage=\"acquire\"} 1");
+        Assert(ok, "Metrics_RenderFormat", "Rendering should follow the Prometheus text format:\n" + text);
+    }
+
+    std::string Fetch(int port, const std::string& request) {
+        SOCKET client = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<uint16_t>(port));
+        inet_pton(AF_INET, "127.0.0.1", &address.sin_addr);
+        if (connect(client, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == SOCKET_ERROR) {
+            closesocket(client);
+            return "";
+        }
+
+        send(client, request.data(), static_cast<int>(request.size()), 0);
+        std::string response;
+        char buffer[4096];
+        int received;
+        while ((received = recv(client, buffer, sizeof(buffer), 0)) > 0) {
+            response.append(buffer, static_cast<size_t>(received));
+        }
+        closesocket(client);
+        return response;
+    }
+
+    void TestHttpScrape() {
+        MetricsRegistry registry;
+        registry.GetCounter("npm_scans_total", "Completed scans")->Increment(42);
+
+        MetricsServer::Config config = MetricsServer::DefaultConfig();
+        config.port = 0;
+        MetricsServer server(registry, config);
+        if (!Assert(server.Start() && server.GetPort() > 0, "Metrics_ServerStart", "Server should bind a free port")) {
+            return;
+        }
+
+        std::string response = Fetch(server.GetPort(), "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+        Assert(response.compare(0, 15, "HTTP/1.1 200 OK") == 0 &&
+               response.find("Content-Type: text/plain; version=0.0.4") != std::string::npos &&
+               response.find("\r\n\r\n# HELP npm_scans_total") != std::string::npos &&
+               Contains(response, "npm_scans_total 42"), "Metrics_HttpScrape",
+               "GET /metrics should return the rendered registry");
+
+        std::string missing = Fetch(server.GetPort(), "GET /status HTTP/1.1\r\n\r\n");
+        MetricsServer::Statistics stats = server.GetStatistics();
+        Assert(missing.compare(0, 22, "HTTP/1.1 404 Not Found") == 0 && stats.scrapes == 1 && stats.notFound == 1,
+               "Metrics_HttpNotFound", "Other paths should get 404 and be counted separately");
+
+        server.Stop();
+        Assert(!server.IsRunning() && server.GetPort() == -1, "Metrics_ServerStop", "Stop should close the listener");
+    }
+
+    void TestStalledScraperDropped() {
+        // Long help texts make the response far larger than the loopback socket buffers
+        MetricsRegistry registry;
+        for (int i = 0; i < 64; ++i) {
+            registry.GetCounter("npm_padding_" + std::to_string(i) + "_total", std::string(128 * 1024, 'x'));
+        }
+
+        MetricsServer::Config config = MetricsServer::DefaultConfig();
+        config.port = 0;
+        config.responseTimeout = std::chrono::milliseconds(300);
+        MetricsServer server(registry, config);
+        if (!Assert(server.Start(), "Stalled_ServerStart", "Server should bind a free port")) {
+            return;
+        }
+
+        // Request a scrape and never read the response
+        SOCKET stalled = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        int receiveBuffer = 4096;
+        setsockopt(stalled, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<const char*>(&receiveBuffer),
+                   sizeof(receiveBuffer));
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<uint16_t>(server.GetPort()));
+        inet_pton(AF_INET, "127.0.0.1", &address.sin_addr);
+        connect(stalled, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        std::string request = "GET /metrics HTTP/1.1\r\n\r\n";
+        send(stalled, request.data(), static_cast<int>(request.size()), 0);
+
+        auto start = std::chrono::steady_clock::now();
+        std::string response = Fetch(server.GetPort(), "GET /metrics HTTP/1.1\r\n\r\n");
+        auto waited = std::chrono::steady_clock::now() - start;
+        MetricsServer::Statistics stats = server.GetStatistics();
+        Assert(response.compare(0, 15, "HTTP/1.1 200 OK") == 0 && stats.timedOut == 1 && stats.scrapes == 1 &&
+               waited < std::chrono::seconds(2), "Stalled_LaterScrapeServed",
+               "A client that stops reading should be dropped after responseTimeout");
+
+        // A client stalled while the server is stopping must not hold up Stop
+        SOCKET second = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        setsockopt(second, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<const char*>(&receiveBuffer),
+                   sizeof(receiveBuffer));
+        connect(second, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        send(second, request.data(), static_cast<int>(request.size()), 0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        start = std::chrono::steady_clock::now();
+        server.Stop();
+        Assert(std::chrono::steady_clock::now() - start < std::chrono::seconds(1), "Stalled_StopReturns",
+               "Stop should not wait on a client that stops reading");
+
+        closesocket(stalled);
+        closesocket(second);
+    }
+};
+
+// Function to run metrics registry tests
+void RunMetricsRegistryTests() {
+    MetricsRegistryTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
@@ -0,0 +1,174 @@
+#include "ModbusTelemetry.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+
+using namespace Nuclear;
+
+class ModbusTelemetryTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+public:
+    ModbusTelemetryTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== ModbusTelemetry Unit Tests ===" << std::endl;
+
+        TestCounters();
+        TestRttStatistics();
+        TestSlowDeviceDetection();
+        TestDiagnosis();
+        TestMetricsExport();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All ModbusTelemetry tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some ModbusTelemetry tests failed!" << std::endl;
+        }
+    }
+
+private:
+    // One request/response exchange with a 12-byte request and a frame sized for 10 registers
+    void Exchange(ModbusTelemetry& telemetry, size_t device, int rttMicros) {
+        telemetry.RecordRequest(device, 12);
+        telemetry.RecordResponse(device, 29, std::chrono::microseconds(rttMicros));
+    }
+
+    void TestCounters() {
+        ModbusTelemetry telemetry;
+        size_t device = telemetry.AddDevice("192.168.1.100:502");
+        Exchange(telemetry, device, 2000);
+        telemetry.RecordRequest(device, 12);
+        telemetry.RecordException(device, 9, 0x02);
+        telemetry.RecordRequest(device, 12);
+        telemetry.RecordTimeout(device);
+        telemetry.RecordFailure(device);
+
+        ModbusDeviceStats stats = telemetry.GetDeviceStats(device);
+        Assert(stats.device == "192.168.1.100:502" && stats.requests == 3 && stats.responses == 1 &&
+               stats.exceptions == 1 && stats.busyExceptions == 0 && stats.lastExceptionCode == 0x02 &&
+               stats.timeouts == 1 && stats.failures == 1 && stats.bytesSent == 36 && stats.bytesReceived == 38,
+               "Telemetry_Counters", "Requests, outcomes and bytes should be counted per device");
+        Assert(telemetry.GetDeviceStats(7).requests == 0 && telemetry.GetAllStats().size() == 1,
+               "Telemetry_UnknownDevice", "Unknown device indexes should be ignored");
+    }
+
+    void TestRttStatistics() {
+        ModbusTelemetry telemetry;
+        size_t device = telemetry.AddDevice("plc:502");
+        for (int i = 0; i < 99; ++i) {
+            Exchange(telemetry, device, 1000);
+        }
+        Exchange(telemetry, device, 90000);
+
+        ModbusDeviceStats stats = telemetry.GetDeviceStats(device);
+        Assert(stats.maxRttMicros == 90000.0 && stats.averageRttMicros > 1880.0 && stats.averageRttMicros < 1900.0 &&
+               stats.p50RttMicros >= 1000.0 && stats.p50RttMicros < 2000.0 && stats.p99RttMicros < 2000.0,
+               "Telemetry_RttStatistics", "Average, max and histogram percentiles should reflect the samples");
+    }
+
+    void TestSlowDeviceDetection() {
+        ModbusTelemetry telemetry;
+        size_t fast = telemetry.AddDevice("fast:502");
+        size_t degrading = telemetry.AddDevice("degrading:502");
+
+        std::vector<std::pair<std::string, bool>> transitions;
+        telemetry.SetSlowDeviceHandler([&transitions](const std::string& device, bool slow) {
+            transitions.emplace_back(device, slow);
+        });
+
+        // A device that is normally slow but steady must not be flagged
+        for (int i = 0; i < 200; ++i) {
+            Exchange(telemetry, fast, 800 + (i % 5) * 10);
+            Exchange(telemetry, degrading, i % 2 == 0 ? 20000 : 22000);
+        }
+        Assert(!telemetry.IsSlow(fast) && !telemetry.IsSlow(degrading) && transitions.empty(),
+               "Telemetry_SteadyNotSlow", "Steady latency should not be flagged whatever its level");
+
+        for (int i = 0; i < 20; ++i) {
+            Exchange(telemetry, degrading, 90000);
+        }
+        ModbusDeviceStats slow = telemetry.GetDeviceStats(degrading);
+        Assert(slow.slow && slow.slowTransitions == 1 && transitions.size() == 1 &&
+               transitions[0].first == "degrading:502" && transitions[0].second && !telemetry.IsSlow(fast),
+               "Telemetry_DegradedFlagged", "A device whose RTT rises above its baseline should be flagged");
+        Assert(slow.baselineRttMicros < 25000.0, "Telemetry_BaselineFrozen",
+               "The baseline should not follow the degradation");
+
+        for (int i = 0; i < 40; ++i) {
+            Exchange(telemetry, degrading, 21000);
+        }
+        Assert(!telemetry.IsSlow(degrading) && transitions.size() == 2 && !transitions[1].second,
+               "Telemetry_Recovered", "The flag should clear once RTT returns near the baseline");
+    }
+
+    void TestDiagnosis() {
+        ModbusTelemetry telemetry;
+        size_t lossy = telemetry.AddDevice("lossy:502");
+        size_t busy = telemetry.AddDevice("busy:502");
+        for (int i = 0; i < 60; ++i) {
+            Exchange(telemetry, lossy, 1500);
+            Exchange(telemetry, busy, 1500);
+        }
+        for (int i = 0; i < 5; ++i) {
+            telemetry.RecordRequest(lossy, 12);
+            telemetry.RecordTimeout(lossy);
+            telemetry.RecordRequest(busy, 12);
+            telemetry.RecordException(busy, 9, 0x06);
+        }
+
+        std::string status = telemetry.FormatStatus();
+        Assert(status.find("lossy:502") != std::string::npos && status.find("TIMEOUTS (network)") != std::string::npos &&
+               status.find("BUSY (PLC overloaded)") != std::string::npos &&
+               telemetry.GetDeviceStats(busy).busyExceptions == 5, "Telemetry_Diagnosis",
+               "Status should separate timeouts from busy devices:\n" + status);
+    }
+
+    void TestMetricsExport() {
+        MetricsRegistry registry;
+        ModbusTelemetry telemetry;
+        size_t first = telemetry.AddDevice("10.0.0.1:502");
+        telemetry.RegisterMetrics(registry);
+        size_t second = telemetry.AddDevice("10.0.0.2:502");
+        Exchange(telemetry, first, 1000);
+        Exchange(telemetry, second, 3000);
+        Exchange(telemetry, second, 3000);
+
+        std::string text = registry.Render();
+        Assert(text.find("npm_modbus_requests_total{device=\"10.0.0.1:502\"} 1\n") != std::string::npos &&
+               text.find("npm_modbus_requests_total{device=\"10.0.0.2:502\"} 2\n") != std::string::npos &&
+               text.find("npm_modbus_rtt_seconds_count{device=\"10.0.0.2:502\"} 2\n") != std::string::npos &&
+               text.find("npm_modbus_device_slow{device=\"10.0.0.1:502\"} 0\n") != std::string::npos,
+               "Telemetry_Metrics", "Devices added before and after registration should be exported");
+    }
+};
+
+// Function to run Modbus telemetry tests
+void RunModbusTelemetryTests() {
+    ModbusTelemetryTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
@@ -0,0 +1,199 @@
+#include "RedundancyVoter.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+
+using namespace Nuclear;
+
+class RedundancyVoterTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+public:
+    RedundancyVoterTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== RedundancyVoter Unit Tests ===" << std::endl;
+
+        TestMedianSelect();
+        TestSpuriousHighChannelOutvoted();
+        TestDegradedToTwoChannels();
+        TestDegradedSurvivorAboveSetpoint();
+        TestAllChannelsFailed();
+        TestTwoChannelGroup();
+        TestFixedPointChannels();
+        TestInvalidGroupsDropped();
+        TestRepeatedAndMixedChannelsDropped();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All RedundancyVoter tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some RedundancyVoter tests failed!" << std::endl;
+        }
+    }
+
+private:
+    // Floating-point scan built from plain columns
+    static SensorSnapshot Scan(const std::vector<double>& values, const std::vector<SensorQuality>& quality) {
+        SensorSnapshot snapshot;
+        snapshot.Resize(values.size());
+        snapshot.values = values;
+        snapshot.quality = quality;
+        return snapshot;
+    }
+
+    RedundancyGroup Group(int groupId, std::vector<size_t> channels, double tolerance = 5.0) {
+        return RedundancyGroup{groupId, SensorKind::Temperature, std::move(channels), tolerance};
+    }
+
+    std::vector<SensorKind> Kinds(size_t channelCount) {
+        return std::vector<SensorKind>(channelCount, SensorKind::Temperature);
+    }
+
+    void TestMedianSelect() {
+        RedundancyVoter voter;
+        voter.Configure({Group(1, {0, 1, 2})}, Kinds(3));
+
+        std::vector<double> values = {301.0, 299.0, 300.0};
+        std::vector<SensorQuality> quality(3, QUALITY_GOOD);
+        voter.Vote(Scan(values, quality));
+
+        Assert(voter.GetVotedValues()[0] == 300.0, "Vote_Median", "Voted value should be the median channel");
+        Assert(voter.GetVotedQuality()[0] == QUALITY_GOOD, "Vote_GoodQuality", "All channels usable should vote GOOD");
+        Assert(voter.GetDiscrepancies()[0] == 0, "Vote_NoDiscrepancy", "Agreeing channels should not raise discrepancy");
+        Assert(voter.IsVotedChannel(1), "Vote_MemberKnown", "Group members should be reported as voted");
+    }
+
+    void TestSpuriousHighChannelOutvoted() {
+        RedundancyVoter voter;
+        voter.Configure({Group(1, {0, 1, 2})}, Kinds(3));
+
+        // One channel reads above a 350 trip setpoint; the vote must not
+        std::vector<double> values = {300.0, 399.0, 301.0};
+        std::vector<SensorQuality> quality(3, QUALITY_GOOD);
+        size_t discrepancies = voter.Vote(Scan(values, quality));
+
+        Assert(voter.GetVotedValues()[0] == 301.0, "Spurious_Outvoted", "Single high channel should be outvoted");
+        Assert(discrepancies == 1 && voter.GetDiscrepancies()[0] == 1, "Spurious_Discrepancy",
+               "Disagreeing channel should raise discrepancy alarm");
+    }
+
+    void TestDegradedToTwoChannels() {
+        RedundancyVoter voter;
+        voter.Configure({Group(1, {0, 1, 2})}, Kinds(3));
+
+        std::vector<double> values = {300.0, -1.0, 302.0};
+        std::vector<SensorQuality> quality = {QUALITY_GOOD, QUALITY_COMM_FAIL, QUALITY_GOOD};
+        voter.Vote(Scan(values, quality));
+
+        Assert(voter.GetVotedValues()[0] == 302.0, "Degraded_HighSelect", "Failed channel should degrade vote to the highest survivor");
+        Assert(voter.GetVotedQuality()[0] == QUALITY_SUBSTITUTED, "Degraded_Quality", "Degraded vote should be SUBSTITUTED");
+        Assert(voter.GetDiscrepancies()[0] == 0, "Degraded_IgnoresFailed", "Failed channel value should not raise discrepancy");
+    }
+
+    void TestDegradedSurvivorAboveSetpoint() {
+        RedundancyGroup low = Group(2, {3, 4, 5}, 100.0);
+        low.degradedSelect = DegradedSelect::Low;
+        RedundancyVoter voter;
+        voter.Configure({Group(1, {0, 1, 2}, 100.0), low}, Kinds(6));
+
+        // One survivor reads above a 350 trip setpoint; a survivor mean of 340 would hide it
+        std::vector<double> values = {320.0, -1.0, 360.0, 20.0, -1.0, 5.0};
+        std::vector<SensorQuality> quality = {QUALITY_GOOD, QUALITY_COMM_FAIL, QUALITY_GOOD,
+                                              QUALITY_GOOD, QUALITY_COMM_FAIL, QUALITY_GOOD};
+        voter.Vote(Scan(values, quality));
+
+        Assert(voter.GetVotedValues()[0] == 360.0, "Degraded_SurvivorTrips",
+               "Either survivor above the setpoint should carry the vote");
+        Assert(voter.GetVotedValues()[1] == 5.0, "Degraded_LowSelect",
+               "A low-select group should vote its lowest survivor");
+    }
+
+    void TestAllChannelsFailed() {
+        RedundancyVoter voter;
+        voter.Configure({Group(1, {0, 1, 2})}, Kinds(3));
+
+        std::vector<double> values = {-1.0, -1.0, -1.0};
+        std::vector<SensorQuality> quality(3, QUALITY_COMM_FAIL);
+        voter.Vote(Scan(values, quality));
+
+        Assert(std::isnan(voter.GetVotedValues()[0]), "Failed_NaN", "No usable channel should vote NaN");
+        Assert(voter.GetVotedQuality()[0] == QUALITY_COMM_FAIL, "Failed_Quality", "No usable channel should vote COMM_FAIL");
+        Assert(voter.GetStatistics().failedGroups == 1, "Failed_Counted", "Failed group should be counted");
+    }
+
+    void TestTwoChannelGroup() {
+        RedundancyVoter voter;
+        voter.Configure({Group(7, {3, 1})}, Kinds(4));
+
+        std::vector<double> values = {0.0, 10.0, 0.0, 14.0};
+        std::vector<SensorQuality> quality(4, QUALITY_GOOD);
+        voter.Vote(Scan(values, quality));
+
+        Assert(voter.GetVotedValues()[0] == 12.0, "TwoChannel_Mean", "Two-channel group should vote the mean");
+        Assert(voter.GetVotedQuality()[0] == QUALITY_GOOD, "TwoChannel_Good", "Both channels usable should vote GOOD");
+    }
+
+    void TestFixedPointChannels() {
+        RedundancyVoter voter;
+        voter.Configure({Group(1, {0, 1, 2})}, Kinds(3));
+
+        // Channel 1 is read in counts only; its values entry is never populated
+        SensorSnapshot snapshot = Scan({301.0, -1.0, 299.0}, std::vector<SensorQuality>(3, QUALITY_GOOD));
+        snapshot.SetFixedPoint(1, FixedPointScale{0.5, 0.0});
+        snapshot.counts[1] = 600;
+        voter.Vote(snapshot);
+
+        Assert(voter.GetVotedValues()[0] == 300.0, "Vote_FixedPoint",
+               "Fixed-point members should vote in engineering units");
+    }
+
+    void TestInvalidGroupsDropped() {
+        RedundancyVoter voter;
+        size_t accepted = voter.Configure({Group(1, {0}), Group(2, {0, 9}), Group(3, {0, 1, 2})}, Kinds(3));
+
+        Assert(accepted == 1 && voter.GetGroups()[0].groupId == 3, "Configure_DropsInvalid",
+               "Groups without two valid channels should be dropped");
+    }
+
+    void TestRepeatedAndMixedChannelsDropped() {
+        std::vector<SensorKind> kinds = Kinds(8);
+        kinds[6] = SensorKind::Pressure;
+        RedundancyVoter voter;
+        size_t accepted = voter.Configure({Group(1, {5, 5, 7}), Group(2, {4, 6, 7}), Group(3, {3, 4, 5})}, kinds);
+
+        Assert(accepted == 1 && voter.GetGroups()[0].groupId == 3, "Configure_DropsRepeatedAndMixed",
+               "Groups repeating a channel or mixing kinds should be dropped");
+        Assert(!voter.IsVotedChannel(6) && !voter.IsVotedChannel(7), "Configure_DroppedNotVoted",
+               "Members of dropped groups should still be alarmed individually");
+    }
+};
+
+// Function to run redundancy voter tests
+void RunRedundancyVoterTests() {
+    RedundancyVoterTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
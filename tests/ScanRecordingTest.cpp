@@ -0,0 +1,240 @@
+#include "ScanRecording.h"
+#include "RecordedSensorReader.h"
+#include "ByteBuffer.h"
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdio>
+
+using namespace Nuclear;
+
+class ScanRecordingTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+    const std::string m_path = "scan_recording_test.npsr";
+
+public:
+    ScanRecordingTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== ScanRecording Unit Tests ===" << std::endl;
+
+        TestRoundTripAcrossChunks();
+        TestChunkColumnDecode();
+        TestLayoutMismatchRejected();
+        TestCorruptChunkRejected();
+        TestUnknownKindRejected();
+        TestRecordedSensorReader();
+        TestReadSnapshot();
+
+        std::remove(m_path.c_str());
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All ScanRecording tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some ScanRecording tests failed!" << std::endl;
+        }
+    }
+
+private:
+    SensorSnapshot MakeSnapshot(uint64_t scan) {
+        SensorSnapshot snapshot;
+        snapshot.Resize(3);
+        snapshot.scanNumber = scan;
+        snapshot.acquiredAt = std::chrono::system_clock::time_point(std::chrono::seconds(1700000000 + scan));
+        snapshot.sensorIds = {1001, 2001, 3001};
+        snapshot.kinds = {SensorKind::Temperature, SensorKind::Pressure, SensorKind::Radiation};
+        snapshot.values = {290.0 + scan, 2250.0 - scan, 0.01 * scan};
+        snapshot.quality = {QUALITY_GOOD, scan % 3 == 0 ? QUALITY_COMM_FAIL : QUALITY_GOOD, QUALITY_GOOD};
+        return snapshot;
+    }
+
+    bool WriteRecording(size_t scans, size_t chunkScans) {
+        SensorSnapshot first = MakeSnapshot(0);
+        ScanRecordingWriter writer;
+        if (!writer.Open(m_path, first.sensorIds, first.kinds, chunkScans)) {
+            return false;
+        }
+        for (uint64_t scan = 0; scan < scans; ++scan) {
+            if (!writer.Append(MakeSnapshot(scan))) {
+                return false;
+            }
+        }
+        writer.Close();
+        return true;
+    }
+
+    void TestRoundTripAcrossChunks() {
+        bool written = WriteRecording(10, 4);
+
+        ScanRecordingReader reader;
+        bool opened = reader.Open(m_path);
+
+        SensorSnapshot snapshot;
+        size_t scans = 0;
+        bool identical = true;
+        while (reader.ReadNext(snapshot)) {
+            SensorSnapshot expected = MakeSnapshot(scans++);
+            identical = identical && snapshot.scanNumber == expected.scanNumber &&
+                        snapshot.acquiredAt == expected.acquiredAt && snapshot.values == expected.values &&
+                        snapshot.quality == expected.quality && snapshot.kinds == expected.kinds;
+        }
+
+        Assert(written && opened, "RoundTrip_Open", "Recording should be written and opened");
+        Assert(scans == 10, "RoundTrip_AllScans", "Every scan should be read back, including the partial chunk");
+        Assert(identical, "RoundTrip_Identical", "Snapshots should round-trip exactly");
+
+        reader.Rewind();
+        Assert(reader.ReadNext(snapshot) && snapshot.scanNumber == 0, "RoundTrip_Rewind", "Rewind should restart at scan 0");
+    }
+
+    void TestChunkColumnDecode() {
+        WriteRecording(6, 6);
+
+        ScanRecordingReader reader;
+        reader.Open(m_path);
+        ScanChunk chunk;
+        bool read = reader.ReadChunk(chunk);
+
+        std::vector<double> values(chunk.scanCount);
+        std::vector<SensorQuality> quality(chunk.scanCount);
+        chunk.DecodeChannel(1, values.data(), quality.data());
+
+        Assert(read && chunk.scanCount == 6 && values[5] == 2245.0 && quality[3] == QUALITY_COMM_FAIL,
+               "Chunk_DecodeSingleChannel", "A single channel should decode without the others");
+        Assert(!reader.ReadChunk(chunk), "Chunk_EndOfFile", "Reading past the last chunk should fail");
+    }
+
+    void TestLayoutMismatchRejected() {
+        SensorSnapshot first = MakeSnapshot(0);
+        ScanRecordingWriter writer;
+        writer.Open(m_path, first.sensorIds, first.kinds);
+
+        SensorSnapshot other = MakeSnapshot(1);
+        other.sensorIds[2] = 9999;
+        Assert(!writer.Append(other), "Layout_Mismatch", "Snapshot with a different layout should be rejected");
+
+        SensorSnapshot relabelled = MakeSnapshot(1);
+        relabelled.kinds[1] = SensorKind::Temperature;
+        Assert(!writer.Append(relabelled), "Layout_KindMismatch", "Snapshot with different kinds should be rejected");
+        writer.Close();
+    }
+
+    void TestCorruptChunkRejected() {
+        WriteRecording(0, 4);
+
+        // A chunk header claiming no scans and no payload
+        std::vector<uint8_t> header;
+        PutU32(header, 0x4B4E4843);
+        PutU32(header, 0);
+        PutU64(header, 0);
+        std::ofstream file(m_path, std::ios::binary | std::ios::app);
+        file.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+        file.close();
+
+        ScanRecordingReader reader;
+        SensorSnapshot snapshot;
+        Assert(reader.Open(m_path) && !reader.ReadNext(snapshot), "Chunk_EmptyRejected",
+               "A chunk with no scans should be refused");
+
+        ScanRecordingWriter writer;
+        Assert(!writer.Open(m_path, std::vector<int>(1 << 20, 1), std::vector<SensorKind>(1 << 20), 1024),
+               "Chunk_OversizedWriterRejected", "A chunk size the reader would refuse should not be opened");
+    }
+
+    void TestUnknownKindRejected() {
+        WriteRecording(2, 4);
+
+        // Header is 16 bytes, then three sensor IDs, then the kinds
+        std::fstream file(m_path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(16 + 3 * 4 + 2);
+        file.put(static_cast<char>(7));
+        file.close();
+
+        ScanRecordingReader reader;
+        Assert(!reader.Open(m_path), "Layout_UnknownKind", "A recording with an unknown sensor kind should be refused");
+    }
+
+    void TestRecordedSensorReader() {
+        WriteRecording(5, 2);
+
+        RecordedSensorReader reader;
+        bool opened = reader.Open(m_path);
+        Assert(opened && reader.GetAvailableSensors().size() == 3, "Reader_Channels", "Reader should serve recorded channels");
+        Assert(reader.ReadTemperature(1001) == -1.0, "Reader_NoScanYet", "Reads before the first advance should fail");
+
+        reader.AdvanceScan();
+        reader.AdvanceScan();
+        Assert(reader.ReadTemperature(1001) == 291.0 && reader.ReadPressure(2001) == 2249.0,
+               "Reader_CurrentScan", "Reads should be answered from the current scan");
+
+        reader.AdvanceScan();
+        reader.AdvanceScan();
+        Assert(!reader.IsSensorOnline(2001), "Reader_RecordedQuality", "Recorded COMM_FAIL should read as offline");
+
+        reader.AdvanceScan();
+        Assert(!reader.AdvanceScan() && reader.IsExhausted() && reader.GetScansServed() == 5, "Reader_Exhausted",
+               "Reader should report exhaustion after the last scan");
+    }
+
+    void TestReadSnapshot() {
+        WriteRecording(3, 4);
+
+        RecordedSensorReader reader;
+        reader.Open(m_path);
+        reader.AdvanceScan();
+
+        SensorSnapshot snapshot;
+        size_t usable = reader.ReadSnapshot(*reader.GetChannelSet(), snapshot);
+        SensorSnapshot expected = MakeSnapshot(0);
+        Assert(usable == 2 && snapshot.sensorIds == expected.sensorIds && snapshot.values == expected.values &&
+               snapshot.quality == expected.quality, "Snapshot_WholeScan", "One call should return the whole recorded scan");
+
+        auto subset = ChannelSet::Create(2, {3001, 4001}, {SensorKind::Radiation, SensorKind::Temperature});
+        usable = reader.ReadSnapshot(*subset, snapshot);
+        Assert(usable == 1 && snapshot.Size() == 2 && snapshot.sensorIds[0] == 3001 &&
+               snapshot.quality[1] == QUALITY_COMM_FAIL, "Snapshot_OtherLayout",
+               "A different set should be resized and unrecorded channels flagged COMM_FAIL");
+
+        auto wrongKind = ChannelSet::Create(3, {1001, 2001}, {SensorKind::Temperature, SensorKind::Radiation});
+        usable = reader.ReadSnapshot(*wrongKind, snapshot);
+        Assert(usable == 1 && snapshot.quality[0] == QUALITY_GOOD && snapshot.quality[1] == QUALITY_COMM_FAIL,
+               "Snapshot_KindMismatch", "A channel recorded as another kind should read as COMM_FAIL");
+
+        double values[2] = {0.0, 0.0};
+        SensorQuality quality[2] = {QUALITY_GOOD, QUALITY_GOOD};
+        usable = reader.ReadChannels({1001, 2001}, {SensorKind::Temperature, SensorKind::Temperature}, values, quality);
+        Assert(usable == 1 && values[0] == 290.0 && values[1] == -1.0 && quality[1] == QUALITY_COMM_FAIL,
+               "Channels_KindMismatch", "ReadChannels should not serve a channel under the wrong kind");
+    }
+};
+
+// Function to run scan recording tests
+void RunScanRecordingTests() {
+    ScanRecordingTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
@@ -0,0 +1,223 @@
+#include "ScanTracer.h"
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+
+using namespace Nuclear;
+
+class ScanTracerTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+    std::string m_tracePath;
+
+public:
+    ScanTracerTest() : testsRun(0), testsPassed(0), testsFailed(0), m_tracePath("scan_tracer_test.json") {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== ScanTracer Unit Tests ===" << std::endl;
+
+        TestOffRecordsNothing();
+        TestOverrunCaptured();
+        TestRingKeepsRecent();
+        TestSpanLimit();
+        TestWorkerSpans();
+        TestChromeTrace();
+        TestIdleSpansIgnored();
+
+        std::remove(m_tracePath.c_str());
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All ScanTracer tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some ScanTracer tests failed!" << std::endl;
+        }
+    }
+
+private:
+    ScanTracer::Config MakeConfig(ScanTracer::Mode mode, int thresholdMs, size_t ring, size_t spans) {
+        return ScanTracer::Config{mode, std::chrono::milliseconds(thresholdMs), ring, spans};
+    }
+
+    // A cycle shaped like a monitoring scan; processing sleeps to create an overrun
+    void RunCycle(ScanTracer& tracer, uint64_t number, int processMs) {
+        tracer.BeginCycle(number);
+        {
+            ScopedSpan acquire(tracer, "acquire");
+        }
+        {
+            ScopedSpan process(tracer, "process");
+            {
+                ScopedSpan thresholds(tracer, "thresholds");
+                std::this_thread::sleep_for(std::chrono::milliseconds(processMs));
+            }
+        }
+        {
+            ScopedSpan publish(tracer, "publish");
+            ScopedSpan encrypt(tracer, "encrypt");
+        }
+        tracer.EndCycle();
+    }
+
+    void TestOffRecordsNothing() {
+        ScanTracer tracer(MakeConfig(ScanTracer::Mode::Off, 0, 4, 16));
+        tracer.BeginCycle(1);
+        bool recording = tracer.IsRecording();
+        {
+            ScopedSpan span(tracer, "acquire");
+        }
+        bool captured = tracer.EndCycle();
+        Assert(!recording && !captured && tracer.GetCapturedCycles().empty() && tracer.GetStatistics().cyclesTraced == 0,
+               "Tracer_Off", "With tracing off no cycle should be opened or captured");
+    }
+
+    void TestOverrunCaptured() {
+        ScanTracer tracer(MakeConfig(ScanTracer::Mode::Overruns, 20, 4, 16));
+        RunCycle(tracer, 1, 0);
+        RunCycle(tracer, 2, 30);
+        RunCycle(tracer, 3, 0);
+
+        std::vector<CycleTrace> cycles = tracer.GetCapturedCycles();
+        ScanTracer::Statistics stats = tracer.GetStatistics();
+        Assert(cycles.size() == 1 && cycles[0].cycleNumber == 2 && stats.cyclesTraced == 3 &&
+               stats.cyclesCaptured == 1 && cycles[0].durationNs >= 20000000, "Tracer_OverrunOnly",
+               "Only the cycle longer than the threshold should be kept");
+
+        bool hierarchy = cycles.size() == 1 && cycles[0].spans.size() == 5;
+        if (hierarchy) {
+            // Spans are recorded as they close: inner before outer
+            const std::vector<TraceSpan>& spans = cycles[0].spans;
+            hierarchy = std::string(spans[0].name) == "acquire" && spans[0].depth == 0 &&
+                        std::string(spans[1].name) == "thresholds" && spans[1].depth == 1 &&
+                        std::string(spans[2].name) == "process" && spans[2].depth == 0 &&
+                        spans[1].startNs >= spans[2].startNs &&
+                        spans[1].startNs + spans[1].durationNs <= spans[2].startNs + spans[2].durationNs &&
+                        spans[1].durationNs >= 30000000 && std::string(spans[3].name) == "encrypt" &&
+                        spans[3].depth == 1;
+        }
+        Assert(hierarchy, "Tracer_Hierarchy", "Nested spans should keep depth and lie inside their parent");
+    }
+
+    void TestRingKeepsRecent() {
+        ScanTracer tracer(MakeConfig(ScanTracer::Mode::Always, 0, 3, 16));
+        for (uint64_t cycle = 1; cycle <= 5; ++cycle) {
+            RunCycle(tracer, cycle, 0);
+        }
+        std::vector<CycleTrace> cycles = tracer.GetCapturedCycles();
+        Assert(cycles.size() == 3 && cycles[0].cycleNumber == 3 && cycles[2].cycleNumber == 5, "Tracer_Ring",
+               "The ring should keep the most recent cycles, oldest first");
+
+        tracer.ClearCaptured();
+        Assert(tracer.GetCapturedCycles().empty(), "Tracer_Clear", "ClearCaptured should empty the ring");
+    }
+
+    void TestSpanLimit() {
+        ScanTracer tracer(MakeConfig(ScanTracer::Mode::Always, 0, 2, 3));
+        RunCycle(tracer, 1, 0);
+        std::vector<CycleTrace> cycles = tracer.GetCapturedCycles();
+        Assert(cycles.size() == 1 && cycles[0].spans.size() == 3 && cycles[0].spansDropped == 2 &&
+               tracer.GetStatistics().spansDropped == 2, "Tracer_SpanLimit",
+               "Spans beyond the per-cycle limit should be dropped and counted");
+    }
+
+    void TestWorkerSpans() {
+        ScanTracer tracer(MakeConfig(ScanTracer::Mode::Always, 0, 2, 64));
+        tracer.BeginCycle(7);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < 4; ++t) {
+            workers.emplace_back([&tracer]() {
+                for (int i = 0; i < 5; ++i) {
+                    ScopedSpan span(tracer, "anomaly", "worker");
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        tracer.EndCycle();
+
+        std::vector<CycleTrace> cycles = tracer.GetCapturedCycles();
+        bool otherThreads = cycles.size() == 1 && cycles[0].spans.size() == 20;
+        for (size_t i = 0; otherThreads && i < cycles[0].spans.size(); ++i) {
+            otherThreads = cycles[0].spans[i].threadId != cycles[0].threadId;
+        }
+        Assert(otherThreads, "Tracer_WorkerSpans", "Spans from worker threads should join the open cycle");
+    }
+
+    void TestChromeTrace() {
+        ScanTracer tracer(MakeConfig(ScanTracer::Mode::Always, 0, 4, 16));
+        RunCycle(tracer, 41, 0);
+        RunCycle(tracer, 42, 0);
+
+        std::ostringstream out;
+        size_t written = tracer.WriteChromeTrace(out);
+        std::string json = out.str();
+        size_t events = 0;
+        for (size_t at = json.find("\"ph\":\"X\""); at != std::string::npos; at = json.find("\"ph\":\"X\"", at + 1)) {
+            events++;
+        }
+        Assert(written == 2 && events == 12 && json.compare(0, 17, "{\"displayTimeUnit") == 0 &&
+               json.find("\"name\":\"encrypt\",\"cat\":\"scan\"") != std::string::npos &&
+               json.find("\"args\":{\"cycle\":42,\"spans\":5,\"dropped\":0}") != std::string::npos &&
+               json.find("\n]}") != std::string::npos, "Tracer_ChromeFormat",
+               "Each cycle and span should become a complete event");
+
+        std::ifstream file;
+        bool dumped = tracer.DumpChromeTrace(m_tracePath);
+        file.open(m_tracePath);
+        std::string first;
+        std::getline(file, first);
+        Assert(dumped && first == "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", "Tracer_Dump",
+               "DumpChromeTrace should write the trace to a file");
+    }
+
+    void TestIdleSpansIgnored() {
+        // Outside a cycle a span is a single relaxed load: nothing is timed, recorded or dropped
+        ScanTracer tracer(MakeConfig(ScanTracer::Mode::Always, 0, 4, 16));
+        for (int i = 0; i < 1000; ++i) {
+            ScopedSpan span(tracer, "idle");
+        }
+
+        tracer.BeginCycle(1);
+        for (int i = 0; i < 3; ++i) {
+            ScopedSpan span(tracer, "active");
+        }
+        tracer.EndCycle();
+
+        std::vector<CycleTrace> cycles = tracer.GetCapturedCycles();
+        Assert(cycles.size() == 1 && cycles[0].spans.size() == 3 && tracer.GetStatistics().spansDropped == 0,
+               "Tracer_IdleSpansIgnored", "Spans outside a traced cycle should leave no trace and use no span slots");
+    }
+};
+
+// Function to run scan tracer tests
+void RunScanTracerTests() {
+    ScanTracerTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
@@ -0,0 +1,219 @@
+#include "SensorHealth.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <limits>
+
+using namespace Nuclear;
+
+class SensorHealthTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+public:
+    SensorHealthTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== SensorHealth Unit Tests ===" << std::endl;
+
+        TestGoodRead();
+        TestOutOfRange();
+        TestNeverGood();
+        TestHoldSubstitution();
+        TestStale();
+        TestNoSubstitution();
+        TestClassifySnapshot();
+        TestLookup();
+        TestQualityEvents();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All SensorHealth tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some SensorHealth tests failed!" << std::endl;
+        }
+    }
+
+private:
+    using Clock = SensorHealthTracker::Clock;
+
+    Clock::time_point At(int milliseconds) {
+        return Clock::time_point(std::chrono::milliseconds(milliseconds));
+    }
+
+    void MakeTracker(SensorHealthTracker& tracker) {
+        tracker.Reset({101, 102, 103});
+        for (size_t channel = 0; channel < 3; ++channel) {
+            tracker.SetRange(channel, 0.0, 700.0);
+        }
+    }
+
+    void TestGoodRead() {
+        SensorHealthTracker tracker;
+        MakeTracker(tracker);
+        double value = 290.0;
+        SensorQuality quality = tracker.Classify(0, true, value, At(0));
+        Assert(quality == QUALITY_GOOD && value == 290.0 && tracker.IsOnline(0) &&
+               tracker.GetLastQuality(0) == QUALITY_GOOD, "Health_Good",
+               "An in-range answered read should be GOOD and left unchanged");
+    }
+
+    void TestOutOfRange() {
+        SensorHealthTracker tracker;
+        MakeTracker(tracker);
+        double high = 900.0;
+        double nan = std::nan("");
+        SensorQuality highQuality = tracker.Classify(0, true, high, At(0));
+        SensorQuality nanQuality = tracker.Classify(1, true, nan, At(0));
+        Assert(highQuality == QUALITY_OUT_OF_RANGE && nanQuality == QUALITY_OUT_OF_RANGE && high == 900.0 &&
+               tracker.IsOnline(0), "Health_OutOfRange",
+               "Values outside the instrument range, and NaN, should be OUT_OF_RANGE but online");
+    }
+
+    void TestNeverGood() {
+        SensorHealthTracker tracker;
+        MakeTracker(tracker);
+        double value = 123.0;
+        SensorQuality quality = tracker.Classify(0, false, value, At(0));
+        Assert(quality == QUALITY_COMM_FAIL && std::isnan(value) && !tracker.IsOnline(0), "Health_NeverGood",
+               "A failed read with no good history should be COMM_FAIL with no value to hold");
+    }
+
+    void TestHoldSubstitution() {
+        SensorHealthTracker tracker;
+        MakeTracker(tracker);
+        double value = 310.0;
+        tracker.Classify(0, true, value, At(0));
+        double failed = 0.0;
+        SensorQuality quality = tracker.Classify(0, false, failed, At(1000));
+        Assert(quality == (QUALITY_COMM_FAIL | QUALITY_SUBSTITUTED) && failed == 310.0 && !tracker.IsOnline(0),
+               "Health_HoldSubstitution", "A failed read should serve the last good value, flagged SUBSTITUTED");
+
+        // An out-of-range read is not good and must not replace the held value
+        double spike = 5000.0;
+        tracker.Classify(0, true, spike, At(1500));
+        double again = 0.0;
+        tracker.Classify(0, false, again, At(2000));
+        Assert(again == 310.0, "Health_HoldIgnoresBadReads", "Only GOOD samples should become the held value");
+    }
+
+    void TestStale() {
+        SensorHealthTracker tracker;
+        MakeTracker(tracker);
+        double value = 310.0;
+        tracker.Classify(0, true, value, At(0));
+        double fresh = 0.0;
+        double old = 0.0;
+        SensorQuality withinAge = tracker.Classify(0, false, fresh, At(5000));
+        SensorQuality pastAge = tracker.Classify(0, false, old, At(5001));
+        Assert((withinAge & QUALITY_STALE) == 0 && (pastAge & QUALITY_STALE) != 0 && old == 310.0 &&
+               !IsQualityUsable(pastAge), "Health_Stale",
+               "A held value older than staleAfter should be flagged STALE and be unusable");
+    }
+
+    void TestNoSubstitution() {
+        SensorHealthTracker tracker;
+        MakeTracker(tracker);
+        tracker.SetConfig(SensorHealthTracker::Config{std::chrono::milliseconds(100), false});
+        double value = 310.0;
+        tracker.Classify(0, true, value, At(0));
+        double failed = 42.0;
+        SensorQuality quality = tracker.Classify(0, false, failed, At(200));
+        Assert(quality == (QUALITY_COMM_FAIL | QUALITY_STALE) && failed == 42.0, "Health_NoSubstitution",
+               "With substitution off the acquired value should be kept and only flagged");
+    }
+
+    void TestClassifySnapshot() {
+        SensorHealthTracker tracker;
+        MakeTracker(tracker);
+        SensorSnapshot snapshot;
+        snapshot.Resize(3);
+        snapshot.values = {300.0, 320.0, 800.0};
+        tracker.ClassifySnapshot(snapshot, {1, 1, 1}, At(0));
+
+        snapshot.values = {0.0, 0.0, 0.0};
+        tracker.ClassifySnapshot(snapshot, {0, 1, 0}, At(100));
+        Assert(snapshot.quality[0] == (QUALITY_COMM_FAIL | QUALITY_SUBSTITUTED) && snapshot.values[0] == 300.0 &&
+               snapshot.quality[1] == QUALITY_GOOD && snapshot.quality[2] == QUALITY_COMM_FAIL &&
+               std::isnan(snapshot.values[2]), "Health_ClassifySnapshot",
+               "A scan should be classified per channel in one pass");
+
+        // Fixed-point channels hold their value as counts
+        snapshot.SetFixedPoint(1, FixedPointScale{0.1, 0.0});
+        snapshot.counts[1] = 3150;
+        tracker.ClassifySnapshot(snapshot, {1, 1, 1}, At(200));
+        snapshot.counts[1] = 0;
+        tracker.ClassifySnapshot(snapshot, {1, 0, 1}, At(300));
+        Assert(snapshot.counts[1] == 3150 && (snapshot.quality[1] & QUALITY_SUBSTITUTED) != 0,
+               "Health_FixedPointHold", "A held value should be written back to a fixed-point channel as counts");
+
+        // A held value beyond the counts range is clamped, not wrapped
+        snapshot.SetFixedPoint(1, FixedPointScale{1e-9, 0.0});
+        tracker.ClassifySnapshot(snapshot, {1, 0, 1}, At(400));
+        bool high = snapshot.counts[1] == std::numeric_limits<int32_t>::max();
+        snapshot.SetFixedPoint(1, FixedPointScale{1e-9, 1000.0});
+        tracker.ClassifySnapshot(snapshot, {1, 0, 1}, At(500));
+        Assert(high && snapshot.counts[1] == std::numeric_limits<int32_t>::min(), "Health_FixedPointHoldClamped",
+               "A held value outside the int32 counts range should be clamped to it");
+    }
+
+    void TestLookup() {
+        SensorHealthTracker tracker;
+        MakeTracker(tracker);
+        double value = 300.0;
+        tracker.Classify(1, true, value, At(0));
+        size_t channel = 0;
+        Assert(tracker.FindChannel(102, channel) && channel == 1 && tracker.IsSensorOnline(102) &&
+               !tracker.IsSensorOnline(101) && !tracker.IsSensorOnline(999) && tracker.GetChannelCount() == 3 &&
+               tracker.Classify(7, true, value, At(0)) == QUALITY_COMM_FAIL, "Health_Lookup",
+               "Sensors should map to channels and unknown channels should be COMM_FAIL");
+    }
+
+    void TestQualityEvents() {
+        SequenceOfEventsRecorder recorder;
+        SensorHealthTracker tracker;
+        MakeTracker(tracker);
+        tracker.SetEventRecorder(&recorder);
+
+        double value = 300.0;
+        for (size_t channel = 0; channel < 3; ++channel) {
+            tracker.Classify(channel, true, value, At(0));
+        }
+        Assert(recorder.GetStatistics().recorded == 0, "Health_FirstScanSilent",
+               "The first classification should not be recorded as a transition");
+
+        tracker.Classify(1, false, value, At(100));
+        std::vector<SequenceEvent> events = recorder.GetRecentEvents(10);
+        Assert(events.size() == 1 && events[0].channel == 102 && events[0].oldValue == QUALITY_GOOD &&
+               (static_cast<SensorQuality>(events[0].newValue) & QUALITY_COMM_FAIL) != 0,
+               "Health_TransitionRecorded", "A later quality change should be recorded");
+    }
+};
+
+// Function to run sensor health tests
+void RunSensorHealthTests() {
+    SensorHealthTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
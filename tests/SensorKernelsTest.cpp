@@ -0,0 +1,326 @@
+#include "SensorKernels.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+using namespace Nuclear;
+
+namespace {
+
+// Reference: the generic loop the kernels replace, dispatching on type names per reading
+struct ReferenceResult {
+    size_t valid;
+    size_t alarms;
+    double sum;
+};
+
+ReferenceResult ReferenceEvaluate(const std::vector<std::string>& types, const std::vector<double>& values,
+                                  const std::vector<SensorQuality>& quality, double maxTemperature,
+                                  double maxPressure, double maxRadiation) {
+    ReferenceResult result{0, 0, 0.0};
+    for (size_t i = 0; i < values.size(); ++i) {
+        if ((quality[i] & QUALITY_UNUSABLE_MASK) != 0) {
+            continue;
+        }
+        double minValue = 0.0;
+        double maxValue = 0.0;
+        double limit = 0.0;
+        if (types[i] == "temperature") {
+            minValue = -50.0;
+            maxValue = 1000.0;
+            limit = maxTemperature;
+        } else if (types[i] == "pressure") {
+            maxValue = 3500.0;
+            limit = maxPressure;
+        } else if (types[i] == "radiation") {
+            maxValue = 10000.0;
+            limit = maxRadiation;
+        }
+        if (!(values[i] >= minValue && values[i] <= maxValue)) {
+            continue;
+        }
+        result.valid++;
+        result.sum += values[i];
+        result.alarms += values[i] > limit ? 1 : 0;
+    }
+    return result;
+}
+
+} // namespace
+
+class SensorKernelsTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+public:
+    SensorKernelsTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== SensorKernels Unit Tests ===" << std::endl;
+
+        TestCompileTimeTables();
+        TestHighLimitKernel();
+        TestBandKernel();
+        TestPlanGroups();
+        TestPlanMatchesReference();
+        TestPlanThresholdChange();
+        TestMismatchedColumns();
+        TestUnknownKind();
+        TestFixedPointKernel();
+        TestFixedPointPlan();
+        TestLargePlanMatchesReference();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All SensorKernels tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some SensorKernels tests failed!" << std::endl;
+        }
+    }
+
+private:
+    SensorSnapshot MakeSnapshot(const std::vector<SensorKind>& kinds, const std::vector<double>& values,
+                                const std::vector<SensorQuality>& quality) {
+        SensorSnapshot snapshot;
+        snapshot.Resize(values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            snapshot.sensorIds[i] = static_cast<int>(1000 + i);
+        }
+        snapshot.kinds = kinds;
+        snapshot.values = values;
+        snapshot.quality = quality;
+        return snapshot;
+    }
+
+    void TestCompileTimeTables() {
+        static_assert(PressureTag::maxValue == 3500.0, "Pressure range should come from the table");
+        static_assert(GetSensorKernel(SensorKind::Radiation, ThresholdPolicy::Band) ==
+                          &RunSensorKernel<RadiationTag, BandPolicy>,
+                      "Kernel table should hold the matching instantiation");
+        bool distinct = GetSensorKernel(SensorKind::Temperature, ThresholdPolicy::HighLimit) !=
+                            GetSensorKernel(SensorKind::Pressure, ThresholdPolicy::HighLimit) &&
+                        GetSensorKernel(SensorKind::Pressure, ThresholdPolicy::HighLimit) !=
+                            GetSensorKernel(SensorKind::Pressure, ThresholdPolicy::Band);
+        Assert(distinct, "Kernels_Table", "Each kind and policy should map to its own instantiation");
+    }
+
+    void TestHighLimitKernel() {
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        std::vector<double> values = {300.0, 360.0, nan, 1200.0, 355.0, -60.0};
+        std::vector<SensorQuality> quality = {QUALITY_GOOD, QUALITY_GOOD, QUALITY_GOOD,
+                                              QUALITY_GOOD, QUALITY_STALE, QUALITY_GOOD};
+        std::vector<uint8_t> flags(values.size(), 0xFF);
+
+        KernelResult result = RunSensorKernel<TemperatureTag, HighLimitPolicy>(
+            values.data(), quality.data(), values.size(), ThresholdLimits{0.0, 350.0}, flags.data());
+        Assert(result.valid == 2 && result.alarms == 1 && result.unusable == 1 && result.outOfRange == 3 &&
+               result.sum == 660.0 && result.min == 300.0 && result.max == 360.0, "Kernels_HighLimit",
+               "NaN and out-of-range values should be excluded and one alarm raised");
+
+        bool flagsOk = flags[0] == 0 && flags[1] == CHANNEL_ALARM && flags[2] == CHANNEL_OUT_OF_RANGE &&
+                       flags[3] == CHANNEL_OUT_OF_RANGE && flags[4] == CHANNEL_UNUSABLE &&
+                       flags[5] == CHANNEL_OUT_OF_RANGE;
+        Assert(flagsOk, "Kernels_Flags", "Every channel should get exactly its CHANNEL_* bits");
+    }
+
+    void TestBandKernel() {
+        std::vector<double> values = {1900.0, 2100.0, 2300.0, 0.0};
+        std::vector<SensorQuality> quality(values.size(), QUALITY_GOOD);
+        std::vector<uint8_t> flags(values.size());
+
+        KernelResult result = RunSensorKernel<PressureTag, BandPolicy>(
+            values.data(), quality.data(), values.size(), ThresholdLimits{2000.0, 2200.0}, flags.data());
+        Assert(result.valid == 4 && result.alarms == 3 && flags[1] == 0 && flags[0] == CHANNEL_ALARM &&
+               flags[2] == CHANNEL_ALARM && flags[3] == CHANNEL_ALARM, "Kernels_Band",
+               "Values on either side of the band should alarm");
+    }
+
+    void TestPlanGroups() {
+        SensorKernelPlan plan;
+        plan.Build({SensorKind::Temperature, SensorKind::Temperature, SensorKind::Pressure, SensorKind::Radiation,
+                    SensorKind::Radiation, SensorKind::Temperature});
+        const std::vector<SensorKernelPlan::Group>& groups = plan.GetGroups();
+        Assert(groups.size() == 4 && groups[0].count == 2 && groups[1].offset == 2 && groups[2].count == 2 &&
+               groups[3].offset == 5 && groups[3].kind == SensorKind::Temperature &&
+               groups[3].kernel == GetSensorKernel(SensorKind::Temperature, ThresholdPolicy::HighLimit),
+               "Kernels_PlanGroups", "Consecutive channels of one kind should share a group");
+    }
+
+    void TestPlanMatchesReference() {
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        std::vector<SensorKind> kinds;
+        std::vector<std::string> types;
+        std::vector<double> values;
+        std::vector<SensorQuality> quality;
+        for (int i = 0; i < 300; ++i) {
+            SensorKind kind = static_cast<SensorKind>(i % 3);
+            double value = kind == SensorKind::Temperature ? 280.0 + (i % 97)
+                           : kind == SensorKind::Pressure  ? 2000.0 + 3.0 * (i % 101)
+                                                           : 0.01 * (i % 150);
+            if (i % 37 == 0) {
+                value = nan;
+            }
+            if (i % 53 == 0) {
+                value = -1.0e6;
+            }
+            kinds.push_back(kind);
+            types.push_back(SensorKindName(kind));
+            values.push_back(value);
+            quality.push_back(i % 29 == 0 ? QUALITY_COMM_FAIL : QUALITY_GOOD);
+        }
+
+        SensorSnapshot snapshot = MakeSnapshot(kinds, values, quality);
+        SensorKernelPlan plan;
+        std::vector<uint8_t> flags;
+        SensorKernelPlan::ScanResult result = plan.Run(snapshot, flags);
+        ReferenceResult reference = ReferenceEvaluate(types, values, quality, 350.0, 2200.0, 1.0);
+
+        size_t valid = 0;
+        double sum = 0.0;
+        for (const KernelResult& kind : result.byKind) {
+            valid += kind.valid;
+            sum += kind.sum;
+        }
+        Assert(flags.size() == values.size() && valid == reference.valid && result.alarms == reference.alarms &&
+               std::fabs(sum - reference.sum) < 1e-6 && plan.GetGroups().size() == 300, "Kernels_MatchReference",
+               "Interleaved channels should give the same counts and sums as string dispatch");
+    }
+
+    void TestPlanThresholdChange() {
+        SensorSnapshot snapshot = MakeSnapshot({SensorKind::Radiation, SensorKind::Radiation},
+                                               {0.5, 1.5}, {QUALITY_GOOD, QUALITY_GOOD});
+        SensorKernelPlan plan;
+        std::vector<uint8_t> flags;
+        size_t before = plan.Run(snapshot, flags).alarms;
+
+        plan.SetThreshold(SensorKind::Radiation, {ThresholdPolicy::Band, {0.6, 2.0}});
+        SensorKernelPlan::ScanResult after = plan.Run(snapshot, flags);
+        Assert(before == 1 && after.alarms == 1 && flags[0] == CHANNEL_ALARM && flags[1] == 0 &&
+               plan.GetGroups()[0].kernel == GetSensorKernel(SensorKind::Radiation, ThresholdPolicy::Band),
+               "Kernels_PolicyChange", "Changing a policy should rebind the groups of that kind");
+
+        const KernelResult& radiation = after.byKind[static_cast<size_t>(SensorKind::Radiation)];
+        const KernelResult& pressure = after.byKind[static_cast<size_t>(SensorKind::Pressure)];
+        Assert(radiation.valid == 2 && radiation.sum == 2.0 && pressure.valid == 0 &&
+               std::isinf(pressure.min), "Kernels_ByKind", "Results should be reported under their own kind only");
+    }
+
+    void TestMismatchedColumns() {
+        SensorSnapshot snapshot = MakeSnapshot({SensorKind::Pressure}, {2100.0, 2300.0},
+                                               {QUALITY_GOOD, QUALITY_GOOD});
+        SensorKernelPlan plan;
+        std::vector<uint8_t> flags;
+        SensorKernelPlan::ScanResult result = plan.Run(snapshot, flags);
+        Assert(result.alarms == 0 && result.byKind[1].valid == 0 && flags.size() == 2, "Kernels_Mismatched",
+               "A snapshot with columns of different lengths should not be evaluated");
+    }
+
+    void TestUnknownKind() {
+        SensorSnapshot snapshot = MakeSnapshot({SensorKind::Pressure, static_cast<SensorKind>(7), SensorKind::Pressure},
+                                               {2300.0, 2300.0, 2300.0}, {QUALITY_GOOD, QUALITY_GOOD, QUALITY_GOOD});
+        SensorKernelPlan plan;
+        plan.SetThreshold(static_cast<SensorKind>(7), {ThresholdPolicy::Band, {0.0, 1.0}});
+        std::vector<uint8_t> flags;
+        SensorKernelPlan::ScanResult result = plan.Run(snapshot, flags);
+        Assert(result.alarms == 2 && result.byKind[1].valid == 2 && flags[1] == CHANNEL_UNUSABLE,
+               "Kernels_UnknownKind", "Channels of an unknown kind should be flagged unusable and skipped");
+    }
+
+    void TestFixedPointKernel() {
+        // 0.1 C per count: 350.0 C is exactly 3500 counts, so only the second channel alarms
+        FixedPointScale scale{0.1, 0.0};
+        std::vector<int32_t> counts = {3500, 3501, 12000, 2900, 3600};
+        std::vector<SensorQuality> quality = {QUALITY_GOOD, QUALITY_GOOD, QUALITY_GOOD, QUALITY_GOOD,
+                                              QUALITY_COMM_FAIL};
+        std::vector<uint8_t> flags(counts.size());
+
+        KernelResult result = RunFixedPointKernel<TemperatureTag, HighLimitPolicy>(
+            counts.data(), quality.data(), counts.size(), scale, ThresholdLimits{0.0, 350.0}, flags.data());
+        Assert(result.valid == 3 && result.alarms == 1 && result.outOfRange == 1 && result.unusable == 1 &&
+               flags[0] == 0 && flags[1] == CHANNEL_ALARM && flags[2] == CHANNEL_OUT_OF_RANGE &&
+               std::fabs(result.sum - 990.1) < 1e-9 && std::fabs(result.min - 290.0) < 1e-9 &&
+               std::fabs(result.max - 350.1) < 1e-9, "Kernels_FixedPoint",
+               "Counts should be thresholded exactly and aggregated in engineering units");
+
+        FixedPointScale offsetScale{0.5, 1000.0};
+        std::vector<int32_t> pressure = {1999, 2000, 2400, 2401};
+        std::vector<SensorQuality> good(pressure.size(), QUALITY_GOOD);
+        std::vector<uint8_t> bandFlags(pressure.size());
+        KernelResult band = RunFixedPointKernel<PressureTag, BandPolicy>(
+            pressure.data(), good.data(), pressure.size(), offsetScale, ThresholdLimits{2000.0, 2200.0},
+            bandFlags.data());
+        Assert(band.alarms == 2 && bandFlags[0] == CHANNEL_ALARM && bandFlags[1] == 0 && bandFlags[2] == 0 &&
+               bandFlags[3] == CHANNEL_ALARM, "Kernels_FixedPointBand",
+               "Band limits should map to counts through the offset without rounding errors");
+    }
+
+    void TestFixedPointPlan() {
+        SensorSnapshot snapshot = MakeSnapshot({SensorKind::Pressure, SensorKind::Pressure, SensorKind::Pressure},
+                                               {2100.0, 0.0, 0.0}, {QUALITY_GOOD, QUALITY_GOOD, QUALITY_GOOD});
+        snapshot.SetFixedPoint(1, FixedPointScale{0.5, 0.0});
+        snapshot.SetFixedPoint(2, FixedPointScale{0.5, 0.0});
+        snapshot.counts[1] = 4300;
+        snapshot.counts[2] = 4402;
+
+        SensorKernelPlan plan;
+        std::vector<uint8_t> flags;
+        SensorKernelPlan::ScanResult result = plan.Run(snapshot, flags);
+        const KernelResult& pressure = result.byKind[static_cast<size_t>(SensorKind::Pressure)];
+        Assert(plan.GetGroups().size() == 2 && plan.GetGroups()[1].fixedKernel != nullptr && result.alarms == 1 &&
+               flags[2] == CHANNEL_ALARM && pressure.valid == 3 && pressure.sum == 2100.0 + 2150.0 + 2201.0,
+               "Kernels_FixedPointPlan", "Fixed-point channels should form their own group and use counts");
+    }
+
+    void TestLargePlanMatchesReference() {
+        const size_t channels = 4096;
+        std::vector<SensorKind> kinds;
+        std::vector<std::string> types;
+        std::vector<double> values;
+        std::vector<SensorQuality> quality(channels, QUALITY_GOOD);
+        for (size_t i = 0; i < channels; ++i) {
+            SensorKind kind = static_cast<SensorKind>(i * 3 / channels);
+            kinds.push_back(kind);
+            types.push_back(SensorKindName(kind));
+            values.push_back(kind == SensorKind::Radiation ? 0.001 * static_cast<double>(i % 2000)
+                                                           : 100.0 + static_cast<double>(i % 2000));
+        }
+        SensorSnapshot snapshot = MakeSnapshot(kinds, values, quality);
+
+        SensorKernelPlan plan;
+        std::vector<uint8_t> flags;
+        size_t kernelAlarms = plan.Run(snapshot, flags).alarms;
+        size_t referenceAlarms = ReferenceEvaluate(types, values, quality, 350.0, 2200.0, 1.0).alarms;
+        Assert(plan.GetGroups().size() == 3 && kernelAlarms == referenceAlarms, "Kernels_LargePlan",
+               "Kind-ordered channels should form three groups and agree with the reference");
+    }
+};
+
+// Function to run sensor kernel tests
+void RunSensorKernelsTests() {
+    SensorKernelsTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
@@ -0,0 +1,212 @@
+#include "SequenceOfEventsRecorder.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+
+using namespace Nuclear;
+
+class SequenceOfEventsRecorderTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+    std::mutex m_captureMutex;
+    std::condition_variable m_captureReady;
+    std::vector<SequenceCapture> m_captures;
+
+public:
+    SequenceOfEventsRecorderTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== SequenceOfEventsRecorder Unit Tests ===" << std::endl;
+
+        TestRecentEvents();
+        TestExplicitTriggerWindow();
+        TestCauseTrigger();
+        TestTriggerPositionAfterSort();
+        TestTimeWindowFreeze();
+        TestConcurrentProducers();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All SequenceOfEventsRecorder tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some SequenceOfEventsRecorder tests failed!" << std::endl;
+        }
+    }
+
+private:
+    SequenceOfEventsRecorder::Config SmallWindow(size_t pre, size_t post, int windowMs = 5000) {
+        SequenceOfEventsRecorder::Config config;
+        config.capacity = 64;
+        config.preTriggerEvents = pre;
+        config.postTriggerEvents = post;
+        config.postTriggerWindow = std::chrono::milliseconds(windowMs);
+        return config;
+    }
+
+    void StartCollecting(SequenceOfEventsRecorder& recorder) {
+        {
+            std::lock_guard<std::mutex> lock(m_captureMutex);
+            m_captures.clear();
+        }
+        recorder.Start([this](const SequenceCapture& capture) {
+            std::lock_guard<std::mutex> lock(m_captureMutex);
+            m_captures.push_back(capture);
+            m_captureReady.notify_all();
+        });
+    }
+
+    bool WaitForCapture(SequenceCapture& capture) {
+        std::unique_lock<std::mutex> lock(m_captureMutex);
+        if (!m_captureReady.wait_for(lock, std::chrono::seconds(2), [this] { return !m_captures.empty(); })) {
+            return false;
+        }
+        capture = m_captures.front();
+        return true;
+    }
+
+    void TestRecentEvents() {
+        SequenceOfEventsRecorder recorder(SmallWindow(4, 4));
+        for (int i = 0; i < 100; ++i) {
+            recorder.Record(i, 0.0, 1.0, EventCause::LimitCrossed, 1000 + i);
+        }
+
+        std::vector<SequenceEvent> recent = recorder.GetRecentEvents(3);
+        Assert(recent.size() == 3 && recent[0].channel == 97 && recent[2].channel == 99, "Recent_Ordered",
+               "Most recent events should be returned oldest first");
+        Assert(recorder.GetStatistics().recorded == 100, "Recent_Counted", "Every record should be counted");
+    }
+
+    void TestExplicitTriggerWindow() {
+        SequenceOfEventsRecorder recorder(SmallWindow(4, 3));
+        StartCollecting(recorder);
+
+        for (int i = 0; i < 10; ++i) {
+            recorder.Record(i, 0.0, 1.0, EventCause::AlarmRaised, 1000 + i);
+        }
+        Assert(recorder.Trigger("EMERGENCY SHUTDOWN: test"), "Trigger_Accepted", "Armed recorder should accept trigger");
+        Assert(!recorder.Trigger("second"), "Trigger_Exclusive", "Second trigger during capture should be rejected");
+        for (int i = 10; i < 20; ++i) {
+            recorder.Record(i, 0.0, 1.0, EventCause::AlarmRaised, 1000 + i);
+        }
+
+        SequenceCapture capture;
+        bool delivered = WaitForCapture(capture);
+        recorder.Stop();
+
+        Assert(delivered && capture.events.size() == 7, "Trigger_WindowSize", "Capture should hold pre + post events");
+        Assert(delivered && capture.triggerPosition == 4 && capture.events[4].channel == 10, "Trigger_Position",
+               "First post-trigger event should follow the pre-trigger window");
+        Assert(delivered && capture.reason == "EMERGENCY SHUTDOWN: test", "Trigger_Reason", "Reason should be kept");
+        Assert(!recorder.IsCapturing(), "Trigger_Rearmed", "Recorder should re-arm after the dump");
+    }
+
+    void TestCauseTrigger() {
+        SequenceOfEventsRecorder recorder(SmallWindow(2, 2));
+        StartCollecting(recorder);
+
+        recorder.Record(1, 0.0, 1.0, EventCause::AlarmRaised, 1000);
+        recorder.Record(2, 0.0, 1.0, EventCause::AlarmRaised, 1001);
+        recorder.Record(42, 0.0, 1.0, EventCause::Trip, 1002);
+        recorder.Record(3, 0.0, 1.0, EventCause::AlarmRaised, 1003);
+
+        SequenceCapture capture;
+        bool delivered = WaitForCapture(capture);
+        recorder.Stop();
+
+        Assert(delivered && capture.events.size() == 4 && capture.events[capture.triggerPosition].channel == 42,
+               "CauseTrigger_TripEvent", "Trip record should trigger a capture starting at itself");
+        Assert(delivered && capture.reason == "TRIP on channel 42", "CauseTrigger_Reason",
+               "Automatic trigger reason should name cause and channel");
+    }
+
+    void TestTriggerPositionAfterSort() {
+        SequenceOfEventsRecorder recorder(SmallWindow(2, 2));
+        StartCollecting(recorder);
+
+        // Producers on different threads stamp out of ring order
+        recorder.Record(1, 0.0, 1.0, EventCause::AlarmRaised, 1000);
+        recorder.Record(2, 0.0, 1.0, EventCause::AlarmRaised, 1004);
+        recorder.Record(42, 0.0, 1.0, EventCause::Trip, 1002);
+        recorder.Record(3, 0.0, 1.0, EventCause::AlarmRaised, 1001);
+
+        SequenceCapture capture;
+        bool delivered = WaitForCapture(capture);
+        recorder.Stop();
+
+        Assert(delivered && capture.events.size() == 4 && capture.triggerPosition == 2 &&
+               capture.events[capture.triggerPosition].channel == 42, "CauseTrigger_PositionAfterSort",
+               "Trigger position should follow the trip event through the time sort");
+    }
+
+    void TestTimeWindowFreeze() {
+        SequenceOfEventsRecorder recorder(SmallWindow(2, 1000, 20));
+        StartCollecting(recorder);
+
+        recorder.Record(1, 0.0, 1.0, EventCause::AlarmRaised);
+        recorder.Trigger("quiet trip");
+        recorder.Record(2, 0.0, 1.0, EventCause::AlarmRaised);
+
+        SequenceCapture capture;
+        bool delivered = WaitForCapture(capture);
+        recorder.Stop();
+
+        Assert(delivered && capture.events.size() == 2, "TimeWindow_Freezes",
+               "Capture should complete after the post-trigger time window");
+    }
+
+    void TestConcurrentProducers() {
+        SequenceOfEventsRecorder recorder(SmallWindow(16, 16));
+
+        std::vector<std::thread> producers;
+        for (int t = 0; t < 4; ++t) {
+            producers.emplace_back([&recorder, t] {
+                for (int i = 0; i < 10000; ++i) {
+                    recorder.Record(t, i, i + 1, EventCause::QualityChange);
+                }
+            });
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+
+        std::vector<SequenceEvent> recent = recorder.GetRecentEvents(64);
+        bool consistent = recent.size() == 64;
+        for (const auto& event : recent) {
+            consistent = consistent && event.newValue == event.oldValue + 1;
+        }
+        Assert(consistent && recorder.GetStatistics().recorded == 40000, "Concurrent_NoTornRecords",
+               "Concurrent producers should never produce torn records");
+    }
+};
+
+// Function to run sequence-of-events recorder tests
+void RunSequenceOfEventsRecorderTests() {
+    SequenceOfEventsRecorderTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
@@ -0,0 +1,336 @@
+#include "SnapshotDeltaCodec.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+using namespace Nuclear;
+
+class SnapshotDeltaCodecTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+public:
+    SnapshotDeltaCodecTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== SnapshotDeltaCodec Unit Tests ===" << std::endl;
+
+        TestKeyframeThenDeltas();
+        TestDeadband();
+        TestKeyframeTriggers();
+        TestMissedFrameNeedsKeyframe();
+        TestFrameAssembly();
+        TestMalformedFrames();
+        TestFixedPointChannels();
+        TestFixedPointDeadband();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All SnapshotDeltaCodec tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some SnapshotDeltaCodec tests failed!" << std::endl;
+        }
+    }
+
+private:
+    SensorSnapshot MakeSnapshot(uint64_t scan, size_t channels = 50) {
+        SensorSnapshot snapshot;
+        snapshot.Resize(channels);
+        snapshot.scanNumber = scan;
+        snapshot.acquiredAt = std::chrono::system_clock::time_point(std::chrono::seconds(1700000000 + scan));
+        for (size_t i = 0; i < channels; ++i) {
+            snapshot.sensorIds[i] = 1000 + static_cast<int>(i);
+            snapshot.kinds[i] = static_cast<SensorKind>(i % 3);
+            snapshot.values[i] = 100.0 + static_cast<double>(i);
+            snapshot.quality[i] = QUALITY_GOOD;
+        }
+        return snapshot;
+    }
+
+    // Decode every frame in a buffer; returns the last result
+    SnapshotDeltaDecoder::Result DecodeAll(SnapshotDeltaDecoder& decoder, const std::vector<uint8_t>& frames) {
+        DeltaFrameAssembler assembler;
+        assembler.Append(frames.data(), frames.size());
+        std::vector<uint8_t> payload;
+        SnapshotDeltaDecoder::Result result = SnapshotDeltaDecoder::Result::Malformed;
+        while (assembler.Next(payload)) {
+            result = decoder.Decode(payload.data(), payload.size());
+        }
+        return result;
+    }
+
+    bool SameSnapshot(const SensorSnapshot& a, const SensorSnapshot& b) {
+        return a.scanNumber == b.scanNumber && a.acquiredAt == b.acquiredAt && a.sensorIds == b.sensorIds &&
+               a.kinds == b.kinds && a.values == b.values && a.quality == b.quality;
+    }
+
+    void TestKeyframeThenDeltas() {
+        SnapshotDeltaEncoder encoder;
+        SnapshotDeltaDecoder decoder;
+        std::vector<uint8_t> frame;
+
+        SensorSnapshot first = MakeSnapshot(1);
+        size_t keyframeBytes = encoder.Encode(first, frame);
+        bool keyframe = DecodeAll(decoder, frame) == SnapshotDeltaDecoder::Result::Keyframe;
+        Assert(keyframe && SameSnapshot(decoder.GetSnapshot(), first), "Codec_Keyframe", "First frame should be a full keyframe");
+
+        SensorSnapshot second = MakeSnapshot(2);
+        second.values[7] = 250.5;
+        second.quality[12] = QUALITY_STALE;
+        frame.clear();
+        size_t deltaBytes = encoder.Encode(second, frame);
+        bool delta = DecodeAll(decoder, frame) == SnapshotDeltaDecoder::Result::Delta;
+        Assert(delta && SameSnapshot(decoder.GetSnapshot(), second), "Codec_Delta", "Delta should reproduce the snapshot");
+        Assert(deltaBytes * 10 < keyframeBytes, "Codec_DeltaSize",
+               "Two changed channels should cost far less than a keyframe (" + std::to_string(deltaBytes) + " vs " +
+               std::to_string(keyframeBytes) + " bytes)");
+
+        SnapshotDeltaEncoder::Statistics stats = encoder.GetStatistics();
+        Assert(stats.keyframes == 1 && stats.deltas == 1 && stats.channelsSent == 52, "Codec_Statistics",
+               "Statistics should count frames and channels sent");
+    }
+
+    void TestDeadband() {
+        SnapshotDeltaEncoder encoder(SnapshotDeltaEncoder::Config{0, 0.5});
+        SnapshotDeltaDecoder decoder;
+        std::vector<uint8_t> frame;
+
+        encoder.Encode(MakeSnapshot(1), frame);
+
+        // Creeps by 0.2 per scan: resent only once drift from the last sent value exceeds the deadband
+        size_t resent = 0;
+        for (uint64_t scan = 2; scan <= 6; ++scan) {
+            SensorSnapshot snapshot = MakeSnapshot(scan);
+            snapshot.values[0] = 100.0 + 0.2 * static_cast<double>(scan - 1);
+            uint64_t before = encoder.GetStatistics().channelsSent;
+            encoder.Encode(snapshot, frame);
+            resent += encoder.GetStatistics().channelsSent - before;
+        }
+        DecodeAll(decoder, frame);
+
+        Assert(resent == 1 && std::fabs(decoder.GetSnapshot().values[0] - 100.6) < 1e-9, "Codec_Deadband",
+               "Slow drift should be sent once it exceeds the deadband, without accumulating error");
+    }
+
+    void TestKeyframeTriggers() {
+        SnapshotDeltaEncoder encoder(SnapshotDeltaEncoder::Config{3, 0.0});
+        std::vector<uint8_t> frame;
+        for (uint64_t scan = 1; scan <= 5; ++scan) {
+            encoder.Encode(MakeSnapshot(scan), frame);
+        }
+        Assert(encoder.GetStatistics().keyframes == 2, "Codec_KeyframeInterval", "A keyframe should follow every 3 deltas");
+
+        SensorSnapshot changedLayout = MakeSnapshot(6);
+        changedLayout.sensorIds[3] = 9999;
+        encoder.Encode(changedLayout, frame);
+        Assert(encoder.GetStatistics().keyframes == 3, "Codec_LayoutKeyframe", "A layout change should force a keyframe");
+    }
+
+    void TestMissedFrameNeedsKeyframe() {
+        SnapshotDeltaEncoder encoder;
+        SnapshotDeltaDecoder decoder;
+        std::vector<uint8_t> frame;
+
+        encoder.Encode(MakeSnapshot(1), frame);
+        DecodeAll(decoder, frame);
+
+        SensorSnapshot second = MakeSnapshot(2);
+        second.values[0] = 1.0;
+        frame.clear();
+        encoder.Encode(second, frame);  // Lost in transit
+
+        SensorSnapshot third = MakeSnapshot(3);
+        third.values[1] = 2.0;
+        frame.clear();
+        encoder.Encode(third, frame);
+
+        bool needKeyframe = DecodeAll(decoder, frame) == SnapshotDeltaDecoder::Result::NeedKeyframe;
+        Assert(needKeyframe && decoder.GetSnapshot().scanNumber == 1, "Codec_GapDetected",
+               "A delta on a missed base should be refused without touching the snapshot");
+
+        encoder.ForceKeyframe();
+        frame.clear();
+        encoder.Encode(MakeSnapshot(4), frame);
+        Assert(DecodeAll(decoder, frame) == SnapshotDeltaDecoder::Result::Keyframe && decoder.GetSnapshot().scanNumber == 4,
+               "Codec_Resync", "A forced keyframe should resynchronize the decoder");
+    }
+
+    void TestFrameAssembly() {
+        SnapshotDeltaEncoder encoder;
+        std::vector<uint8_t> stream;
+        for (uint64_t scan = 1; scan <= 4; ++scan) {
+            SensorSnapshot snapshot = MakeSnapshot(scan);
+            snapshot.values[scan] = -1.0;
+            encoder.Encode(snapshot, stream);
+        }
+
+        // Deliver in 7-byte pieces, as a TCP stream may
+        DeltaFrameAssembler assembler;
+        SnapshotDeltaDecoder decoder;
+        std::vector<uint8_t> payload;
+        size_t frames = 0;
+        for (size_t offset = 0; offset < stream.size(); offset += 7) {
+            assembler.Append(stream.data() + offset, std::min<size_t>(7, stream.size() - offset));
+            while (assembler.Next(payload)) {
+                decoder.Decode(payload.data(), payload.size());
+                frames++;
+            }
+        }
+
+        SensorSnapshot expected = MakeSnapshot(4);
+        expected.values[4] = -1.0;
+        Assert(frames == 4 && SameSnapshot(decoder.GetSnapshot(), expected), "Assembler_SplitStream",
+               "Frames split across reads should reassemble in order");
+    }
+
+    void TestMalformedFrames() {
+        SnapshotDeltaEncoder encoder;
+        SnapshotDeltaDecoder decoder;
+        std::vector<uint8_t> frame;
+        encoder.Encode(MakeSnapshot(1), frame);
+
+        std::vector<uint8_t> truncated(frame.begin() + 4, frame.end() - 5);
+        Assert(decoder.Decode(truncated.data(), truncated.size()) == SnapshotDeltaDecoder::Result::Malformed &&
+               !decoder.HasSnapshot(), "Malformed_Truncated", "A truncated keyframe should be rejected");
+
+        std::vector<uint8_t> oversized = {0xFF, 0xFF, 0xFF, 0xFF, 0x00};
+        DeltaFrameAssembler assembler;
+        assembler.Append(oversized.data(), oversized.size());
+        std::vector<uint8_t> payload;
+        Assert(!assembler.Next(payload) && assembler.IsCorrupt(), "Malformed_Length",
+               "An impossible frame length should mark the stream corrupt");
+
+        // Second delta entry names a channel past the end; the first must not be applied
+        SensorSnapshot first = MakeSnapshot(1);
+        SensorSnapshot second = MakeSnapshot(2);
+        second.values[7] = 250.5;
+        second.values[12] = 260.5;
+        SnapshotDeltaEncoder deltaEncoder;
+        decoder.Reset();
+        frame.clear();
+        deltaEncoder.Encode(first, frame);
+        DecodeAll(decoder, frame);
+        frame.clear();
+        deltaEncoder.Encode(second, frame);
+
+        std::vector<uint8_t> corrupt(frame.begin() + 4, frame.end());
+        const size_t secondEntry = 33 + 4 + 13;
+        std::fill(corrupt.begin() + secondEntry, corrupt.begin() + secondEntry + 4, 0xFF);
+        Assert(decoder.Decode(corrupt.data(), corrupt.size()) == SnapshotDeltaDecoder::Result::Malformed &&
+               SameSnapshot(decoder.GetSnapshot(), first), "Malformed_DeltaUnapplied",
+               "A rejected delta should leave the snapshot unchanged");
+        Assert(DecodeAll(decoder, frame) == SnapshotDeltaDecoder::Result::Delta &&
+               SameSnapshot(decoder.GetSnapshot(), second), "Malformed_DeltaRecovers",
+               "The intact delta should still apply to the untouched snapshot");
+
+        // Last channel's kind byte names no SensorKind; the held snapshot must survive
+        frame.clear();
+        deltaEncoder.ForceKeyframe();
+        deltaEncoder.Encode(MakeSnapshot(3), frame);
+        std::vector<uint8_t> badKind(frame.begin() + 4, frame.end());
+        badKind[badKind.size() - 10] = 7;
+        Assert(decoder.Decode(badKind.data(), badKind.size()) == SnapshotDeltaDecoder::Result::Malformed &&
+               SameSnapshot(decoder.GetSnapshot(), second), "Malformed_UnknownKind",
+               "A keyframe with an unknown sensor kind should be rejected before it is applied");
+    }
+
+    // Even channels carry 0.1-unit counts; their values entries hold junk that must never be read
+    SensorSnapshot MakeFixedPointSnapshot(uint64_t scan, int32_t step) {
+        SensorSnapshot snapshot = MakeSnapshot(scan);
+        for (size_t i = 0; i < snapshot.Size(); i += 2) {
+            snapshot.SetFixedPoint(i, FixedPointScale{0.1, -50.0});
+            snapshot.counts[i] = 1500 + static_cast<int32_t>(i) + step;
+            snapshot.values[i] = -1.0;
+        }
+        return snapshot;
+    }
+
+    void TestFixedPointChannels() {
+        SnapshotDeltaEncoder encoder;
+        SnapshotDeltaDecoder decoder;
+        std::vector<uint8_t> frame;
+        encoder.Encode(MakeFixedPointSnapshot(1, 0), frame);
+        SnapshotDeltaDecoder::Result first = DecodeAll(decoder, frame);
+
+        const SensorSnapshot& decoded = decoder.GetSnapshot();
+        bool keyframeOk = first == SnapshotDeltaDecoder::Result::Keyframe && decoded.IsFixedPoint(0) &&
+                          !decoded.IsFixedPoint(1) && decoded.counts[4] == 1504 &&
+                          std::fabs(decoded.EngineeringValue(4) - 100.4) < 1e-9 && decoded.EngineeringValue(5) == 105.0;
+        Assert(keyframeOk, "DeltaCodec_FixedPointKeyframe",
+               "Keyframes should carry counts and scaling, read back in engineering units");
+
+        // Move every fixed-point channel by one count
+        frame.clear();
+        size_t bytes = encoder.Encode(MakeFixedPointSnapshot(2, 1), frame);
+        SnapshotDeltaDecoder::Result second = DecodeAll(decoder, frame);
+        Assert(second == SnapshotDeltaDecoder::Result::Delta && bytes == 4 + 33 + 4 + 25 * 9 &&
+               decoder.GetSnapshot().counts[4] == 1505 &&
+               std::fabs(decoder.GetSnapshot().EngineeringValue(4) - 100.5) < 1e-9,
+               "DeltaCodec_FixedPointDelta", "Fixed-point changes should be sent as 9-byte integer entries");
+
+        frame.clear();
+        SensorSnapshot floating = MakeSnapshot(3);
+        encoder.Encode(floating, frame);
+        Assert(DecodeAll(decoder, frame) == SnapshotDeltaDecoder::Result::Keyframe &&
+               !decoder.GetSnapshot().HasFixedPoint() && decoder.GetSnapshot().values[4] == 104.0,
+               "DeltaCodec_FixedPointRevert", "Dropping fixed point should force a plain keyframe");
+
+        // Fixed point throughout: neither side carries a values column
+        SensorSnapshot counted = MakeSnapshot(4);
+        for (size_t i = 0; i < counted.Size(); ++i) {
+            counted.SetFixedPoint(i, FixedPointScale{0.1, -50.0});
+            counted.counts[i] = 1500;
+        }
+        frame.clear();
+        encoder.Encode(counted, frame);
+        counted.scanNumber = 5;
+        counted.counts[3] = 1510;
+        encoder.Encode(counted, frame);
+        bool delta = DecodeAll(decoder, frame) == SnapshotDeltaDecoder::Result::Delta;
+        Assert(delta && counted.values.empty() && decoder.GetSnapshot().values.empty() &&
+               std::fabs(decoder.GetSnapshot().EngineeringValue(3) - 101.0) < 1e-9, "DeltaCodec_FixedPointOnly",
+               "A layout of only fixed-point channels should round-trip without a values column");
+    }
+
+    void TestFixedPointDeadband() {
+        // A 0.25 deadband is 2 counts at 0.1 per count; a 3-count move must be sent
+        SnapshotDeltaEncoder encoder(SnapshotDeltaEncoder::Config{0, 0.25});
+        std::vector<uint8_t> frame;
+        encoder.Encode(MakeFixedPointSnapshot(1, 0), frame);
+        encoder.Encode(MakeFixedPointSnapshot(2, 2), frame);
+        uint64_t afterTwo = encoder.GetStatistics().channelsSent;
+        encoder.Encode(MakeFixedPointSnapshot(3, 3), frame);
+        uint64_t afterThree = encoder.GetStatistics().channelsSent;
+        Assert(afterTwo == 50 && afterThree == 75, "DeltaCodec_FixedPointDeadband",
+               "Fixed-point channels should be compared against the deadband in whole counts");
+    }
+};
+
+// Function to run snapshot delta codec tests
+void RunSnapshotDeltaCodecTests() {
+    SnapshotDeltaCodecTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
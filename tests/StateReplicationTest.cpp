@@ -0,0 +1,431 @@
+#include "StateReplication.h"
+#include "AnomalyDetector.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <atomic>
+
+using namespace Nuclear;
+
+class StateReplicationTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+public:
+    StateReplicationTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== StateReplication Unit Tests ===" << std::endl;
+
+        TestFullSyncThenDeltas();
+        TestDeltaWithoutSync();
+        TestEmptyBlockSync();
+        TestTakeoverOnSilence();
+        TestTakeoverOnStalledScans();
+        TestFailedScanLeavesState();
+        TestStaleEpochRefused();
+        TestLoopbackFailover();
+        TestLoopbackFencing();
+        TestDetectorStateRoundTrip();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All StateReplication tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some StateReplication tests failed!" << std::endl;
+        }
+    }
+
+private:
+    // Floating-point scan built from plain columns
+    static SensorSnapshot Scan(const std::vector<double>& values, const std::vector<SensorQuality>& quality) {
+        SensorSnapshot snapshot;
+        snapshot.Resize(values.size());
+        snapshot.values = values;
+        snapshot.quality = quality;
+        return snapshot;
+    }
+
+    ReplicatedState MakeState(uint64_t scan, size_t channels = 40) {
+        ReplicatedState state;
+        state.values.Resize(channels);
+        state.values.scanNumber = scan;
+        state.values.acquiredAt = std::chrono::system_clock::time_point(std::chrono::seconds(1700000000 + scan));
+        for (size_t i = 0; i < channels; ++i) {
+            state.values.sensorIds[i] = 1000 + static_cast<int>(i);
+            state.values.kinds[i] = static_cast<SensorKind>(i % 3);
+            state.values.values[i] = 100.0 + static_cast<double>(i);
+            state.values.quality[i] = QUALITY_GOOD;
+        }
+        state.alarms[1001] = false;
+        state.alarms[1002] = true;
+        state.blocks.push_back({"anomaly", std::vector<double>(200, 1.5)});
+        return state;
+    }
+
+    // Feed every frame in a buffer to the receiver; returns false on the first rejected one
+    bool IngestAll(StandbyReceiver& receiver, const std::vector<uint8_t>& frames) {
+        DeltaFrameAssembler assembler;
+        assembler.Append(frames.data(), frames.size());
+        std::vector<uint8_t> payload;
+        bool ok = true;
+        while (ok && assembler.Next(payload)) {
+            ok = receiver.Ingest(payload.data(), payload.size());
+        }
+        return ok;
+    }
+
+    bool SameState(const ReplicatedState& a, const ReplicatedState& b) {
+        if (a.values.scanNumber != b.values.scanNumber || a.values.sensorIds != b.values.sensorIds ||
+            a.values.values != b.values.values || a.values.quality != b.values.quality) {
+            return false;
+        }
+        for (const auto& alarm : b.alarms) {
+            auto held = a.alarms.find(alarm.first);
+            if ((held != a.alarms.end() && held->second) != alarm.second) {
+                return false;
+            }
+        }
+        if (a.blocks.size() != b.blocks.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < a.blocks.size(); ++i) {
+            if (a.blocks[i].name != b.blocks[i].name || a.blocks[i].data != b.blocks[i].data) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void TestFullSyncThenDeltas() {
+        StateReplicator replicator;
+        StandbyReceiver receiver;
+        std::vector<uint8_t> frame;
+
+        ReplicatedState first = MakeState(1);
+        size_t fullBytes = replicator.EncodeScan(first, true, frame);
+        Assert(IngestAll(receiver, frame) && receiver.IsSynchronized() && SameState(receiver.GetState(), first),
+               "Replication_FullSync", "A full sync should reproduce the primary state");
+
+        ReplicatedState second = MakeState(2);
+        second.values.values[5] = 321.0;
+        second.alarms[1001] = true;
+        second.alarms.erase(1002);
+        second.blocks[0].data[17] = -4.0;
+        frame.clear();
+        size_t deltaBytes = replicator.EncodeScan(second, false, frame);
+        Assert(IngestAll(receiver, frame) && SameState(receiver.GetState(), second), "Replication_Delta",
+               "Value, alarm and block changes should apply incrementally");
+        Assert(deltaBytes * 10 < fullBytes, "Replication_DeltaSize",
+               "A scan with three changes should cost far less than a full sync (" + std::to_string(deltaBytes) +
+               " vs " + std::to_string(fullBytes) + " bytes)");
+
+        frame.clear();
+        replicator.EncodeHeartbeat(2, frame);
+        Assert(IngestAll(receiver, frame) && receiver.GetStatistics().heartbeats == 1, "Replication_Heartbeat",
+               "Heartbeats should be accepted without changing state");
+    }
+
+    void TestEmptyBlockSync() {
+        StateReplicator replicator;
+        StandbyReceiver receiver;
+        std::vector<uint8_t> frame;
+
+        // A resync after the standby reconnects clears what the replicator believes was sent
+        ReplicatedState state = MakeState(1);
+        state.blocks[0].data.clear();
+        replicator.EncodeScan(state, true, frame);
+        frame.clear();
+        replicator.EncodeScan(state, true, frame);
+        Assert(IngestAll(receiver, frame) && receiver.IsSynchronized() && SameState(receiver.GetState(), state),
+               "Replication_EmptyBlockFullSync", "A full sync should carry an empty block whole");
+
+        ReplicatedState next = MakeState(2);
+        next.blocks[0].data.clear();
+        frame.clear();
+        replicator.EncodeScan(next, false, frame);
+        Assert(IngestAll(receiver, frame) && receiver.IsSynchronized() && SameState(receiver.GetState(), next),
+               "Replication_EmptyBlockDelta", "An empty block already held should apply as a delta");
+    }
+
+    void TestDeltaWithoutSync() {
+        StateReplicator replicator;
+        std::vector<uint8_t> frame;
+        replicator.EncodeScan(MakeState(1), true, frame);
+        frame.clear();
+        replicator.EncodeScan(MakeState(2), false, frame);
+
+        StandbyReceiver receiver;
+        Assert(!IngestAll(receiver, frame) && !receiver.IsSynchronized() && receiver.GetStatistics().resyncs == 1,
+               "Replication_NeedsFullSync", "A delta without a prior full sync should be refused");
+
+        std::vector<uint8_t> truncated = {1, 0, 0};
+        Assert(!receiver.Ingest(truncated.data(), truncated.size()), "Replication_Malformed",
+               "A truncated message should be rejected");
+    }
+
+    void TestTakeoverOnSilence() {
+        auto clock = std::make_shared<VirtualClock>(std::chrono::system_clock::time_point(std::chrono::seconds(1700000000)));
+        StandbyReceiver::Config config = StandbyReceiver::DefaultConfig();
+        config.takeoverTimeout = std::chrono::milliseconds(100);
+        StandbyReceiver receiver(config, clock);
+
+        uint64_t takeoverScan = 0;
+        receiver.SetTakeoverHandler([&takeoverScan](const ReplicatedState& state) { takeoverScan = state.values.scanNumber; });
+
+        clock->Advance(std::chrono::seconds(5));
+        Assert(!receiver.CheckTakeover(), "Takeover_NotBeforeSync", "A standby without state should never take over");
+
+        StateReplicator replicator(StateReplicator::DefaultConfig(), clock);
+        std::vector<uint8_t> frame;
+        replicator.EncodeScan(MakeState(7), true, frame);
+        IngestAll(receiver, frame);
+
+        clock->Advance(std::chrono::milliseconds(90));
+        bool early = receiver.CheckTakeover();
+        clock->Advance(std::chrono::milliseconds(20));
+        bool late = receiver.CheckTakeover();
+        Assert(!early && late && takeoverScan == 7 && receiver.HasTakenOver(), "Takeover_AfterTimeout",
+               "Takeover should happen once the timeout passes, with the last applied state");
+    }
+
+    void TestTakeoverOnStalledScans() {
+        auto clock = std::make_shared<VirtualClock>(std::chrono::system_clock::time_point(std::chrono::seconds(1700000000)));
+        StandbyReceiver::Config config = StandbyReceiver::DefaultConfig();
+        config.takeoverTimeout = std::chrono::milliseconds(100);
+        StandbyReceiver receiver(config, clock);
+        StateReplicator replicator(StateReplicator::DefaultConfig(), clock);
+
+        std::vector<uint8_t> frame;
+        replicator.EncodeScan(MakeState(7), true, frame);
+        IngestAll(receiver, frame);
+
+        // Scans keep advancing: no takeover even though the full sync is older than the timeout
+        clock->Advance(std::chrono::milliseconds(60));
+        frame.clear();
+        replicator.EncodeScan(MakeState(8), false, frame);
+        IngestAll(receiver, frame);
+        clock->Advance(std::chrono::milliseconds(60));
+        frame.clear();
+        replicator.EncodeHeartbeat(8, frame);
+        IngestAll(receiver, frame);
+        Assert(!receiver.CheckTakeover(), "Stall_ProgressKeepsFollowing",
+               "A primary whose scans advance should keep its standby following");
+
+        // Monitoring thread hung: the sender still heartbeats, but the scan number stays put
+        clock->Advance(std::chrono::milliseconds(30));
+        frame.clear();
+        replicator.EncodeHeartbeat(8, frame);
+        IngestAll(receiver, frame);
+        bool early = receiver.CheckTakeover();
+        clock->Advance(std::chrono::milliseconds(20));
+        frame.clear();
+        replicator.EncodeHeartbeat(8, frame);
+        IngestAll(receiver, frame);
+        bool late = receiver.CheckTakeover();
+        Assert(!early && late && receiver.HasTakenOver(), "Stall_HeartbeatsDoNotHoldOff",
+               "Heartbeats without scan progress should not hold off takeover");
+    }
+
+    void TestFailedScanLeavesState() {
+        StateReplicator replicator;
+        StandbyReceiver receiver;
+        std::vector<uint8_t> frame;
+
+        ReplicatedState first = MakeState(1);
+        replicator.EncodeScan(first, true, frame);
+        IngestAll(receiver, frame);
+
+        // Values and alarms decode; the block section is cut short
+        ReplicatedState second = MakeState(2);
+        second.values.values[3] = 999.0;
+        second.alarms[1001] = true;
+        second.blocks[0].data[0] = 7.0;
+        frame.clear();
+        replicator.EncodeScan(second, false, frame);
+        bool applied = receiver.Ingest(frame.data() + 4, frame.size() - 5);
+        Assert(!applied && SameState(receiver.GetState(), first) && !receiver.IsSynchronized(),
+               "Apply_FailureLeavesState", "A scan that fails part way should leave the held state untouched");
+    }
+
+    void TestStaleEpochRefused() {
+        StateReplicator::Config config = StateReplicator::DefaultConfig();
+        config.epoch = 5;
+        StateReplicator current(config);
+        config.epoch = 4;
+        StateReplicator stale(config);
+        config.epoch = 6;
+        StateReplicator successor(config);
+        StandbyReceiver receiver;
+
+        std::vector<uint8_t> frame;
+        ReplicatedState first = MakeState(10);
+        current.EncodeScan(first, true, frame);
+        IngestAll(receiver, frame);
+
+        frame.clear();
+        stale.EncodeScan(MakeState(11), true, frame);
+        bool staleScan = IngestAll(receiver, frame);
+        frame.clear();
+        stale.EncodeHeartbeat(11, frame);
+        bool staleHeartbeat = IngestAll(receiver, frame);
+        StandbyReceiver::Statistics stats = receiver.GetStatistics();
+        Assert(!staleScan && !staleHeartbeat && stats.staleFrames == 2 && stats.epoch == 5 &&
+               SameState(receiver.GetState(), first), "Epoch_StaleRefused",
+               "Frames from an epoch below the one followed should be refused");
+
+        frame.clear();
+        ReplicatedState next = MakeState(1);
+        successor.EncodeScan(next, true, frame);
+        Assert(IngestAll(receiver, frame) && receiver.GetStatistics().epoch == 6 && SameState(receiver.GetState(), next),
+               "Epoch_HigherFollowed", "A full sync from a higher epoch should be followed");
+    }
+
+    void TestLoopbackFailover() {
+        StateReplicator::Config primaryConfig = StateReplicator::DefaultConfig();
+        primaryConfig.endpoint = "127.0.0.1:0";
+        primaryConfig.heartbeatInterval = std::chrono::milliseconds(20);
+        auto primary = std::make_unique<StateReplicator>(primaryConfig);
+        if (!Assert(primary->Start() && primary->GetPort() > 0, "Loopback_Listen", "Primary should bind an ephemeral port")) {
+            return;
+        }
+
+        StandbyReceiver::Config standbyConfig = StandbyReceiver::DefaultConfig();
+        standbyConfig.endpoint = "127.0.0.1:" + std::to_string(primary->GetPort());
+        standbyConfig.takeoverTimeout = std::chrono::milliseconds(200);
+        standbyConfig.reconnectInterval = std::chrono::milliseconds(20);
+        StandbyReceiver standby(standbyConfig);
+
+        std::atomic<uint64_t> takeoverScan{0};
+        standby.SetTakeoverHandler([&takeoverScan](const ReplicatedState& state) {
+            takeoverScan = state.values.scanNumber;
+        });
+        standby.Start();
+
+        // Publish until the standby has caught up with the latest scan
+        ReplicatedState state = MakeState(1);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (std::chrono::steady_clock::now() < deadline && standby.GetStatistics().lastScanNumber < 30) {
+            state.values.scanNumber++;
+            state.values.values[state.values.scanNumber % state.values.Size()] += 1.0;
+            primary->PublishScan(state);
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(60));
+
+        StateReplicator::Statistics stats = primary->GetStatistics();
+        Assert(SameState(standby.GetState(), state) && stats.fullSyncs >= 1 && stats.scansSent > 1,
+               "Loopback_Replicates", "The standby should mirror the latest published state");
+
+        primary.reset();  // Primary fails
+        deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (std::chrono::steady_clock::now() < deadline && !standby.HasTakenOver()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        Assert(standby.HasTakenOver() && takeoverScan.load() == state.values.scanNumber, "Loopback_Takeover",
+               "The standby should take over with the last replicated scan after the primary stops");
+        standby.Stop();
+    }
+
+    void TestLoopbackFencing() {
+        StateReplicator::Config primaryConfig = StateReplicator::DefaultConfig();
+        primaryConfig.endpoint = "127.0.0.1:0";
+        primaryConfig.heartbeatInterval = std::chrono::milliseconds(20);
+        primaryConfig.epoch = 10;
+        StateReplicator primary(primaryConfig);
+
+        std::atomic<uint64_t> fencedBy{0};
+        primary.SetFencedHandler([&fencedBy](uint64_t epoch) { fencedBy = epoch; });
+        if (!Assert(primary.Start(), "Fence_Listen", "Primary should bind an ephemeral port")) {
+            return;
+        }
+
+        StandbyReceiver::Config standbyConfig = StandbyReceiver::DefaultConfig();
+        standbyConfig.endpoint = "127.0.0.1:" + std::to_string(primary.GetPort());
+        standbyConfig.takeoverTimeout = std::chrono::milliseconds(200);
+        standbyConfig.reconnectInterval = std::chrono::milliseconds(20);
+        StandbyReceiver standby(standbyConfig);
+        standby.Start();
+
+        ReplicatedState state = MakeState(1);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (std::chrono::steady_clock::now() < deadline && standby.GetStatistics().lastScanNumber < 10) {
+            state.values.scanNumber++;
+            primary.PublishScan(state);
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+
+        // Scans stop but the sender keeps heartbeating, as with a hung monitoring thread
+        deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (std::chrono::steady_clock::now() < deadline && !primary.IsFenced()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        Assert(standby.HasTakenOver() && standby.GetStatistics().heartbeats > 0, "Fence_TakeoverWhileHeartbeating",
+               "A standby should take over from a primary that heartbeats without scanning");
+        Assert(primary.IsFenced() && fencedBy.load() == 11 && !primary.GetStatistics().standbyConnected,
+               "Fence_PrimaryStepsDown", "The old primary should be fenced by the next epoch and stop streaming");
+        standby.Stop();
+        primary.Stop();
+    }
+
+    void TestDetectorStateRoundTrip() {
+        AnomalyDetectorBank primary;
+        AnomalyDetectorBank standby;
+        AnomalyDetectorBank::Config config = AnomalyDetectorBank::DefaultConfig();
+        primary.Configure(4, config);
+        standby.Configure(4, config);
+
+        std::vector<double> values(4);
+        std::vector<SensorQuality> quality(4, QUALITY_GOOD);
+        std::vector<AnomalyFlags> primaryFlags(4);
+        std::vector<AnomalyFlags> standbyFlags(4);
+        for (int scan = 0; scan < 60; ++scan) {
+            for (size_t i = 0; i < values.size(); ++i) {
+                values[i] = 50.0 + static_cast<double>(i) + 0.1 * static_cast<double>(scan % 5);
+            }
+            primary.Process(Scan(values, quality), primaryFlags.data());
+        }
+
+        std::vector<double> exported;
+        primary.ExportState(exported);
+        bool imported = standby.ImportState(exported);
+
+        values[2] = 500.0;  // Spike both detectors must agree on
+        primary.Process(Scan(values, quality), primaryFlags.data());
+        standby.Process(Scan(values, quality), standbyFlags.data());
+        Assert(imported && primaryFlags == standbyFlags && (standbyFlags[2] & ANOMALY_SPIKE) != 0,
+               "Detector_StateRoundTrip", "An imported detector should continue exactly like the original");
+
+        Assert(!standby.ImportState(std::vector<double>(3)), "Detector_StateSizeMismatch",
+               "State of the wrong size should be refused");
+    }
+};
+
+// Function to run state replication tests
+void RunStateReplicationTests() {
+    StateReplicationTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
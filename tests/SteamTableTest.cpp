@@ -0,0 +1,137 @@
+#include "SteamTable.h"
+#include "DerivedChannelEngine.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+
+using namespace Nuclear;
+
+class SteamTableTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+public:
+    SteamTableTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== SteamTable Unit Tests ===" << std::endl;
+
+        TestReferenceEquations();
+        TestTableAccuracy();
+        TestOutOfRange();
+        TestBatchMatchesScalar();
+        TestDerivedChannelFunctions();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All SteamTable tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some SteamTable tests failed!" << std::endl;
+        }
+    }
+
+private:
+    // Floating-point scan built from plain columns
+    static SensorSnapshot Scan(const std::vector<double>& values, const std::vector<SensorQuality>& quality) {
+        SensorSnapshot snapshot;
+        snapshot.Resize(values.size());
+        snapshot.values = values;
+        snapshot.quality = quality;
+        return snapshot;
+    }
+
+    void TestReferenceEquations() {
+        // IAPWS-IF97 verification values (tables 35 and 36)
+        Assert(std::fabs(SteamTable::ExactSaturationPressure(300.0) - 0.353658941e-2) < 1e-10, "IF97_Psat300",
+               "psat(300 K) should match IF97 verification value");
+        Assert(std::fabs(SteamTable::ExactSaturationPressure(600.0) - 0.123443146e2) < 1e-6, "IF97_Psat600",
+               "psat(600 K) should match IF97 verification value");
+        Assert(std::fabs(SteamTable::ExactSaturationTemperature(0.1) - 0.372755919e3) < 1e-6, "IF97_Tsat01",
+               "Tsat(0.1 MPa) should match IF97 verification value");
+        Assert(std::fabs(SteamTable::ExactSaturationTemperature(10.0) - 0.584149488e3) < 1e-6, "IF97_Tsat10",
+               "Tsat(10 MPa) should match IF97 verification value");
+    }
+
+    void TestTableAccuracy() {
+        const SteamTable& table = GetDefaultSteamTable();
+
+        Assert(table.GetMaxTemperatureError() < 0.01, "Table_TemperatureError",
+               "Tsat table error should be below 0.01 C");
+        Assert(table.GetMaxPressureError() < 1e-4, "Table_PressureError",
+               "psat table error should be below 0.01%");
+
+        double exact = KelvinToCelsius(SteamTable::ExactSaturationTemperature(PsiToMPa(2250.0)));
+        Assert(std::fabs(table.SaturationTemperature(2250.0) - exact) < 0.01, "Table_PrimaryPressure",
+               "Tsat at normal primary pressure should match IF97");
+        Assert(std::fabs(table.SubcoolingMargin(300.0, 2250.0) - (exact - 300.0)) < 0.01, "Table_Subcooling",
+               "Subcooling margin should be Tsat minus coolant temperature");
+    }
+
+    void TestOutOfRange() {
+        const SteamTable& table = GetDefaultSteamTable();
+
+        Assert(std::isnan(table.SaturationTemperature(-5.0)), "Range_NegativePressure", "Negative pressure should be NaN");
+        Assert(std::isnan(table.SaturationTemperature(5000.0)), "Range_Supercritical", "Supercritical pressure should be NaN");
+        Assert(std::isnan(table.SaturationPressure(std::nan(""))), "Range_NaNInput", "NaN input should be NaN");
+    }
+
+    void TestBatchMatchesScalar() {
+        const SteamTable& table = GetDefaultSteamTable();
+
+        std::vector<double> pressures = {14.7, 100.0, 1000.0, 2250.0, 3100.0};
+        std::vector<double> temperatures(pressures.size());
+        table.SaturationTemperature(pressures.data(), temperatures.data(), pressures.size());
+
+        bool matches = true;
+        for (size_t i = 0; i < pressures.size(); ++i) {
+            matches = matches && temperatures[i] == table.SaturationTemperature(pressures[i]);
+        }
+        Assert(matches, "Batch_MatchesScalar", "Batch evaluation should match scalar lookups");
+    }
+
+    void TestDerivedChannelFunctions() {
+        DerivedChannelEngine engine;
+        Assert(RegisterSteamTableFunctions(engine), "Register_SteamFunctions", "Steam functions should register");
+
+        std::string error;
+        bool ok = engine.Compile({DerivedChannelDefinition{9001, "margin", SensorKind::Temperature,
+                                                           "subcooling(sensor(1), sensor(2))"}},
+                                 {1, 2}, error);
+
+        std::vector<double> values = {300.0, 2250.0};
+        std::vector<SensorQuality> quality(2, QUALITY_GOOD);
+        engine.Evaluate(Scan(values, quality), 0.0);
+
+        double expected = GetDefaultSteamTable().SubcoolingMargin(300.0, 2250.0);
+        Assert(ok && engine.GetValues()[0] == expected, "Derived_Subcooling",
+               "Derived channel should evaluate subcooling margin");
+    }
+};
+
+// Function to run steam table tests
+void RunSteamTableTests() {
+    SteamTableTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
@@ -0,0 +1,169 @@
+#include "SubscriptionRouter.h"
+#include <iostream>
+#include <string>
+#include <thread>
+#include <atomic>
+
+using namespace Nuclear;
+
+class SubscriptionRouterTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+public:
+    SubscriptionRouterTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== SubscriptionRouter Unit Tests ===" << std::endl;
+
+        TestRoutesByPlant();
+        TestRemoveClient();
+        TestCommands();
+        TestDeltaFeed();
+        TestLookupDuringUpdates();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All SubscriptionRouter tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some SubscriptionRouter tests failed!" << std::endl;
+        }
+    }
+
+private:
+    void TestRoutesByPlant() {
+        SubscriptionRouter router;
+        bool registered = router.RegisterPlant("UNIT_1") && router.RegisterPlant("UNIT_2");
+        Assert(registered && !router.RegisterPlant("UNIT_1"), "Routes_RegisterOnce", "Plant IDs should be unique");
+
+        router.Subscribe("client-a", "UNIT_1");
+        router.Subscribe("client-b", "UNIT_2");
+        router.Subscribe("client-a", "UNIT_1");
+
+        auto unit1 = router.GetSubscribers("UNIT_1");
+        auto unit2 = router.GetSubscribers("UNIT_2");
+        Assert(unit1 && unit1->size() == 1 && unit1->front() == "client-a" && unit2 && unit2->front() == "client-b",
+               "Routes_PerPlant", "Each plant should only route to its own subscribers");
+
+        Assert(!router.Subscribe("client-a", "UNIT_9") && !router.GetSubscribers("UNIT_9"), "Routes_UnknownPlant",
+               "Subscribing to an unhosted plant should fail");
+    }
+
+    void TestRemoveClient() {
+        SubscriptionRouter router;
+        router.RegisterPlant("UNIT_1");
+        router.RegisterPlant("UNIT_2");
+        router.Subscribe("client-a", "UNIT_1");
+        router.Subscribe("client-a", "UNIT_2");
+        router.Subscribe("client-b", "UNIT_2");
+
+        auto before = router.GetSubscribers("UNIT_2");
+        size_t removed = router.RemoveClient("client-a");
+
+        Assert(removed == 2 && router.GetSubscribers("UNIT_1")->empty() && router.GetSubscribers("UNIT_2")->size() == 1,
+               "Remove_AllSubscriptions", "Removing a client should drop it from every plant");
+        Assert(before->size() == 2, "Remove_SnapshotStable", "Lists already handed out should not change");
+    }
+
+    void TestCommands() {
+        SubscriptionRouter router;
+        router.RegisterPlant("UNIT_1");
+        std::string response;
+
+        bool handled = router.HandleCommand("client-a", "SUBSCRIBE UNIT_1\r\n", response);
+        Assert(handled && response == "SUBSCRIBED UNIT_1", "Command_Subscribe", "Got: " + response);
+
+        router.HandleCommand("client-a", "SUBSCRIBE UNIT_7", response);
+        Assert(response == "ERROR unknown plant UNIT_7", "Command_UnknownPlant", "Got: " + response);
+
+        router.HandleCommand("client-a", "UNSUBSCRIBE UNIT_1", response);
+        Assert(response == "UNSUBSCRIBED UNIT_1" && router.GetSubscribers("UNIT_1")->empty(), "Command_Unsubscribe",
+               "Got: " + response);
+
+        response.clear();
+        Assert(!router.HandleCommand("client-a", "STATUS", response) && response.empty(), "Command_NotSubscription",
+               "Other messages should be left to the caller");
+    }
+
+    void TestDeltaFeed() {
+        SubscriptionRouter router;
+        router.RegisterPlant("UNIT_1");
+        std::string response;
+        std::string deltaPlant;
+
+        router.HandleCommand("client-a", "SUBSCRIBE UNIT_1", response);
+        bool handled = router.HandleCommand("client-a", "SUBSCRIBE_DELTA\n", response, &deltaPlant);
+        auto delta = router.GetSubscribers("UNIT_1", SubscriptionRouter::Feed::Delta);
+        Assert(handled && response.empty() && deltaPlant == "UNIT_1" && delta && delta->size() == 1 &&
+               router.GetSubscribers("UNIT_1")->empty(), "Delta_SinglePlantDefault",
+               "A bare SUBSCRIBE_DELTA should move the client to the only plant's delta feed");
+
+        router.RegisterPlant("UNIT_2");
+        deltaPlant.clear();
+        router.HandleCommand("client-b", "SUBSCRIBE_DELTA", response, &deltaPlant);
+        Assert(deltaPlant.empty() && response.compare(0, 6, "ERROR ") == 0, "Delta_MultiPlantNeedsId",
+               "With several plants the delta feed must be named");
+
+        router.HandleCommand("client-b", "SUBSCRIBE_DELTA UNIT_2", response, &deltaPlant);
+        auto unit1 = router.GetSubscribers("UNIT_1", SubscriptionRouter::Feed::Delta);
+        auto unit2 = router.GetSubscribers("UNIT_2", SubscriptionRouter::Feed::Delta);
+        Assert(deltaPlant == "UNIT_2" && unit1->size() == 1 && unit2->size() == 1, "Delta_PerPlant",
+               "Delta subscriptions should be routed per plant");
+
+        Assert(router.RemoveClient("client-a") == 1 &&
+               router.GetSubscribers("UNIT_1", SubscriptionRouter::Feed::Delta)->empty(), "Delta_RemoveClient",
+               "Removing a client should drop its delta subscriptions too");
+    }
+
+    void TestLookupDuringUpdates() {
+        SubscriptionRouter router;
+        router.RegisterPlant("UNIT_1");
+        std::atomic<bool> running{true};
+        std::atomic<bool> consistent{true};
+
+        std::thread reader([&]() {
+            while (running) {
+                auto subscribers = router.GetSubscribers("UNIT_1");
+                if (!subscribers || subscribers->size() > 1) {
+                    consistent = false;
+                }
+            }
+        });
+
+        for (int i = 0; i < 2000; ++i) {
+            router.Subscribe("client-" + std::to_string(i), "UNIT_1");
+            router.RemoveClient("client-" + std::to_string(i));
+        }
+        running = false;
+        reader.join();
+
+        Assert(consistent, "Concurrent_Lookup", "Lock-free lookups should always see a complete list");
+    }
+};
+
+// Function to run subscription router tests
+void RunSubscriptionRouterTests() {
+    SubscriptionRouterTest test;
+    test.RunAllTests();
+}
\ No newline at end of file
@@ -0,0 +1,165 @@
+#include "ThreadPool.h"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <stdexcept>
+
+using namespace Nuclear;
+
+class ThreadPoolTest {
+private:
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+public:
+    ThreadPoolTest() : testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== ThreadPool Unit Tests ===" << std::endl;
+
+        TestSubmitRunsTasks();
+        TestSubmitToPreservesOrder();
+        TestFullQueueRejected();
+        TestShutdownDrainsQueue();
+        TestThrowingTaskKeepsWorker();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All ThreadPool tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some ThreadPool tests failed!" << std::endl;
+        }
+    }
+
+private:
+    // Occupy a shard's worker until released so its queue can be filled deterministically
+    static void BlockWorker(ThreadPool& pool, size_t shardKey, std::atomic<bool>& started,
+                            std::atomic<bool>& release) {
+        pool.SubmitTo(shardKey, [&started, &release]() {
+            started = true;
+            while (!release.load()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+        while (!started.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    void TestSubmitRunsTasks() {
+        ThreadPool pool(4);
+        std::atomic<int> executed(0);
+
+        bool allQueued = true;
+        for (int i = 0; i < 100; ++i) {
+            allQueued = pool.Submit([&executed]() { executed.fetch_add(1); }) && allQueued;
+        }
+        pool.Shutdown();
+
+        Assert(pool.GetShardCount() == 4, "Submit_ShardCount", "Pool should run the requested shards");
+        Assert(allQueued, "Submit_Queued", "Submit should accept tasks while running");
+        Assert(executed.load() == 100, "Submit_AllExecuted", "Every submitted task should run");
+        Assert(pool.GetPendingTasks() == 0, "Submit_NoPending", "No task should be pending after shutdown");
+        Assert(!pool.Submit([]() {}), "Submit_RejectedAfterShutdown", "Submit after shutdown should be rejected");
+    }
+
+    void TestSubmitToPreservesOrder() {
+        ThreadPool pool(3);
+        std::vector<int> order;
+
+        for (int i = 0; i < 50; ++i) {
+            pool.SubmitTo(7, [&order, i]() { order.push_back(i); });
+        }
+        pool.Shutdown();
+
+        bool inOrder = order.size() == 50;
+        for (size_t i = 0; inOrder && i < order.size(); ++i) {
+            inOrder = order[i] == static_cast<int>(i);
+        }
+        Assert(inOrder, "SubmitTo_Ordered", "Tasks with the same shard key should run in submission order");
+    }
+
+    void TestFullQueueRejected() {
+        ThreadPool pool(1, 2);
+        std::atomic<bool> started(false);
+        std::atomic<bool> release(false);
+        std::atomic<int> executed(0);
+        BlockWorker(pool, 0, started, release);
+
+        bool first = pool.Submit([&executed]() { executed.fetch_add(1); });
+        bool second = pool.Submit([&executed]() { executed.fetch_add(1); });
+        bool overflow = pool.Submit([&executed]() { executed.fetch_add(1); });
+
+        Assert(first && second, "Full_AcceptsUpToLimit", "Shard should queue up to its limit");
+        Assert(!overflow, "Full_RejectsOverLimit", "Submit to a full shard should be rejected");
+        Assert(!pool.Submit(nullptr), "Full_RejectsEmptyTask", "Empty task should be rejected");
+
+        release = true;
+        pool.Shutdown();
+        Assert(executed.load() == 2, "Full_RejectedNotRun", "Rejected task should never run");
+    }
+
+    void TestShutdownDrainsQueue() {
+        ThreadPool pool(2, 64);
+        std::atomic<bool> started(false);
+        std::atomic<bool> release(false);
+        std::atomic<int> executed(0);
+        BlockWorker(pool, 0, started, release);
+
+        for (int i = 0; i < 10; ++i) {
+            pool.SubmitTo(0, [&executed]() { executed.fetch_add(1); });
+        }
+        Assert(pool.GetPendingTasks() == 11, "Drain_PendingCounted", "Queued and running tasks should be pending");
+
+        // Release the worker only once shutdown has begun
+        std::thread releaser([&release]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            release = true;
+        });
+        pool.Shutdown();
+        releaser.join();
+
+        Assert(executed.load() == 10, "Drain_QueuedTasksRun", "Shutdown should finish every queued task");
+        Assert(pool.GetPendingTasks() == 0, "Drain_NoPending", "No task should be pending after shutdown");
+    }
+
+    void TestThrowingTaskKeepsWorker() {
+        ThreadPool pool(1);
+        std::atomic<bool> ran(false);
+
+        pool.Submit([]() { throw std::runtime_error("task failure"); });
+        pool.Submit([&ran]() { ran = true; });
+        pool.Shutdown();
+
+        Assert(ran.load(), "Throwing_WorkerSurvives", "A throwing task should not stop later tasks");
+    }
+};
+
+// Function to run thread pool tests
+void RunThreadPoolTests() {
+    ThreadPoolTest test;
+    test.RunAllTests();
+}
@@ -0,0 +1,162 @@
+#include "TimerWheel.h"
+#include <iostream>
+#include <vector>
+#include <string>
+
+using namespace Nuclear;
+
+class TimerWheelTest {
+private:
+    using Clock = TimerWheel::Clock;
+    using ms = std::chrono::milliseconds;
+
+    Clock::time_point startTime;
+    int testsRun;
+    int testsPassed;
+    int testsFailed;
+
+public:
+    TimerWheelTest() : startTime(Clock::now()), testsRun(0), testsPassed(0), testsFailed(0) {}
+
+    bool Assert(bool condition, const std::string& testName, const std::string& message) {
+        testsRun++;
+        if (condition) {
+            testsPassed++;
+            std::cout << "  [PASS] " << testName << std::endl;
+            return true;
+        } else {
+            testsFailed++;
+            std::cout << "  [FAIL] " << testName << ": " << message << std::endl;
+            return false;
+        }
+    }
+
+    void RunAllTests() {
+        std::cout << "\n=== TimerWheel Unit Tests ===" << std::endl;
+
+        TestFiresAfterDelay();
+        TestCancel();
+        TestReschedule();
+        TestLongDelayCascade();
+        TestStaleTimerId();
+        TestCallbackSchedulesTimer();
+        TestManyTimers();
+
+        // Print summary
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Total Tests: " << testsRun << std::endl;
+        std::cout << "Passed: " << testsPassed << std::endl;
+        std::cout << "Failed: " << testsFailed << std::endl;
+        std::cout << "Success Rate: " << (100.0 * testsPassed / testsRun) << "%" << std::endl;
+
+        if (testsFailed == 0) {
+            std::cout << "\n[PASSED] All TimerWheel tests completed successfully!" << std::endl;
+        } else {
+            std::cout << "\n[FAILED] Some TimerWheel tests failed!" << std::endl;
+        }
+    }
+
+private:
+    Clock::time_point At(int milliseconds) const {
+        return startTime + ms(milliseconds);
+    }
+
+    void TestFiresAfterDelay() {
+        TimerWheel wheel(ms(10), 16, startTime);
+        int fired = 0;
+        wheel.Schedule(ms(50), [&fired]() { ++fired; });
+
+        wheel.Advance(At(40));
+        Assert(fired == 0, "Timer_NotEarly", "Timer should not fire before its delay");
+
+        wheel.Advance(At(50));
+        Assert(fired == 1, "Timer_FiresOnTime", "Timer should fire once its delay has elapsed");
+        Assert(wheel.GetActiveTimers() == 0, "Timer_Released", "Fired timer should no longer be active");
+    }
+
+    void TestCancel() {
+        TimerWheel wheel(ms(10), 16, startTime);
+        int fired = 0;
+        auto timerId = wheel.Schedule(ms(30), [&fired]() { ++fired; });
+
+        Assert(wheel.Cancel(timerId), "Cancel_Pending", "Pending timer should cancel");
+        Assert(!wheel.Cancel(timerId), "Cancel_Twice", "Cancelled timer should not cancel again");
+
+        wheel.Advance(At(100));
+        Assert(fired == 0, "Cancel_NeverFires", "Cancelled timer should never fire");
+    }
+
+    void TestReschedule() {
+        TimerWheel wheel(ms(10), 16, startTime);
+        int fired = 0;
+        auto timerId = wheel.Schedule(ms(30), [&fired]() { ++fired; });
+
+        wheel.Advance(At(20));
+        Assert(wheel.Reschedule(timerId, ms(60)), "Reschedule_Pending", "Pending timer should reschedule");
+
+        wheel.Advance(At(70));
+        Assert(fired == 0, "Reschedule_Deferred", "Rescheduled timer should not fire at old expiry");
+
+        wheel.Advance(At(80));
+        Assert(fired == 1, "Reschedule_Fires", "Rescheduled timer should fire at new expiry");
+    }
+
+    void TestLongDelayCascade() {
+        TimerWheel wheel(ms(1), 16, startTime);
+        std::vector<int> order;
+        wheel.Schedule(ms(70000), [&order]() { order.push_back(3); });
+        wheel.Schedule(ms(5000), [&order]() { order.push_back(2); });
+        wheel.Schedule(ms(63), [&order]() { order.push_back(1); });
+
+        wheel.Advance(At(69999));
+        Assert(order.size() == 2, "Cascade_PartialExpiry", "Only timers within elapsed time should fire");
+
+        wheel.Advance(At(70000));
+        Assert(order == std::vector<int>({1, 2, 3}), "Cascade_Order", "Timers across levels should fire in expiry order");
+    }
+
+    void TestStaleTimerId() {
+        TimerWheel wheel(ms(10), 16, startTime);
+        auto first = wheel.Schedule(ms(10), []() {});
+        wheel.Advance(At(10));
+
+        // Entry is recycled for the next timer; the old ID must not alias it
+        auto second = wheel.Schedule(ms(10), []() {});
+        Assert(!wheel.IsPending(first), "StaleId_NotPending", "Fired timer ID should not be pending");
+        Assert(!wheel.Cancel(first), "StaleId_NoCancel", "Stale ID should not cancel recycled entry");
+        Assert(wheel.IsPending(second), "StaleId_NewPending", "New timer should remain pending");
+    }
+
+    void TestCallbackSchedulesTimer() {
+        TimerWheel wheel(ms(10), 16, startTime);
+        int heartbeats = 0;
+        std::function<void()> heartbeat = [&]() {
+            ++heartbeats;
+            wheel.Schedule(ms(100), heartbeat);
+        };
+        wheel.Schedule(ms(100), heartbeat);
+
+        wheel.Advance(At(1000));
+        Assert(heartbeats == 10, "Periodic_Rearm", "Self-rearming timer should fire every period");
+    }
+
+    void TestManyTimers() {
+        TimerWheel wheel(ms(1), 4096, startTime);
+        int fired = 0;
+        for (int i = 1; i <= 4000; ++i) {
+            wheel.Schedule(ms(i), [&fired]() { ++fired; });
+        }
+
+        size_t firedByAdvance = wheel.Advance(At(2000));
+        Assert(fired == 2000 && firedByAdvance == 2000, "ManyTimers_Half", "Half of the timers should have fired");
+
+        wheel.Advance(At(4000));
+        Assert(fired == 4000, "ManyTimers_All", "All timers should have fired");
+    }
+};
+
+// Function to run timer wheel tests
+void RunTimerWheelTests() {
+    TimerWheelTest test;
+    test.RunAllTests();
+}
\ No newline at end of file